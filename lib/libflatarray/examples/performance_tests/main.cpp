@@ -1598,30 +1598,10 @@ public:
 
 int main(int argc, char **argv)
 {
-    if ((argc < 3) || (argc == 4) || (argc > 5)) {
-        std::cerr << "usage: " << argv[0] << " [-n,--name SUBSTRING] REVISION CUDA_DEVICE \n"
-                  << "  - optional: only run tests whose name contains a SUBSTRING,\n"
-                  << "  - REVISION is purely for output reasons,\n"
-                  << "  - CUDA_DEVICE causes CUDA tests to run on the device with the given ID.\n";
+    evaluate eval;
+    if (!eval.parse_arguments(argc, argv)) {
         return 1;
     }
-    std::string name = "";
-    int argumentIndex = 1;
-    if (argc == 5) {
-        if ((std::string(argv[1]) == "-n") ||
-            (std::string(argv[1]) == "--name")) {
-            name = std::string(argv[2]);
-        }
-        argumentIndex = 3;
-    }
-    std::string revision = argv[argumentIndex + 0];
-
-    std::stringstream s;
-    s << argv[argumentIndex + 1];
-    int cudaDevice;
-    s >> cudaDevice;
-
-    evaluate eval(name, revision);
     eval.print_header();
 
     std::vector<std::vector<int> > sizes;
@@ -1694,5 +1674,5 @@ int main(int argc, char **argv)
         eval(NBodyGold(),  *i);
     }
 
-    return 0;
+    return (eval.finish() > 0) ? 2 : 0;
 }
@@ -191,6 +191,102 @@ public:
         _mm512_i32scatter_pd(ptr, indices, val2, 8);
     }
 
+    inline
+    short_vec<double, 16> operator<(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_LT_OQ)));
+    }
+
+    inline
+    short_vec<double, 16> operator<=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_LE_OQ)));
+    }
+
+    inline
+    short_vec<double, 16> operator>(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_GT_OQ)));
+    }
+
+    inline
+    short_vec<double, 16> operator>=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_GE_OQ)));
+    }
+
+    inline
+    short_vec<double, 16> operator==(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_EQ_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_EQ_OQ)));
+    }
+
+    inline
+    short_vec<double, 16> operator!=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_NEQ_UQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_NEQ_UQ)));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 16> blend(const short_vec<double, 16>& other, const short_vec<double, 16>& mask) const
+    {
+        return short_vec<double, 16>(
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val1), val1, other.val1),
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val2), val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 16> min(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm512_min_pd(val1, other.val1),
+            _mm512_min_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 16> max(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm512_max_pd(val1, other.val1),
+            _mm512_max_pd(val2, other.val2));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 16> fma(const short_vec<double, 16>& factor, const short_vec<double, 16>& summand) const
+    {
+        return short_vec<double, 16>(
+            _mm512_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm512_fmadd_pd(val2, factor.val2, summand.val2));
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 16>& mask) const
+    {
+        _mm512_mask_storeu_pd(data + 0, ShortVecHelpers::vec_to_mask_pd(mask.val1), val1);
+        _mm512_mask_storeu_pd(data + 8, ShortVecHelpers::vec_to_mask_pd(mask.val2), val2);
+    }
+
 private:
     __m512d val1;
     __m512d val2;
@@ -202,6 +298,36 @@ void operator<<(double *data, const short_vec<double, 16>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 16> blend(const short_vec<double, 16>& a, const short_vec<double, 16>& b, const short_vec<double, 16>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 16> min(const short_vec<double, 16>& a, const short_vec<double, 16>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 16> max(const short_vec<double, 16>& a, const short_vec<double, 16>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 16> fma(const short_vec<double, 16>& a, const short_vec<double, 16>& b, const short_vec<double, 16>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 16>& vec, const short_vec<double, 16>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
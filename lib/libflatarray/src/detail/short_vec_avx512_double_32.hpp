@@ -231,6 +231,124 @@ public:
         _mm512_i32scatter_pd(ptr, indices, val4, 8);
     }
 
+    inline
+    short_vec<double, 32> operator<(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_LT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_LT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_LT_OQ)));
+    }
+
+    inline
+    short_vec<double, 32> operator<=(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_LE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_LE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_LE_OQ)));
+    }
+
+    inline
+    short_vec<double, 32> operator>(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_GT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_GT_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_GT_OQ)));
+    }
+
+    inline
+    short_vec<double, 32> operator>=(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_GE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_GE_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_GE_OQ)));
+    }
+
+    inline
+    short_vec<double, 32> operator==(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_EQ_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_EQ_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_EQ_OQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_EQ_OQ)));
+    }
+
+    inline
+    short_vec<double, 32> operator!=(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_NEQ_UQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val2, other.val2, _CMP_NEQ_UQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val3, other.val3, _CMP_NEQ_UQ)),
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val4, other.val4, _CMP_NEQ_UQ)));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 32> blend(const short_vec<double, 32>& other, const short_vec<double, 32>& mask) const
+    {
+        return short_vec<double, 32>(
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val1), val1, other.val1),
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val2), val2, other.val2),
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val3), val3, other.val3),
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val4), val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 32> min(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm512_min_pd(val1, other.val1),
+            _mm512_min_pd(val2, other.val2),
+            _mm512_min_pd(val3, other.val3),
+            _mm512_min_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 32> max(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm512_max_pd(val1, other.val1),
+            _mm512_max_pd(val2, other.val2),
+            _mm512_max_pd(val3, other.val3),
+            _mm512_max_pd(val4, other.val4));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 32> fma(const short_vec<double, 32>& factor, const short_vec<double, 32>& summand) const
+    {
+        return short_vec<double, 32>(
+            _mm512_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm512_fmadd_pd(val2, factor.val2, summand.val2),
+            _mm512_fmadd_pd(val3, factor.val3, summand.val3),
+            _mm512_fmadd_pd(val4, factor.val4, summand.val4));
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 32>& mask) const
+    {
+        _mm512_mask_storeu_pd(data + 0, ShortVecHelpers::vec_to_mask_pd(mask.val1), val1);
+        _mm512_mask_storeu_pd(data + 8, ShortVecHelpers::vec_to_mask_pd(mask.val2), val2);
+        _mm512_mask_storeu_pd(data + 16, ShortVecHelpers::vec_to_mask_pd(mask.val3), val3);
+        _mm512_mask_storeu_pd(data + 24, ShortVecHelpers::vec_to_mask_pd(mask.val4), val4);
+    }
+
 private:
     __m512d val1;
     __m512d val2;
@@ -244,6 +362,36 @@ void operator<<(double *data, const short_vec<double, 32>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 32> blend(const short_vec<double, 32>& a, const short_vec<double, 32>& b, const short_vec<double, 32>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 32> min(const short_vec<double, 32>& a, const short_vec<double, 32>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 32> max(const short_vec<double, 32>& a, const short_vec<double, 32>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 32> fma(const short_vec<double, 32>& a, const short_vec<double, 32>& b, const short_vec<double, 32>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 32>& vec, const short_vec<double, 32>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
@@ -171,6 +171,91 @@ public:
         _mm512_i32scatter_pd(ptr, indices, val1, 8);
     }
 
+    inline
+    short_vec<double, 8> operator<(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LT_OQ)));
+    }
+
+    inline
+    short_vec<double, 8> operator<=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_LE_OQ)));
+    }
+
+    inline
+    short_vec<double, 8> operator>(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GT_OQ)));
+    }
+
+    inline
+    short_vec<double, 8> operator>=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_GE_OQ)));
+    }
+
+    inline
+    short_vec<double, 8> operator==(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_EQ_OQ)));
+    }
+
+    inline
+    short_vec<double, 8> operator!=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::mask_to_vec_pd(_mm512_cmp_pd_mask(val1, other.val1, _CMP_NEQ_UQ)));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 8> blend(const short_vec<double, 8>& other, const short_vec<double, 8>& mask) const
+    {
+        return short_vec<double, 8>(
+            _mm512_mask_blend_pd(ShortVecHelpers::vec_to_mask_pd(mask.val1), val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm512_min_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm512_max_pd(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+        return short_vec<double, 8>(
+            _mm512_fmadd_pd(val1, factor.val1, summand.val1));
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 8>& mask) const
+    {
+        _mm512_mask_storeu_pd(data + 0, ShortVecHelpers::vec_to_mask_pd(mask.val1), val1);
+    }
+
 private:
     __m512d val1;
 };
@@ -181,6 +266,36 @@ void operator<<(double *data, const short_vec<double, 8>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 8> blend(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 8> min(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 8> max(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 8> fma(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 8>& vec, const short_vec<double, 8>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
@@ -192,6 +192,91 @@ public:
         _mm512_i32scatter_ps(ptr, indices, val1, 4);
     }
 
+    inline
+    short_vec<float, 16> operator<(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_LT_OQ)));
+    }
+
+    inline
+    short_vec<float, 16> operator<=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_LE_OQ)));
+    }
+
+    inline
+    short_vec<float, 16> operator>(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_GT_OQ)));
+    }
+
+    inline
+    short_vec<float, 16> operator>=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_GE_OQ)));
+    }
+
+    inline
+    short_vec<float, 16> operator==(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_EQ_OQ)));
+    }
+
+    inline
+    short_vec<float, 16> operator!=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_NEQ_UQ)));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 16> blend(const short_vec<float, 16>& other, const short_vec<float, 16>& mask) const
+    {
+        return short_vec<float, 16>(
+            _mm512_mask_blend_ps(ShortVecHelpers::vec_to_mask_ps(mask.val1), val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 16> min(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm512_min_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 16> max(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm512_max_ps(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 16> fma(const short_vec<float, 16>& factor, const short_vec<float, 16>& summand) const
+    {
+        return short_vec<float, 16>(
+            _mm512_fmadd_ps(val1, factor.val1, summand.val1));
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 16>& mask) const
+    {
+        _mm512_mask_storeu_ps(data + 0, ShortVecHelpers::vec_to_mask_ps(mask.val1), val1);
+    }
+
 private:
     __m512 val1;
 };
@@ -202,6 +287,36 @@ void operator<<(float *data, const short_vec<float, 16>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 16> blend(const short_vec<float, 16>& a, const short_vec<float, 16>& b, const short_vec<float, 16>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 16> min(const short_vec<float, 16>& a, const short_vec<float, 16>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 16> max(const short_vec<float, 16>& a, const short_vec<float, 16>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 16> fma(const short_vec<float, 16>& a, const short_vec<float, 16>& b, const short_vec<float, 16>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 16>& vec, const short_vec<float, 16>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 16>
 {
@@ -204,6 +204,102 @@ public:
         _mm512_i32scatter_ps(ptr, indices, val2, 4);
     }
 
+    inline
+    short_vec<float, 32> operator<(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_LT_OQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_LT_OQ)));
+    }
+
+    inline
+    short_vec<float, 32> operator<=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_LE_OQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_LE_OQ)));
+    }
+
+    inline
+    short_vec<float, 32> operator>(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_GT_OQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_GT_OQ)));
+    }
+
+    inline
+    short_vec<float, 32> operator>=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_GE_OQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_GE_OQ)));
+    }
+
+    inline
+    short_vec<float, 32> operator==(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_EQ_OQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_EQ_OQ)));
+    }
+
+    inline
+    short_vec<float, 32> operator!=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val1, other.val1, _CMP_NEQ_UQ)),
+            ShortVecHelpers::mask_to_vec_ps(_mm512_cmp_ps_mask(val2, other.val2, _CMP_NEQ_UQ)));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 32> blend(const short_vec<float, 32>& other, const short_vec<float, 32>& mask) const
+    {
+        return short_vec<float, 32>(
+            _mm512_mask_blend_ps(ShortVecHelpers::vec_to_mask_ps(mask.val1), val1, other.val1),
+            _mm512_mask_blend_ps(ShortVecHelpers::vec_to_mask_ps(mask.val2), val2, other.val2));
+    }
+
+    inline
+    short_vec<float, 32> min(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm512_min_ps(val1, other.val1),
+            _mm512_min_ps(val2, other.val2));
+    }
+
+    inline
+    short_vec<float, 32> max(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm512_max_ps(val1, other.val1),
+            _mm512_max_ps(val2, other.val2));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 32> fma(const short_vec<float, 32>& factor, const short_vec<float, 32>& summand) const
+    {
+        return short_vec<float, 32>(
+            _mm512_fmadd_ps(val1, factor.val1, summand.val1),
+            _mm512_fmadd_ps(val2, factor.val2, summand.val2));
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 32>& mask) const
+    {
+        _mm512_mask_storeu_ps(data + 0, ShortVecHelpers::vec_to_mask_ps(mask.val1), val1);
+        _mm512_mask_storeu_ps(data + 16, ShortVecHelpers::vec_to_mask_ps(mask.val2), val2);
+    }
+
 private:
     __m512 val1;
     __m512 val2;
@@ -215,6 +311,36 @@ void operator<<(float *data, const short_vec<float, 32>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 32> blend(const short_vec<float, 32>& a, const short_vec<float, 32>& b, const short_vec<float, 32>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 32> min(const short_vec<float, 32>& a, const short_vec<float, 32>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 32> max(const short_vec<float, 32>& a, const short_vec<float, 32>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 32> fma(const short_vec<float, 32>& a, const short_vec<float, 32>& b, const short_vec<float, 32>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 32>& vec, const short_vec<float, 32>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 32>
 {
@@ -286,6 +286,132 @@ public:
         _mm_storeh_pd(ptr + offsets[15], tmp);
     }
 
+    inline
+    short_vec<double, 16> operator<(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LT_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_LT_OQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_LT_OQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_LT_OQ));
+    }
+
+    inline
+    short_vec<double, 16> operator<=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LE_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_LE_OQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_LE_OQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_LE_OQ));
+    }
+
+    inline
+    short_vec<double, 16> operator>(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GT_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_GT_OQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_GT_OQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_GT_OQ));
+    }
+
+    inline
+    short_vec<double, 16> operator>=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GE_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_GE_OQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_GE_OQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_GE_OQ));
+    }
+
+    inline
+    short_vec<double, 16> operator==(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_EQ_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_EQ_OQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_EQ_OQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_EQ_OQ));
+    }
+
+    inline
+    short_vec<double, 16> operator!=(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_NEQ_UQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_NEQ_UQ),
+            _mm256_cmp_pd(val3, other.val3, _CMP_NEQ_UQ),
+            _mm256_cmp_pd(val4, other.val4, _CMP_NEQ_UQ));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 16> blend(const short_vec<double, 16>& other, const short_vec<double, 16>& mask) const
+    {
+        return short_vec<double, 16>(
+            _mm256_blendv_pd(val1, other.val1, mask.val1),
+            _mm256_blendv_pd(val2, other.val2, mask.val2),
+            _mm256_blendv_pd(val3, other.val3, mask.val3),
+            _mm256_blendv_pd(val4, other.val4, mask.val4));
+    }
+
+    inline
+    short_vec<double, 16> min(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_min_pd(val1, other.val1),
+            _mm256_min_pd(val2, other.val2),
+            _mm256_min_pd(val3, other.val3),
+            _mm256_min_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 16> max(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm256_max_pd(val1, other.val1),
+            _mm256_max_pd(val2, other.val2),
+            _mm256_max_pd(val3, other.val3),
+            _mm256_max_pd(val4, other.val4));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 16> fma(const short_vec<double, 16>& factor, const short_vec<double, 16>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 16>(
+            _mm256_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm256_fmadd_pd(val2, factor.val2, summand.val2),
+            _mm256_fmadd_pd(val3, factor.val3, summand.val3),
+            _mm256_fmadd_pd(val4, factor.val4, summand.val4));
+#else
+        return short_vec<double, 16>(
+            _mm256_add_pd(_mm256_mul_pd(val1, factor.val1), summand.val1),
+            _mm256_add_pd(_mm256_mul_pd(val2, factor.val2), summand.val2),
+            _mm256_add_pd(_mm256_mul_pd(val3, factor.val3), summand.val3),
+            _mm256_add_pd(_mm256_mul_pd(val4, factor.val4), summand.val4));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 16>& mask) const
+    {
+        _mm256_maskstore_pd(data + 0, _mm256_castpd_si256(mask.val1), val1);
+        _mm256_maskstore_pd(data + 4, _mm256_castpd_si256(mask.val2), val2);
+        _mm256_maskstore_pd(data + 8, _mm256_castpd_si256(mask.val3), val3);
+        _mm256_maskstore_pd(data + 12, _mm256_castpd_si256(mask.val4), val4);
+    }
+
 private:
     __m256d val1;
     __m256d val2;
@@ -299,6 +425,36 @@ void operator<<(double *data, const short_vec<double, 16>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 16> blend(const short_vec<double, 16>& a, const short_vec<double, 16>& b, const short_vec<double, 16>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 16> min(const short_vec<double, 16>& a, const short_vec<double, 16>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 16> max(const short_vec<double, 16>& a, const short_vec<double, 16>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 16> fma(const short_vec<double, 16>& a, const short_vec<double, 16>& b, const short_vec<double, 16>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 16>& vec, const short_vec<double, 16>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
@@ -194,6 +194,96 @@ public:
         _mm_storeh_pd(ptr + offsets[3], tmp);
     }
 
+    inline
+    short_vec<double, 4> operator<(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LT_OQ));
+    }
+
+    inline
+    short_vec<double, 4> operator<=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LE_OQ));
+    }
+
+    inline
+    short_vec<double, 4> operator>(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GT_OQ));
+    }
+
+    inline
+    short_vec<double, 4> operator>=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GE_OQ));
+    }
+
+    inline
+    short_vec<double, 4> operator==(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_EQ_OQ));
+    }
+
+    inline
+    short_vec<double, 4> operator!=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_NEQ_UQ));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 4> blend(const short_vec<double, 4>& other, const short_vec<double, 4>& mask) const
+    {
+        return short_vec<double, 4>(
+            _mm256_blendv_pd(val1, other.val1, mask.val1));
+    }
+
+    inline
+    short_vec<double, 4> min(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_min_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 4> max(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_max_pd(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 4> fma(const short_vec<double, 4>& factor, const short_vec<double, 4>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 4>(
+            _mm256_fmadd_pd(val1, factor.val1, summand.val1));
+#else
+        return short_vec<double, 4>(
+            _mm256_add_pd(_mm256_mul_pd(val1, factor.val1), summand.val1));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 4>& mask) const
+    {
+        _mm256_maskstore_pd(data + 0, _mm256_castpd_si256(mask.val1), val1);
+    }
+
 private:
     __m256d val1;
 };
@@ -204,6 +294,36 @@ void operator<<(double *data, const short_vec<double, 4>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 4> blend(const short_vec<double, 4>& a, const short_vec<double, 4>& b, const short_vec<double, 4>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 4> min(const short_vec<double, 4>& a, const short_vec<double, 4>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 4> max(const short_vec<double, 4>& a, const short_vec<double, 4>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 4> fma(const short_vec<double, 4>& a, const short_vec<double, 4>& b, const short_vec<double, 4>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 4>& vec, const short_vec<double, 4>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
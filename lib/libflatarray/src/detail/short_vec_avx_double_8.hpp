@@ -226,6 +226,108 @@ public:
         _mm_storeh_pd(ptr + offsets[7], tmp);
     }
 
+    inline
+    short_vec<double, 8> operator<(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LT_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_LT_OQ));
+    }
+
+    inline
+    short_vec<double, 8> operator<=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_LE_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_LE_OQ));
+    }
+
+    inline
+    short_vec<double, 8> operator>(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GT_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_GT_OQ));
+    }
+
+    inline
+    short_vec<double, 8> operator>=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_GE_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_GE_OQ));
+    }
+
+    inline
+    short_vec<double, 8> operator==(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_EQ_OQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_EQ_OQ));
+    }
+
+    inline
+    short_vec<double, 8> operator!=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_cmp_pd(val1, other.val1, _CMP_NEQ_UQ),
+            _mm256_cmp_pd(val2, other.val2, _CMP_NEQ_UQ));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 8> blend(const short_vec<double, 8>& other, const short_vec<double, 8>& mask) const
+    {
+        return short_vec<double, 8>(
+            _mm256_blendv_pd(val1, other.val1, mask.val1),
+            _mm256_blendv_pd(val2, other.val2, mask.val2));
+    }
+
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_min_pd(val1, other.val1),
+            _mm256_min_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_max_pd(val1, other.val1),
+            _mm256_max_pd(val2, other.val2));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 8>(
+            _mm256_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm256_fmadd_pd(val2, factor.val2, summand.val2));
+#else
+        return short_vec<double, 8>(
+            _mm256_add_pd(_mm256_mul_pd(val1, factor.val1), summand.val1),
+            _mm256_add_pd(_mm256_mul_pd(val2, factor.val2), summand.val2));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 8>& mask) const
+    {
+        _mm256_maskstore_pd(data + 0, _mm256_castpd_si256(mask.val1), val1);
+        _mm256_maskstore_pd(data + 4, _mm256_castpd_si256(mask.val2), val2);
+    }
+
 private:
     __m256d val1;
     __m256d val2;
@@ -237,6 +339,36 @@ void operator<<(double *data, const short_vec<double, 8>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 8> blend(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 8> min(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 8> max(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 8> fma(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 8>& vec, const short_vec<double, 8>& mask)
+{
+    vec.store(data, mask);
+}
+
 #ifdef __ICC
 #pragma warning pop
 #endif
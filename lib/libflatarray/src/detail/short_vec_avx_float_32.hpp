@@ -331,6 +331,132 @@ public:
         _MM_EXTRACT_FLOAT(ptr[offsets[31]], tmp, 3);
     }
 
+    inline
+    short_vec<float, 32> operator<(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_LT_OQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_LT_OQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_LT_OQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_LT_OQ));
+    }
+
+    inline
+    short_vec<float, 32> operator<=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_LE_OQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_LE_OQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_LE_OQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_LE_OQ));
+    }
+
+    inline
+    short_vec<float, 32> operator>(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_GT_OQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_GT_OQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_GT_OQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_GT_OQ));
+    }
+
+    inline
+    short_vec<float, 32> operator>=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_GE_OQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_GE_OQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_GE_OQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_GE_OQ));
+    }
+
+    inline
+    short_vec<float, 32> operator==(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_EQ_OQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_EQ_OQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_EQ_OQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_EQ_OQ));
+    }
+
+    inline
+    short_vec<float, 32> operator!=(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_NEQ_UQ),
+            _mm256_cmp_ps(val2, other.val2, _CMP_NEQ_UQ),
+            _mm256_cmp_ps(val3, other.val3, _CMP_NEQ_UQ),
+            _mm256_cmp_ps(val4, other.val4, _CMP_NEQ_UQ));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 32> blend(const short_vec<float, 32>& other, const short_vec<float, 32>& mask) const
+    {
+        return short_vec<float, 32>(
+            _mm256_blendv_ps(val1, other.val1, mask.val1),
+            _mm256_blendv_ps(val2, other.val2, mask.val2),
+            _mm256_blendv_ps(val3, other.val3, mask.val3),
+            _mm256_blendv_ps(val4, other.val4, mask.val4));
+    }
+
+    inline
+    short_vec<float, 32> min(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_min_ps(val1, other.val1),
+            _mm256_min_ps(val2, other.val2),
+            _mm256_min_ps(val3, other.val3),
+            _mm256_min_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 32> max(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm256_max_ps(val1, other.val1),
+            _mm256_max_ps(val2, other.val2),
+            _mm256_max_ps(val3, other.val3),
+            _mm256_max_ps(val4, other.val4));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 32> fma(const short_vec<float, 32>& factor, const short_vec<float, 32>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<float, 32>(
+            _mm256_fmadd_ps(val1, factor.val1, summand.val1),
+            _mm256_fmadd_ps(val2, factor.val2, summand.val2),
+            _mm256_fmadd_ps(val3, factor.val3, summand.val3),
+            _mm256_fmadd_ps(val4, factor.val4, summand.val4));
+#else
+        return short_vec<float, 32>(
+            _mm256_add_ps(_mm256_mul_ps(val1, factor.val1), summand.val1),
+            _mm256_add_ps(_mm256_mul_ps(val2, factor.val2), summand.val2),
+            _mm256_add_ps(_mm256_mul_ps(val3, factor.val3), summand.val3),
+            _mm256_add_ps(_mm256_mul_ps(val4, factor.val4), summand.val4));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 32>& mask) const
+    {
+        _mm256_maskstore_ps(data + 0, _mm256_castps_si256(mask.val1), val1);
+        _mm256_maskstore_ps(data + 8, _mm256_castps_si256(mask.val2), val2);
+        _mm256_maskstore_ps(data + 16, _mm256_castps_si256(mask.val3), val3);
+        _mm256_maskstore_ps(data + 24, _mm256_castps_si256(mask.val4), val4);
+    }
+
 private:
     __m256 val1;
     __m256 val2;
@@ -344,6 +470,36 @@ void operator<<(float *data, const short_vec<float, 32>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 32> blend(const short_vec<float, 32>& a, const short_vec<float, 32>& b, const short_vec<float, 32>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 32> min(const short_vec<float, 32>& a, const short_vec<float, 32>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 32> max(const short_vec<float, 32>& a, const short_vec<float, 32>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 32> fma(const short_vec<float, 32>& a, const short_vec<float, 32>& b, const short_vec<float, 32>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 32>& vec, const short_vec<float, 32>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 32>
 {
@@ -211,6 +211,96 @@ public:
         _MM_EXTRACT_FLOAT(ptr[offsets[7]], tmp, 3);
     }
 
+    inline
+    short_vec<float, 8> operator<(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_LT_OQ));
+    }
+
+    inline
+    short_vec<float, 8> operator<=(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_LE_OQ));
+    }
+
+    inline
+    short_vec<float, 8> operator>(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_GT_OQ));
+    }
+
+    inline
+    short_vec<float, 8> operator>=(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_GE_OQ));
+    }
+
+    inline
+    short_vec<float, 8> operator==(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_EQ_OQ));
+    }
+
+    inline
+    short_vec<float, 8> operator!=(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_cmp_ps(val1, other.val1, _CMP_NEQ_UQ));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 8> blend(const short_vec<float, 8>& other, const short_vec<float, 8>& mask) const
+    {
+        return short_vec<float, 8>(
+            _mm256_blendv_ps(val1, other.val1, mask.val1));
+    }
+
+    inline
+    short_vec<float, 8> min(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_min_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 8> max(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_max_ps(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 8> fma(const short_vec<float, 8>& factor, const short_vec<float, 8>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<float, 8>(
+            _mm256_fmadd_ps(val1, factor.val1, summand.val1));
+#else
+        return short_vec<float, 8>(
+            _mm256_add_ps(_mm256_mul_ps(val1, factor.val1), summand.val1));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 8>& mask) const
+    {
+        _mm256_maskstore_ps(data + 0, _mm256_castps_si256(mask.val1), val1);
+    }
+
 private:
     __m256 val1;
 };
@@ -221,6 +311,36 @@ void operator<<(float *data, const short_vec<float, 8>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 8> blend(const short_vec<float, 8>& a, const short_vec<float, 8>& b, const short_vec<float, 8>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 8> min(const short_vec<float, 8>& a, const short_vec<float, 8>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 8> max(const short_vec<float, 8>& a, const short_vec<float, 8>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 8> fma(const short_vec<float, 8>& a, const short_vec<float, 8>& b, const short_vec<float, 8>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 8>& vec, const short_vec<float, 8>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 8>
 {
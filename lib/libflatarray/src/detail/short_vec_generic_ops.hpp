@@ -0,0 +1,162 @@
+/**
+ * Copyright 2016 Andreas Schäfer
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef FLAT_ARRAY_DETAIL_SHORT_VEC_GENERIC_OPS_HPP
+#define FLAT_ARRAY_DETAIL_SHORT_VEC_GENERIC_OPS_HPP
+
+#include <cstring>
+
+// Comparisons, blending, masked stores, min/max and FMA are
+// implemented natively for the SSE, AVX and AVX-512 floating point
+// short_vecs. The templates below serve as a fallback for all other
+// implementations and define the reference semantics:
+//
+// - comparisons yield masks, which are short_vecs of the same type
+//   with either all or no bits set per element,
+// - blend(a, b, mask) selects b's elements where mask is set and a's
+//   elements otherwise,
+// - masked_store(data, vec, mask) only writes elements for which
+//   mask is set,
+// - min(a, b) equals (a < b) ? a : b and max(a, b) equals
+//   (a > b) ? a : b, per element,
+// - fma(a, b, c) computes a * b + c (fused where available).
+//
+// Native member functions and non-template overloads take
+// precedence over these templates during overload resolution.
+
+namespace LibFlatArray {
+
+template<typename CARGO, int ARITY>
+class short_vec;
+
+namespace ShortVecHelpers {
+
+/**
+ * Helper to keep the second parameter of the comparison operators
+ * from taking part in template argument deduction, which allows
+ * comparisons with scalars (e.g. vec < 0.5).
+ */
+template<typename T>
+class identity
+{
+public:
+    typedef T type;
+};
+
+template<typename CARGO>
+inline
+CARGO mask_element(bool flag)
+{
+    CARGO ret;
+    std::memset(&ret, flag ? 0xff : 0, sizeof(CARGO));
+    return ret;
+}
+
+template<typename CARGO>
+inline
+bool mask_element_is_set(const CARGO& element)
+{
+    const char zero[sizeof(CARGO)] = { 0 };
+    return std::memcmp(&element, zero, sizeof(CARGO)) != 0;
+}
+
+}
+
+#define LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(OPERATOR)             \
+    template<typename CARGO, int ARITY>                                 \
+    inline                                                              \
+    short_vec<CARGO, ARITY> operator OPERATOR(                          \
+        const short_vec<CARGO, ARITY>& a,                               \
+        const typename ShortVecHelpers::identity<short_vec<CARGO, ARITY> >::type& b) \
+    {                                                                   \
+        CARGO bufA[ARITY];                                              \
+        CARGO bufB[ARITY];                                              \
+        a.store(bufA);                                                  \
+        b.store(bufB);                                                  \
+                                                                        \
+        for (int i = 0; i < ARITY; ++i) {                               \
+            bufA[i] = ShortVecHelpers::mask_element<CARGO>(bufA[i] OPERATOR bufB[i]); \
+        }                                                               \
+                                                                        \
+        return short_vec<CARGO, ARITY>(bufA);                           \
+    }
+
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(<)
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(<=)
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(>)
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(>=)
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(==)
+LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON(!=)
+
+#undef LIBFLATARRAY_SHORT_VEC_GENERIC_COMPARISON
+
+template<typename CARGO, int ARITY>
+inline
+short_vec<CARGO, ARITY> blend(
+    const short_vec<CARGO, ARITY>& a,
+    const short_vec<CARGO, ARITY>& b,
+    const short_vec<CARGO, ARITY>& mask)
+{
+    CARGO bufA[ARITY];
+    CARGO bufB[ARITY];
+    CARGO bufMask[ARITY];
+    a.store(bufA);
+    b.store(bufB);
+    mask.store(bufMask);
+
+    for (int i = 0; i < ARITY; ++i) {
+        if (ShortVecHelpers::mask_element_is_set(bufMask[i])) {
+            bufA[i] = bufB[i];
+        }
+    }
+
+    return short_vec<CARGO, ARITY>(bufA);
+}
+
+template<typename CARGO, int ARITY>
+inline
+short_vec<CARGO, ARITY> min(const short_vec<CARGO, ARITY>& a, const short_vec<CARGO, ARITY>& b)
+{
+    return blend(b, a, a < b);
+}
+
+template<typename CARGO, int ARITY>
+inline
+short_vec<CARGO, ARITY> max(const short_vec<CARGO, ARITY>& a, const short_vec<CARGO, ARITY>& b)
+{
+    return blend(b, a, a > b);
+}
+
+template<typename CARGO, int ARITY>
+inline
+short_vec<CARGO, ARITY> fma(
+    const short_vec<CARGO, ARITY>& a,
+    const short_vec<CARGO, ARITY>& b,
+    const short_vec<CARGO, ARITY>& c)
+{
+    return a * b + c;
+}
+
+template<typename CARGO, int ARITY>
+inline
+void masked_store(CARGO *data, const short_vec<CARGO, ARITY>& vec, const short_vec<CARGO, ARITY>& mask)
+{
+    CARGO bufVec[ARITY];
+    CARGO bufMask[ARITY];
+    vec.store(bufVec);
+    mask.store(bufMask);
+
+    for (int i = 0; i < ARITY; ++i) {
+        if (ShortVecHelpers::mask_element_is_set(bufMask[i])) {
+            data[i] = bufVec[i];
+        }
+    }
+}
+
+}
+
+#endif
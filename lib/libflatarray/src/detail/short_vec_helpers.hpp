@@ -19,10 +19,18 @@
 #define _SHORTVEC_UINTPTR_T unsigned long long
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #ifdef __SSE4_1__
 #include <smmintrin.h>
 #endif
 
+#ifdef __AVX512F__
+#include <immintrin.h>
+#endif
+
 /**
  * This macro asserts that the pointer is correctly aligned.
  *
@@ -122,6 +130,125 @@ union ExtractResult {
 
 #endif
 
+#ifdef __SSE2__
+
+/**
+ * Selects lanes from b where mask is set and from a otherwise.
+ * Masks are expected to have either all or no bits set per lane, as
+ * yielded by comparisons.
+ */
+inline
+__m128d blend_pd(const __m128d& a, const __m128d& b, const __m128d& mask)
+{
+#ifdef __SSE4_1__
+    return _mm_blendv_pd(a, b, mask);
+#else
+    return _mm_or_pd(_mm_and_pd(mask, b), _mm_andnot_pd(mask, a));
+#endif
+}
+
+/**
+ * Same as above, but for single precision.
+ */
+inline
+__m128 blend_ps(const __m128& a, const __m128& b, const __m128& mask)
+{
+#ifdef __SSE4_1__
+    return _mm_blendv_ps(a, b, mask);
+#else
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+#endif
+}
+
+/**
+ * Stores only those lanes of val for which mask is set. Other lanes
+ * of data are neither read nor written, which makes this safe for
+ * loop tails (where they may lie beyond the end of the buffer) and
+ * for lanes owned by other threads. SSE lacks a proper masked store
+ * (_mm_maskmoveu_si128 is non-temporal and thus slow for data which
+ * is about to be read again), hence we store lane by lane unless
+ * all lanes are selected.
+ */
+inline
+void masked_store_pd(double *data, const __m128d& val, const __m128d& mask)
+{
+    int bits = _mm_movemask_pd(mask);
+    if (bits == 3) {
+        _mm_storeu_pd(data, val);
+        return;
+    }
+
+    if (bits & 1) {
+        _mm_storel_pd(data + 0, val);
+    }
+    if (bits & 2) {
+        _mm_storeh_pd(data + 1, val);
+    }
+}
+
+/**
+ * Same as above, but for single precision.
+ */
+inline
+void masked_store_ps(float *data, const __m128& val, const __m128& mask)
+{
+    int bits = _mm_movemask_ps(mask);
+    if (bits == 15) {
+        _mm_storeu_ps(data, val);
+        return;
+    }
+
+    if (bits & 1) {
+        _mm_store_ss(data + 0, val);
+    }
+    if (bits & 2) {
+        _mm_store_ss(data + 1, _mm_shuffle_ps(val, val, _MM_SHUFFLE(1, 1, 1, 1)));
+    }
+    if (bits & 4) {
+        _mm_store_ss(data + 2, _mm_shuffle_ps(val, val, _MM_SHUFFLE(2, 2, 2, 2)));
+    }
+    if (bits & 8) {
+        _mm_store_ss(data + 3, _mm_shuffle_ps(val, val, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+}
+
+#endif
+
+#ifdef __AVX512F__
+
+/**
+ * AVX-512 comparisons yield bit masks, but short_vec masks are
+ * registers with all bits set in the selected lanes (just like with
+ * SSE and AVX). These functions convert between both formats.
+ */
+inline
+__m512d mask_to_vec_pd(__mmask8 mask)
+{
+    return _mm512_castsi512_pd(_mm512_maskz_set1_epi64(mask, -1));
+}
+
+inline
+__m512 mask_to_vec_ps(__mmask16 mask)
+{
+    return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(mask, -1));
+}
+
+inline
+__mmask8 vec_to_mask_pd(const __m512d& vec)
+{
+    __m512i buf = _mm512_castpd_si512(vec);
+    return _mm512_test_epi64_mask(buf, buf);
+}
+
+inline
+__mmask16 vec_to_mask_ps(const __m512& vec)
+{
+    __m512i buf = _mm512_castps_si512(vec);
+    return _mm512_test_epi32_mask(buf, buf);
+}
+
+#endif
+
 }
 
 }
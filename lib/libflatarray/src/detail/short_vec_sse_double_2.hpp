@@ -12,6 +12,9 @@
 #ifdef __SSE__
 
 #include <emmintrin.h>
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
 #include <libflatarray/detail/short_vec_helpers.hpp>
 #include <libflatarray/config.h>
 
@@ -176,6 +179,96 @@ public:
         _mm_storeh_pd(ptr + offsets[1], val1);
     }
 
+    inline
+    short_vec<double, 2> operator<(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmplt_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> operator<=(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmple_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> operator>(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmpgt_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> operator>=(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmpge_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> operator==(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmpeq_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> operator!=(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_cmpneq_pd(val1, other.val1));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 2> blend(const short_vec<double, 2>& other, const short_vec<double, 2>& mask) const
+    {
+        return short_vec<double, 2>(
+            ShortVecHelpers::blend_pd(val1, other.val1, mask.val1));
+    }
+
+    inline
+    short_vec<double, 2> min(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_min_pd(val1, other.val1));
+    }
+
+    inline
+    short_vec<double, 2> max(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_max_pd(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 2> fma(const short_vec<double, 2>& factor, const short_vec<double, 2>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 2>(
+            _mm_fmadd_pd(val1, factor.val1, summand.val1));
+#else
+        return short_vec<double, 2>(
+            _mm_add_pd(_mm_mul_pd(val1, factor.val1), summand.val1));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 2>& mask) const
+    {
+        ShortVecHelpers::masked_store_pd(data + 0, val1, mask.val1);
+    }
+
 private:
     __m128d val1;
 };
@@ -190,6 +283,36 @@ void operator<<(double *data, const short_vec<double, 2>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 2> blend(const short_vec<double, 2>& a, const short_vec<double, 2>& b, const short_vec<double, 2>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 2> min(const short_vec<double, 2>& a, const short_vec<double, 2>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 2> max(const short_vec<double, 2>& a, const short_vec<double, 2>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 2> fma(const short_vec<double, 2>& a, const short_vec<double, 2>& b, const short_vec<double, 2>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 2>& vec, const short_vec<double, 2>& mask)
+{
+    vec.store(data, mask);
+}
+
 inline
 short_vec<double, 2> sqrt(const short_vec<double, 2>& vec)
 {
@@ -12,6 +12,9 @@
 #ifdef __SSE__
 
 #include <emmintrin.h>
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
 #include <libflatarray/detail/short_vec_helpers.hpp>
 #include <libflatarray/config.h>
 
@@ -197,6 +200,108 @@ public:
         _mm_storeh_pd(ptr + offsets[3], val2);
     }
 
+    inline
+    short_vec<double, 4> operator<(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmplt_pd(val1, other.val1),
+            _mm_cmplt_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> operator<=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmple_pd(val1, other.val1),
+            _mm_cmple_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> operator>(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmpgt_pd(val1, other.val1),
+            _mm_cmpgt_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> operator>=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmpge_pd(val1, other.val1),
+            _mm_cmpge_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> operator==(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmpeq_pd(val1, other.val1),
+            _mm_cmpeq_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> operator!=(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_cmpneq_pd(val1, other.val1),
+            _mm_cmpneq_pd(val2, other.val2));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 4> blend(const short_vec<double, 4>& other, const short_vec<double, 4>& mask) const
+    {
+        return short_vec<double, 4>(
+            ShortVecHelpers::blend_pd(val1, other.val1, mask.val1),
+            ShortVecHelpers::blend_pd(val2, other.val2, mask.val2));
+    }
+
+    inline
+    short_vec<double, 4> min(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_min_pd(val1, other.val1),
+            _mm_min_pd(val2, other.val2));
+    }
+
+    inline
+    short_vec<double, 4> max(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm_max_pd(val1, other.val1),
+            _mm_max_pd(val2, other.val2));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 4> fma(const short_vec<double, 4>& factor, const short_vec<double, 4>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 4>(
+            _mm_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm_fmadd_pd(val2, factor.val2, summand.val2));
+#else
+        return short_vec<double, 4>(
+            _mm_add_pd(_mm_mul_pd(val1, factor.val1), summand.val1),
+            _mm_add_pd(_mm_mul_pd(val2, factor.val2), summand.val2));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 4>& mask) const
+    {
+        ShortVecHelpers::masked_store_pd(data + 0, val1, mask.val1);
+        ShortVecHelpers::masked_store_pd(data + 2, val2, mask.val2);
+    }
+
 private:
     __m128d val1;
     __m128d val2;
@@ -212,6 +317,36 @@ void operator<<(double *data, const short_vec<double, 4>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 4> blend(const short_vec<double, 4>& a, const short_vec<double, 4>& b, const short_vec<double, 4>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 4> min(const short_vec<double, 4>& a, const short_vec<double, 4>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 4> max(const short_vec<double, 4>& a, const short_vec<double, 4>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 4> fma(const short_vec<double, 4>& a, const short_vec<double, 4>& b, const short_vec<double, 4>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 4>& vec, const short_vec<double, 4>& mask)
+{
+    vec.store(data, mask);
+}
+
 inline
 short_vec<double, 4> sqrt(const short_vec<double, 4>& vec)
 {
@@ -11,6 +11,9 @@
 #ifdef __SSE__
 
 #include <emmintrin.h>
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
 #include <libflatarray/detail/short_vec_helpers.hpp>
 #include <libflatarray/config.h>
 
@@ -237,6 +240,132 @@ public:
         _mm_storeh_pd(ptr + offsets[7], val4);
     }
 
+    inline
+    short_vec<double, 8> operator<(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmplt_pd(val1, other.val1),
+            _mm_cmplt_pd(val2, other.val2),
+            _mm_cmplt_pd(val3, other.val3),
+            _mm_cmplt_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> operator<=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmple_pd(val1, other.val1),
+            _mm_cmple_pd(val2, other.val2),
+            _mm_cmple_pd(val3, other.val3),
+            _mm_cmple_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> operator>(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmpgt_pd(val1, other.val1),
+            _mm_cmpgt_pd(val2, other.val2),
+            _mm_cmpgt_pd(val3, other.val3),
+            _mm_cmpgt_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> operator>=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmpge_pd(val1, other.val1),
+            _mm_cmpge_pd(val2, other.val2),
+            _mm_cmpge_pd(val3, other.val3),
+            _mm_cmpge_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> operator==(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmpeq_pd(val1, other.val1),
+            _mm_cmpeq_pd(val2, other.val2),
+            _mm_cmpeq_pd(val3, other.val3),
+            _mm_cmpeq_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> operator!=(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_cmpneq_pd(val1, other.val1),
+            _mm_cmpneq_pd(val2, other.val2),
+            _mm_cmpneq_pd(val3, other.val3),
+            _mm_cmpneq_pd(val4, other.val4));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<double, 8> blend(const short_vec<double, 8>& other, const short_vec<double, 8>& mask) const
+    {
+        return short_vec<double, 8>(
+            ShortVecHelpers::blend_pd(val1, other.val1, mask.val1),
+            ShortVecHelpers::blend_pd(val2, other.val2, mask.val2),
+            ShortVecHelpers::blend_pd(val3, other.val3, mask.val3),
+            ShortVecHelpers::blend_pd(val4, other.val4, mask.val4));
+    }
+
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_min_pd(val1, other.val1),
+            _mm_min_pd(val2, other.val2),
+            _mm_min_pd(val3, other.val3),
+            _mm_min_pd(val4, other.val4));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm_max_pd(val1, other.val1),
+            _mm_max_pd(val2, other.val2),
+            _mm_max_pd(val3, other.val3),
+            _mm_max_pd(val4, other.val4));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<double, 8>(
+            _mm_fmadd_pd(val1, factor.val1, summand.val1),
+            _mm_fmadd_pd(val2, factor.val2, summand.val2),
+            _mm_fmadd_pd(val3, factor.val3, summand.val3),
+            _mm_fmadd_pd(val4, factor.val4, summand.val4));
+#else
+        return short_vec<double, 8>(
+            _mm_add_pd(_mm_mul_pd(val1, factor.val1), summand.val1),
+            _mm_add_pd(_mm_mul_pd(val2, factor.val2), summand.val2),
+            _mm_add_pd(_mm_mul_pd(val3, factor.val3), summand.val3),
+            _mm_add_pd(_mm_mul_pd(val4, factor.val4), summand.val4));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(double *data, const short_vec<double, 8>& mask) const
+    {
+        ShortVecHelpers::masked_store_pd(data + 0, val1, mask.val1);
+        ShortVecHelpers::masked_store_pd(data + 2, val2, mask.val2);
+        ShortVecHelpers::masked_store_pd(data + 4, val3, mask.val3);
+        ShortVecHelpers::masked_store_pd(data + 6, val4, mask.val4);
+    }
+
 private:
     __m128d val1;
     __m128d val2;
@@ -254,6 +383,36 @@ void operator<<(double *data, const short_vec<double, 8>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<double, 8> blend(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<double, 8> min(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<double, 8> max(const short_vec<double, 8>& a, const short_vec<double, 8>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<double, 8> fma(const short_vec<double, 8>& a, const short_vec<double, 8>& b, const short_vec<double, 8>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(double *data, const short_vec<double, 8>& vec, const short_vec<double, 8>& mask)
+{
+    vec.store(data, mask);
+}
+
 inline
 short_vec<double, 8> sqrt(const short_vec<double, 8>& vec)
 {
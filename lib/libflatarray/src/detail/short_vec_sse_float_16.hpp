@@ -11,6 +11,9 @@
 #ifdef __SSE__
 
 #include <emmintrin.h>
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
 #include <libflatarray/config.h>
@@ -360,6 +363,132 @@ public:
    }
 #endif
 
+    inline
+    short_vec<float, 16> operator<(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmplt_ps(val1, other.val1),
+            _mm_cmplt_ps(val2, other.val2),
+            _mm_cmplt_ps(val3, other.val3),
+            _mm_cmplt_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> operator<=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmple_ps(val1, other.val1),
+            _mm_cmple_ps(val2, other.val2),
+            _mm_cmple_ps(val3, other.val3),
+            _mm_cmple_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> operator>(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmpgt_ps(val1, other.val1),
+            _mm_cmpgt_ps(val2, other.val2),
+            _mm_cmpgt_ps(val3, other.val3),
+            _mm_cmpgt_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> operator>=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmpge_ps(val1, other.val1),
+            _mm_cmpge_ps(val2, other.val2),
+            _mm_cmpge_ps(val3, other.val3),
+            _mm_cmpge_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> operator==(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmpeq_ps(val1, other.val1),
+            _mm_cmpeq_ps(val2, other.val2),
+            _mm_cmpeq_ps(val3, other.val3),
+            _mm_cmpeq_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> operator!=(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_cmpneq_ps(val1, other.val1),
+            _mm_cmpneq_ps(val2, other.val2),
+            _mm_cmpneq_ps(val3, other.val3),
+            _mm_cmpneq_ps(val4, other.val4));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 16> blend(const short_vec<float, 16>& other, const short_vec<float, 16>& mask) const
+    {
+        return short_vec<float, 16>(
+            ShortVecHelpers::blend_ps(val1, other.val1, mask.val1),
+            ShortVecHelpers::blend_ps(val2, other.val2, mask.val2),
+            ShortVecHelpers::blend_ps(val3, other.val3, mask.val3),
+            ShortVecHelpers::blend_ps(val4, other.val4, mask.val4));
+    }
+
+    inline
+    short_vec<float, 16> min(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_min_ps(val1, other.val1),
+            _mm_min_ps(val2, other.val2),
+            _mm_min_ps(val3, other.val3),
+            _mm_min_ps(val4, other.val4));
+    }
+
+    inline
+    short_vec<float, 16> max(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_max_ps(val1, other.val1),
+            _mm_max_ps(val2, other.val2),
+            _mm_max_ps(val3, other.val3),
+            _mm_max_ps(val4, other.val4));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 16> fma(const short_vec<float, 16>& factor, const short_vec<float, 16>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<float, 16>(
+            _mm_fmadd_ps(val1, factor.val1, summand.val1),
+            _mm_fmadd_ps(val2, factor.val2, summand.val2),
+            _mm_fmadd_ps(val3, factor.val3, summand.val3),
+            _mm_fmadd_ps(val4, factor.val4, summand.val4));
+#else
+        return short_vec<float, 16>(
+            _mm_add_ps(_mm_mul_ps(val1, factor.val1), summand.val1),
+            _mm_add_ps(_mm_mul_ps(val2, factor.val2), summand.val2),
+            _mm_add_ps(_mm_mul_ps(val3, factor.val3), summand.val3),
+            _mm_add_ps(_mm_mul_ps(val4, factor.val4), summand.val4));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 16>& mask) const
+    {
+        ShortVecHelpers::masked_store_ps(data + 0, val1, mask.val1);
+        ShortVecHelpers::masked_store_ps(data + 4, val2, mask.val2);
+        ShortVecHelpers::masked_store_ps(data + 8, val3, mask.val3);
+        ShortVecHelpers::masked_store_ps(data + 12, val4, mask.val4);
+    }
+
 private:
     __m128 val1;
     __m128 val2;
@@ -373,6 +502,36 @@ void operator<<(float *data, const short_vec<float, 16>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 16> blend(const short_vec<float, 16>& a, const short_vec<float, 16>& b, const short_vec<float, 16>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 16> min(const short_vec<float, 16>& a, const short_vec<float, 16>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 16> max(const short_vec<float, 16>& a, const short_vec<float, 16>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 16> fma(const short_vec<float, 16>& a, const short_vec<float, 16>& b, const short_vec<float, 16>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 16>& vec, const short_vec<float, 16>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 16>
 {
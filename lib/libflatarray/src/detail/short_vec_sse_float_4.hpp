@@ -11,6 +11,9 @@
 #ifdef __SSE__
 
 #include <emmintrin.h>
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
 #include <libflatarray/config.h>
@@ -230,6 +233,96 @@ public:
     }
 #endif
 
+    inline
+    short_vec<float, 4> operator<(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmplt_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> operator<=(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmple_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> operator>(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmpgt_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> operator>=(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmpge_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> operator==(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmpeq_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> operator!=(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_cmpneq_ps(val1, other.val1));
+    }
+
+    /**
+     * Returns other's elements where mask is set, ours otherwise.
+     */
+    inline
+    short_vec<float, 4> blend(const short_vec<float, 4>& other, const short_vec<float, 4>& mask) const
+    {
+        return short_vec<float, 4>(
+            ShortVecHelpers::blend_ps(val1, other.val1, mask.val1));
+    }
+
+    inline
+    short_vec<float, 4> min(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_min_ps(val1, other.val1));
+    }
+
+    inline
+    short_vec<float, 4> max(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_max_ps(val1, other.val1));
+    }
+
+    /**
+     * Computes this * factor + summand, fused if the hardware supports it.
+     */
+    inline
+    short_vec<float, 4> fma(const short_vec<float, 4>& factor, const short_vec<float, 4>& summand) const
+    {
+#ifdef __FMA__
+        return short_vec<float, 4>(
+            _mm_fmadd_ps(val1, factor.val1, summand.val1));
+#else
+        return short_vec<float, 4>(
+            _mm_add_ps(_mm_mul_ps(val1, factor.val1), summand.val1));
+#endif
+    }
+
+    /**
+     * Stores only those elements for which mask is set.
+     */
+    inline
+    void store(float *data, const short_vec<float, 4>& mask) const
+    {
+        ShortVecHelpers::masked_store_ps(data + 0, val1, mask.val1);
+    }
+
 private:
     __m128 val1;
 };
@@ -240,6 +333,36 @@ void operator<<(float *data, const short_vec<float, 4>& vec)
     vec.store(data);
 }
 
+inline
+short_vec<float, 4> blend(const short_vec<float, 4>& a, const short_vec<float, 4>& b, const short_vec<float, 4>& mask)
+{
+    return a.blend(b, mask);
+}
+
+inline
+short_vec<float, 4> min(const short_vec<float, 4>& a, const short_vec<float, 4>& b)
+{
+    return a.min(b);
+}
+
+inline
+short_vec<float, 4> max(const short_vec<float, 4>& a, const short_vec<float, 4>& b)
+{
+    return a.max(b);
+}
+
+inline
+short_vec<float, 4> fma(const short_vec<float, 4>& a, const short_vec<float, 4>& b, const short_vec<float, 4>& c)
+{
+    return a.fma(b, c);
+}
+
+inline
+void masked_store(float *data, const short_vec<float, 4>& vec, const short_vec<float, 4>& mask)
+{
+    vec.store(data, mask);
+}
+
 template<>
 class sqrt_reference<float, 4>
 {
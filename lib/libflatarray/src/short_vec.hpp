@@ -108,4 +108,6 @@ public:
 #include <libflatarray/detail/short_vec_mic_float_16.hpp>
 #include <libflatarray/detail/short_vec_mic_float_32.hpp>
 
+#include <libflatarray/detail/short_vec_generic_ops.hpp>
+
 #endif
@@ -25,6 +25,32 @@ public:
     virtual std::string unit() = 0;
     virtual std::string device() = 0;
 
+    /**
+     * Floating point operations and bytes of memory traffic (reads
+     * plus writes, without write-allocates) per update, i.e. per unit
+     * of work counted by performance(), which then needs to report
+     * 10^9 updates per second (e.g. GLUPS, or GFLOP/s with 1 flop per
+     * update). Used for roofline analysis, 0 means unknown.
+     */
+    virtual double flops_per_update()
+    {
+        return 0;
+    }
+
+    virtual double bytes_per_update()
+    {
+        return 0;
+    }
+
+    /**
+     * Multi-threaded benchmarks are compared against the ceilings
+     * measured with all threads.
+     */
+    virtual bool multithreaded()
+    {
+        return false;
+    }
+
     static double time()
     {
         boost::posix_time::ptime now = boost::posix_time::microsec_clock::local_time();
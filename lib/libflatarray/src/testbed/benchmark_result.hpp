@@ -0,0 +1,345 @@
+/**
+ * Copyright 2014 Andreas Schäfer
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef FLAT_ARRAY_TESTBED_BENCHMARK_RESULT_HPP
+#define FLAT_ARRAY_TESTBED_BENCHMARK_RESULT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibFlatArray {
+
+/**
+ * Outcome of one benchmark (for one set of dimensions), possibly
+ * aggregated over multiple repetitions. Can be written as CSV or
+ * JSON and read back from CSV, which is what we use for baselines.
+ */
+class benchmark_result
+{
+public:
+    benchmark_result() :
+        repetitions(0),
+        median(0),
+        mad(0),
+        min(0),
+        max(0),
+        intensity(0),
+        percent_of_roofline(0)
+    {}
+
+    /**
+     * Derives median, median absolute deviation (MAD), minimum and
+     * maximum from the measured samples.
+     */
+    void set_samples(std::vector<double> samples)
+    {
+        repetitions = samples.size();
+        if (samples.empty()) {
+            median = mad = min = max = 0;
+            return;
+        }
+
+        min = *std::min_element(samples.begin(), samples.end());
+        max = *std::max_element(samples.begin(), samples.end());
+        median = median_of(samples);
+
+        for (std::vector<double>::iterator i = samples.begin(); i != samples.end(); ++i) {
+            *i = std::abs(*i - median);
+        }
+        mad = median_of(samples);
+    }
+
+    /**
+     * Identifies a benchmark across runs.
+     */
+    std::string key() const
+    {
+        return order + ";" + family + ";" + species + ";" + format_dimensions();
+    }
+
+    /**
+     * Rates such as GLUPS, GFLOP/s or GB/s are better if higher, times
+     * (s) and other ratios if lower.
+     */
+    bool higher_is_better() const
+    {
+        if (unit == "s") {
+            return false;
+        }
+
+        return ends_with(unit, "/s") || ends_with(unit, "PS");
+    }
+
+    /**
+     * Relative improvement over reference: negative values mean that
+     * this result is worse.
+     */
+    double relative_change(const benchmark_result& reference) const
+    {
+        if (reference.median == 0) {
+            return 0;
+        }
+
+        double change = (median - reference.median) / reference.median;
+        return higher_is_better() ? change : -change;
+    }
+
+    static std::string csv_header()
+    {
+        return "revision,date,host,compiler,device,order,family,species,dimensions,unit,repetitions,median,mad,min,max,intensity,percent_of_roofline";
+    }
+
+    std::string to_csv() const
+    {
+        std::stringstream buf;
+        buf.precision(10);
+        buf << quote(revision) << ","
+            << quote(date) << ","
+            << quote(host) << ","
+            << quote(compiler) << ","
+            << quote(device) << ","
+            << quote(order) << ","
+            << quote(family) << ","
+            << quote(species) << ","
+            << quote(format_dimensions()) << ","
+            << quote(unit) << ","
+            << repetitions << ","
+            << median << ","
+            << mad << ","
+            << min << ","
+            << max << ","
+            << optional(intensity) << ","
+            << optional(percent_of_roofline);
+
+        return buf.str();
+    }
+
+    static benchmark_result from_csv(const std::string& line)
+    {
+        std::vector<std::string> fields = split_csv(line);
+        // results written prior to the roofline analysis lack the last two fields:
+        if ((fields.size() != 15) && (fields.size() != 17)) {
+            throw std::invalid_argument("malformed benchmark result: " + line);
+        }
+
+        benchmark_result ret;
+        ret.revision = fields[0];
+        ret.date = fields[1];
+        ret.host = fields[2];
+        ret.compiler = fields[3];
+        ret.device = fields[4];
+        ret.order = fields[5];
+        ret.family = fields[6];
+        ret.species = fields[7];
+        ret.dimensions = parse_dimensions(fields[8]);
+        ret.unit = fields[9];
+        ret.repetitions = parse<std::size_t>(fields[10]);
+        ret.median = parse<double>(fields[11]);
+        ret.mad = parse<double>(fields[12]);
+        ret.min = parse<double>(fields[13]);
+        ret.max = parse<double>(fields[14]);
+        if (fields.size() == 17) {
+            ret.intensity = fields[15].empty() ? 0 : parse<double>(fields[15]);
+            ret.percent_of_roofline = fields[16].empty() ? 0 : parse<double>(fields[16]);
+        }
+
+        return ret;
+    }
+
+    std::string to_json() const
+    {
+        std::stringstream buf;
+        buf.precision(10);
+        buf << "{\"revision\": " << escape(revision)
+            << ", \"date\": " << escape(date)
+            << ", \"host\": " << escape(host)
+            << ", \"compiler\": " << escape(compiler)
+            << ", \"device\": " << escape(device)
+            << ", \"order\": " << escape(order)
+            << ", \"family\": " << escape(family)
+            << ", \"species\": " << escape(species)
+            << ", \"dimensions\": [";
+        for (std::size_t i = 0; i < dimensions.size(); ++i) {
+            buf << (i ? ", " : "") << dimensions[i];
+        }
+        buf << "], \"unit\": " << escape(unit)
+            << ", \"repetitions\": " << repetitions
+            << ", \"median\": " << median
+            << ", \"mad\": " << mad
+            << ", \"min\": " << min
+            << ", \"max\": " << max
+            << ", \"intensity\": " << (intensity ? optional(intensity) : "null")
+            << ", \"percent_of_roofline\": " << (percent_of_roofline ? optional(percent_of_roofline) : "null")
+            << "}";
+
+        return buf.str();
+    }
+
+    std::string revision;
+    std::string date;
+    std::string host;
+    std::string compiler;
+    std::string device;
+    std::string order;
+    std::string family;
+    std::string species;
+    std::vector<int> dimensions;
+    std::string unit;
+    std::size_t repetitions;
+    double median;
+    double mad;
+    double min;
+    double max;
+    // flops per byte, 0 if unknown
+    double intensity;
+    // percentage of the attainable performance according to the roofline model, 0 if unknown
+    double percent_of_roofline;
+
+private:
+    static std::string optional(double value)
+    {
+        if (value == 0) {
+            return "";
+        }
+
+        std::stringstream buf;
+        buf.precision(10);
+        buf << value;
+        return buf.str();
+    }
+
+    static double median_of(std::vector<double> values)
+    {
+        std::size_t half = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + half, values.end());
+        double upper = values[half];
+        if (values.size() % 2) {
+            return upper;
+        }
+
+        double lower = *std::max_element(values.begin(), values.begin() + half);
+        return (lower + upper) * 0.5;
+    }
+
+    static bool ends_with(const std::string& string, const std::string& suffix)
+    {
+        return (string.size() >= suffix.size()) &&
+            (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0);
+    }
+
+    template<typename T>
+    static T parse(const std::string& string)
+    {
+        std::stringstream buf(string);
+        T ret;
+        buf >> ret;
+        if (buf.fail()) {
+            throw std::invalid_argument("could not parse " + string);
+        }
+
+        return ret;
+    }
+
+    std::string format_dimensions() const
+    {
+        std::stringstream buf;
+        for (std::size_t i = 0; i < dimensions.size(); ++i) {
+            buf << (i ? "x" : "") << dimensions[i];
+        }
+
+        return buf.str();
+    }
+
+    static std::vector<int> parse_dimensions(const std::string& string)
+    {
+        std::vector<int> ret;
+        std::stringstream buf(string);
+        std::string token;
+        while (std::getline(buf, token, 'x')) {
+            ret.push_back(parse<int>(token));
+        }
+
+        return ret;
+    }
+
+    static std::string quote(const std::string& string)
+    {
+        std::string ret = "\"";
+        for (std::string::const_iterator i = string.begin(); i != string.end(); ++i) {
+            if (*i == '"') {
+                ret += '"';
+            }
+            ret += *i;
+        }
+
+        return ret + "\"";
+    }
+
+    /**
+     * Reverses quote(), fields may or may not be quoted.
+     */
+    static std::vector<std::string> split_csv(const std::string& line)
+    {
+        std::vector<std::string> ret(1);
+        bool quoted = false;
+
+        for (std::size_t i = 0; i < line.size(); ++i) {
+            char c = line[i];
+
+            if (quoted) {
+                if ((c == '"') && (i + 1 < line.size()) && (line[i + 1] == '"')) {
+                    ret.back() += c;
+                    ++i;
+                } else if (c == '"') {
+                    quoted = false;
+                } else {
+                    ret.back() += c;
+                }
+                continue;
+            }
+
+            if (c == '"') {
+                quoted = true;
+            } else if (c == ',') {
+                ret.push_back("");
+            } else if (c != '\r') {
+                ret.back() += c;
+            }
+        }
+
+        return ret;
+    }
+
+    static std::string escape(const std::string& string)
+    {
+        std::string ret = "\"";
+        for (std::string::const_iterator i = string.begin(); i != string.end(); ++i) {
+            unsigned char c = *i;
+            if ((c == '"') || (c == '\\')) {
+                ret += '\\';
+                ret += c;
+            } else if (c < 0x20) {
+                char buf[8];
+                std::sprintf(buf, "\\u%04x", c);
+                ret += buf;
+            } else {
+                ret += c;
+            }
+        }
+
+        return ret + "\"";
+    }
+};
+
+}
+
+#endif
@@ -8,27 +8,185 @@
 #ifndef FLAT_ARRAY_TESTBED_EVALUATE_HPP
 #define FLAT_ARRAY_TESTBED_EVALUATE_HPP
 
+#include <libflatarray/config.h>
 #include <libflatarray/testbed/benchmark.hpp>
+#include <libflatarray/testbed/benchmark_result.hpp>
+#include <libflatarray/testbed/roofline.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+#ifdef LIBFLATARRAY_WITH_CPP14
+#include <regex>
+#endif
 
 namespace LibFlatArray {
 
+/**
+ * Runs benchmarks and reports their performance, either as a
+ * human-readable table ("text", the default), as CSV or as JSON
+ * Lines (one object per benchmark). Each benchmark may be repeated,
+ * in which case the median and the median absolute deviation (MAD)
+ * are reported.
+ *
+ * Results can be compared against a baseline, i.e. the CSV output
+ * of a previous run: finish() lists all benchmarks whose median
+ * deteriorated by more than the given threshold.
+ *
+ * For CPU benchmarks which declare their flops and bytes per update,
+ * the arithmetic intensity and the percentage of the performance
+ * attainable according to the roofline model are reported, too. The
+ * machine's ceilings are measured once, when the first such benchmark
+ * is run. As the bandwidth ceiling refers to main memory, problems
+ * which fit into the caches may exceed 100%.
+ */
 class evaluate
 {
 public:
-    evaluate(const std::string& name, const std::string& revision) :
+    evaluate(const std::string& name = "", const std::string& revision = "") :
         name(name),
-        revision(revision)
+        revision(revision),
+        format("text"),
+        repetitions(1),
+        threshold(0.05),
+        device_id(0),
+        roofline_enabled(true)
     {}
 
+    static std::string usage(const std::string& program)
+    {
+        std::stringstream buf;
+        buf << "usage: " << program << " [OPTIONS] REVISION CUDA_DEVICE\n"
+            << "  - REVISION is purely for output reasons,\n"
+            << "  - CUDA_DEVICE causes CUDA tests to run on the device with the given ID.\n"
+            << "options:\n"
+            << "  -n,--name SUBSTRING    only run tests whose family contains SUBSTRING\n"
+            << "  --family REGEX         only run tests whose family matches REGEX\n"
+            << "  --species REGEX        only run tests whose species matches REGEX\n"
+            << "  --format FORMAT        text (default), csv or json\n"
+            << "  --repetitions N        run each test N times, report median and MAD\n"
+            << "  --baseline FILE        compare against FILE (CSV output of a previous run)\n"
+            << "  --threshold PERCENT    flag regressions beyond PERCENT (default: 5)\n"
+            << "  --no-roofline          skip measuring the machine's roofline\n";
+        return buf.str();
+    }
+
+    /**
+     * Parses the command line shared by our performance tests.
+     * Prints the usage and returns false if the arguments are
+     * invalid.
+     */
+    bool parse_arguments(int argc, char **argv)
+    {
+        std::vector<std::string> positional;
+
+        try {
+            for (int i = 1; i < argc; ++i) {
+                std::string arg = argv[i];
+                if ((arg.size() < 2) || (arg[0] != '-')) {
+                    positional.push_back(arg);
+                    continue;
+                }
+                if (arg == "--no-roofline") {
+                    roofline_enabled = false;
+                    continue;
+                }
+
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("missing value for " + arg);
+                }
+                std::string value = argv[++i];
+
+                if ((arg == "-n") || (arg == "--name")) {
+                    name = value;
+                } else if (arg == "--family") {
+                    family_pattern = value;
+                } else if (arg == "--species") {
+                    species_pattern = value;
+                } else if (arg == "--format") {
+                    if ((value != "text") && (value != "csv") && (value != "json")) {
+                        throw std::invalid_argument("unknown format " + value);
+                    }
+                    format = value;
+                } else if (arg == "--repetitions") {
+                    repetitions = parse<int>(value);
+                    if (repetitions < 1) {
+                        throw std::invalid_argument("repetitions need to be positive");
+                    }
+                } else if (arg == "--baseline") {
+                    read_baseline(value);
+                } else if (arg == "--threshold") {
+                    threshold = parse<double>(value) * 0.01;
+                } else {
+                    throw std::invalid_argument("unknown option " + arg);
+                }
+            }
+
+            if (positional.size() != 2) {
+                throw std::invalid_argument("expected REVISION and CUDA_DEVICE");
+            }
+            revision = positional[0];
+            device_id = parse<int>(positional[1]);
+
+            // fail early on malformed regular expressions:
+            matches(family_pattern, "");
+            matches(species_pattern, "");
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n" << usage(argv[0]);
+            return false;
+        }
+
+        return true;
+    }
+
+    int cuda_device() const
+    {
+        return device_id;
+    }
+
+    const std::string& get_name() const
+    {
+        return name;
+    }
+
+    const std::string& get_revision() const
+    {
+        return revision;
+    }
+
     void print_header()
     {
-        std::cout << "#rev              ; date                 ; host                            ; device                                          ; order   ; family                          ; species ; dimensions              ; perf        ; unit" << std::endl;
+        if (format == "text") {
+            std::cout << "#rev              ; date                 ; host                            ; device                                          ; order   ; family                          ; species ; dimensions              ; perf        ; unit     ; flop/byte ; roofline" << std::endl;
+        }
+        if (format == "csv") {
+            std::cout << benchmark_result::csv_header() << std::endl;
+        }
+    }
+
+    /**
+     * Lets callers skip expensive setup for benchmarks which would be
+     * filtered out anyway.
+     */
+    bool selects_family(const std::string& family) const
+    {
+        return
+            (family.find(name, 0) != std::string::npos) &&
+            matches(family_pattern, family);
     }
 
     template<class BENCHMARK>
     void operator()(BENCHMARK benchmark, std::vector<int> dim, bool output = true)
     {
-        if (benchmark.family().find(name, 0) == std::string::npos) {
+        if (!selects_family(benchmark.family()) ||
+            !matches(species_pattern, benchmark.species())) {
             return;
         }
 
@@ -38,15 +196,45 @@ public:
         std::string now_string = buf.str();
         now_string.resize(20);
 
-        std::string device = benchmark.device();
+        benchmark_result result;
+        result.revision = revision;
+        result.date = now_string;
+        result.host = hostname();
+        result.compiler = compiler();
+        result.device = benchmark.device();
+        result.order = benchmark.order();
+        result.family = benchmark.family();
+        result.species = benchmark.species();
+        result.dimensions = dim;
+        result.unit = benchmark.unit();
 
-        int hostname_length = 2048;
-        std::string hostname(hostname_length, ' ');
-        gethostname(&hostname[0], hostname_length);
-        // cuts string at first 0 byte, required as gethostname returns 0-terminated strings
-        hostname = std::string(hostname.c_str());
+        std::vector<double> samples;
+        for (int i = 0; i < repetitions; ++i) {
+            samples.push_back(benchmark.performance(dim));
+        }
+        result.set_samples(samples);
+
+        double flops = benchmark.flops_per_update();
+        double bytes = benchmark.bytes_per_update();
+        if (roofline_enabled && (result.order == "CPU") && (flops > 0) && (bytes > 0)) {
+            const roofline& machine = get_roofline(benchmark.multithreaded(), output);
+            result.intensity = flops / bytes;
+            result.percent_of_roofline = 100 * result.median * flops / machine.attainable(result.intensity);
+        }
+        results.push_back(result);
+
+        if (!output) {
+            return;
+        }
 
-        double performance = benchmark.performance(dim);
+        if (format == "csv") {
+            std::cout << result.to_csv() << std::endl;
+            return;
+        }
+        if (format == "json") {
+            std::cout << result.to_json() << std::endl;
+            return;
+        }
 
         std::ostringstream pretty_dim;
         pretty_dim << "(" << dim[0];
@@ -55,24 +243,174 @@ public:
         }
         pretty_dim << ")";
 
+        std::cout << std::setiosflags(std::ios::left);
+        std::cout << std::setw(18) << revision << "; "
+                  << now_string << " ; "
+                  << std::setw(32) << result.host << "; "
+                  << std::setw(48) << result.device << "; "
+                  << std::setw( 8) << result.order <<  "; "
+                  << std::setw(32) << result.family <<  "; "
+                  << std::setw( 8) << result.species <<  "; "
+                  << std::setw(24) << pretty_dim.str() <<  "; "
+                  << std::setw(12) << result.median <<  "; "
+                  << std::setw( 8) << result.unit;
+        if (result.intensity > 0) {
+            std::cout << " ; " << std::setw(9) << result.intensity
+                      << " ; " << std::fixed << std::setprecision(1) << result.percent_of_roofline << "%";
+            std::cout.unsetf(std::ios::fixed);
+            std::cout << std::setprecision(6);
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * Compares all results gathered so far with the baseline (if
+     * any). Regressions are reported on stderr so stdout stays
+     * machine-readable. Returns the number of regressions.
+     */
+    int finish(bool output = true)
+    {
+        int regressions = 0;
+        if (baseline.empty()) {
+            return regressions;
+        }
+
+        for (std::vector<benchmark_result>::iterator i = results.begin(); i != results.end(); ++i) {
+            std::map<std::string, benchmark_result>::iterator reference = baseline.find(i->key());
+            if (reference == baseline.end()) {
+                continue;
+            }
+
+            double change = i->relative_change(reference->second);
+            if (change >= -threshold) {
+                continue;
+            }
+
+            ++regressions;
+            if (output) {
+                std::cerr << "REGRESSION: " << i->key() << ": "
+                          << reference->second.median << " -> " << i->median << " " << i->unit
+                          << " (" << std::fixed << std::setprecision(1) << (change * 100) << "%, MAD "
+                          << std::setprecision(3) << i->mad << ")" << std::endl;
+                std::cerr.unsetf(std::ios::fixed);
+            }
+        }
+
         if (output) {
-            std::cout << std::setiosflags(std::ios::left);
-            std::cout << std::setw(18) << revision << "; "
-                      << now_string << " ; "
-                      << std::setw(32) << hostname << "; "
-                      << std::setw(48) << device << "; "
-                      << std::setw( 8) << benchmark.order() <<  "; "
-                      << std::setw(32) << benchmark.family() <<  "; "
-                      << std::setw( 8) << benchmark.species() <<  "; "
-                      << std::setw(24) << pretty_dim.str() <<  "; "
-                      << std::setw(12) << performance <<  "; "
-                      << std::setw( 8) << benchmark.unit() << std::endl;
+            std::cerr << regressions << " regression(s) beyond "
+                      << (threshold * 100) << "% in " << results.size() << " test(s)" << std::endl;
         }
+
+        return regressions;
+    }
+
+    const std::vector<benchmark_result>& get_results() const
+    {
+        return results;
     }
 
 private:
     std::string name;
     std::string revision;
+    std::string family_pattern;
+    std::string species_pattern;
+    std::string format;
+    int repetitions;
+    double threshold;
+    int device_id;
+    bool roofline_enabled;
+    roofline single_threaded;
+    roofline multi_threaded;
+    std::map<std::string, benchmark_result> baseline;
+    std::vector<benchmark_result> results;
+
+    const roofline& get_roofline(bool multithreaded, bool output)
+    {
+        roofline& ret = multithreaded ? multi_threaded : single_threaded;
+        if (ret.threads == 0) {
+            ret = roofline::measure(multithreaded ? roofline::max_threads() : 1);
+            if (output) {
+                std::cerr << "# " << ret.to_string() << std::endl;
+            }
+        }
+
+        return ret;
+    }
+
+    template<typename T>
+    static T parse(const std::string& string)
+    {
+        std::stringstream buf(string);
+        T ret;
+        buf >> ret;
+        if (buf.fail() || !buf.eof()) {
+            throw std::invalid_argument("could not parse " + string);
+        }
+
+        return ret;
+    }
+
+    /**
+     * Falls back to substring matching if std::regex is unavailable.
+     */
+    static bool matches(const std::string& pattern, const std::string& string)
+    {
+        if (pattern.empty()) {
+            return true;
+        }
+
+#ifdef LIBFLATARRAY_WITH_CPP14
+        return std::regex_search(string, std::regex(pattern));
+#else
+        return string.find(pattern) != std::string::npos;
+#endif
+    }
+
+    void read_baseline(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        if (!file) {
+            throw std::invalid_argument("could not open baseline " + filename);
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || (line == benchmark_result::csv_header())) {
+                continue;
+            }
+
+            benchmark_result result = benchmark_result::from_csv(line);
+            baseline[result.key()] = result;
+        }
+    }
+
+    static std::string hostname()
+    {
+        int hostname_length = 2048;
+        std::string hostname(hostname_length, ' ');
+        gethostname(&hostname[0], hostname_length);
+        // cuts string at first 0 byte, required as gethostname returns 0-terminated strings
+        return std::string(hostname.c_str());
+    }
+
+    static std::string compiler()
+    {
+#if defined(__INTEL_COMPILER)
+        std::stringstream buf;
+        buf << "icc " << __INTEL_COMPILER;
+        return buf.str();
+#elif defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "g++ " __VERSION__;
+#elif defined(_MSC_VER)
+        std::stringstream buf;
+        buf << "msvc " << _MSC_VER;
+        return buf.str();
+#else
+        return "unknown";
+#endif
+    }
 };
 
 }
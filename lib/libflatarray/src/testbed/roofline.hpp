@@ -0,0 +1,214 @@
+/**
+ * Copyright 2014 Andreas Schäfer
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef FLAT_ARRAY_TESTBED_ROOFLINE_HPP
+#define FLAT_ARRAY_TESTBED_ROOFLINE_HPP
+
+#include <libflatarray/short_vec.hpp>
+#include <libflatarray/testbed/benchmark.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace LibFlatArray {
+
+/**
+ * Machine model for roofline analysis: the attainable performance
+ * of a kernel with a given arithmetic intensity (flops per byte of
+ * memory traffic) is bounded by the peak floating point performance
+ * and by the memory bandwidth times the intensity.
+ *
+ * The ceilings are measured with STREAM-like copy and triad kernels
+ * and a micro-kernel of independent short_vec FMAs. Following STREAM,
+ * traffic caused by write-allocates is not counted.
+ */
+class roofline
+{
+public:
+    roofline() :
+        copy_bandwidth(0),
+        triad_bandwidth(0),
+        peak_gflops(0),
+        threads(0)
+    {}
+
+    /**
+     * Number of threads available for multi-threaded kernels.
+     */
+    static int max_threads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * Measures all ceilings with the given number of threads.
+     * elements should be large enough to make the arrays exceed the
+     * last level cache by far. Reports the best of repeats runs.
+     */
+    static roofline measure(int threads, long elements = 1 << 24, int repeats = 5)
+    {
+        roofline ret;
+        ret.threads = threads;
+
+        double *a = new double[elements];
+        double *b = new double[elements];
+        double *c = new double[elements];
+
+        // first touch by the same threads which use the data later on:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+        for (long i = 0; i < elements; ++i) {
+            a[i] = 0;
+            b[i] = 1;
+            c[i] = 2;
+        }
+
+        for (int r = 0; r < repeats; ++r) {
+            double start = benchmark::time();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+            for (long i = 0; i < elements; ++i) {
+                a[i] = b[i];
+            }
+            double seconds = benchmark::time() - start;
+            ret.copy_bandwidth = (std::max)(ret.copy_bandwidth, 1e-9 * 16 * elements / seconds);
+
+            start = benchmark::time();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(threads)
+#endif
+            for (long i = 0; i < elements; ++i) {
+                a[i] = b[i] + 3.0 * c[i];
+            }
+            seconds = benchmark::time() - start;
+            ret.triad_bandwidth = (std::max)(ret.triad_bandwidth, 1e-9 * 24 * elements / seconds);
+
+            ret.peak_gflops = (std::max)(ret.peak_gflops, measure_peak(threads));
+        }
+
+        if (a[elements / 2] == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        delete[] a;
+        delete[] b;
+        delete[] c;
+
+        return ret;
+    }
+
+    /**
+     * Upper bound for the performance (in GFLOP/s) of a kernel with
+     * the given arithmetic intensity. The triad is the better model
+     * for stencil codes as these read and write in parallel streams.
+     */
+    double attainable(double intensity) const
+    {
+        return (std::min)(peak_gflops, triad_bandwidth * intensity);
+    }
+
+    std::string to_string() const
+    {
+        std::stringstream buf;
+        buf << "roofline (" << threads << " thread(s)): "
+            << "copy " << copy_bandwidth << " GB/s, "
+            << "triad " << triad_bandwidth << " GB/s, "
+            << "peak " << peak_gflops << " GFLOP/s";
+        return buf.str();
+    }
+
+    double copy_bandwidth;
+    double triad_bandwidth;
+    double peak_gflops;
+    int threads;
+
+private:
+    typedef short_vec<double, 4> double_vec;
+
+    /**
+     * Runs enough independent FMAs per thread to hide their latency.
+     * The values converge to a fixed point, so neither overflows nor
+     * denormals get in the way.
+     *
+     * A double_vec occupies one AVX, two SSE or four scalar
+     * registers. Latency times throughput of the FMA units asks for
+     * about 10 independent chains, but the accumulators and the two
+     * constants have to fit into the 16 registers, or the loop would
+     * measure spills instead.
+     */
+    static double measure_peak(int threads)
+    {
+#if defined(__AVX__)
+        const int accumulators = 10;
+#elif defined(__SSE__)
+        const int accumulators = 6;
+#else
+        const int accumulators = 3;
+#endif
+        const long iterations = 1 << 22;
+        double sum = 0;
+
+        double start = benchmark::time();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads) reduction(+:sum)
+#endif
+        {
+            // distinct start values for all lanes, so that the
+            // compiler can't merge chains which would be identical:
+            double_vec acc[accumulators];
+            double buf[double_vec::ARITY];
+            for (int i = 0; i < accumulators; ++i) {
+                for (int j = 0; j < double_vec::ARITY; ++j) {
+                    buf[j] = 1.0 + 0.001 * (i * double_vec::ARITY + j);
+                }
+                acc[i].load(buf);
+            }
+            double_vec mul = 0.999999;
+            double_vec add = 0.000001;
+
+            for (long t = 0; t < iterations; ++t) {
+                for (int i = 0; i < accumulators; ++i) {
+                    acc[i] = fma(acc[i], mul, add);
+                }
+            }
+
+            // all lanes need to be consumed, or the compiler might
+            // drop those we don't look at:
+            for (int i = 0; i < accumulators; ++i) {
+                acc[i].store(buf);
+                for (int j = 0; j < double_vec::ARITY; ++j) {
+                    sum += buf[j];
+                }
+            }
+        }
+        double seconds = benchmark::time() - start;
+
+        if (sum == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        double flops = 2.0 * double_vec::ARITY * accumulators * iterations * threads;
+        return 1e-9 * flops / seconds;
+    }
+};
+
+}
+
+#endif
@@ -8,6 +8,7 @@
  */
 
 #include <libflatarray/config.h>
+#include <algorithm>
 #include <libflatarray/aligned_allocator.hpp>
 #include <cmath>
 #include <boost/detail/lightweight_test.hpp>
@@ -19,6 +20,11 @@
 #include <vector>
 #include <cstring>
 
+#ifdef __unix__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "test.hpp"
 
 namespace LibFlatArray {
@@ -668,6 +674,148 @@ void testImplementationInt()
     }
 }
 
+template<typename CARGO, int ARITY>
+void testImplementationMasks()
+{
+    typedef short_vec<CARGO, ARITY> ShortVec;
+
+    CARGO bufA[ARITY];
+    CARGO bufB[ARITY];
+    for (int i = 0; i < ARITY; ++i) {
+        bufA[i] = i;
+        bufB[i] = ARITY - 1 - i;
+    }
+    // make sure we'll see equal elements for odd and even arities:
+    bufB[0] = 0;
+
+    ShortVec a(bufA);
+    ShortVec b(bufB);
+    ShortVec zero(CARGO(0));
+    ShortVec one(CARGO(1));
+    CARGO actual[ARITY];
+
+    // test comparisons
+    actual << blend(zero, one, a < b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] < bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    actual << blend(zero, one, a <= b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] <= bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    actual << blend(zero, one, a > b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] > bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    actual << blend(zero, one, a >= b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] >= bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    actual << blend(zero, one, a == b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] == bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    actual << blend(zero, one, a != b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] != bufB[i]) ? 1 : 0, actual[i]);
+    }
+
+    // test comparison with scalars
+    actual << blend(zero, one, a < CARGO(ARITY / 2));
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((i < (ARITY / 2)) ? 1 : 0, actual[i]);
+    }
+
+    // test min/max
+    actual << min(a, b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ(std::min(bufA[i], bufB[i]), actual[i]);
+    }
+
+    actual << max(a, b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ(std::max(bufA[i], bufB[i]), actual[i]);
+    }
+
+    // test fused multiply-add
+    actual << fma(a, b, one);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ(bufA[i] * bufB[i] + 1, actual[i]);
+    }
+
+    // test masked store
+    for (int i = 0; i < ARITY; ++i) {
+        actual[i] = -1;
+    }
+    masked_store(actual, a, a > b);
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] > bufB[i]) ? bufA[i] : -1, actual[i]);
+    }
+
+    // test typical branch elimination: x = (x > threshold) ? x * 2 : x
+    ShortVec x = a;
+    x = blend(x, x * CARGO(2), x > CARGO(2));
+    actual << x;
+    for (int i = 0; i < ARITY; ++i) {
+        BOOST_TEST_EQ((bufA[i] > 2) ? (bufA[i] * 2) : bufA[i], actual[i]);
+    }
+}
+
+/**
+ * Masked stores must neither read nor write unselected lanes: on loop
+ * tails these may lie beyond the end of the buffer or be owned by
+ * other threads.
+ */
+template<typename CARGO, int ARITY>
+void testMaskedStoreTail()
+{
+    typedef short_vec<CARGO, ARITY> ShortVec;
+
+    CARGO indices[ARITY];
+    for (int i = 0; i < ARITY; ++i) {
+        indices[i] = i;
+    }
+    ShortVec index(indices);
+    ShortVec value(CARGO(7));
+
+    // sentinels around the target need to remain untouched:
+    for (int tail = 0; tail <= ARITY; ++tail) {
+        CARGO buf[3 * ARITY];
+        std::fill(buf, buf + 3 * ARITY, CARGO(-1));
+        masked_store(buf + ARITY, value, index < CARGO(tail));
+
+        for (int i = 0; i < 3 * ARITY; ++i) {
+            bool selected = (i >= ARITY) && (i < (ARITY + tail));
+            BOOST_TEST_EQ(selected ? CARGO(7) : CARGO(-1), buf[i]);
+        }
+    }
+
+#ifdef __unix__
+    // unselected lanes on a guard page must not trigger a segfault:
+    long pageSize = sysconf(_SC_PAGESIZE);
+    char *pages = static_cast<char*>(
+        mmap(0, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    BOOST_TEST(pages != MAP_FAILED);
+    BOOST_TEST_EQ(0, mprotect(pages + pageSize, pageSize, PROT_NONE));
+
+    for (int tail = 0; tail < ARITY; ++tail) {
+        CARGO *data = reinterpret_cast<CARGO*>(pages + pageSize) - tail;
+        masked_store(data, value, index < CARGO(tail));
+
+        for (int i = 0; i < tail; ++i) {
+            BOOST_TEST_EQ(CARGO(7), data[i]);
+        }
+    }
+
+    munmap(pages, 2 * pageSize);
+#endif
+}
+
 ADD_TEST(TestBasic)
 {
     testImplementationReal<double, 1>();
@@ -692,6 +840,51 @@ ADD_TEST(TestBasic)
     testImplementationInt<int, 32>();
 }
 
+ADD_TEST(TestMasks)
+{
+    testImplementationMasks<double, 1>();
+    testImplementationMasks<double, 2>();
+    testImplementationMasks<double, 4>();
+    testImplementationMasks<double, 8>();
+    testImplementationMasks<double, 16>();
+    testImplementationMasks<double, 32>();
+
+    testImplementationMasks<float, 1>();
+    testImplementationMasks<float, 2>();
+    testImplementationMasks<float, 4>();
+    testImplementationMasks<float, 8>();
+    testImplementationMasks<float, 16>();
+    testImplementationMasks<float, 32>();
+
+    testImplementationMasks<int, 1>();
+    testImplementationMasks<int, 2>();
+    testImplementationMasks<int, 4>();
+    testImplementationMasks<int, 8>();
+    testImplementationMasks<int, 16>();
+    testImplementationMasks<int, 32>();
+
+    testMaskedStoreTail<double, 1>();
+    testMaskedStoreTail<double, 2>();
+    testMaskedStoreTail<double, 4>();
+    testMaskedStoreTail<double, 8>();
+    testMaskedStoreTail<double, 16>();
+    testMaskedStoreTail<double, 32>();
+
+    testMaskedStoreTail<float, 1>();
+    testMaskedStoreTail<float, 2>();
+    testMaskedStoreTail<float, 4>();
+    testMaskedStoreTail<float, 8>();
+    testMaskedStoreTail<float, 16>();
+    testMaskedStoreTail<float, 32>();
+
+    testMaskedStoreTail<int, 1>();
+    testMaskedStoreTail<int, 2>();
+    testMaskedStoreTail<int, 4>();
+    testMaskedStoreTail<int, 8>();
+    testMaskedStoreTail<int, 16>();
+    testMaskedStoreTail<int, 32>();
+}
+
 template<typename STRATEGY>
 void checkForStrategy(STRATEGY, STRATEGY)
 {}
@@ -0,0 +1,18 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hpxreceiver.cpp
+  ${RELATIVE_PATH}hpxserialization.cpp
+  ${RELATIVE_PATH}typemaps.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}boostserialization.h
+  ${RELATIVE_PATH}hpxcomponentregsitrationhelper.h
+  ${RELATIVE_PATH}hpxpatchlink.h
+  ${RELATIVE_PATH}hpxreceiver.h
+  ${RELATIVE_PATH}hpxserialization.h
+  ${RELATIVE_PATH}hpxserializationwrapper.h
+  ${RELATIVE_PATH}mpilayer.h
+  ${RELATIVE_PATH}patchlink.h
+  ${RELATIVE_PATH}serializationhelpers.h
+  ${RELATIVE_PATH}threadpatchlink.h
+  ${RELATIVE_PATH}typemaps.h
+)
@@ -27,6 +27,7 @@ public:
     inline
     static void serialize(ARCHIVE& archive, LibGeoDecomp::Chronometer& object, const unsigned /*version*/)
     {
+        archive & object.totalCounters;
         archive & object.totalTimes;
     }
 
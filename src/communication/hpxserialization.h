@@ -28,6 +28,7 @@ public:
     inline
     static void serialize(ARCHIVE& archive, LibGeoDecomp::Chronometer& object, const unsigned /*version*/)
     {
+        archive & object.totalCounters;
         archive & object.totalTimes;
     }
 
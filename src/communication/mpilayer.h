@@ -116,6 +116,37 @@ public:
         requests[tag].push_back(req);
     }
 
+    /**
+     * Blocks until a message from src arrives and receives it into
+     * buffer, which is resized to fit, so the sender doesn't need to
+     * announce the size in a separate message. The matched probe
+     * (MPI 3) guarantees that no other receive can steal the message
+     * between probing and receiving.
+     */
+    template<typename T>
+    inline void recvUnknownSize(
+        std::vector<T> *buffer,
+        int src,
+        int tag,
+        const MPI_Datatype& datatype = Typemaps::lookup<T>())
+    {
+        MPI_Status status;
+        int count;
+
+#if MPI_VERSION >= 3
+        MPI_Message message;
+        MPI_Mprobe(src, tag, comm, &message, &status);
+        MPI_Get_count(&status, datatype, &count);
+        buffer->resize(count);
+        MPI_Mrecv(count ? &(*buffer)[0] : 0, count, datatype, &message, MPI_STATUS_IGNORE);
+#else
+        MPI_Probe(src, tag, comm, &status);
+        MPI_Get_count(&status, datatype, &count);
+        buffer->resize(count);
+        MPI_Recv(count ? &(*buffer)[0] : 0, count, datatype, src, tag, comm, MPI_STATUS_IGNORE);
+#endif
+    }
+
     void cancelAll()
     {
         for (RequestsMap::iterator i = requests.begin();
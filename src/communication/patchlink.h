@@ -136,7 +136,9 @@ public:
 
             wait();
             GridVecConv::gridToVector(grid, &buffer, region);
-            sendHeader(FixedSize());
+            if (buffer.size() > INT_MAX) {
+                throw std::invalid_argument("buffer size exceeds INT_MAX");
+            }
             mpiLayer.send(&buffer[0], dest, buffer.size(), tag, cellMPIDatatype);
 
             std::size_t nextNanoStep = (min)(requestedNanoSteps) + stride;
@@ -150,23 +152,7 @@ public:
 
     private:
         int dest;
-        int dataSize;
         MPI_Datatype cellMPIDatatype;
-
-        void sendHeader(APITraits::TrueType)
-        {
-            // we don't need any header for fixed size buffers
-        }
-
-        void sendHeader(APITraits::FalseType)
-        {
-            if (buffer.size() > INT_MAX) {
-                throw std::invalid_argument("buffer size exceeds INT_MAX");
-            }
-
-            dataSize = buffer.size();
-            mpiLayer.send(&dataSize, dest, 1, tag, MPI_INT);
-        }
     };
 
     class Provider :
@@ -195,7 +181,6 @@ public:
             MPI_Comm communicator = MPI_COMM_WORLD) :
             Link(region, tag, communicator),
             source(source),
-            dataSize(0),
             cellMPIDatatype(cellMPIDatatype),
             transmissionInFlight(false)
         {}
@@ -250,7 +235,6 @@ public:
 
     private:
         int source;
-        int dataSize;
         MPI_Datatype cellMPIDatatype;
         bool transmissionInFlight;
 
@@ -261,10 +245,10 @@ public:
 
         void recvFirstPart(APITraits::FalseType)
         {
-            // fixme: benchmark whether this could be done more
-            // efficiently with MPI_Iprobe (to detect the message
-            // size)
-            mpiLayer.recv(&dataSize, source, 1, tag, MPI_INT);
+            // We can't post a receive without knowing the size of
+            // the payload. Rather than having the sender announce it
+            // in a separate message (which would double the latency)
+            // we pick up the message in recvSecondPart(), sized to fit.
         }
 
         void recvSecondPart(APITraits::TrueType)
@@ -274,9 +258,7 @@ public:
 
         void recvSecondPart(APITraits::FalseType)
         {
-            buffer.resize(dataSize);
-            mpiLayer.recv(&buffer[0], source, dataSize, tag, cellMPIDatatype);
-            wait();
+            mpiLayer.recvUnknownSize(&buffer, source, tag, cellMPIDatatype);
         }
     };
 
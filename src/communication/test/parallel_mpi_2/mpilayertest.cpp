@@ -0,0 +1,128 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelMPILayerTest_init = false;
+#include "/root/repo/src/communication/test/parallel_mpi_2/mpilayertest.h"
+
+static ParallelMPILayerTest suite_ParallelMPILayerTest;
+
+static CxxTest::List Tests_ParallelMPILayerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelMPILayerTest( "/root/repo/src/communication/test/parallel_mpi_2/mpilayertest.h", 13, "ParallelMPILayerTest", suite_ParallelMPILayerTest, Tests_ParallelMPILayerTest );
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGather1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGather1() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 16, "testAllGather1" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGather1(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGather1;
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGather2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGather2() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 27, "testAllGather2" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGather2(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGather2;
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGather3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGather3() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 40, "testAllGather3" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGather3(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGather3;
+
+static class TestDescription_suite_ParallelMPILayerTest_testGather : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testGather() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 52, "testGather" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testGather(); }
+} testDescription_suite_ParallelMPILayerTest_testGather;
+
+static class TestDescription_suite_ParallelMPILayerTest_testBroadcast : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testBroadcast() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 70, "testBroadcast" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testBroadcast(); }
+} testDescription_suite_ParallelMPILayerTest_testBroadcast;
+
+static class TestDescription_suite_ParallelMPILayerTest_testBroadcast2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testBroadcast2() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 82, "testBroadcast2" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testBroadcast2(); }
+} testDescription_suite_ParallelMPILayerTest_testBroadcast2;
+
+static class TestDescription_suite_ParallelMPILayerTest_testBroadcastVector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testBroadcastVector() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 93, "testBroadcastVector" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testBroadcastVector(); }
+} testDescription_suite_ParallelMPILayerTest_testBroadcastVector;
+
+static class TestDescription_suite_ParallelMPILayerTest_testSendRecvCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testSendRecvCell() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 112, "testSendRecvCell" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testSendRecvCell(); }
+} testDescription_suite_ParallelMPILayerTest_testSendRecvCell;
+
+static class TestDescription_suite_ParallelMPILayerTest_testSendRecvFloatCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testSendRecvFloatCoord() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 135, "testSendRecvFloatCoord" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testSendRecvFloatCoord(); }
+} testDescription_suite_ParallelMPILayerTest_testSendRecvFloatCoord;
+
+static class TestDescription_suite_ParallelMPILayerTest_testSendRecvRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testSendRecvRegion() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 151, "testSendRecvRegion" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testSendRecvRegion(); }
+} testDescription_suite_ParallelMPILayerTest_testSendRecvRegion;
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGatherAgain : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGatherAgain() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 168, "testAllGatherAgain" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGatherAgain(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGatherAgain;
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGatherV1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGatherV1() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 179, "testAllGatherV1" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGatherV1(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGatherV1;
+
+static class TestDescription_suite_ParallelMPILayerTest_testAllGatherV2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testAllGatherV2() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 197, "testAllGatherV2" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testAllGatherV2(); }
+} testDescription_suite_ParallelMPILayerTest_testAllGatherV2;
+
+static class TestDescription_suite_ParallelMPILayerTest_testGatherV : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testGatherV() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 214, "testGatherV" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testGatherV(); }
+} testDescription_suite_ParallelMPILayerTest_testGatherV;
+
+static class TestDescription_suite_ParallelMPILayerTest_testRecvUnknownSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testRecvUnknownSize() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 240, "testRecvUnknownSize" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testRecvUnknownSize(); }
+} testDescription_suite_ParallelMPILayerTest_testRecvUnknownSize;
+
+static class TestDescription_suite_ParallelMPILayerTest_testCancel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMPILayerTest_testCancel() : CxxTest::RealTestDescription( Tests_ParallelMPILayerTest, suiteDescription_ParallelMPILayerTest, 264, "testCancel" ) {}
+ void runTest() { suite_ParallelMPILayerTest.testCancel(); }
+} testDescription_suite_ParallelMPILayerTest_testCancel;
+
@@ -237,6 +237,30 @@ public:
         }
     }
 
+    void testRecvUnknownSize()
+    {
+        MPILayer layer;
+        std::vector<int> small;
+        small << 1 << 2 << 3;
+        std::vector<int> large(100000, 47);
+        std::vector<int> empty;
+
+        if (layer.rank() == 0) {
+            layer.send(&small[0], 1, small.size(), 5);
+            layer.send(&large[0], 1, large.size(), 5);
+            layer.send(static_cast<int*>(0), 1, 0, 5);
+            layer.waitAll();
+        } else {
+            std::vector<int> buffer(7, -1);
+            layer.recvUnknownSize(&buffer, 0, 5);
+            TS_ASSERT_EQUALS(small, buffer);
+            layer.recvUnknownSize(&buffer, 0, 5);
+            TS_ASSERT_EQUALS(large, buffer);
+            layer.recvUnknownSize(&buffer, 0, 5);
+            TS_ASSERT_EQUALS(empty, buffer);
+        }
+    }
+
     void testCancel()
     {
         if (MPILayer().rank() == 0) {
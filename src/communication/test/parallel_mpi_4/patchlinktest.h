@@ -34,6 +34,16 @@ public:
     std::vector<int> cargo;
 };
 
+/**
+ * Test model for use with BinaryOutputArchive/BinaryInputArchive
+ */
+class MyBinaryCell : public MyComplicatedCell
+{
+public:
+    class API : public APITraits::HasBinarySerialization
+    {};
+};
+
 class PatchLinkTest : public CxxTest::TestSuite
 {
 public:
@@ -44,8 +54,6 @@ public:
     typedef TestCellSoA TestCellType;
     typedef SoAGrid<TestCellSoA, Topologies::Cube<3>::Topology> GridType2;
 
-    typedef DisplacedGrid<MyComplicatedCell> GridType3;
-
     void setUp()
     {
         mpiLayer.reset(new MPILayer());
@@ -292,6 +300,90 @@ public:
     void testBoostSerialization()
     {
 #ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
+        checkVariableSizeCells<MyComplicatedCell>(2701);
+#endif
+    }
+
+    void testBinarySerialization()
+    {
+        checkVariableSizeCells<MyBinaryCell>(2702);
+    }
+
+    void testVariableSizeStream()
+    {
+        // consecutive patches differ in size, so the receiver has to
+        // resize its buffer for each message:
+        typedef DisplacedGrid<MyBinaryCell> GridType3;
+        Coord<2> dim(10, 5);
+        CoordBox<2> box(Coord<2>(), dim);
+        Region<2> region;
+        region << box;
+
+        int source = (mpiLayer->rank() + mpiLayer->size() - 1) % mpiLayer->size();
+        int dest   = (mpiLayer->rank() + 1) % mpiLayer->size();
+        PatchLink<GridType3>::Accepter accepter(region, dest, 2703, MPI_CHAR);
+        PatchLink<GridType3>::Provider provider(region, source, 2703, MPI_CHAR);
+        accepter.charge(10, 40, 10);
+        provider.charge(10, 40, 10);
+
+        GridType3 sendGrid(box);
+        GridType3 recvGrid(box);
+        for (std::size_t nanoStep = 10; nanoStep < 40; nanoStep += 10) {
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                MyBinaryCell cell;
+                for (std::size_t j = 0; j < (nanoStep / 10 + i->x()); ++j) {
+                    cell.cargo << int(nanoStep + mpiLayer->rank());
+                }
+                sendGrid.set(*i, cell);
+            }
+
+            accepter.put(sendGrid, region, dim, nanoStep, mpiLayer->rank());
+            provider.get(&recvGrid, region, dim, nanoStep, mpiLayer->rank());
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                MyBinaryCell cell = recvGrid.get(*i);
+                TS_ASSERT_EQUALS(cell.cargo.size(), nanoStep / 10 + i->x());
+                TS_ASSERT_EQUALS(cell.cargo.back(), int(nanoStep + source));
+            }
+        }
+
+        accepter.wait();
+    }
+
+private:
+    int tag;
+
+    GridType zeroGrid;
+    GridType sendGrid1;
+    GridType sendGrid2;
+    GridType expected;
+    GridType actual;
+
+    CoordBox<2> boundingBox;
+    Region<2> boundingRegion;
+    Region<2> region1;
+    Region<2> region2;
+
+    boost::shared_ptr<PatchAccepterType> acc;
+    boost::shared_ptr<PatchProviderType> pro;
+    boost::shared_ptr<MPILayer> mpiLayer;
+
+    GridType markGrid(const Region<2>& region, const int& id)
+    {
+        GridType ret = zeroGrid;
+
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            ret[*i] = id + i->y() * 10 + i->x();
+        }
+
+        return ret;
+    }
+
+    template<typename CELL>
+    void checkVariableSizeCells(int mpiTag)
+    {
+        typedef DisplacedGrid<CELL> GridType3;
+
         Coord<2> dim(30, 20);
         CoordBox<2> box(Coord<2>(), dim);
         Region<2> boxRegion;
@@ -301,7 +393,7 @@ public:
         GridType3 recvGrid(box);
 
         for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
-            MyComplicatedCell cell;
+            CELL cell;
             cell.cargo << i->x();
             cell.cargo << i->y();
             cell.cargo << mpiLayer->rank();
@@ -313,24 +405,24 @@ public:
             regions[i] << Streak<2>(Coord<2>(0, i), dim.x());;
         }
 
-        PatchLink<GridType3>::Accepter accepter(
+        typename PatchLink<GridType3>::Accepter accepter(
             regions[mpiLayer->rank()],
             0,
-            2701,
+            mpiTag,
             MPI_CHAR);
         accepter.charge(4, 4, 1);
         accepter.put(sendGrid, boxRegion, dim, 4, mpiLayer->rank());
         accepter.wait();
 
-        std::vector<boost::shared_ptr<PatchLink<GridType3>::Provider> > providers;
+        std::vector<boost::shared_ptr<typename PatchLink<GridType3>::Provider> > providers;
         if (mpiLayer->rank() == 0) {
             for (int i = 0; i < mpiLayer->size(); ++i) {
                 providers.push_back(
-                    boost::shared_ptr<PatchLink<GridType3>::Provider>(
-                        new PatchLink<GridType3>::Provider(
+                    boost::shared_ptr<typename PatchLink<GridType3>::Provider>(
+                        new typename PatchLink<GridType3>::Provider(
                             regions[i],
                             i,
-                            2701,
+                            mpiTag,
                             MPI_CHAR)));
 
                 providers.back()->charge(4, 4, 1);
@@ -341,7 +433,7 @@ public:
             }
 
             for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
-                MyComplicatedCell cell = recvGrid.get(*i);
+                CELL cell = recvGrid.get(*i);
 
                 if (i->y() < mpiLayer->size()) {
                     TS_ASSERT_EQUALS(cell.cargo.size(), std::size_t(3));
@@ -356,36 +448,6 @@ public:
         }
 
         accepter.wait();
-#endif
-    }
-
-private:
-    int tag;
-
-    GridType zeroGrid;
-    GridType sendGrid1;
-    GridType sendGrid2;
-    GridType expected;
-    GridType actual;
-
-    CoordBox<2> boundingBox;
-    Region<2> boundingRegion;
-    Region<2> region1;
-    Region<2> region2;
-
-    boost::shared_ptr<PatchAccepterType> acc;
-    boost::shared_ptr<PatchProviderType> pro;
-    boost::shared_ptr<MPILayer> mpiLayer;
-
-    GridType markGrid(const Region<2>& region, const int& id)
-    {
-        GridType ret = zeroGrid;
-
-        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
-            ret[*i] = id + i->y() * 10 + i->x();
-        }
-
-        return ret;
     }
 
     int genTag(int from, int to) {
@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ThreadPatchLinkTest_init = false;
+#include "/root/repo/src/communication/test/unit/threadpatchlinktest.h"
+
+static ThreadPatchLinkTest suite_ThreadPatchLinkTest;
+
+static CxxTest::List Tests_ThreadPatchLinkTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThreadPatchLinkTest( "/root/repo/src/communication/test/unit/threadpatchlinktest.h", 15, "ThreadPatchLinkTest", suite_ThreadPatchLinkTest, Tests_ThreadPatchLinkTest );
+
+static class TestDescription_suite_ThreadPatchLinkTest_testChannelPreservesOrderAcrossThreads : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPatchLinkTest_testChannelPreservesOrderAcrossThreads() : CxxTest::RealTestDescription( Tests_ThreadPatchLinkTest, suiteDescription_ThreadPatchLinkTest, 38, "testChannelPreservesOrderAcrossThreads" ) {}
+ void runTest() { suite_ThreadPatchLinkTest.testChannelPreservesOrderAcrossThreads(); }
+} testDescription_suite_ThreadPatchLinkTest_testChannelPreservesOrderAcrossThreads;
+
+static class TestDescription_suite_ThreadPatchLinkTest_testChannelRejectsUnexpectedNanoStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPatchLinkTest_testChannelRejectsUnexpectedNanoStep() : CxxTest::RealTestDescription( Tests_ThreadPatchLinkTest, suiteDescription_ThreadPatchLinkTest, 57, "testChannelRejectsUnexpectedNanoStep" ) {}
+ void runTest() { suite_ThreadPatchLinkTest.testChannelRejectsUnexpectedNanoStep(); }
+} testDescription_suite_ThreadPatchLinkTest_testChannelRejectsUnexpectedNanoStep;
+
+static class TestDescription_suite_ThreadPatchLinkTest_testCancelReleasesBlockedThreads : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPatchLinkTest_testCancelReleasesBlockedThreads() : CxxTest::RealTestDescription( Tests_ThreadPatchLinkTest, suiteDescription_ThreadPatchLinkTest, 69, "testCancelReleasesBlockedThreads" ) {}
+ void runTest() { suite_ThreadPatchLinkTest.testCancelReleasesBlockedThreads(); }
+} testDescription_suite_ThreadPatchLinkTest_testCancelReleasesBlockedThreads;
+
+static class TestDescription_suite_ThreadPatchLinkTest_testRegistrySharesChannelsPerDirection : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPatchLinkTest_testRegistrySharesChannelsPerDirection() : CxxTest::RealTestDescription( Tests_ThreadPatchLinkTest, suiteDescription_ThreadPatchLinkTest, 100, "testRegistrySharesChannelsPerDirection" ) {}
+ void runTest() { suite_ThreadPatchLinkTest.testRegistrySharesChannelsPerDirection(); }
+} testDescription_suite_ThreadPatchLinkTest_testRegistrySharesChannelsPerDirection;
+
+static class TestDescription_suite_ThreadPatchLinkTest_testAccepterAndProvider : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPatchLinkTest_testAccepterAndProvider() : CxxTest::RealTestDescription( Tests_ThreadPatchLinkTest, suiteDescription_ThreadPatchLinkTest, 112, "testAccepterAndProvider" ) {}
+ void runTest() { suite_ThreadPatchLinkTest.testAccepterAndProvider(); }
+} testDescription_suite_ThreadPatchLinkTest_testAccepterAndProvider;
+
@@ -0,0 +1,187 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/communication/threadpatchlink.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <boost/thread.hpp>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ThreadPatchLinkTest : public CxxTest::TestSuite
+{
+public:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    typedef DisplacedGrid<int> GridType;
+    typedef ThreadPatchLink<GridType>::Channel ChannelType;
+    typedef ThreadPatchLink<GridType>::Registry RegistryType;
+    typedef ThreadPatchLink<GridType>::Accepter PatchAccepterType;
+    typedef ThreadPatchLink<GridType>::Provider PatchProviderType;
+#endif
+
+    void setUp()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        region.clear();
+        region << Streak<2>(Coord<2>(2, 2), 4)
+               << Streak<2>(Coord<2>(1, 3), 6);
+        boundingBox = CoordBox<2>(Coord<2>(0, 0), Coord<2>(7, 5));
+        boundingRegion.clear();
+        boundingRegion << boundingBox;
+#endif
+    }
+
+    void testChannelPreservesOrderAcrossThreads()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        ChannelType channel(region, 3);
+        TS_ASSERT(!channel.ready());
+
+        int numPatches = 200;
+        boost::thread producer(&ThreadPatchLinkTest::produce, this, &channel, numPatches);
+
+        for (int i = 0; i < numPatches; ++i) {
+            GridType actual(boundingBox, -1);
+            channel.receive(&actual, region, 10 + i);
+            TS_ASSERT_EQUALS(markGrid(i), actual);
+        }
+        producer.join();
+        TS_ASSERT(!channel.ready());
+#endif
+    }
+
+    void testChannelRejectsUnexpectedNanoStep()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        ChannelType channel(region);
+        channel.send(markGrid(1), region, 5);
+        TS_ASSERT(channel.ready());
+
+        GridType actual(boundingBox, -1);
+        TS_ASSERT_THROWS(channel.receive(&actual, region, 6), std::logic_error&);
+#endif
+    }
+
+    void testCancelReleasesBlockedThreads()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        RegistryType registry;
+        boost::shared_ptr<ChannelType> incoming = registry.channel(0, 1, region);
+        boost::shared_ptr<ChannelType> outgoing = registry.channel(1, 0, region);
+
+        // fill the ring so that the next send() would block:
+        for (int i = 0; i < 4; ++i) {
+            outgoing->send(markGrid(i), region, i);
+        }
+
+        bool receiverCancelled = false;
+        bool senderCancelled = false;
+        boost::thread receiver(&ThreadPatchLinkTest::receiveOrCancel, this, incoming.get(), &receiverCancelled);
+        boost::thread sender(&ThreadPatchLinkTest::sendOrCancel, this, outgoing.get(), &senderCancelled);
+
+        registry.cancel();
+        receiver.join();
+        sender.join();
+        TS_ASSERT(receiverCancelled);
+        TS_ASSERT(senderCancelled);
+
+        // channels handed out after cancellation are cancelled, too:
+        GridType actual(boundingBox, -1);
+        TS_ASSERT_THROWS(
+            registry.channel(2, 3, region)->receive(&actual, region, 0),
+            ThreadPatchLink<GridType>::Cancelled&);
+#endif
+    }
+
+    void testRegistrySharesChannelsPerDirection()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        RegistryType registry;
+        boost::shared_ptr<ChannelType> channel1 = registry.channel(0, 1, region);
+        boost::shared_ptr<ChannelType> channel2 = registry.channel(1, 0, region);
+
+        TS_ASSERT_EQUALS(channel1, registry.channel(0, 1, region));
+        TS_ASSERT_DIFFERS(channel1, channel2);
+#endif
+    }
+
+    void testAccepterAndProvider()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        RegistryType registry;
+        PatchAccepterType accepter(region, registry.channel(0, 1, region));
+        PatchProviderType provider(region, registry.channel(0, 1, region));
+        accepter.charge(4, PatchAccepterType::infinity(), 2);
+        provider.charge(4, PatchProviderType::infinity(), 2);
+
+        TS_ASSERT(provider.ready(3));
+        TS_ASSERT(!provider.ready(4));
+
+        // not requested, hence discarded:
+        accepter.put(markGrid(42), boundingRegion, boundingBox.dimensions, 3, 0);
+        TS_ASSERT(!provider.ready(4));
+
+        accepter.put(markGrid(4), boundingRegion, boundingBox.dimensions, 4, 0);
+        accepter.put(markGrid(6), boundingRegion, boundingBox.dimensions, 6, 0);
+        TS_ASSERT(provider.ready(4));
+
+        GridType actual(boundingBox, -1);
+        provider.get(&actual, boundingRegion, boundingBox.dimensions, 4, 1);
+        TS_ASSERT_EQUALS(markGrid(4), actual);
+        TS_ASSERT_EQUALS(std::size_t(6), provider.nextAvailableNanoStep());
+
+        provider.get(&actual, boundingRegion, boundingBox.dimensions, 6, 1);
+        TS_ASSERT_EQUALS(markGrid(6), actual);
+        TS_ASSERT(!provider.ready(8));
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    Region<2> region;
+    Region<2> boundingRegion;
+    CoordBox<2> boundingBox;
+
+    GridType markGrid(int seed)
+    {
+        GridType ret(boundingBox, -1);
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            ret[*i] = seed * 100 + i->x() * 10 + i->y();
+        }
+
+        return ret;
+    }
+
+    void receiveOrCancel(ChannelType *channel, bool *cancelled)
+    {
+        GridType actual(boundingBox, -1);
+        try {
+            channel->receive(&actual, region, 0);
+        } catch (const ThreadPatchLink<GridType>::Cancelled&) {
+            *cancelled = true;
+        }
+    }
+
+    void sendOrCancel(ChannelType *channel, bool *cancelled)
+    {
+        try {
+            channel->send(markGrid(4), region, 4);
+        } catch (const ThreadPatchLink<GridType>::Cancelled&) {
+            *cancelled = true;
+        }
+    }
+
+    void produce(ChannelType *channel, int numPatches)
+    {
+        for (int i = 0; i < numPatches; ++i) {
+            channel->send(markGrid(i), region, 10 + i);
+        }
+    }
+#endif
+};
+
+}
@@ -0,0 +1,355 @@
+#ifndef LIBGEODECOMP_COMMUNICATION_THREADPATCHLINK_H
+#define LIBGEODECOMP_COMMUNICATION_THREADPATCHLINK_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+#include <libgeodecomp/storage/gridvecconv.h>
+#include <libgeodecomp/storage/patchaccepter.h>
+#include <libgeodecomp/storage/patchprovider.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
+
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <map>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * ThreadPatchLink is the shared memory counterpart of PatchLink: it
+ * connects UpdateGroups which live within the same process (see
+ * ThreadUpdateGroup). Patches are handed over via a Channel, a
+ * lock-free single-producer/single-consumer ring buffer, so no MPI
+ * (or any other runtime) is involved.
+ */
+template<class GRID_TYPE>
+class ThreadPatchLink
+{
+public:
+    friend class ThreadPatchLinkTest;
+
+    typedef typename GRID_TYPE::CellType CellType;
+    typedef typename SerializationBuffer<CellType>::BufferType BufferType;
+
+    const static int DIM = GRID_TYPE::DIM;
+
+    typedef boost::shared_ptr<boost::atomic<bool> > CancelToken;
+
+    /**
+     * Thrown by a Channel's blocking operations once its CancelToken
+     * has been set, e.g. because the peer thread has failed and
+     * won't ever send or receive again.
+     */
+    class Cancelled : public std::runtime_error
+    {
+    public:
+        Cancelled() :
+            std::runtime_error("ThreadPatchLink: channel has been cancelled")
+        {}
+    };
+
+    /**
+     * A fixed number of pre-allocated slots which are filled by
+     * exactly one Accepter and drained by exactly one Provider. Both
+     * sides only block (by yielding) if the ring is full or empty,
+     * respectively, and bail out with Cancelled if cancelToken gets
+     * set meanwhile.
+     */
+    class Channel
+    {
+    public:
+        explicit Channel(
+            const Region<DIM>& region,
+            std::size_t capacity = 4,
+            CancelToken cancelToken = CancelToken(new boost::atomic<bool>(false))) :
+            slots(capacity, SerializationBuffer<CellType>::create(region)),
+            nanoSteps(capacity),
+            cancelToken(cancelToken),
+            head(0),
+            tail(0)
+        {
+            if (capacity == 0) {
+                throw std::invalid_argument("Channel needs at least one slot");
+            }
+        }
+
+        /**
+         * Copies region from grid into the next free slot. May only
+         * be called by the producer thread.
+         */
+        void send(const GRID_TYPE& grid, const Region<DIM>& region, std::size_t nanoStep)
+        {
+            std::size_t h = head.load(boost::memory_order_relaxed);
+            while ((h - tail.load(boost::memory_order_acquire)) == slots.size()) {
+                checkCancelled();
+                boost::this_thread::yield();
+            }
+
+            std::size_t index = h % slots.size();
+            GridVecConv::gridToVector(grid, &slots[index], region);
+            nanoSteps[index] = nanoStep;
+            head.store(h + 1, boost::memory_order_release);
+        }
+
+        /**
+         * Copies the oldest patch to region in grid, waits for its
+         * arrival if neccessary. May only be called by the consumer
+         * thread.
+         */
+        void receive(GRID_TYPE *grid, const Region<DIM>& region, std::size_t nanoStep)
+        {
+            std::size_t t = tail.load(boost::memory_order_relaxed);
+            while (head.load(boost::memory_order_acquire) == t) {
+                checkCancelled();
+                boost::this_thread::yield();
+            }
+
+            std::size_t index = t % slots.size();
+            if (nanoSteps[index] != nanoStep) {
+                throw std::logic_error("patch received out of order");
+            }
+            GridVecConv::vectorToGrid(slots[index], grid, region);
+            tail.store(t + 1, boost::memory_order_release);
+        }
+
+        /**
+         * true if receive() would return immediately. Consumer side
+         * only.
+         */
+        bool ready() const
+        {
+            return head.load(boost::memory_order_acquire) != tail.load(boost::memory_order_relaxed);
+        }
+
+        /**
+         * Makes pending and future blocking calls to send() and
+         * receive() throw Cancelled. Safe to call from any thread.
+         */
+        void cancel()
+        {
+            cancelToken->store(true, boost::memory_order_release);
+        }
+
+    private:
+        std::vector<BufferType> slots;
+        std::vector<std::size_t> nanoSteps;
+        CancelToken cancelToken;
+        // head and tail are written by different threads, so we keep
+        // them on separate cache lines:
+        boost::atomic<std::size_t> head;
+        char padding[64];
+        boost::atomic<std::size_t> tail;
+
+        void checkCancelled() const
+        {
+            if (cancelToken->load(boost::memory_order_acquire)) {
+                throw Cancelled();
+            }
+        }
+    };
+
+    /**
+     * Hands out the Channel for each pair of communicating
+     * UpdateGroups, regardless of which side asks first. All
+     * Channels share one CancelToken, so a single cancel() releases
+     * every thread blocked on any of them.
+     */
+    class Registry
+    {
+    public:
+        explicit Registry(std::size_t capacity = 4) :
+            capacity(capacity),
+            cancelToken(new boost::atomic<bool>(false))
+        {}
+
+        boost::shared_ptr<Channel> channel(int source, int target, const Region<DIM>& region)
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            boost::shared_ptr<Channel>& ret = channels[std::make_pair(source, target)];
+            if (!ret) {
+                ret.reset(new Channel(region, capacity, cancelToken));
+            }
+
+            return ret;
+        }
+
+        /**
+         * Cancels all Channels handed out so far and in the future.
+         */
+        void cancel()
+        {
+            cancelToken->store(true, boost::memory_order_release);
+        }
+
+    private:
+        std::size_t capacity;
+        CancelToken cancelToken;
+        boost::mutex mutex;
+        std::map<std::pair<int, int>, boost::shared_ptr<Channel> > channels;
+    };
+
+    class Link
+    {
+    public:
+        inline Link(
+            const Region<DIM>& region,
+            boost::shared_ptr<Channel> channel) :
+            lastNanoStep(0),
+            stride(1),
+            region(region),
+            channel(channel)
+        {}
+
+        virtual ~Link()
+        {}
+
+        /**
+         * Should be called prior to destruction to allow
+         * implementations to perform any cleanup actions (e.g. to
+         * post any receives to pending transmissions).
+         */
+        virtual void cleanup()
+        {}
+
+        virtual void charge(std::size_t next, std::size_t last, std::size_t newStride)
+        {
+            lastNanoStep = last;
+            stride = newStride;
+        }
+
+        /**
+         * Returns false if a Stepper which is about to reach nanoStep
+         * would have to wait for this link.
+         */
+        virtual bool ready(std::size_t /* nanoStep */) const
+        {
+            return true;
+        }
+
+    protected:
+        std::size_t lastNanoStep;
+        long stride;
+        Region<DIM> region;
+        boost::shared_ptr<Channel> channel;
+    };
+
+    class Accepter :
+        public Link,
+        public PatchAccepter<GRID_TYPE>
+    {
+    public:
+        using Link::channel;
+        using Link::lastNanoStep;
+        using Link::region;
+        using Link::stride;
+        using PatchAccepter<GRID_TYPE>::checkNanoStepPut;
+        using PatchAccepter<GRID_TYPE>::infinity;
+        using PatchAccepter<GRID_TYPE>::pushRequest;
+        using PatchAccepter<GRID_TYPE>::requestedNanoSteps;
+
+        inline Accepter(
+            const Region<DIM>& region,
+            boost::shared_ptr<Channel> channel) :
+            Link(region, channel)
+        {}
+
+        virtual void charge(std::size_t next, std::size_t last, std::size_t newStride)
+        {
+            Link::charge(next, last, newStride);
+            pushRequest(next);
+        }
+
+        virtual void put(
+            const GRID_TYPE& grid,
+            const Region<DIM>& /*validRegion*/,
+            const Coord<DIM>& globalGridDimensions,
+            const std::size_t nanoStep,
+            const std::size_t rank)
+        {
+            if (!checkNanoStepPut(nanoStep)) {
+                return;
+            }
+
+            channel->send(grid, region, nanoStep);
+
+            std::size_t nextNanoStep = (min)(requestedNanoSteps) + stride;
+            if ((lastNanoStep == infinity()) ||
+                (nextNanoStep < lastNanoStep)) {
+                requestedNanoSteps << nextNanoStep;
+            }
+
+            erase_min(requestedNanoSteps);
+        }
+    };
+
+    class Provider :
+        public Link,
+        public PatchProvider<GRID_TYPE>
+    {
+    public:
+        using Link::channel;
+        using Link::lastNanoStep;
+        using Link::region;
+        using Link::stride;
+        using PatchProvider<GRID_TYPE>::checkNanoStepGet;
+        using PatchProvider<GRID_TYPE>::infinity;
+        using PatchProvider<GRID_TYPE>::nextAvailableNanoStep;
+        using PatchProvider<GRID_TYPE>::storedNanoSteps;
+        using PatchProvider<GRID_TYPE>::get;
+
+        inline Provider(
+            const Region<DIM>& region,
+            boost::shared_ptr<Channel> channel) :
+            Link(region, channel)
+        {}
+
+        virtual void charge(const std::size_t next, const std::size_t last, const std::size_t newStride)
+        {
+            Link::charge(next, last, newStride);
+            recv(next);
+        }
+
+        virtual bool ready(std::size_t nanoStep) const
+        {
+            return (nextAvailableNanoStep() > nanoStep) || channel->ready();
+        }
+
+        virtual void get(
+            GRID_TYPE *grid,
+            const Region<DIM>& patchableRegion,
+            const Coord<DIM>& globalGridDimensions,
+            const std::size_t nanoStep,
+            const std::size_t rank,
+            const bool remove = true)
+        {
+            if (storedNanoSteps.empty() || (nanoStep < (min)(storedNanoSteps))) {
+                return;
+            }
+
+            checkNanoStepGet(nanoStep);
+            channel->receive(grid, region, nanoStep);
+
+            std::size_t nextNanoStep = (min)(storedNanoSteps) + stride;
+            if ((lastNanoStep == infinity()) ||
+                (nextNanoStep < lastNanoStep)) {
+                recv(nextNanoStep);
+            }
+
+            erase_min(storedNanoSteps);
+        }
+
+        void recv(const std::size_t nanoStep)
+        {
+            storedNanoSteps << nanoStep;
+        }
+    };
+};
+
+}
+
+#endif
+#endif
@@ -11,6 +11,7 @@ MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_1_;
 MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_2_;
 MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_3_;
 MPI_Datatype MPI_LIBGEODECOMP_COORDBOXMPIDATATYPEHELPER;
+MPI_Datatype MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_COUNTER_SLOTS_;
 MPI_Datatype MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_INTERVALS_;
 MPI_Datatype MPI_LIBGEODECOMP_FLOATCOORD_1_;
 MPI_Datatype MPI_LIBGEODECOMP_FLOATCOORD_2_;
@@ -312,6 +313,44 @@ Typemaps::generateMapLibGeoDecomp_CoordBoxMPIDatatypeHelper() {
     return objType;
 }
 
+MPI_Datatype
+Typemaps::generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_COUNTER_SLOTS_() {
+    char fakeObject[sizeof(LibGeoDecomp::FixedArray<double,Chronometer::NUM_COUNTER_SLOTS >)];
+    LibGeoDecomp::FixedArray<double,Chronometer::NUM_COUNTER_SLOTS > *obj = (LibGeoDecomp::FixedArray<double,Chronometer::NUM_COUNTER_SLOTS >*)fakeObject;
+
+    const int count = 2;
+    int lengths[count];
+
+    // sort addresses in ascending order
+    MemberSpec rawSpecs[] = {
+        MemberSpec(getAddress(&obj->elements), lookup<std::size_t >(), 1),
+        MemberSpec(getAddress(&obj->store), lookup<double >(), Chronometer::NUM_COUNTER_SLOTS)
+    };
+    std::sort(rawSpecs, rawSpecs + count, addressLower);
+
+    // split addresses from member types
+    MPI_Aint displacements[count];
+    MPI_Datatype memberTypes[count];
+    for (int i = 0; i < count; i++) {
+        displacements[i] = rawSpecs[i].address;
+        memberTypes[i] = rawSpecs[i].type;
+        lengths[i] = rawSpecs[i].length;
+    }
+
+    // transform absolute addresses into offsets
+    for (int i = count-1; i > 0; i--) {
+        displacements[i] -= displacements[0];
+    }
+    displacements[0] = 0;
+
+    // create datatype
+    MPI_Datatype objType;
+    MPI_Type_create_struct(count, lengths, displacements, memberTypes, &objType);
+    MPI_Type_commit(&objType);
+
+    return objType;
+}
+
 MPI_Datatype
 Typemaps::generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_INTERVALS_() {
     char fakeObject[sizeof(LibGeoDecomp::FixedArray<double,Chronometer::NUM_INTERVALS >)];
@@ -823,11 +862,12 @@ Typemaps::generateMapLibGeoDecomp_Chronometer() {
     char fakeObject[sizeof(LibGeoDecomp::Chronometer)];
     LibGeoDecomp::Chronometer *obj = (LibGeoDecomp::Chronometer*)fakeObject;
 
-    const int count = 1;
+    const int count = 2;
     int lengths[count];
 
     // sort addresses in ascending order
     MemberSpec rawSpecs[] = {
+        MemberSpec(getAddress(&obj->totalCounters), lookup<FixedArray<double,Chronometer::NUM_COUNTER_SLOTS > >(), 1),
         MemberSpec(getAddress(&obj->totalTimes), lookup<FixedArray<double,Chronometer::NUM_INTERVALS > >(), 1)
     };
     std::sort(rawSpecs, rawSpecs + count, addressLower);
@@ -879,6 +919,7 @@ void Typemaps::initializeMaps()
     MPI_LIBGEODECOMP_COORDBOX_2_ = generateMapLibGeoDecomp_CoordBox_2_();
     MPI_LIBGEODECOMP_COORDBOX_3_ = generateMapLibGeoDecomp_CoordBox_3_();
     MPI_LIBGEODECOMP_COORDBOXMPIDATATYPEHELPER = generateMapLibGeoDecomp_CoordBoxMPIDatatypeHelper();
+    MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_COUNTER_SLOTS_ = generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_COUNTER_SLOTS_();
     MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_INTERVALS_ = generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_INTERVALS_();
     MPI_LIBGEODECOMP_FLOATCOORD_1_ = generateMapLibGeoDecomp_FloatCoord_1_();
     MPI_LIBGEODECOMP_FLOATCOORD_2_ = generateMapLibGeoDecomp_FloatCoord_2_();
@@ -13,6 +13,7 @@
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/storage/fixedarray.h>
+#include <libgeodecomp/storage/fixedarray.h>
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/floatcoord.h>
@@ -34,6 +35,7 @@ extern MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_1_;
 extern MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_2_;
 extern MPI_Datatype MPI_LIBGEODECOMP_COORDBOX_3_;
 extern MPI_Datatype MPI_LIBGEODECOMP_COORDBOXMPIDATATYPEHELPER;
+extern MPI_Datatype MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_COUNTER_SLOTS_;
 extern MPI_Datatype MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_INTERVALS_;
 extern MPI_Datatype MPI_LIBGEODECOMP_FLOATCOORD_1_;
 extern MPI_Datatype MPI_LIBGEODECOMP_FLOATCOORD_2_;
@@ -111,6 +113,7 @@ private:
     static MPI_Datatype generateMapLibGeoDecomp_CoordBox_2_();
     static MPI_Datatype generateMapLibGeoDecomp_CoordBox_3_();
     static MPI_Datatype generateMapLibGeoDecomp_CoordBoxMPIDatatypeHelper();
+    static MPI_Datatype generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_COUNTER_SLOTS_();
     static MPI_Datatype generateMapLibGeoDecomp_FixedArray_double_Chronometer_NUM_INTERVALS_();
     static MPI_Datatype generateMapLibGeoDecomp_FloatCoord_1_();
     static MPI_Datatype generateMapLibGeoDecomp_FloatCoord_2_();
@@ -252,6 +255,11 @@ public:
         return MPI_LIBGEODECOMP_COORDBOXMPIDATATYPEHELPER;
     }
 
+    static inline MPI_Datatype lookup(LibGeoDecomp::FixedArray<double,Chronometer::NUM_COUNTER_SLOTS >*)
+    {
+        return MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_COUNTER_SLOTS_;
+    }
+
     static inline MPI_Datatype lookup(LibGeoDecomp::FixedArray<double,Chronometer::NUM_INTERVALS >*)
     {
         return MPI_LIBGEODECOMP_FIXEDARRAY_DOUBLE_CHRONOMETER_NUM_INTERVALS_;
@@ -0,0 +1,8 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hull.cpp
+  ${RELATIVE_PATH}kernel.f
+  ${RELATIVE_PATH}main.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hull.h
+)
@@ -0,0 +1,23 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}regionbasedadjacency.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}adjacency.h
+  ${RELATIVE_PATH}convexpolytope.h
+  ${RELATIVE_PATH}coord.h
+  ${RELATIVE_PATH}coordbox.h
+  ${RELATIVE_PATH}cudaregion.h
+  ${RELATIVE_PATH}fixedcoord.h
+  ${RELATIVE_PATH}floatcoord.h
+  ${RELATIVE_PATH}partitionanalyzer.h
+  ${RELATIVE_PATH}partitionmanager.h
+  ${RELATIVE_PATH}plane.h
+  ${RELATIVE_PATH}region.h
+  ${RELATIVE_PATH}regionbasedadjacency.h
+  ${RELATIVE_PATH}regionstreakiterator.h
+  ${RELATIVE_PATH}stencils.h
+  ${RELATIVE_PATH}streak.h
+  ${RELATIVE_PATH}topologies.h
+  ${RELATIVE_PATH}unstructuredgridmesher.h
+  ${RELATIVE_PATH}voronoimesher.h
+)
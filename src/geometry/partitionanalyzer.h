@@ -0,0 +1,343 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONANALYZER_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONANALYZER_H
+
+#include <libgeodecomp/geometry/partitionmanager.h>
+#include <libgeodecomp/geometry/partitions/partition.h>
+
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace PartitionAnalyzerHelpers {
+
+/**
+ * Serves precomputed Regions so that the PartitionManagers which the
+ * PartitionAnalyzer sets up for each rank don't have to rerun the
+ * decomposition for each of their neighbors.
+ */
+template<int DIM>
+class CachedPartition : public Partition<DIM>
+{
+public:
+    explicit CachedPartition(boost::shared_ptr<Partition<DIM> > delegate) :
+        Partition<DIM>(0, delegate->getWeights()),
+        delegate(delegate),
+        regions(delegate->getWeights().size())
+    {
+        for (std::size_t i = 0; i < regions.size(); ++i) {
+            regions[i] = delegate->getRegion(i);
+        }
+    }
+
+    Region<DIM> getRegion(const std::size_t node) const
+    {
+        return regions[node];
+    }
+
+    const Adjacency& getAdjacency() const
+    {
+        return delegate->getAdjacency();
+    }
+
+private:
+    boost::shared_ptr<Partition<DIM> > delegate;
+    std::vector<Region<DIM> > regions;
+};
+
+}
+
+/**
+ * Compares domain decomposition schemes without running a
+ * simulation: the PartitionAnalyzer instantiates a Partition for a
+ * hypothetical number of ranks and collects the per-rank statistics
+ * which PartitionManager would yield on each of them (volume, ghost
+ * zone sizes, number of neighbors and messages). Based on a simple
+ * latency/bandwidth model it then predicts the time per time step
+ * and can recommend the fastest scheme. Everything runs on a single
+ * machine, which is fast enough for layouts with 10k ranks.
+ */
+template<typename TOPOLOGY>
+class PartitionAnalyzer
+{
+public:
+    typedef TOPOLOGY Topology;
+    static const int DIM = Topology::DIM;
+
+    /**
+     * Describes the machine and the model: latency is the time
+     * required per message (in seconds), bandwidth the number of
+     * bytes that can be transmitted per second. bytesPerCell is the
+     * size of a cell on the wire and secondsPerCell the time required
+     * for updating a single cell.
+     */
+    class CostModel
+    {
+    public:
+        explicit CostModel(
+            double latency = 2e-6,
+            double bandwidth = 5e9,
+            double bytesPerCell = 8,
+            double secondsPerCell = 1e-9) :
+            latency(latency),
+            bandwidth(bandwidth),
+            bytesPerCell(bytesPerCell),
+            secondsPerCell(secondsPerCell)
+        {}
+
+        double latency;
+        double bandwidth;
+        double bytesPerCell;
+        double secondsPerCell;
+    };
+
+    /**
+     * Per-rank figures. The outer ghost volume is the number of
+     * cells a rank receives per ghost zone synchronization, the
+     * inner ghost volume the number of cells it sends. numMessages
+     * counts both, sent and received messages per synchronization.
+     */
+    class RankStats
+    {
+    public:
+        RankStats() :
+            volume(0),
+            outerGhostVolume(0),
+            innerGhostVolume(0),
+            numNeighbors(0),
+            numMessages(0),
+            stepTime(0)
+        {}
+
+        std::size_t volume;
+        std::size_t outerGhostVolume;
+        std::size_t innerGhostVolume;
+        std::size_t numNeighbors;
+        std::size_t numMessages;
+        double stepTime;
+    };
+
+    /**
+     * Aggregates the RankStats of one Partition. As ranks wait for
+     * their neighbors during each synchronization, the predicted
+     * time per step is that of the slowest rank.
+     */
+    class Report
+    {
+    public:
+        Report(const std::string& name = "", std::size_t numRanks = 0) :
+            name(name),
+            ranks(numRanks),
+            maxVolume(0),
+            loadImbalance(0),
+            totalGhostVolume(0),
+            maxGhostVolume(0),
+            maxNeighbors(0),
+            meanNeighbors(0),
+            messagesPerStep(0),
+            predictedStepTime(0)
+        {}
+
+        std::string name;
+        std::vector<RankStats> ranks;
+        std::size_t maxVolume;
+        double loadImbalance;
+        std::size_t totalGhostVolume;
+        std::size_t maxGhostVolume;
+        std::size_t maxNeighbors;
+        double meanNeighbors;
+        double messagesPerStep;
+        double predictedStepTime;
+
+        static std::string header()
+        {
+            std::stringstream buf;
+            buf << std::left << std::setw(20) << "partition"
+                << std::right
+                << std::setw(12) << "maxVolume"
+                << std::setw(11) << "imbalance"
+                << std::setw(14) << "totalGhosts"
+                << std::setw(12) << "maxGhosts"
+                << std::setw(10) << "maxNeigh"
+                << std::setw(11) << "meanNeigh"
+                << std::setw(12) << "msgs/step"
+                << std::setw(14) << "step time[s]";
+            return buf.str();
+        }
+
+        std::string toString() const
+        {
+            std::stringstream buf;
+            buf << std::left << std::setw(20) << name
+                << std::right
+                << std::setw(12) << maxVolume
+                << std::setw(11) << std::setprecision(4) << loadImbalance
+                << std::setw(14) << totalGhostVolume
+                << std::setw(12) << maxGhostVolume
+                << std::setw(10) << maxNeighbors
+                << std::setw(11) << std::setprecision(4) << meanNeighbors
+                << std::setw(12) << std::setprecision(6) << messagesPerStep
+                << std::setw(14) << std::setprecision(4) << predictedStepTime;
+            return buf.str();
+        }
+    };
+
+    /**
+     * Like in PartitionManager, the simulation area always starts at
+     * the origin.
+     */
+    explicit PartitionAnalyzer(
+        const Coord<DIM>& dimensions,
+        unsigned ghostZoneWidth = 1,
+        const CostModel& costModel = CostModel()) :
+        simulationArea(Coord<DIM>(), dimensions),
+        ghostZoneWidth(ghostZoneWidth),
+        costModel(costModel)
+    {}
+
+    /**
+     * Splits the simulation area into numRanks equally sized parts
+     * via PARTITION and analyzes the result. The returned reference
+     * is valid until the next call to analyze().
+     */
+    template<typename PARTITION>
+    const Report& analyze(const std::string& name, std::size_t numRanks)
+    {
+        std::vector<std::size_t> weights(numRanks, simulationArea.size() / numRanks);
+        std::size_t remainder = simulationArea.size() - sum(weights);
+        for (std::size_t i = 0; i < remainder; ++i) {
+            ++weights[i];
+        }
+
+        boost::shared_ptr<Partition<DIM> > partition(
+            new PARTITION(simulationArea.origin, simulationArea.dimensions, 0, weights));
+        return analyze(name, partition);
+    }
+
+    const Report& analyze(const std::string& name, boost::shared_ptr<Partition<DIM> > partition)
+    {
+        boost::shared_ptr<Partition<DIM> > cachedPartition(
+            new PartitionAnalyzerHelpers::CachedPartition<DIM>(partition));
+        std::size_t numRanks = partition->getWeights().size();
+
+        std::vector<CoordBox<DIM> > boundingBoxes;
+        for (std::size_t i = 0; i < numRanks; ++i) {
+            boundingBoxes << cachedPartition->getRegion(i).boundingBox();
+        }
+
+        Report report(name, numRanks);
+        for (std::size_t i = 0; i < numRanks; ++i) {
+            report.ranks[i] = analyzeRank(cachedPartition, boundingBoxes, i);
+        }
+        summarize(&report);
+
+        reports << report;
+        return reports.back();
+    }
+
+    const std::vector<Report>& getReports() const
+    {
+        return reports;
+    }
+
+    /**
+     * Returns the report with the lowest predicted time per step.
+     */
+    const Report& recommendation() const
+    {
+        if (reports.empty()) {
+            throw std::logic_error("no partition has been analyzed yet");
+        }
+
+        std::size_t best = 0;
+        for (std::size_t i = 1; i < reports.size(); ++i) {
+            if (reports[i].predictedStepTime < reports[best].predictedStepTime) {
+                best = i;
+            }
+        }
+
+        return reports[best];
+    }
+
+private:
+    CoordBox<DIM> simulationArea;
+    unsigned ghostZoneWidth;
+    CostModel costModel;
+    std::vector<Report> reports;
+
+    RankStats analyzeRank(
+        boost::shared_ptr<Partition<DIM> > partition,
+        const std::vector<CoordBox<DIM> >& boundingBoxes,
+        std::size_t rank)
+    {
+        typedef typename PartitionManager<Topology>::RegionVecMap RegionVecMap;
+
+        PartitionManager<Topology> partitionManager;
+        partitionManager.resetRegions(simulationArea, partition, rank, ghostZoneWidth);
+        partitionManager.resetGhostZones(boundingBoxes);
+
+        RankStats ret;
+        ret.volume = partitionManager.ownRegion().size();
+
+        RegionVecMap& outer = partitionManager.getOuterGhostZoneFragments();
+        RegionVecMap& inner = partitionManager.getInnerGhostZoneFragments();
+
+        for (typename RegionVecMap::iterator i = outer.begin(); i != outer.end(); ++i) {
+            if (i->first == PartitionManager<Topology>::OUTGROUP) {
+                continue;
+            }
+
+            std::size_t outerSize = i->second.back().size();
+            std::size_t innerSize = inner[i->first].back().size();
+            ret.outerGhostVolume += outerSize;
+            ret.innerGhostVolume += innerSize;
+            ret.numNeighbors += ((outerSize > 0) || (innerSize > 0));
+            ret.numMessages += (outerSize > 0) + (innerSize > 0);
+        }
+
+        // ghost zones are synchronized every ghostZoneWidth steps:
+        double commTime =
+            ret.numMessages * costModel.latency +
+            (ret.outerGhostVolume + ret.innerGhostVolume) * costModel.bytesPerCell / costModel.bandwidth;
+        ret.stepTime =
+            ret.volume * costModel.secondsPerCell +
+            commTime / ghostZoneWidth;
+
+        return ret;
+    }
+
+    void summarize(Report *report) const
+    {
+        std::size_t totalVolume = 0;
+        std::size_t totalNeighbors = 0;
+        std::size_t totalMessages = 0;
+
+        for (typename std::vector<RankStats>::const_iterator i = report->ranks.begin();
+             i != report->ranks.end();
+             ++i) {
+            totalVolume += i->volume;
+            totalNeighbors += i->numNeighbors;
+            totalMessages += i->numMessages;
+            report->totalGhostVolume += i->outerGhostVolume;
+            report->maxVolume = (std::max)(report->maxVolume, i->volume);
+            report->maxGhostVolume = (std::max)(report->maxGhostVolume, i->outerGhostVolume);
+            report->maxNeighbors = (std::max)(report->maxNeighbors, i->numNeighbors);
+            report->predictedStepTime = (std::max)(report->predictedStepTime, i->stepTime);
+        }
+
+        double numRanks = report->ranks.size();
+        report->loadImbalance = report->maxVolume * numRanks / totalVolume;
+        report->meanNeighbors = totalNeighbors / numRanks;
+        // each message is counted twice: by its sender and its receiver
+        report->messagesPerStep = 0.5 * totalMessages / ghostZoneWidth;
+    }
+};
+
+}
+
+#endif
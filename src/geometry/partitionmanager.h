@@ -4,6 +4,7 @@
 #include <libgeodecomp/config.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/stencils.h>
 
 #include <boost/shared_ptr.hpp>
 
@@ -14,8 +15,13 @@ namespace LibGeoDecomp {
  * subdomain (as defined by a Partition) and the inner and outer ghost
  * regions (halos) which are used for synchronization with neighboring
  * subdomains.
+ *
+ * All regions are grown by the shape of STENCIL (see
+ * Region::expandWithStencil()). For VonNeumann and Cross stencils
+ * this excludes the corner and edge cells of the ghost zones, which
+ * reduces both, communication and redundant ghost zone updates.
  */
-template<typename TOPOLOGY>
+template<typename TOPOLOGY, typename STENCIL = Stencils::Moore<TOPOLOGY::DIM, 1> >
 class PartitionManager
 {
 public:
@@ -23,6 +29,7 @@ public:
     friend class VanillaStepperTest;
 
     typedef TOPOLOGY Topology;
+    typedef STENCIL Stencil;
     static const int DIM = Topology::DIM;
     typedef std::map<int, std::vector<Region<DIM> > > RegionVecMap;
 
@@ -248,10 +255,11 @@ private:
         for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
             Region<DIM> expanded;
             const Region<DIM>& reg = regionExpansion[i - 1];
-            expanded = reg.expandWithTopology(
+            expanded = reg.expandWithStencil(
                 1,
                 simulationArea.dimensions,
                 Topology(),
+                Stencil(),
                 adjacency());
             regionExpansion[i] = expanded;
         }
@@ -261,17 +269,19 @@ private:
     {
         fillRegion(myRank);
         Region<DIM> surface(
-            ownRegion().expandWithTopology(
+            ownRegion().expandWithStencil(
                 1,
                 simulationArea.dimensions,
                 Topology(),
+                Stencil(),
                 adjacency()) - ownRegion());
         Region<DIM> kernel(
             ownRegion() -
-            surface.expandWithTopology(
+            surface.expandWithStencil(
                 getGhostZoneWidth(),
                 simulationArea.dimensions,
                 Topology(),
+                Stencil(),
                 adjacency()));
         outerRim = ownExpandedRegion() - ownRegion();
         ownRims.resize(getGhostZoneWidth() + 1);
@@ -279,16 +289,16 @@ private:
 
         ownRims.back() = ownRegion() - kernel;
         for (int i = getGhostZoneWidth() - 1; i >= 0; --i) {
-            ownRims[i] = ownRims[i + 1].expandWithTopology(
-                1, simulationArea.dimensions, Topology(), adjacency());
+            ownRims[i] = ownRims[i + 1].expandWithStencil(
+                1, simulationArea.dimensions, Topology(), Stencil(), adjacency());
         }
 
         ownInnerSets.front() = ownRegion();
-        Region<DIM> minuend = surface.expandWithTopology(
-            1, simulationArea.dimensions, Topology(), adjacency());
+        Region<DIM> minuend = surface.expandWithStencil(
+            1, simulationArea.dimensions, Topology(), Stencil(), adjacency());
         for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
             ownInnerSets[i] = ownInnerSets[i - 1] - minuend;
-            minuend = minuend.expandWithTopology(1, simulationArea.dimensions, Topology(), adjacency());
+            minuend = minuend.expandWithStencil(1, simulationArea.dimensions, Topology(), Stencil(), adjacency());
         }
 
         volatileKernel = ownInnerSets.back() & rim(0);
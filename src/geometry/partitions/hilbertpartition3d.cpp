@@ -0,0 +1,9 @@
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+
+namespace LibGeoDecomp {
+
+HilbertPartition3D::Cache HilbertPartition3D::coordsCache;
+Coord<3> HilbertPartition3D::maxCachedDimensions;
+bool HilbertPartition3D::cachesInitialized = HilbertPartition3D::fillCaches();
+
+}
@@ -0,0 +1,451 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_HILBERTPARTITION3D_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_HILBERTPARTITION3D_H
+
+#include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/partitions/spacefillingcurve.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <boost/shared_ptr.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A 3D variant of Hilbert's space-filling curve. Unlike the classic
+ * construction it's not limited to cubes with edge lengths of 2^n,
+ * but uses the generalized scheme (aka "Gilbert curve") which splits
+ * arbitrary cuboids into 2, 3 or 5 sub-cuboids, depending on their
+ * aspect ratio. The curve is contiguous for even edge lengths, odd
+ * lengths may introduce a few diagonal steps.
+ *
+ * Compared to the ZCurvePartition the resulting subdomains are
+ * connected and more compact, which reduces ghost zone volume. The
+ * iterator follows the same design as ZCurvePartition: it descends
+ * directly to the requested offset and uses cached coordinates for
+ * small blocks.
+ */
+class HilbertPartition3D : public SpaceFillingCurve<3>
+{
+    friend class HilbertPartition3DTest;
+public:
+    typedef std::vector<Coord<3> > CoordVector;
+    typedef Grid<CoordVector, Topologies::Cube<3>::Topology> GridType;
+    typedef boost::shared_ptr<GridType> Cache;
+
+    /**
+     * A cuboid section of the curve. Cells are addressed by local
+     * coordinates (i, j, k) with 0 <= i < dimensions[0] etc., which
+     * are mapped to origin + i * axes[0] + j * axes[1] + k * axes[2].
+     * All axes are (possibly negative) unit vectors. The curve enters
+     * the block at local (0, 0, 0) and leaves it at the far end of
+     * the first axis.
+     */
+    class Block
+    {
+    public:
+        // axis identifiers for subBlock(), negative values invert the
+        // direction of the parent's axis:
+        static const int A = 1;
+        static const int B = 2;
+        static const int C = 3;
+
+        static const int MAX_CHILDREN = 5;
+
+        inline Block(
+            const Coord<3>& origin = Coord<3>(),
+            const Coord<3>& axis0 = Coord<3>(1, 0, 0),
+            const Coord<3>& axis1 = Coord<3>(0, 1, 0),
+            const Coord<3>& axis2 = Coord<3>(0, 0, 1),
+            const Coord<3>& dimensions = Coord<3>(),
+            const int child = 0) :
+            origin(origin),
+            dimensions(dimensions),
+            child(child)
+        {
+            axes[0] = axis0;
+            axes[1] = axis1;
+            axes[2] = axis2;
+        }
+
+        inline Coord<3> toGlobal(const Coord<3>& local) const
+        {
+            return origin +
+                axes[0] * local.x() +
+                axes[1] * local.y() +
+                axes[2] * local.z();
+        }
+
+        /**
+         * Stores the sub-blocks in traversal order in children and
+         * returns their number. Some may have a volume of 0.
+         */
+        inline int split(Block *children) const
+        {
+            int w = dimensions[0];
+            int h = dimensions[1];
+            int d = dimensions[2];
+
+            int w2 = halve(w);
+            int h2 = halve(h);
+            int d2 = halve(d);
+
+            // wide block: split only along first axis
+            if ((2 * w > 3 * h) && (2 * w > 3 * d)) {
+                children[0] = subBlock(Coord<3>(0,  0, 0), A, w2,     B, h, C, d);
+                children[1] = subBlock(Coord<3>(w2, 0, 0), A, w - w2, B, h, C, d);
+                return 2;
+            }
+
+            // don't split along third axis
+            if (3 * h > 4 * d) {
+                children[0] = subBlock(Coord<3>(0,     0,      0), B,  h2, C, d,      A,  w2);
+                children[1] = subBlock(Coord<3>(0,     h2,     0), A,  w,  B, h - h2, C,  d);
+                children[2] = subBlock(Coord<3>(w - 1, h2 - 1, 0), -B, h2, C, d,      -A, w - w2);
+                return 3;
+            }
+
+            // don't split along second axis
+            if (3 * d > 4 * h) {
+                children[0] = subBlock(Coord<3>(0,     0, 0),      C,  d2, A,  w2,     B, h);
+                children[1] = subBlock(Coord<3>(0,     0, d2),     A,  w,  B,  h,      C, d - d2);
+                children[2] = subBlock(Coord<3>(w - 1, 0, d2 - 1), -C, d2, -A, w - w2, B, h);
+                return 3;
+            }
+
+            children[0] = subBlock(Coord<3>(0,     0,      0),     B,  h2, C,  d2,     A,  w2);
+            children[1] = subBlock(Coord<3>(0,     h2,     0),     C,  d,  A,  w2,     B,  h - h2);
+            children[2] = subBlock(Coord<3>(0,     h2 - 1, d - 1), A,  w,  -B, h2,     -C, d - d2);
+            children[3] = subBlock(Coord<3>(w - 1, h2,     d - 1), -C, d,  -A, w - w2, B,  h - h2);
+            children[4] = subBlock(Coord<3>(w - 1, h2 - 1, 0),     -B, h2, C,  d2,     -A, w - w2);
+            return 5;
+        }
+
+        inline std::string toString() const
+        {
+            std::stringstream s;
+            s << "Block(origin: " << origin
+              << ", axes: [" << axes[0] << ", " << axes[1] << ", " << axes[2] << "]"
+              << ", dimensions: " << dimensions
+              << ", child: " << child << ")";
+            return s.str();
+        }
+
+        Coord<3> origin;
+        Coord<3> axes[3];
+        Coord<3> dimensions;
+        int child;
+
+    private:
+        /**
+         * Halves an edge length, but prefers even results so that
+         * sub-blocks can be traversed without diagonal steps.
+         */
+        static inline int halve(int length)
+        {
+            int ret = length / 2;
+            if ((ret % 2) && (length > 2)) {
+                ++ret;
+            }
+            return ret;
+        }
+
+        inline Coord<3> axis(int id) const
+        {
+            return (id > 0) ? axes[id - 1] : axes[-id - 1] * -1;
+        }
+
+        inline Block subBlock(
+            const Coord<3>& localOrigin,
+            int axis0, int length0,
+            int axis1, int length1,
+            int axis2, int length2) const
+        {
+            return Block(
+                toGlobal(localOrigin),
+                axis(axis0),
+                axis(axis1),
+                axis(axis2),
+                Coord<3>(length0, length1, length2));
+        }
+    };
+
+    class Iterator : public SpaceFillingCurve<3>::Iterator
+    {
+    public:
+        friend class HilbertPartition3DTest;
+
+        using SpaceFillingCurve<3>::Iterator::cursor;
+        using SpaceFillingCurve<3>::Iterator::endReached;
+        using SpaceFillingCurve<3>::Iterator::hasTrivialDimensions;
+        using SpaceFillingCurve<3>::Iterator::origin;
+        using SpaceFillingCurve<3>::Iterator::sublevelState;
+
+        inline Iterator(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            const unsigned& pos = 0) :
+            SpaceFillingCurve<3>::Iterator(origin, false)
+        {
+            init(rootBlock(origin, dimensions), pos);
+        }
+
+        inline Iterator(const Block& block, const unsigned& pos) :
+            SpaceFillingCurve<3>::Iterator(block.origin, false)
+        {
+            init(block, pos);
+        }
+
+        inline explicit Iterator(const Coord<3>& origin) :
+            SpaceFillingCurve<3>::Iterator(origin, true)
+        {}
+
+        inline Iterator& operator++()
+        {
+            if (endReached) {
+                return *this;
+            }
+
+            if (sublevelState == TRIVIAL) {
+                operatorIncTrivial();
+            } else {
+                operatorIncCached();
+            }
+            return *this;
+        }
+
+    private:
+        std::vector<Block> blockStack;
+        Coord<3> trivialDirection;
+        int trivialCounter;
+        Block cachedBlock;
+        const Coord<3> *cachedCoordsIterator;
+        const Coord<3> *cachedCoordsEnd;
+
+        /**
+         * Orients the curve along the longest edge of the domain.
+         */
+        static inline Block rootBlock(const Coord<3>& origin, const Coord<3>& dim)
+        {
+            Coord<3> x(1, 0, 0);
+            Coord<3> y(0, 1, 0);
+            Coord<3> z(0, 0, 1);
+
+            if ((dim.x() >= dim.y()) && (dim.x() >= dim.z())) {
+                return Block(origin, x, y, z, Coord<3>(dim.x(), dim.y(), dim.z()));
+            }
+            if (dim.y() >= dim.z()) {
+                return Block(origin, y, x, z, Coord<3>(dim.y(), dim.x(), dim.z()));
+            }
+            return Block(origin, z, x, y, Coord<3>(dim.z(), dim.x(), dim.y()));
+        }
+
+        inline void init(const Block& block, const unsigned& pos)
+        {
+            if (pos >= unsigned(block.dimensions.prod())) {
+                endReached = true;
+                cursor = origin;
+                return;
+            }
+
+            digDown(block, pos);
+        }
+
+        inline void operatorIncTrivial()
+        {
+            if (--trivialCounter > 0) {
+                cursor += trivialDirection;
+            } else {
+                digUpDown();
+            }
+        }
+
+        inline void operatorIncCached()
+        {
+            ++cachedCoordsIterator;
+            if (cachedCoordsIterator != cachedCoordsEnd) {
+                cursor = cachedBlock.toGlobal(*cachedCoordsIterator);
+            } else {
+                digUpDown();
+            }
+        }
+
+        inline void digDown(Block block, unsigned offset)
+        {
+            for (;;) {
+                if (hasTrivialDimensions(block.dimensions)) {
+                    digDownTrivial(block, offset);
+                    return;
+                }
+
+                if (isCached(block.dimensions)) {
+                    digDownCached(block, offset);
+                    return;
+                }
+
+                Block children[Block::MAX_CHILDREN];
+                int numChildren = block.split(children);
+
+                int index = 0;
+                for (; index < numChildren; ++index) {
+                    unsigned volume = children[index].dimensions.prod();
+                    if (offset < volume) {
+                        break;
+                    }
+                    offset -= volume;
+                }
+
+                if (index == numChildren) {
+                    throw std::logic_error("offset too large?");
+                }
+
+                block.child = index;
+                blockStack.push_back(block);
+                block = children[index];
+            }
+        }
+
+        inline void digDownTrivial(const Block& block, const unsigned& offset)
+        {
+            sublevelState = TRIVIAL;
+
+            int dir = 0;
+            for (int i = 1; i < 3; ++i) {
+                if (block.dimensions[i] > 1) {
+                    dir = i;
+                }
+            }
+
+            trivialDirection = block.axes[dir];
+            trivialCounter = block.dimensions[dir] - offset;
+            cursor = block.origin + trivialDirection * offset;
+        }
+
+        inline void digDownCached(const Block& block, const unsigned& offset)
+        {
+            sublevelState = CACHED;
+            const CoordVector& coords = (*HilbertPartition3D::coordsCache)[block.dimensions];
+            cachedBlock = block;
+            cachedCoordsIterator = &coords[offset];
+            cachedCoordsEnd      = &coords[0] + coords.size();
+            cursor = cachedBlock.toGlobal(*cachedCoordsIterator);
+        }
+
+        inline void digUpDown()
+        {
+            while (!blockStack.empty()) {
+                Block& parent = blockStack.back();
+                Block children[Block::MAX_CHILDREN];
+                int numChildren = parent.split(children);
+
+                // skip empty sub-blocks
+                for (++parent.child; parent.child < numChildren; ++parent.child) {
+                    if (children[parent.child].dimensions.prod() > 0) {
+                        digDown(children[parent.child], 0);
+                        return;
+                    }
+                }
+
+                blockStack.pop_back();
+            }
+
+            endReached = true;
+            cursor = origin;
+        }
+
+        inline bool isCached(const Coord<3>& dimensions) const
+        {
+            return
+                (dimensions.x() < maxCachedDimensions.x()) &&
+                (dimensions.y() < maxCachedDimensions.y()) &&
+                (dimensions.z() < maxCachedDimensions.z());
+        }
+    };
+
+    inline explicit HilbertPartition3D(
+        const Coord<3>& origin = Coord<3>(),
+        const Coord<3>& dimensions = Coord<3>(),
+        const long& offset = 0,
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2)) :
+        SpaceFillingCurve<3>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {}
+
+    inline Iterator operator[](const unsigned& i) const
+    {
+        return Iterator(origin, dimensions, i);
+    }
+
+    inline Iterator begin() const
+    {
+        return (*this)[0];
+    }
+
+    inline Iterator end() const
+    {
+        return Iterator(origin);
+    }
+
+    inline Region<3> getRegion(const std::size_t node) const
+    {
+        return Region<3>(
+            (*this)[startOffsets[node + 0]],
+            (*this)[startOffsets[node + 1]]);
+    }
+
+private:
+    using SpaceFillingCurve<3>::startOffsets;
+
+    static Cache coordsCache;
+    static Coord<3> maxCachedDimensions;
+    static bool cachesInitialized;
+
+    Coord<3> origin;
+    Coord<3> dimensions;
+
+    /**
+     * Stores the local coordinates of all small blocks. Since
+     * sub-blocks are defined relative to their parent's axes, the
+     * traversal order only depends on a block's dimensions.
+     */
+    static inline bool fillCaches()
+    {
+        Coord<3> maxDim = Coord<3>::diagonal(9);
+        coordsCache.reset(new GridType(maxDim));
+
+        CoordBox<3> box(Coord<3>(), maxDim);
+        for (CoordBox<3>::Iterator iter = box.begin(); iter != box.end(); ++iter) {
+            Coord<3> dim = *iter;
+            if (Iterator::hasTrivialDimensions(dim)) {
+                continue;
+            }
+
+            CoordVector coords;
+            Block block(Coord<3>(), Coord<3>(1, 0, 0), Coord<3>(0, 1, 0), Coord<3>(0, 0, 1), dim);
+            Iterator end((Coord<3>()));
+            for (Iterator i(block, 0); i != end; ++i) {
+                coords.push_back(*i);
+            }
+            (*coordsCache)[dim] = coords;
+        }
+
+        maxCachedDimensions = maxDim;
+        return true;
+    }
+};
+
+template<typename _CharT, typename _Traits>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const HilbertPartition3D::Block& block)
+{
+    __os << block.toString();
+    return __os;
+}
+
+}
+
+#endif
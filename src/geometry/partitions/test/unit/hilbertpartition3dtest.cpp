@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HilbertPartition3DTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/hilbertpartition3dtest.h"
+
+static HilbertPartition3DTest suite_HilbertPartition3DTest;
+
+static CxxTest::List Tests_HilbertPartition3DTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HilbertPartition3DTest( "/root/repo/src/geometry/partitions/test/unit/hilbertpartition3dtest.h", 10, "HilbertPartition3DTest", suite_HilbertPartition3DTest, Tests_HilbertPartition3DTest );
+
+static class TestDescription_suite_HilbertPartition3DTest_testSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testSimple() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 15, "testSimple" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testSimple(); }
+} testDescription_suite_HilbertPartition3DTest_testSimple;
+
+static class TestDescription_suite_HilbertPartition3DTest_testCompleteness : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testCompleteness() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 43, "testCompleteness" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testCompleteness(); }
+} testDescription_suite_HilbertPartition3DTest_testCompleteness;
+
+static class TestDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 56, "testSquareBracketsOperatorVersusIteration" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testSquareBracketsOperatorVersusIteration(); }
+} testDescription_suite_HilbertPartition3DTest_testSquareBracketsOperatorVersusIteration;
+
+static class TestDescription_suite_HilbertPartition3DTest_testContinuity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testContinuity() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 79, "testContinuity" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testContinuity(); }
+} testDescription_suite_HilbertPartition3DTest_testContinuity;
+
+static class TestDescription_suite_HilbertPartition3DTest_testGetRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testGetRegion() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 87, "testGetRegion" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testGetRegion(); }
+} testDescription_suite_HilbertPartition3DTest_testGetRegion;
+
+static class TestDescription_suite_HilbertPartition3DTest_testSmallerGhostVolumeThanZCurve : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartition3DTest_testSmallerGhostVolumeThanZCurve() : CxxTest::RealTestDescription( Tests_HilbertPartition3DTest, suiteDescription_HilbertPartition3DTest, 112, "testSmallerGhostVolumeThanZCurve" ) {}
+ void runTest() { suite_HilbertPartition3DTest.testSmallerGhostVolumeThanZCurve(); }
+} testDescription_suite_HilbertPartition3DTest_testSmallerGhostVolumeThanZCurve;
+
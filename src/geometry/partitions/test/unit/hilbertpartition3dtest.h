@@ -0,0 +1,181 @@
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class HilbertPartition3DTest : public CxxTest::TestSuite
+{
+public:
+    typedef std::vector<Coord<3> > CoordVector;
+
+    void testSimple()
+    {
+        HilbertPartition3D partition(Coord<3>(1, 2, 3), Coord<3>(2, 2, 2));
+
+        CoordVector expected;
+        expected << Coord<3>(1, 2, 3)
+                 << Coord<3>(1, 3, 3)
+                 << Coord<3>(1, 3, 4)
+                 << Coord<3>(1, 2, 4)
+                 << Coord<3>(2, 2, 4)
+                 << Coord<3>(2, 3, 4)
+                 << Coord<3>(2, 3, 3)
+                 << Coord<3>(2, 2, 3);
+
+        CoordVector actual1;
+        for (int i = 0; i < 8; ++i) {
+            actual1 << *partition[i];
+        }
+
+        CoordVector actual2;
+        for (HilbertPartition3D::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            actual2 << *i;
+        }
+
+        TS_ASSERT_EQUALS(actual1, expected);
+        TS_ASSERT_EQUALS(actual2, expected);
+    }
+
+    void testCompleteness()
+    {
+        checkCompleteness(Coord<3>(1,   1,  1));
+        checkCompleteness(Coord<3>(1,   9,  1));
+        checkCompleteness(Coord<3>(10,  1,  7));
+        checkCompleteness(Coord<3>(5,   7,  3));
+        checkCompleteness(Coord<3>(13,  2,  9));
+        checkCompleteness(Coord<3>(5,   7, 20));
+        checkCompleteness(Coord<3>(5,  40,  4));
+        checkCompleteness(Coord<3>(50,  8,  8));
+        checkCompleteness(Coord<3>(31, 17, 25));
+    }
+
+    void testSquareBracketsOperatorVersusIteration()
+    {
+        HilbertPartition3D partition(Coord<3>(10, 20, 30), Coord<3>(21, 12, 33));
+
+        CoordVector expected;
+        for (HilbertPartition3D::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            expected << *i;
+        }
+
+        for (std::size_t i = 0; i < expected.size(); i += 97) {
+            TS_ASSERT_EQUALS(expected[i], *partition[i]);
+
+            // iterators need to continue correctly from any offset:
+            HilbertPartition3D::Iterator iter = partition[i];
+            for (std::size_t j = i; (j < (i + 50)) && (j < expected.size()); ++j) {
+                TS_ASSERT_EQUALS(expected[j], *iter);
+                ++iter;
+            }
+        }
+
+        TS_ASSERT(partition.end() == partition[expected.size()]);
+    }
+
+    void testContinuity()
+    {
+        // even edge lengths yield a curve without any jumps:
+        checkContinuity(Coord<3>(16, 16, 16));
+        checkContinuity(Coord<3>(8,  12, 20));
+        checkContinuity(Coord<3>(64,  4,  6));
+    }
+
+    void testGetRegion()
+    {
+        Coord<3> origin(5, 6, 7);
+        Coord<3> dimensions(30, 20, 40);
+        std::vector<std::size_t> weights;
+        weights << 1000
+                << 5000
+                << 7000
+                << 11000;
+
+        HilbertPartition3D partition(origin, dimensions, 0, weights);
+        Region<3> accu;
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<3> region = partition.getRegion(i);
+            TS_ASSERT_EQUALS(weights[i], region.size());
+            TS_ASSERT((accu & region).empty());
+            accu += region;
+        }
+
+        Region<3> expected;
+        expected << CoordBox<3>(origin, dimensions);
+        TS_ASSERT_EQUALS(expected, accu);
+    }
+
+    void testSmallerGhostVolumeThanZCurve()
+    {
+        Coord<3> dimensions(64, 64, 64);
+        std::vector<std::size_t> weights(24, dimensions.prod() / 24);
+        weights.back() += dimensions.prod() - sum(weights);
+
+        HilbertPartition3D hilbert(Coord<3>(), dimensions, 0, weights);
+        ZCurvePartition<3> zCurve(Coord<3>(), dimensions, 0, weights);
+
+        TS_ASSERT_LESS_THAN(
+            ghostVolume(hilbert, dimensions, weights.size()),
+            ghostVolume(zCurve,  dimensions, weights.size()));
+    }
+
+private:
+    void checkCompleteness(const Coord<3>& dimensions)
+    {
+        Coord<3> origin(10, 20, 30);
+        HilbertPartition3D partition(origin, dimensions);
+
+        CoordVector expected;
+        CoordBox<3> box(origin, dimensions);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            expected << *i;
+        }
+
+        CoordVector actual;
+        for (HilbertPartition3D::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            actual << *i;
+        }
+
+        sort(expected);
+        sort(actual);
+        TS_ASSERT_EQUALS(expected, actual);
+    }
+
+    void checkContinuity(const Coord<3>& dimensions)
+    {
+        HilbertPartition3D partition(Coord<3>(), dimensions);
+        HilbertPartition3D::Iterator i = partition.begin();
+        Coord<3> last = *i;
+        int steps = 1;
+
+        for (++i; i != partition.end(); ++i) {
+            Coord<3> delta = *i - last;
+            TS_ASSERT_EQUALS(1, delta.abs().sum());
+            last = *i;
+            ++steps;
+        }
+
+        TS_ASSERT_EQUALS(dimensions.prod(), steps);
+    }
+
+    template<typename PARTITION>
+    std::size_t ghostVolume(const PARTITION& partition, const Coord<3>& dimensions, std::size_t numParts)
+    {
+        Region<3> domain;
+        domain << CoordBox<3>(Coord<3>(), dimensions);
+        std::size_t ret = 0;
+
+        for (std::size_t i = 0; i < numParts; ++i) {
+            Region<3> region = partition.getRegion(i);
+            ret += ((region.expand(1) & domain) - region).size();
+        }
+
+        return ret;
+    }
+};
+
+}
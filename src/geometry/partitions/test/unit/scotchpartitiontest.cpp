@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ScotchPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/scotchpartitiontest.h"
+
+static ScotchPartitionTest suite_ScotchPartitionTest;
+
+static CxxTest::List Tests_ScotchPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScotchPartitionTest( "/root/repo/src/geometry/partitions/test/unit/scotchpartitiontest.h", 13, "ScotchPartitionTest", suite_ScotchPartitionTest, Tests_ScotchPartitionTest );
+
+static class TestDescription_suite_ScotchPartitionTest_testComplete2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScotchPartitionTest_testComplete2D() : CxxTest::RealTestDescription( Tests_ScotchPartitionTest, suiteDescription_ScotchPartitionTest, 16, "testComplete2D" ) {}
+ void runTest() { suite_ScotchPartitionTest.testComplete2D(); }
+} testDescription_suite_ScotchPartitionTest_testComplete2D;
+
+static class TestDescription_suite_ScotchPartitionTest_testOverlapse2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScotchPartitionTest_testOverlapse2D() : CxxTest::RealTestDescription( Tests_ScotchPartitionTest, suiteDescription_ScotchPartitionTest, 35, "testOverlapse2D" ) {}
+ void runTest() { suite_ScotchPartitionTest.testOverlapse2D(); }
+} testDescription_suite_ScotchPartitionTest_testOverlapse2D;
+
+static class TestDescription_suite_ScotchPartitionTest_testEqual3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScotchPartitionTest_testEqual3D() : CxxTest::RealTestDescription( Tests_ScotchPartitionTest, suiteDescription_ScotchPartitionTest, 54, "testEqual3D" ) {}
+ void runTest() { suite_ScotchPartitionTest.testEqual3D(); }
+} testDescription_suite_ScotchPartitionTest_testEqual3D;
+
+static class TestDescription_suite_ScotchPartitionTest_testComplete3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScotchPartitionTest_testComplete3D() : CxxTest::RealTestDescription( Tests_ScotchPartitionTest, suiteDescription_ScotchPartitionTest, 75, "testComplete3D" ) {}
+ void runTest() { suite_ScotchPartitionTest.testComplete3D(); }
+} testDescription_suite_ScotchPartitionTest_testComplete3D;
+
+static class TestDescription_suite_ScotchPartitionTest_testOverlapse3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScotchPartitionTest_testOverlapse3D() : CxxTest::RealTestDescription( Tests_ScotchPartitionTest, suiteDescription_ScotchPartitionTest, 96, "testOverlapse3D" ) {}
+ void runTest() { suite_ScotchPartitionTest.testOverlapse3D(); }
+} testDescription_suite_ScotchPartitionTest_testOverlapse3D;
+
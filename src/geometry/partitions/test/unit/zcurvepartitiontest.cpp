@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ZCurvePartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/zcurvepartitiontest.h"
+
+static ZCurvePartitionTest suite_ZCurvePartitionTest;
+
+static CxxTest::List Tests_ZCurvePartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ZCurvePartitionTest( "/root/repo/src/geometry/partitions/test/unit/zcurvepartitiontest.h", 11, "ZCurvePartitionTest", suite_ZCurvePartitionTest, Tests_ZCurvePartitionTest );
+
+static class TestDescription_suite_ZCurvePartitionTest_testFillRectangles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testFillRectangles() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 28, "testFillRectangles" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testFillRectangles(); }
+} testDescription_suite_ZCurvePartitionTest_testFillRectangles;
+
+static class TestDescription_suite_ZCurvePartitionTest_testOperatorInc : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testOperatorInc() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 36, "testOperatorInc" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testOperatorInc(); }
+} testDescription_suite_ZCurvePartitionTest_testOperatorInc;
+
+static class TestDescription_suite_ZCurvePartitionTest_testLoop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testLoop() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 52, "testLoop" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testLoop(); }
+} testDescription_suite_ZCurvePartitionTest_testLoop;
+
+static class TestDescription_suite_ZCurvePartitionTest_testAsymmetric : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testAsymmetric() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 60, "testAsymmetric" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testAsymmetric(); }
+} testDescription_suite_ZCurvePartitionTest_testAsymmetric;
+
+static class TestDescription_suite_ZCurvePartitionTest_testSquareBracketsOperatorVersusIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testSquareBracketsOperatorVersusIteration() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 77, "testSquareBracketsOperatorVersusIteration" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testSquareBracketsOperatorVersusIteration(); }
+} testDescription_suite_ZCurvePartitionTest_testSquareBracketsOperatorVersusIteration;
+
+static class TestDescription_suite_ZCurvePartitionTest_testLarge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_testLarge() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 94, "testLarge" ) {}
+ void runTest() { suite_ZCurvePartitionTest.testLarge(); }
+} testDescription_suite_ZCurvePartitionTest_testLarge;
+
+static class TestDescription_suite_ZCurvePartitionTest_test3dSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_test3dSimple() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 109, "test3dSimple" ) {}
+ void runTest() { suite_ZCurvePartitionTest.test3dSimple(); }
+} testDescription_suite_ZCurvePartitionTest_test3dSimple;
+
+static class TestDescription_suite_ZCurvePartitionTest_test3dLarge2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ZCurvePartitionTest_test3dLarge2() : CxxTest::RealTestDescription( Tests_ZCurvePartitionTest, suiteDescription_ZCurvePartitionTest, 167, "test3dLarge2" ) {}
+ void runTest() { suite_ZCurvePartitionTest.test3dLarge2(); }
+} testDescription_suite_ZCurvePartitionTest_test3dLarge2;
+
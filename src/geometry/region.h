@@ -3,6 +3,7 @@
 
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/regionstreakiterator.h>
+#include <libgeodecomp/geometry/stencils.h>
 #include <libgeodecomp/geometry/streak.h>
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
@@ -637,20 +638,7 @@ public:
         TOPOLOGY /* unused */) const
     {
         Coord<DIM> dia = Coord<DIM>::diagonal(width);
-        Region buffer = expand(dia);
-        Region ret;
-
-        for (StreakIterator i = buffer.beginStreak(); i != buffer.endStreak(); ++i) {
-            Streak<DIM> streak = *i;
-            if (TOPOLOGY::template WrapsAxis<0>::VALUE) {
-                splitStreak<TOPOLOGY>(streak, &ret, globalDimensions);
-            } else {
-                normalizeStreak<TOPOLOGY>(
-                    trimStreak(streak, globalDimensions), &ret, globalDimensions);
-            }
-        }
-
-        return ret;
+        return applyTopology<TOPOLOGY>(expand(dia), globalDimensions);
     }
 
     template<typename TOPOLOGY, typename ADJACENCY>
@@ -673,6 +661,75 @@ public:
         return expandWithAdjacency(width, adjacency);
     }
 
+    /**
+     * Expands the Region by width applications of the stencil's
+     * shape. For Moore stencils this is equivalent to expand(), but
+     * VonNeumann and Cross stencils grow it only along the axes, so
+     * corner and edge cells which no update would ever read are left
+     * out. Only shape and radius are considered, not the stencil's
+     * dimension.
+     */
+    template<int STENCIL_DIM, int RADIUS>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        Stencils::Moore<STENCIL_DIM, RADIUS> /* unused */) const
+    {
+        return expand(width * RADIUS);
+    }
+
+    template<int STENCIL_DIM, int RADIUS>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        Stencils::VonNeumann<STENCIL_DIM, RADIUS> /* unused */) const
+    {
+        // a diamond of radius r is the r-fold sum of unit crosses:
+        return expandAlongAxes(width * RADIUS, 1);
+    }
+
+    template<int STENCIL_DIM, int RADIUS>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        Stencils::Cross<STENCIL_DIM, RADIUS> /* unused */) const
+    {
+        return expandAlongAxes(width, RADIUS);
+    }
+
+    /**
+     * Same as expandWithStencil(), but wraps/trims the Region
+     * according to TOPOLOGY, like expandWithTopology().
+     */
+    template<typename TOPOLOGY, typename STENCIL>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        const Coord<DIM>& globalDimensions,
+        TOPOLOGY /* unused */,
+        STENCIL stencil) const
+    {
+        return applyTopology<TOPOLOGY>(expandWithStencil(width, stencil), globalDimensions);
+    }
+
+    template<typename TOPOLOGY, typename STENCIL, typename ADJACENCY>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        const Coord<DIM>& globalDimensions,
+        TOPOLOGY topology,
+        STENCIL stencil,
+        const ADJACENCY& adjacency) const
+    {
+        return expandWithStencil(width, globalDimensions, topology, stencil);
+    }
+
+    template<typename STENCIL, typename ADJACENCY>
+    inline Region expandWithStencil(
+        const unsigned& width,
+        const Coord<DIM>& /* unused: globalDimensions */,
+        Topologies::Unstructured::Topology /* used just for overload */,
+        STENCIL /* unused: the adjacency defines the neighborhood */,
+        const ADJACENCY& adjacency) const
+    {
+        return expandWithAdjacency(width, adjacency);
+    }
+
     /**
      * does the same as expand, but reads adjacent indices out of
      * an adjacency list
@@ -1439,6 +1496,45 @@ private:
         }
     }
 
+    /**
+     * Adds steps times all cells within radius along any single
+     * axis, i.e. grows the Region by a Cross stencil per step.
+     */
+    inline Region expandAlongAxes(unsigned steps, int radius) const
+    {
+        Region ret = *this;
+
+        for (unsigned i = 0; i < steps; ++i) {
+            Region buffer = ret;
+            for (int d = 0; d < DIM; ++d) {
+                Coord<DIM> radii;
+                radii[d] = radius;
+                buffer += ret.expand(radii);
+            }
+            ret = buffer;
+        }
+
+        return ret;
+    }
+
+    template<typename TOPOLOGY>
+    inline Region applyTopology(const Region& buffer, const Coord<DIM>& globalDimensions) const
+    {
+        Region ret;
+
+        for (StreakIterator i = buffer.beginStreak(); i != buffer.endStreak(); ++i) {
+            Streak<DIM> streak = *i;
+            if (TOPOLOGY::template WrapsAxis<0>::VALUE) {
+                splitStreak<TOPOLOGY>(streak, &ret, globalDimensions);
+            } else {
+                normalizeStreak<TOPOLOGY>(
+                    trimStreak(streak, globalDimensions), &ret, globalDimensions);
+            }
+        }
+
+        return ret;
+    }
+
     static inline void expandInOneDimension(
         int dim, int radius, Region<DIM>& accumulator, Region<DIM>& buffer)
     {
@@ -0,0 +1,38 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}convexpolytopetest.cpp
+  ${RELATIVE_PATH}coordboxtest.cpp
+  ${RELATIVE_PATH}coordtest.cpp
+  ${RELATIVE_PATH}fixedcoordtest.cpp
+  ${RELATIVE_PATH}floatcoordtest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}partitionanalyzertest.cpp
+  ${RELATIVE_PATH}partitionmanagertest.cpp
+  ${RELATIVE_PATH}planetest.cpp
+  ${RELATIVE_PATH}regionbasedadjacencytest.cpp
+  ${RELATIVE_PATH}regionstreakiteratortest.cpp
+  ${RELATIVE_PATH}regiontest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}stencilstest.cpp
+  ${RELATIVE_PATH}topologiestest.cpp
+  ${RELATIVE_PATH}unstructuredgridmeshertest.cpp
+  ${RELATIVE_PATH}voronoimeshertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}convexpolytopetest.h
+  ${RELATIVE_PATH}coord2test.h
+  ${RELATIVE_PATH}coordboxtest.h
+  ${RELATIVE_PATH}coordtest.h
+  ${RELATIVE_PATH}cudaregiontest.h
+  ${RELATIVE_PATH}fixedcoordtest.h
+  ${RELATIVE_PATH}floatcoordtest.h
+  ${RELATIVE_PATH}partitionanalyzertest.h
+  ${RELATIVE_PATH}partitionmanagertest.h
+  ${RELATIVE_PATH}planetest.h
+  ${RELATIVE_PATH}regionbasedadjacencytest.h
+  ${RELATIVE_PATH}regionstreakiteratortest.h
+  ${RELATIVE_PATH}regiontest.h
+  ${RELATIVE_PATH}stencilstest.h
+  ${RELATIVE_PATH}topologiestest.h
+  ${RELATIVE_PATH}unstructuredgridmeshertest.h
+  ${RELATIVE_PATH}voronoimeshertest.h
+)
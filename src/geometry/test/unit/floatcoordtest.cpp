@@ -0,0 +1,211 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FloatCoordTest_init = false;
+#include "/root/repo/src/geometry/test/unit/floatcoordtest.h"
+
+static FloatCoordTest suite_FloatCoordTest;
+
+static CxxTest::List Tests_FloatCoordTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FloatCoordTest( "/root/repo/src/geometry/test/unit/floatcoordtest.h", 11, "FloatCoordTest", suite_FloatCoordTest, Tests_FloatCoordTest );
+
+static class TestDescription_suite_FloatCoordTest_testDefaultConstructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDefaultConstructors() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 14, "testDefaultConstructors" ) {}
+ void runTest() { suite_FloatCoordTest.testDefaultConstructors(); }
+} testDescription_suite_FloatCoordTest_testDefaultConstructors;
+
+static class TestDescription_suite_FloatCoordTest_testLength : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testLength() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 25, "testLength" ) {}
+ void runTest() { suite_FloatCoordTest.testLength(); }
+} testDescription_suite_FloatCoordTest_testLength;
+
+static class TestDescription_suite_FloatCoordTest_testAbs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testAbs() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 32, "testAbs" ) {}
+ void runTest() { suite_FloatCoordTest.testAbs(); }
+} testDescription_suite_FloatCoordTest_testAbs;
+
+static class TestDescription_suite_FloatCoordTest_testSum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testSum() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 44, "testSum" ) {}
+ void runTest() { suite_FloatCoordTest.testSum(); }
+} testDescription_suite_FloatCoordTest_testSum;
+
+static class TestDescription_suite_FloatCoordTest_testScale : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testScale() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 51, "testScale" ) {}
+ void runTest() { suite_FloatCoordTest.testScale(); }
+} testDescription_suite_FloatCoordTest_testScale;
+
+static class TestDescription_suite_FloatCoordTest_testProd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testProd() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 68, "testProd" ) {}
+ void runTest() { suite_FloatCoordTest.testProd(); }
+} testDescription_suite_FloatCoordTest_testProd;
+
+static class TestDescription_suite_FloatCoordTest_testMax : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testMax() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 75, "testMax" ) {}
+ void runTest() { suite_FloatCoordTest.testMax(); }
+} testDescription_suite_FloatCoordTest_testMax;
+
+static class TestDescription_suite_FloatCoordTest_testMin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testMin() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 93, "testMin" ) {}
+ void runTest() { suite_FloatCoordTest.testMin(); }
+} testDescription_suite_FloatCoordTest_testMin;
+
+static class TestDescription_suite_FloatCoordTest_testMaxElement : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testMaxElement() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 111, "testMaxElement" ) {}
+ void runTest() { suite_FloatCoordTest.testMaxElement(); }
+} testDescription_suite_FloatCoordTest_testMaxElement;
+
+static class TestDescription_suite_FloatCoordTest_testMinElement : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testMinElement() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 124, "testMinElement" ) {}
+ void runTest() { suite_FloatCoordTest.testMinElement(); }
+} testDescription_suite_FloatCoordTest_testMinElement;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorPlus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorPlus() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 137, "testOperatorPlus" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorPlus(); }
+} testDescription_suite_FloatCoordTest_testOperatorPlus;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorPlusWithOtherCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorPlusWithOtherCoord() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 163, "testOperatorPlusWithOtherCoord" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorPlusWithOtherCoord(); }
+} testDescription_suite_FloatCoordTest_testOperatorPlusWithOtherCoord;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorMinus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorMinus() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 189, "testOperatorMinus" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorMinus(); }
+} testDescription_suite_FloatCoordTest_testOperatorMinus;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorMinusWithOtherCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorMinusWithOtherCoord() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 216, "testOperatorMinusWithOtherCoord" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorMinusWithOtherCoord(); }
+} testDescription_suite_FloatCoordTest_testOperatorMinusWithOtherCoord;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorUnaryMinus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorUnaryMinus() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 243, "testOperatorUnaryMinus" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorUnaryMinus(); }
+} testDescription_suite_FloatCoordTest_testOperatorUnaryMinus;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorMultiply : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorMultiply() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 255, "testOperatorMultiply" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorMultiply(); }
+} testDescription_suite_FloatCoordTest_testOperatorMultiply;
+
+static class TestDescription_suite_FloatCoordTest_testDotProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDotProduct() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 287, "testDotProduct" ) {}
+ void runTest() { suite_FloatCoordTest.testDotProduct(); }
+} testDescription_suite_FloatCoordTest_testDotProduct;
+
+static class TestDescription_suite_FloatCoordTest_testDotProductWithOtherCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDotProductWithOtherCoord() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 303, "testDotProductWithOtherCoord" ) {}
+ void runTest() { suite_FloatCoordTest.testDotProductWithOtherCoord(); }
+} testDescription_suite_FloatCoordTest_testDotProductWithOtherCoord;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorEquals() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 319, "testOperatorEquals" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorEquals(); }
+} testDescription_suite_FloatCoordTest_testOperatorEquals;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorLess() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 346, "testOperatorLess" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorLess(); }
+} testDescription_suite_FloatCoordTest_testOperatorLess;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorEqualsWithOtherCoordType : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorEqualsWithOtherCoordType() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 365, "testOperatorEqualsWithOtherCoordType" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorEqualsWithOtherCoordType(); }
+} testDescription_suite_FloatCoordTest_testOperatorEqualsWithOtherCoordType;
+
+static class TestDescription_suite_FloatCoordTest_testOperatorDivide : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testOperatorDivide() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 386, "testOperatorDivide" ) {}
+ void runTest() { suite_FloatCoordTest.testOperatorDivide(); }
+} testDescription_suite_FloatCoordTest_testOperatorDivide;
+
+static class TestDescription_suite_FloatCoordTest_testDiagonal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDiagonal() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 417, "testDiagonal" ) {}
+ void runTest() { suite_FloatCoordTest.testDiagonal(); }
+} testDescription_suite_FloatCoordTest_testDiagonal;
+
+static class TestDescription_suite_FloatCoordTest_testDominates1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDominates1D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 424, "testDominates1D" ) {}
+ void runTest() { suite_FloatCoordTest.testDominates1D(); }
+} testDescription_suite_FloatCoordTest_testDominates1D;
+
+static class TestDescription_suite_FloatCoordTest_testDominates2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDominates2D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 442, "testDominates2D" ) {}
+ void runTest() { suite_FloatCoordTest.testDominates2D(); }
+} testDescription_suite_FloatCoordTest_testDominates2D;
+
+static class TestDescription_suite_FloatCoordTest_testDominates3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDominates3D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 465, "testDominates3D" ) {}
+ void runTest() { suite_FloatCoordTest.testDominates3D(); }
+} testDescription_suite_FloatCoordTest_testDominates3D;
+
+static class TestDescription_suite_FloatCoordTest_testStrictlyDominates1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testStrictlyDominates1D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 498, "testStrictlyDominates1D" ) {}
+ void runTest() { suite_FloatCoordTest.testStrictlyDominates1D(); }
+} testDescription_suite_FloatCoordTest_testStrictlyDominates1D;
+
+static class TestDescription_suite_FloatCoordTest_testStrictlyDominates2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testStrictlyDominates2D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 516, "testStrictlyDominates2D" ) {}
+ void runTest() { suite_FloatCoordTest.testStrictlyDominates2D(); }
+} testDescription_suite_FloatCoordTest_testStrictlyDominates2D;
+
+static class TestDescription_suite_FloatCoordTest_testStrictlyDominates3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testStrictlyDominates3D() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 544, "testStrictlyDominates3D" ) {}
+ void runTest() { suite_FloatCoordTest.testStrictlyDominates3D(); }
+} testDescription_suite_FloatCoordTest_testStrictlyDominates3D;
+
+static class TestDescription_suite_FloatCoordTest_testDim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FloatCoordTest_testDim() : CxxTest::RealTestDescription( Tests_FloatCoordTest, suiteDescription_FloatCoordTest, 581, "testDim" ) {}
+ void runTest() { suite_FloatCoordTest.testDim(); }
+} testDescription_suite_FloatCoordTest_testDim;
+
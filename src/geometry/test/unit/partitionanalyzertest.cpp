@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PartitionAnalyzerTest_init = false;
+#include "/root/repo/src/geometry/test/unit/partitionanalyzertest.h"
+
+static PartitionAnalyzerTest suite_PartitionAnalyzerTest;
+
+static CxxTest::List Tests_PartitionAnalyzerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PartitionAnalyzerTest( "/root/repo/src/geometry/test/unit/partitionanalyzertest.h", 12, "PartitionAnalyzerTest", suite_PartitionAnalyzerTest, Tests_PartitionAnalyzerTest );
+
+static class TestDescription_suite_PartitionAnalyzerTest_testStriping : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionAnalyzerTest_testStriping() : CxxTest::RealTestDescription( Tests_PartitionAnalyzerTest, suiteDescription_PartitionAnalyzerTest, 17, "testStriping" ) {}
+ void runTest() { suite_PartitionAnalyzerTest.testStriping(); }
+} testDescription_suite_PartitionAnalyzerTest_testStriping;
+
+static class TestDescription_suite_PartitionAnalyzerTest_testCheckerboarding : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionAnalyzerTest_testCheckerboarding() : CxxTest::RealTestDescription( Tests_PartitionAnalyzerTest, suiteDescription_PartitionAnalyzerTest, 43, "testCheckerboarding" ) {}
+ void runTest() { suite_PartitionAnalyzerTest.testCheckerboarding(); }
+} testDescription_suite_PartitionAnalyzerTest_testCheckerboarding;
+
+static class TestDescription_suite_PartitionAnalyzerTest_testRecommendation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionAnalyzerTest_testRecommendation() : CxxTest::RealTestDescription( Tests_PartitionAnalyzerTest, suiteDescription_PartitionAnalyzerTest, 58, "testRecommendation" ) {}
+ void runTest() { suite_PartitionAnalyzerTest.testRecommendation(); }
+} testDescription_suite_PartitionAnalyzerTest_testRecommendation;
+
@@ -0,0 +1,78 @@
+#include <libgeodecomp/geometry/partitionanalyzer.h>
+#include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/topologies.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class PartitionAnalyzerTest : public CxxTest::TestSuite
+{
+public:
+    typedef PartitionAnalyzer<Topologies::Cube<3>::Topology> Analyzer;
+
+    void testStriping()
+    {
+        Analyzer analyzer(Coord<3>(64, 64, 64));
+        const Analyzer::Report& report = analyzer.analyze<StripingPartition<3> >("striping", 8);
+
+        TS_ASSERT_EQUALS(std::string("striping"), report.name);
+        TS_ASSERT_EQUALS(std::size_t(8), report.ranks.size());
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            std::size_t expectedNeighbors = ((i == 0) || (i == 7)) ? 1 : 2;
+            TS_ASSERT_EQUALS(std::size_t(64 * 64 * 8),             report.ranks[i].volume);
+            TS_ASSERT_EQUALS(expectedNeighbors,                    report.ranks[i].numNeighbors);
+            TS_ASSERT_EQUALS(expectedNeighbors * 2,                report.ranks[i].numMessages);
+            TS_ASSERT_EQUALS(expectedNeighbors * 64 * 64,          report.ranks[i].outerGhostVolume);
+            TS_ASSERT_EQUALS(expectedNeighbors * 64 * 64,          report.ranks[i].innerGhostVolume);
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(64 * 64 * 8), report.maxVolume);
+        TS_ASSERT_EQUALS(1.0,                      report.loadImbalance);
+        TS_ASSERT_EQUALS(std::size_t(14 * 64 * 64), report.totalGhostVolume);
+        TS_ASSERT_EQUALS(std::size_t(2 * 64 * 64), report.maxGhostVolume);
+        TS_ASSERT_EQUALS(std::size_t(2),           report.maxNeighbors);
+        TS_ASSERT_EQUALS(1.75,                     report.meanNeighbors);
+        TS_ASSERT_EQUALS(14.0,                     report.messagesPerStep);
+    }
+
+    void testCheckerboarding()
+    {
+        Analyzer analyzer(Coord<3>(64, 64, 64), 2);
+        const Analyzer::Report& report = analyzer.analyze<CheckerboardingPartition<3> >("checkerboarding", 8);
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            TS_ASSERT_EQUALS(std::size_t(32 * 32 * 32),           report.ranks[i].volume);
+            TS_ASSERT_EQUALS(std::size_t(7),                      report.ranks[i].numNeighbors);
+            TS_ASSERT_EQUALS(std::size_t(34 * 34 * 34 - 32 * 32 * 32), report.ranks[i].outerGhostVolume);
+        }
+
+        // the ghost zones are twice as wide, but only synchronized every other step:
+        TS_ASSERT_EQUALS(28.0, report.messagesPerStep);
+    }
+
+    void testRecommendation()
+    {
+        Coord<3> dim(64, 64, 64);
+
+        // latency-bound: fewer neighbors win
+        Analyzer analyzer1(dim, 1, Analyzer::CostModel(1e-3, 1e12));
+        TS_ASSERT_THROWS(analyzer1.recommendation(), std::logic_error&);
+        analyzer1.analyze<StripingPartition<3> >("striping", 8);
+        analyzer1.analyze<CheckerboardingPartition<3> >("checkerboarding", 8);
+        TS_ASSERT_EQUALS(std::size_t(2), analyzer1.getReports().size());
+        TS_ASSERT_EQUALS(std::string("striping"), analyzer1.recommendation().name);
+
+        // bandwidth-bound: smaller surfaces win
+        Analyzer analyzer2(dim, 1, Analyzer::CostModel(0, 1e6));
+        analyzer2.analyze<StripingPartition<3> >("striping", 8);
+        analyzer2.analyze<CheckerboardingPartition<3> >("checkerboarding", 8);
+        TS_ASSERT_EQUALS(std::string("checkerboarding"), analyzer2.recommendation().name);
+    }
+};
+
+}
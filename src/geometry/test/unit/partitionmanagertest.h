@@ -137,6 +137,45 @@ public:
         TS_ASSERT_EQUALS(expected, partitionManager.getOuterRim());
     }
 
+    void testVonNeumannStencilExcludesCorners()
+    {
+        CoordBox<2> box(Coord<2>(), Coord<2>(30, 30));
+        std::vector<std::size_t> weights(4, 225);
+        boost::shared_ptr<Partition<2> > partition(
+            new RecursiveBisectionPartition<2>(Coord<2>(), box.dimensions, 0, weights));
+
+        typedef Topologies::Cube<2>::Topology Topology;
+        PartitionManager<Topology> moore;
+        PartitionManager<Topology, Stencils::VonNeumann<2, 1> > vonNeumann;
+        moore.resetRegions(box, partition, 0, 2);
+        vonNeumann.resetRegions(box, partition, 0, 2);
+
+        std::vector<CoordBox<2> > boundingBoxes;
+        for (int i = 0; i < 4; ++i) {
+            boundingBoxes << moore.getRegion(i, 0).boundingBox();
+        }
+        moore.resetGhostZones(boundingBoxes);
+        vonNeumann.resetGhostZones(boundingBoxes);
+
+        TS_ASSERT_EQUALS(moore.ownRegion(), vonNeumann.ownRegion());
+        TS_ASSERT_EQUALS(Region<2>() << CoordBox<2>(Coord<2>(), Coord<2>(15, 15)), moore.ownRegion());
+
+        TS_ASSERT_EQUALS(std::size_t(17 * 17 - 15 * 15), moore.getOuterRim().size());
+        TS_ASSERT_EQUALS(std::size_t(17 * 17 - 15 * 15 - 3), vonNeumann.getOuterRim().size());
+        TS_ASSERT((vonNeumann.getOuterRim() - moore.getOuterRim()).empty());
+        TS_ASSERT_EQUALS(std::size_t(0), vonNeumann.getOuterRim().count(Coord<2>(16, 16)));
+
+        // node 3 is our diagonal neighbor, so with a VonNeumann
+        // stencil just a single cell needs to be communicated:
+        TS_ASSERT_EQUALS(std::size_t(4), moore.getOuterGhostZoneFragments()[3].back().size());
+        TS_ASSERT_EQUALS(
+            Region<2>() << Coord<2>(15, 15),
+            vonNeumann.getOuterGhostZoneFragments()[3].back());
+        TS_ASSERT(vonNeumann.getOuterGhostZoneFragments()[3][1].empty());
+
+        TS_ASSERT_EQUALS(moore.innerSet(2), vonNeumann.innerSet(2));
+    }
+
     void test3D()
     {
         int ghostZoneWidth = 4;
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionBasedAdjacencyTest_init = false;
+#include "/root/repo/src/geometry/test/unit/regionbasedadjacencytest.h"
+
+static RegionBasedAdjacencyTest suite_RegionBasedAdjacencyTest;
+
+static CxxTest::List Tests_RegionBasedAdjacencyTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionBasedAdjacencyTest( "/root/repo/src/geometry/test/unit/regionbasedadjacencytest.h", 11, "RegionBasedAdjacencyTest", suite_RegionBasedAdjacencyTest, Tests_RegionBasedAdjacencyTest );
+
+static class TestDescription_suite_RegionBasedAdjacencyTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionBasedAdjacencyTest_testBasic() : CxxTest::RealTestDescription( Tests_RegionBasedAdjacencyTest, suiteDescription_RegionBasedAdjacencyTest, 14, "testBasic" ) {}
+ void runTest() { suite_RegionBasedAdjacencyTest.testBasic(); }
+} testDescription_suite_RegionBasedAdjacencyTest_testBasic;
+
+static class TestDescription_suite_RegionBasedAdjacencyTest_testBulkInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionBasedAdjacencyTest_testBulkInsert() : CxxTest::RealTestDescription( Tests_RegionBasedAdjacencyTest, suiteDescription_RegionBasedAdjacencyTest, 57, "testBulkInsert" ) {}
+ void runTest() { suite_RegionBasedAdjacencyTest.testBulkInsert(); }
+} testDescription_suite_RegionBasedAdjacencyTest_testBulkInsert;
+
@@ -0,0 +1,476 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionTest_init = false;
+#include "/root/repo/src/geometry/test/unit/regiontest.h"
+
+static RegionTest suite_RegionTest;
+
+static CxxTest::List Tests_RegionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionTest( "/root/repo/src/geometry/test/unit/regiontest.h", 15, "RegionTest", suite_RegionTest, Tests_RegionTest );
+
+static class TestDescription_suite_RegionTest_testExpandWithAdjacency : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithAdjacency() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 69, "testExpandWithAdjacency" ) {}
+ void runTest() { suite_RegionTest.testExpandWithAdjacency(); }
+} testDescription_suite_RegionTest_testExpandWithAdjacency;
+
+static class TestDescription_suite_RegionTest_testMoveAssignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMoveAssignment() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 133, "testMoveAssignment" ) {}
+ void runTest() { suite_RegionTest.testMoveAssignment(); }
+} testDescription_suite_RegionTest_testMoveAssignment;
+
+static class TestDescription_suite_RegionTest_testMoveConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMoveConstructor() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 155, "testMoveConstructor" ) {}
+ void runTest() { suite_RegionTest.testMoveConstructor(); }
+} testDescription_suite_RegionTest_testMoveConstructor;
+
+static class TestDescription_suite_RegionTest_testIntersectOrTouch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIntersectOrTouch() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 176, "testIntersectOrTouch" ) {}
+ void runTest() { suite_RegionTest.testIntersectOrTouch(); }
+} testDescription_suite_RegionTest_testIntersectOrTouch;
+
+static class TestDescription_suite_RegionTest_testIntersect : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIntersect() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 212, "testIntersect" ) {}
+ void runTest() { suite_RegionTest.testIntersect(); }
+} testDescription_suite_RegionTest_testIntersect;
+
+static class TestDescription_suite_RegionTest_testFuse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testFuse() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 250, "testFuse" ) {}
+ void runTest() { suite_RegionTest.testFuse(); }
+} testDescription_suite_RegionTest_testFuse;
+
+static class TestDescription_suite_RegionTest_testSubstract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSubstract() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 268, "testSubstract" ) {}
+ void runTest() { suite_RegionTest.testSubstract(); }
+} testDescription_suite_RegionTest_testSubstract;
+
+static class TestDescription_suite_RegionTest_testInsert1a : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1a() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 296, "testInsert1a" ) {}
+ void runTest() { suite_RegionTest.testInsert1a(); }
+} testDescription_suite_RegionTest_testInsert1a;
+
+static class TestDescription_suite_RegionTest_testInsert1b : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1b() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 307, "testInsert1b" ) {}
+ void runTest() { suite_RegionTest.testInsert1b(); }
+} testDescription_suite_RegionTest_testInsert1b;
+
+static class TestDescription_suite_RegionTest_testInsert1c : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1c() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 318, "testInsert1c" ) {}
+ void runTest() { suite_RegionTest.testInsert1c(); }
+} testDescription_suite_RegionTest_testInsert1c;
+
+static class TestDescription_suite_RegionTest_testInsert2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 326, "testInsert2" ) {}
+ void runTest() { suite_RegionTest.testInsert2(); }
+} testDescription_suite_RegionTest_testInsert2;
+
+static class TestDescription_suite_RegionTest_testInsert3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 358, "testInsert3" ) {}
+ void runTest() { suite_RegionTest.testInsert3(); }
+} testDescription_suite_RegionTest_testInsert3;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 379, "testInsertCoordBox1D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox1D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox1D;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 391, "testInsertCoordBox2D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox2D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox2D;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 405, "testInsertCoordBox3D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox3D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox3D;
+
+static class TestDescription_suite_RegionTest_testInsert3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 422, "testInsert3D" ) {}
+ void runTest() { suite_RegionTest.testInsert3D(); }
+} testDescription_suite_RegionTest_testInsert3D;
+
+static class TestDescription_suite_RegionTest_testInsertVsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertVsOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 465, "testInsertVsOperator" ) {}
+ void runTest() { suite_RegionTest.testInsertVsOperator(); }
+} testDescription_suite_RegionTest_testInsertVsOperator;
+
+static class TestDescription_suite_RegionTest_testCount : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCount() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 478, "testCount" ) {}
+ void runTest() { suite_RegionTest.testCount(); }
+} testDescription_suite_RegionTest_testCount;
+
+static class TestDescription_suite_RegionTest_testCountCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCountCoord() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 526, "testCountCoord" ) {}
+ void runTest() { suite_RegionTest.testCountCoord(); }
+} testDescription_suite_RegionTest_testCountCoord;
+
+static class TestDescription_suite_RegionTest_testCountStreak : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCountStreak() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 556, "testCountStreak" ) {}
+ void runTest() { suite_RegionTest.testCountStreak(); }
+} testDescription_suite_RegionTest_testCountStreak;
+
+static class TestDescription_suite_RegionTest_testStreakIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIteration() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 575, "testStreakIteration" ) {}
+ void runTest() { suite_RegionTest.testStreakIteration(); }
+} testDescription_suite_RegionTest_testStreakIteration;
+
+static class TestDescription_suite_RegionTest_testEmptyStreakIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEmptyStreakIteration() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 603, "testEmptyStreakIteration" ) {}
+ void runTest() { suite_RegionTest.testEmptyStreakIteration(); }
+} testDescription_suite_RegionTest_testEmptyStreakIteration;
+
+static class TestDescription_suite_RegionTest_testUnorderedInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testUnorderedInsert() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 620, "testUnorderedInsert" ) {}
+ void runTest() { suite_RegionTest.testUnorderedInsert(); }
+} testDescription_suite_RegionTest_testUnorderedInsert;
+
+static class TestDescription_suite_RegionTest_testBigInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBigInsert() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 648, "testBigInsert" ) {}
+ void runTest() { suite_RegionTest.testBigInsert(); }
+} testDescription_suite_RegionTest_testBigInsert;
+
+static class TestDescription_suite_RegionTest_testSubstractionOfCoordBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSubstractionOfCoordBox() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 688, "testSubstractionOfCoordBox" ) {}
+ void runTest() { suite_RegionTest.testSubstractionOfCoordBox(); }
+} testDescription_suite_RegionTest_testSubstractionOfCoordBox;
+
+static class TestDescription_suite_RegionTest_testEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEmpty() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 708, "testEmpty" ) {}
+ void runTest() { suite_RegionTest.testEmpty(); }
+} testDescription_suite_RegionTest_testEmpty;
+
+static class TestDescription_suite_RegionTest_testBoundingBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBoundingBox() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 716, "testBoundingBox" ) {}
+ void runTest() { suite_RegionTest.testBoundingBox(); }
+} testDescription_suite_RegionTest_testBoundingBox;
+
+static class TestDescription_suite_RegionTest_testSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSize() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 768, "testSize" ) {}
+ void runTest() { suite_RegionTest.testSize(); }
+} testDescription_suite_RegionTest_testSize;
+
+static class TestDescription_suite_RegionTest_testDimension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testDimension() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 783, "testDimension" ) {}
+ void runTest() { suite_RegionTest.testDimension(); }
+} testDescription_suite_RegionTest_testDimension;
+
+static class TestDescription_suite_RegionTest_testExpand1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 795, "testExpand1" ) {}
+ void runTest() { suite_RegionTest.testExpand1(); }
+} testDescription_suite_RegionTest_testExpand1;
+
+static class TestDescription_suite_RegionTest_testExpand2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 842, "testExpand2" ) {}
+ void runTest() { suite_RegionTest.testExpand2(); }
+} testDescription_suite_RegionTest_testExpand2;
+
+static class TestDescription_suite_RegionTest_testExpand3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 862, "testExpand3" ) {}
+ void runTest() { suite_RegionTest.testExpand3(); }
+} testDescription_suite_RegionTest_testExpand3;
+
+static class TestDescription_suite_RegionTest_testDelete : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testDelete() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 884, "testDelete" ) {}
+ void runTest() { suite_RegionTest.testDelete(); }
+} testDescription_suite_RegionTest_testDelete;
+
+static class TestDescription_suite_RegionTest_testAndNot1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndNot1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 914, "testAndNot1" ) {}
+ void runTest() { suite_RegionTest.testAndNot1(); }
+} testDescription_suite_RegionTest_testAndNot1;
+
+static class TestDescription_suite_RegionTest_testAndNot2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndNot2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 944, "testAndNot2" ) {}
+ void runTest() { suite_RegionTest.testAndNot2(); }
+} testDescription_suite_RegionTest_testAndNot2;
+
+static class TestDescription_suite_RegionTest_testAndAssignmentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndAssignmentOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 965, "testAndAssignmentOperator" ) {}
+ void runTest() { suite_RegionTest.testAndAssignmentOperator(); }
+} testDescription_suite_RegionTest_testAndAssignmentOperator;
+
+static class TestDescription_suite_RegionTest_testAndOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 990, "testAndOperator" ) {}
+ void runTest() { suite_RegionTest.testAndOperator(); }
+} testDescription_suite_RegionTest_testAndOperator;
+
+static class TestDescription_suite_RegionTest_testAddAssignmentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAddAssignmentOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1014, "testAddAssignmentOperator" ) {}
+ void runTest() { suite_RegionTest.testAddAssignmentOperator(); }
+} testDescription_suite_RegionTest_testAddAssignmentOperator;
+
+static class TestDescription_suite_RegionTest_testAddOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAddOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1039, "testAddOperator" ) {}
+ void runTest() { suite_RegionTest.testAddOperator(); }
+} testDescription_suite_RegionTest_testAddOperator;
+
+static class TestDescription_suite_RegionTest_testEqualsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEqualsOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1063, "testEqualsOperator" ) {}
+ void runTest() { suite_RegionTest.testEqualsOperator(); }
+} testDescription_suite_RegionTest_testEqualsOperator;
+
+static class TestDescription_suite_RegionTest_testNumStreaks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testNumStreaks() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1085, "testNumStreaks" ) {}
+ void runTest() { suite_RegionTest.testNumStreaks(); }
+} testDescription_suite_RegionTest_testNumStreaks;
+
+static class TestDescription_suite_RegionTest_testToVector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testToVector() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1103, "testToVector" ) {}
+ void runTest() { suite_RegionTest.testToVector(); }
+} testDescription_suite_RegionTest_testToVector;
+
+static class TestDescription_suite_RegionTest_testIteratorInsertConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIteratorInsertConstructor() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1125, "testIteratorInsertConstructor" ) {}
+ void runTest() { suite_RegionTest.testIteratorInsertConstructor(); }
+} testDescription_suite_RegionTest_testIteratorInsertConstructor;
+
+static class TestDescription_suite_RegionTest_testClear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testClear() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1139, "testClear" ) {}
+ void runTest() { suite_RegionTest.testClear(); }
+} testDescription_suite_RegionTest_testClear;
+
+static class TestDescription_suite_RegionTest_test3DSimple1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1151, "test3DSimple1" ) {}
+ void runTest() { suite_RegionTest.test3DSimple1(); }
+} testDescription_suite_RegionTest_test3DSimple1;
+
+static class TestDescription_suite_RegionTest_test3DSimple2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1175, "test3DSimple2" ) {}
+ void runTest() { suite_RegionTest.test3DSimple2(); }
+} testDescription_suite_RegionTest_test3DSimple2;
+
+static class TestDescription_suite_RegionTest_test3DSimple3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1195, "test3DSimple3" ) {}
+ void runTest() { suite_RegionTest.test3DSimple3(); }
+} testDescription_suite_RegionTest_test3DSimple3;
+
+static class TestDescription_suite_RegionTest_test3DSimple4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple4() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1211, "test3DSimple4" ) {}
+ void runTest() { suite_RegionTest.test3DSimple4(); }
+} testDescription_suite_RegionTest_test3DSimple4;
+
+static class TestDescription_suite_RegionTest_testExpand3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1235, "testExpand3D" ) {}
+ void runTest() { suite_RegionTest.testExpand3D(); }
+} testDescription_suite_RegionTest_testExpand3D;
+
+static class TestDescription_suite_RegionTest_testExpandWithTopology1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithTopology1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1260, "testExpandWithTopology1" ) {}
+ void runTest() { suite_RegionTest.testExpandWithTopology1(); }
+} testDescription_suite_RegionTest_testExpandWithTopology1;
+
+static class TestDescription_suite_RegionTest_testExpandWithTopology2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithTopology2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1291, "testExpandWithTopology2" ) {}
+ void runTest() { suite_RegionTest.testExpandWithTopology2(); }
+} testDescription_suite_RegionTest_testExpandWithTopology2;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencil2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencil2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1313, "testExpandWithStencil2D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencil2D(); }
+} testDescription_suite_RegionTest_testExpandWithStencil2D;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencil3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencil3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1340, "testExpandWithStencil3D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencil3D(); }
+} testDescription_suite_RegionTest_testExpandWithStencil3D;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencilAndTopology : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencilAndTopology() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1355, "testExpandWithStencilAndTopology" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencilAndTopology(); }
+} testDescription_suite_RegionTest_testExpandWithStencilAndTopology;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1388, "testExpandWithRadius1D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius1D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius1D;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1404, "testExpandWithRadius2D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius2D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius2D;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1417, "testExpandWithRadius3D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius3D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius3D;
+
+static class TestDescription_suite_RegionTest_testBoolean3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBoolean3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1432, "testBoolean3D" ) {}
+ void runTest() { suite_RegionTest.testBoolean3D(); }
+} testDescription_suite_RegionTest_testBoolean3D;
+
+static class TestDescription_suite_RegionTest_testSwap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSwap() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1462, "testSwap" ) {}
+ void runTest() { suite_RegionTest.testSwap(); }
+} testDescription_suite_RegionTest_testSwap;
+
+static class TestDescription_suite_RegionTest_testRemove1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRemove1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1488, "testRemove1D" ) {}
+ void runTest() { suite_RegionTest.testRemove1D(); }
+} testDescription_suite_RegionTest_testRemove1D;
+
+static class TestDescription_suite_RegionTest_testRemove3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRemove3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1502, "testRemove3D" ) {}
+ void runTest() { suite_RegionTest.testRemove3D(); }
+} testDescription_suite_RegionTest_testRemove3D;
+
+static class TestDescription_suite_RegionTest_testMerge2way : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMerge2way() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1557, "testMerge2way" ) {}
+ void runTest() { suite_RegionTest.testMerge2way(); }
+} testDescription_suite_RegionTest_testMerge2way;
+
+static class TestDescription_suite_RegionTest_testMerge3way : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMerge3way() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1577, "testMerge3way" ) {}
+ void runTest() { suite_RegionTest.testMerge3way(); }
+} testDescription_suite_RegionTest_testMerge3way;
+
+static class TestDescription_suite_RegionTest_testStreakIterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIterator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1687, "testStreakIterator" ) {}
+ void runTest() { suite_RegionTest.testStreakIterator(); }
+} testDescription_suite_RegionTest_testStreakIterator;
+
+static class TestDescription_suite_RegionTest_testNormalIterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testNormalIterator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1740, "testNormalIterator" ) {}
+ void runTest() { suite_RegionTest.testNormalIterator(); }
+} testDescription_suite_RegionTest_testNormalIterator;
+
+static class TestDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1762, "testOffsetBasedStreakIteratorAccess" ) {}
+ void runTest() { suite_RegionTest.testOffsetBasedStreakIteratorAccess(); }
+} testDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess;
+
+static class TestDescription_suite_RegionTest_testRandomAccessIteratorAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRandomAccessIteratorAccess() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1799, "testRandomAccessIteratorAccess" ) {}
+ void runTest() { suite_RegionTest.testRandomAccessIteratorAccess(); }
+} testDescription_suite_RegionTest_testRandomAccessIteratorAccess;
+
+static class TestDescription_suite_RegionTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testToString() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1823, "testToString" ) {}
+ void runTest() { suite_RegionTest.testToString(); }
+} testDescription_suite_RegionTest_testToString;
+
+static class TestDescription_suite_RegionTest_testPrettyPrint : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrettyPrint() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1851, "testPrettyPrint" ) {}
+ void runTest() { suite_RegionTest.testPrettyPrint(); }
+} testDescription_suite_RegionTest_testPrettyPrint;
+
+static class TestDescription_suite_RegionTest_testPlaneStreakIterator3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPlaneStreakIterator3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1879, "testPlaneStreakIterator3D" ) {}
+ void runTest() { suite_RegionTest.testPlaneStreakIterator3D(); }
+} testDescription_suite_RegionTest_testPlaneStreakIterator3D;
+
+static class TestDescription_suite_RegionTest_testPlaneStreakIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPlaneStreakIterator2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1919, "testPlaneStreakIterator2D" ) {}
+ void runTest() { suite_RegionTest.testPlaneStreakIterator2D(); }
+} testDescription_suite_RegionTest_testPlaneStreakIterator2D;
+
+static class TestDescription_suite_RegionTest_testStreakIteratorOnOrAfter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIteratorOnOrAfter() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1937, "testStreakIteratorOnOrAfter" ) {}
+ void runTest() { suite_RegionTest.testStreakIteratorOnOrAfter(); }
+} testDescription_suite_RegionTest_testStreakIteratorOnOrAfter;
+
+static class TestDescription_suite_RegionTest_testPrettyPrint2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrettyPrint2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2071, "testPrettyPrint2D" ) {}
+ void runTest() { suite_RegionTest.testPrettyPrint2D(); }
+} testDescription_suite_RegionTest_testPrettyPrint2D;
+
+static class TestDescription_suite_RegionTest_testPrintToBOV3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrintToBOV3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2082, "testPrintToBOV3D" ) {}
+ void runTest() { suite_RegionTest.testPrintToBOV3D(); }
+} testDescription_suite_RegionTest_testPrintToBOV3D;
+
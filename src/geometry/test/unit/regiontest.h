@@ -1310,6 +1310,81 @@ public:
         TS_ASSERT_EQUALS(actual, expected);
     }
 
+    void testExpandWithStencil2D()
+    {
+        Region<2> r;
+        r << Coord<2>(5, 5);
+
+        TS_ASSERT_EQUALS(r.expand(1), r.expandWithStencil(1, Stencils::Moore<2, 1>()));
+        TS_ASSERT_EQUALS(r.expand(4), r.expandWithStencil(2, Stencils::Moore<2, 2>()));
+
+        Region<2> expected;
+        expected << Streak<2>(Coord<2>(5, 3), 6)
+                 << Streak<2>(Coord<2>(4, 4), 7)
+                 << Streak<2>(Coord<2>(3, 5), 8)
+                 << Streak<2>(Coord<2>(4, 6), 7)
+                 << Streak<2>(Coord<2>(5, 7), 6);
+        TS_ASSERT_EQUALS(expected, r.expandWithStencil(2, Stencils::VonNeumann<2, 1>()));
+        TS_ASSERT_EQUALS(expected, r.expandWithStencil(1, Stencils::VonNeumann<2, 2>()));
+        TS_ASSERT_EQUALS(expected, r.expandWithStencil(2, Stencils::Cross<2, 1>()));
+
+        expected.clear();
+        expected << Streak<2>(Coord<2>(5, 3), 6)
+                 << Streak<2>(Coord<2>(5, 4), 6)
+                 << Streak<2>(Coord<2>(3, 5), 8)
+                 << Streak<2>(Coord<2>(5, 6), 6)
+                 << Streak<2>(Coord<2>(5, 7), 6);
+        TS_ASSERT_EQUALS(expected, r.expandWithStencil(1, Stencils::Cross<2, 2>()));
+    }
+
+    void testExpandWithStencil3D()
+    {
+        Region<3> r;
+        r << CoordBox<3>(Coord<3>(10, 10, 10), Coord<3>(4, 3, 2));
+
+        // only the faces are added, edges and corners are left out:
+        Region<3> actual = r.expandWithStencil(1, Stencils::VonNeumann<3, 1>());
+        TS_ASSERT_EQUALS(std::size_t(24 + 2 * (12 + 8 + 6)), actual.size());
+        TS_ASSERT_EQUALS(std::size_t(1), actual.count(Coord<3>( 9, 10, 10)));
+        TS_ASSERT_EQUALS(std::size_t(0), actual.count(Coord<3>( 9,  9, 10)));
+        TS_ASSERT_EQUALS(std::size_t(0), actual.count(Coord<3>(14, 13, 12)));
+
+        TS_ASSERT_EQUALS(std::size_t(6 * 5 * 4), r.expandWithStencil(1, Stencils::Moore<3, 1>()).size());
+    }
+
+    void testExpandWithStencilAndTopology()
+    {
+        Region<2> r;
+        r << Coord<2>(0, 0);
+
+        Region<2> expected;
+        expected << Coord<2>(0, 0)
+                 << Coord<2>(1, 0)
+                 << Coord<2>(9, 0)
+                 << Coord<2>(0, 1)
+                 << Coord<2>(0, 9);
+        TS_ASSERT_EQUALS(
+            expected,
+            r.expandWithStencil(
+                1,
+                Coord<2>(10, 10),
+                Topologies::Torus<2>::Topology(),
+                Stencils::VonNeumann<2, 1>(),
+                Adjacency()));
+
+        expected.clear();
+        expected << Coord<2>(0, 0)
+                 << Coord<2>(1, 0)
+                 << Coord<2>(0, 1);
+        TS_ASSERT_EQUALS(
+            expected,
+            r.expandWithStencil(
+                1,
+                Coord<2>(10, 10),
+                Topologies::Cube<2>::Topology(),
+                Stencils::Cross<2, 1>()));
+    }
+
     void testExpandWithRadius1D()
     {
         Region<1> r;
@@ -7,6 +7,8 @@
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/gridvecconv.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
 
 namespace LibGeoDecomp {
 
@@ -23,6 +25,8 @@ public:
     typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
     typedef DisplacedGrid<CELL_TYPE, Topology> StorageGridType;
     typedef typename DistributedSimulator<CELL_TYPE>::GridType SimulatorGridType;
+    typedef typename SerializationBuffer<CELL_TYPE>::BufferType BufferType;
+    typedef typename SerializationBuffer<CELL_TYPE>::FixedSize FixedSize;
 
     using ParallelWriter<CELL_TYPE>::period;
 
@@ -37,7 +41,8 @@ public:
         writer(writer),
         mpiLayer(communicator),
         root(root),
-        datatype(mpiDatatype)
+        datatype(mpiDatatype),
+        bufferSize(0)
     {
         if ((mpiLayer.rank() != root) && (writer != 0)) {
             throw std::invalid_argument("can't call back a writer on a node other than the root");
@@ -85,21 +90,11 @@ public:
                 if (mpiLayer.rank() == root) {
                     Region<DIM> recvRegion;
                     mpiLayer.recvRegion(&recvRegion, sender);
-                    mpiLayer.recvUnregisteredRegion(
-                        &globalGrid,
-                        recvRegion,
-                        sender,
-                        MPILayer::PARALLEL_MEMORY_WRITER,
-                        datatype);
+                    recvCells(recvRegion, sender, FixedSize());
                 }
                 if (mpiLayer.rank() == sender) {
                     mpiLayer.sendRegion(validRegion, root);
-                    mpiLayer.sendUnregisteredRegion(
-                        &localGrid,
-                        validRegion,
-                        root,
-                        MPILayer::PARALLEL_MEMORY_WRITER,
-                        datatype);
+                    sendCells(localGrid, validRegion, FixedSize());
                 }
             }
         }
@@ -117,6 +112,57 @@ private:
     int root;
     StorageGridType globalGrid;
     MPI_Datatype datatype;
+    BufferType buffer;
+    int bufferSize;
+
+    void sendCells(StorageGridType& localGrid, const Region<DIM>& region, APITraits::TrueType)
+    {
+        mpiLayer.sendUnregisteredRegion(
+            &localGrid,
+            region,
+            root,
+            MPILayer::PARALLEL_MEMORY_WRITER,
+            datatype);
+    }
+
+    void recvCells(const Region<DIM>& region, int sender, APITraits::TrueType)
+    {
+        mpiLayer.recvUnregisteredRegion(
+            &globalGrid,
+            region,
+            sender,
+            MPILayer::PARALLEL_MEMORY_WRITER,
+            datatype);
+    }
+
+    /**
+     * Cells of varying size can't be described by an MPI datatype,
+     * so we serialize them (reusing the buffer) and send the buffer's
+     * size ahead.
+     */
+    void sendCells(StorageGridType& localGrid, const Region<DIM>& region, APITraits::FalseType)
+    {
+        GridVecConv::gridToVector(localGrid, &buffer, region);
+        bufferSize = buffer.size();
+        mpiLayer.send(&bufferSize, root, 1, MPILayer::PARALLEL_MEMORY_WRITER, MPI_INT);
+        if (bufferSize > 0) {
+            mpiLayer.send(&buffer[0], root, bufferSize, MPILayer::PARALLEL_MEMORY_WRITER, MPI_CHAR);
+        }
+    }
+
+    void recvCells(const Region<DIM>& region, int sender, APITraits::FalseType)
+    {
+        mpiLayer.recv(&bufferSize, sender, 1, MPILayer::PARALLEL_MEMORY_WRITER, MPI_INT);
+        mpiLayer.wait(MPILayer::PARALLEL_MEMORY_WRITER);
+
+        buffer.resize(bufferSize);
+        if (bufferSize > 0) {
+            mpiLayer.recv(&buffer[0], sender, bufferSize, MPILayer::PARALLEL_MEMORY_WRITER, MPI_CHAR);
+            mpiLayer.wait(MPILayer::PARALLEL_MEMORY_WRITER);
+        }
+
+        GridVecConv::vectorToGrid(buffer, &globalGrid, region);
+    }
 };
 
 }
@@ -0,0 +1,604 @@
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+#ifndef LIBGEODECOMP_IO_COMPRESSEDMPIIO_H
+#define LIBGEODECOMP_IO_COMPRESSEDMPIIO_H
+
+#include <mpi.h>
+
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/misc/stringops.h>
+
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace CompressedMPIIOHelpers {
+
+/**
+ * Lossless codec for arrays of cells: the bytes are first shuffled
+ * (all first bytes of all cells, then all second bytes...) as
+ * neighboring cells of floating point fields tend to share their
+ * sign/exponent bytes, which then form long runs. These are
+ * run-length encoded, all other bytes are stored as literals.
+ *
+ * Encoded stream: a control byte c < 128 is followed by c + 1
+ * literal bytes, c >= 128 denotes c - 125 repetitions of the next
+ * byte.
+ */
+class ShuffleRLECodec
+{
+public:
+    static void encode(
+        const char *data,
+        std::size_t elementSize,
+        std::size_t count,
+        std::vector<char> *target)
+    {
+        std::size_t size = elementSize * count;
+        std::vector<char> shuffled(size);
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t b = 0; b < elementSize; ++b) {
+                shuffled[b * count + i] = data[i * elementSize + b];
+            }
+        }
+
+        std::size_t i = 0;
+        while (i < size) {
+            std::size_t run = runLength(shuffled, i);
+            if (run >= MIN_RUN) {
+                target->push_back(static_cast<char>(128 + run - MIN_RUN));
+                target->push_back(shuffled[i]);
+                i += run;
+                continue;
+            }
+
+            std::size_t start = i;
+            while ((i < size) && ((i - start) < MAX_LITERALS) && (runLength(shuffled, i) < MIN_RUN)) {
+                ++i;
+            }
+            target->push_back(static_cast<char>(i - start - 1));
+            target->insert(target->end(), &shuffled[start], &shuffled[0] + i);
+        }
+    }
+
+    static void decode(
+        const char *source,
+        std::size_t sourceSize,
+        std::size_t elementSize,
+        std::size_t count,
+        char *data)
+    {
+        std::size_t size = elementSize * count;
+        std::vector<char> shuffled(size);
+        std::size_t pos = 0;
+        const char *end = source + sourceSize;
+
+        while (source < end) {
+            unsigned char control = *source++;
+            std::size_t length = (control < 128) ? (control + 1) : (control - 128 + MIN_RUN);
+            std::size_t inputLength = (control < 128) ? length : 1;
+
+            if ((pos + length > size) || (source + inputLength > end)) {
+                throw std::logic_error("ShuffleRLECodec: corrupt input");
+            }
+
+            if (control < 128) {
+                std::copy(source, source + length, &shuffled[pos]);
+            } else {
+                std::fill(&shuffled[pos], &shuffled[pos] + length, *source);
+            }
+            source += inputLength;
+            pos += length;
+        }
+
+        if (pos != size) {
+            throw std::logic_error("ShuffleRLECodec: input too short");
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t b = 0; b < elementSize; ++b) {
+                data[i * elementSize + b] = shuffled[b * count + i];
+            }
+        }
+    }
+
+private:
+    static const std::size_t MIN_RUN = 3;
+    static const std::size_t MAX_RUN = 127 + MIN_RUN;
+    static const std::size_t MAX_LITERALS = 128;
+
+    static std::size_t runLength(const std::vector<char>& data, std::size_t start)
+    {
+        std::size_t end = std::min(data.size(), start + MAX_RUN);
+        std::size_t i = start + 1;
+        while ((i < end) && (data[i] == data[start])) {
+            ++i;
+        }
+
+        return i - start;
+    }
+};
+
+/**
+ * FNV-1a-style 64-bit hash, used for detecting unchanged blocks. It
+ * consumes 8 bytes per round, which is sufficient for change
+ * detection and much faster than hashing bytewise.
+ */
+inline boost::uint64_t hash(const char *data, std::size_t size)
+{
+    boost::uint64_t ret = 14695981039346656037ULL;
+    std::size_t words = size / sizeof(boost::uint64_t);
+
+    for (std::size_t i = 0; i < words; ++i) {
+        boost::uint64_t word;
+        std::memcpy(&word, data + i * sizeof(word), sizeof(word));
+        ret ^= word;
+        ret *= 1099511628211ULL;
+        ret ^= ret >> 29;
+    }
+    for (std::size_t i = words * sizeof(boost::uint64_t); i < size; ++i) {
+        ret ^= static_cast<unsigned char>(data[i]);
+        ret *= 1099511628211ULL;
+    }
+
+    return ret;
+}
+
+/**
+ * Index entry of a compressed checkpoint: a block of cells (part of
+ * a streak) and where its encoded data can be found. dataStep refers
+ * to the checkpoint file containing the data, which may be an
+ * earlier one if the block didn't change in between.
+ */
+template<int DIM>
+class Entry
+{
+public:
+    Streak<DIM> streak;
+    boost::uint64_t hash;
+    boost::uint64_t offset;
+    boost::uint64_t size;
+    unsigned dataStep;
+};
+
+}
+
+/**
+ * Alternative checkpoint format to MPIIO's raw dumps (files use the
+ * extension .cmpiio). Each rank's region is cut into blocks of at
+ * most blockSize cells which are stored compressed (see
+ * ShuffleRLECodec). Blocks whose hash didn't change since the
+ * previous call to writeRegion() aren't written again but referenced
+ * from the older file -- which therefore has to be kept around.
+ *
+ * File layout: header (magic, dimensions, step, maxSteps, number of
+ * index entries, edge cell), the index, then the encoded blocks. The
+ * index allows readRegion() to decode only the blocks it actually
+ * needs. Cells and index are stored bytewise, so CELL_TYPE needs to
+ * be trivially copyable and files can only be read on machines with
+ * the same data layout.
+ */
+template<
+    typename CELL_TYPE,
+    typename TOPOLOGY = typename APITraits::SelectTopology<CELL_TYPE>::Value
+>
+class CompressedMPIIO
+{
+public:
+    static const int DIM = TOPOLOGY::DIM;
+    typedef CompressedMPIIOHelpers::Entry<DIM> Entry;
+
+    explicit CompressedMPIIO(std::size_t blockSize = 4096) :
+        blockSize(blockSize),
+        previousStep(-1),
+        bytesWritten(0)
+    {}
+
+    static std::string filename(const std::string& prefix, unsigned step)
+    {
+        std::ostringstream buf;
+        buf << prefix << std::setfill('0') << std::setw(5) << step << ".cmpiio";
+        return buf.str();
+    }
+
+    /**
+     * Inverse of filename(): extracts the prefix from a checkpoint's
+     * filename. The step is required as the width of its field grows
+     * beyond 5 digits for steps >= 100000.
+     */
+    static std::string prefixOf(const std::string& filename, unsigned step)
+    {
+        std::string suffix = CompressedMPIIO::filename("", step);
+        if ((filename.size() < suffix.size()) ||
+            (filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) != 0)) {
+            throw std::invalid_argument(
+                "checkpoint filename " + filename + " doesn't match its step " + StringOps::itoa(step));
+        }
+
+        return filename.substr(0, filename.size() - suffix.size());
+    }
+
+    /**
+     * Writes a checkpoint to filename(prefix, step). All ranks of
+     * comm need to call this. Unchanged blocks are detected by
+     * comparing with the previous call's blocks.
+     */
+    template<typename GRID_TYPE>
+    void writeRegion(
+        const GRID_TYPE& grid,
+        const Coord<DIM>& dimensions,
+        unsigned step,
+        unsigned maxSteps,
+        const std::string& prefix,
+        const Region<DIM>& region,
+        const MPI_Comm& comm = MPI_COMM_WORLD)
+    {
+        // rewriting a file must not reference its own old contents:
+        if (int(step) == previousStep) {
+            reset();
+        }
+
+        std::vector<Entry> entries;
+        std::vector<std::size_t> newEntries;
+        std::vector<char> payload;
+        std::vector<CELL_TYPE> buffer;
+        BlockMap blocks;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            for (int x = i->origin.x(); x < i->endX; x += int(blockSize)) {
+                Streak<DIM> block(i->origin, std::min(i->endX, x + int(blockSize)));
+                block.origin.x() = x;
+                buffer.resize(block.length());
+                grid.get(block, &buffer[0]);
+
+                const char *data = reinterpret_cast<const char*>(&buffer[0]);
+                std::size_t size = buffer.size() * sizeof(CELL_TYPE);
+                Entry entry;
+                entry.streak = block;
+                entry.hash = CompressedMPIIOHelpers::hash(data, size);
+
+                typename BlockMap::iterator previous = previousBlocks.find(key(block));
+                if ((previous != previousBlocks.end()) && (previous->second.hash == entry.hash)) {
+                    entry = previous->second;
+                } else {
+                    entry.offset = payload.size();
+                    entry.dataStep = step;
+                    CompressedMPIIOHelpers::ShuffleRLECodec::encode(
+                        data, sizeof(CELL_TYPE), buffer.size(), &payload);
+                    entry.size = payload.size() - entry.offset;
+                    newEntries << entries.size();
+                }
+
+                entries << entry;
+            }
+        }
+
+        boost::uint64_t localEntries = entries.size();
+        boost::uint64_t localPayload = payload.size();
+        boost::uint64_t entryOffset = exclusivePrefixSum(localEntries, comm);
+        boost::uint64_t payloadOffset = exclusivePrefixSum(localPayload, comm);
+        boost::uint64_t totalEntries = 0;
+        MPI_Allreduce(&localEntries, &totalEntries, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+
+        MPI_Offset dataStart = headerLength() + totalEntries * sizeof(Entry);
+        for (std::vector<std::size_t>::iterator i = newEntries.begin(); i != newEntries.end(); ++i) {
+            entries[*i].offset += dataStart + payloadOffset;
+        }
+
+        MPI_File file;
+        std::string name = filename(prefix, step);
+        MPI_File_open(
+            comm, const_cast<char*>(name.c_str()),
+            MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+            &file);
+        MPI_File_set_errhandler(file, MPI_ERRORS_ARE_FATAL);
+
+        int rank;
+        MPI_Comm_rank(comm, &rank);
+        if (rank == 0) {
+            std::vector<char> header;
+            append(&header, MAGIC, sizeof(MAGIC));
+            append(&header, &dimensions, sizeof(dimensions));
+            append(&header, &step, sizeof(step));
+            append(&header, &maxSteps, sizeof(maxSteps));
+            append(&header, &totalEntries, sizeof(totalEntries));
+            CELL_TYPE edge = grid.getEdge();
+            append(&header, &edge, sizeof(edge));
+            write(file, 0, &header[0], header.size());
+        }
+
+        if (localEntries > 0) {
+            write(file, headerLength() + entryOffset * sizeof(Entry), &entries[0], localEntries * sizeof(Entry));
+        }
+        if (localPayload > 0) {
+            write(file, dataStart + payloadOffset, &payload[0], localPayload);
+        }
+        MPI_File_close(&file);
+
+        for (typename std::vector<Entry>::iterator i = entries.begin(); i != entries.end(); ++i) {
+            blocks[key(i->streak)] = *i;
+        }
+        previousBlocks.swap(blocks);
+        previousStep = step;
+        bytesWritten = localPayload + localEntries * sizeof(Entry);
+    }
+
+    void readMetadata(
+        Coord<DIM> *dimensions,
+        unsigned *step,
+        unsigned *maxSteps,
+        const std::string& filename,
+        const MPI_Comm& comm = MPI_COMM_WORLD)
+    {
+        MPI_File file = openFileForRead(filename, comm);
+        boost::uint64_t numEntries;
+        CELL_TYPE edge;
+        readHeader(file, filename, dimensions, step, maxSteps, &numEntries, &edge);
+        MPI_File_close(&file);
+    }
+
+    /**
+     * Restores the cells in region. Only blocks overlapping with
+     * region are read and decoded. All ranks of comm need to call
+     * this.
+     */
+    template<typename GRID_TYPE>
+    void readRegion(
+        GRID_TYPE *grid,
+        const std::string& filename,
+        const Region<DIM>& region,
+        const MPI_Comm& comm = MPI_COMM_WORLD)
+    {
+        MPI_File file = openFileForRead(filename, comm);
+        Coord<DIM> dimensions;
+        unsigned step;
+        unsigned maxSteps;
+        boost::uint64_t numEntries;
+        CELL_TYPE edge;
+        readHeader(file, filename, &dimensions, &step, &maxSteps, &numEntries, &edge);
+        grid->setEdge(edge);
+
+        std::vector<Entry> entries(numEntries);
+        if (numEntries > 0) {
+            read(file, headerLength(), &entries[0], numEntries * sizeof(Entry));
+        }
+        MPI_File_close(&file);
+
+        std::map<Coord<DIM>, std::vector<std::size_t> > rows;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            rows[rowKey(entries[i].streak.origin)] << i;
+        }
+
+        std::string prefix = prefixOf(filename, step);
+        std::map<unsigned, MPI_File> files;
+        std::vector<char> encoded;
+        std::vector<CELL_TYPE> decoded;
+        std::size_t decodedEntry = entries.size();
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            // the coords need to be normalized because on torus
+            // topologies the coordnates may exceed the bounding box
+            // (especially negative coordnates may occurr).
+            Coord<DIM> origin = TOPOLOGY::normalize(i->origin, dimensions);
+            int endX = origin.x() + i->length();
+
+            typename std::map<Coord<DIM>, std::vector<std::size_t> >::iterator row = rows.find(rowKey(origin));
+            if (row == rows.end()) {
+                continue;
+            }
+
+            for (std::vector<std::size_t>::iterator e = row->second.begin(); e != row->second.end(); ++e) {
+                const Entry& entry = entries[*e];
+                int overlapStart = std::max(origin.x(), entry.streak.origin.x());
+                int overlapEnd = std::min(endX, entry.streak.endX);
+                if (overlapStart >= overlapEnd) {
+                    continue;
+                }
+
+                if (decodedEntry != *e) {
+                    MPI_File source = getFile(&files, step, entry.dataStep, prefix, filename);
+                    encoded.resize(entry.size);
+                    read(source, entry.offset, &encoded[0], entry.size);
+                    decoded.resize(entry.streak.length());
+                    CompressedMPIIOHelpers::ShuffleRLECodec::decode(
+                        &encoded[0], entry.size, sizeof(CELL_TYPE), decoded.size(),
+                        reinterpret_cast<char*>(&decoded[0]));
+                    decodedEntry = *e;
+                }
+
+                Streak<DIM> target(i->origin, 0);
+                target.origin.x() += overlapStart - origin.x();
+                target.endX = target.origin.x() + overlapEnd - overlapStart;
+                grid->set(target, &decoded[overlapStart - entry.streak.origin.x()]);
+            }
+        }
+
+        for (std::map<unsigned, MPI_File>::iterator i = files.begin(); i != files.end(); ++i) {
+            MPI_File_close(&i->second);
+        }
+    }
+
+    /**
+     * Forget about the previous checkpoint, i.e. the next call to
+     * writeRegion() will write all blocks.
+     */
+    void reset()
+    {
+        previousBlocks.clear();
+        previousStep = -1;
+    }
+
+    /**
+     * Number of bytes written by the local rank during the last call
+     * to writeRegion() (excluding the header).
+     */
+    std::size_t lastBytesWritten() const
+    {
+        return bytesWritten;
+    }
+
+private:
+    typedef std::pair<Coord<DIM>, int> BlockKey;
+    typedef std::map<BlockKey, Entry> BlockMap;
+
+    static const char MAGIC[8];
+
+    std::size_t blockSize;
+    int previousStep;
+    std::size_t bytesWritten;
+    BlockMap previousBlocks;
+
+    static BlockKey key(const Streak<DIM>& streak)
+    {
+        return std::make_pair(streak.origin, streak.endX);
+    }
+
+    static Coord<DIM> rowKey(Coord<DIM> coord)
+    {
+        coord.x() = 0;
+        return coord;
+    }
+
+    static MPI_Offset headerLength()
+    {
+        return
+            sizeof(MAGIC) +
+            sizeof(Coord<DIM>) +
+            2 * sizeof(unsigned) +
+            sizeof(boost::uint64_t) +
+            sizeof(CELL_TYPE);
+    }
+
+    static void append(std::vector<char> *buffer, const void *data, std::size_t size)
+    {
+        const char *source = static_cast<const char*>(data);
+        buffer->insert(buffer->end(), source, source + size);
+    }
+
+    static boost::uint64_t exclusivePrefixSum(boost::uint64_t value, const MPI_Comm& comm)
+    {
+        boost::uint64_t ret = 0;
+        MPI_Exscan(&value, &ret, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+
+        int rank;
+        MPI_Comm_rank(comm, &rank);
+        // MPI_Exscan leaves the result undefined on rank 0:
+        return (rank == 0) ? 0 : ret;
+    }
+
+    /**
+     * MPI counts are ints, so we transfer large buffers in chunks of
+     * at most INT_MAX bytes.
+     */
+    static void write(MPI_File file, MPI_Offset offset, const void *data, std::size_t size)
+    {
+        const char *cursor = static_cast<const char*>(data);
+        while (size > 0) {
+            int chunk = static_cast<int>((std::min)(size, std::size_t(INT_MAX)));
+            MPI_File_write_at(
+                file, offset, const_cast<char*>(cursor), chunk, MPI_BYTE, MPI_STATUS_IGNORE);
+            offset += chunk;
+            cursor += chunk;
+            size -= chunk;
+        }
+    }
+
+    static void read(MPI_File file, MPI_Offset offset, void *data, std::size_t size)
+    {
+        char *cursor = static_cast<char*>(data);
+        while (size > 0) {
+            int chunk = static_cast<int>((std::min)(size, std::size_t(INT_MAX)));
+            MPI_File_read_at(file, offset, cursor, chunk, MPI_BYTE, MPI_STATUS_IGNORE);
+            offset += chunk;
+            cursor += chunk;
+            size -= chunk;
+        }
+    }
+
+    static MPI_File openFileForRead(const std::string& filename, const MPI_Comm& comm)
+    {
+        MPI_File file;
+        MPI_File_open(
+            comm, const_cast<char*>(filename.c_str()),
+            MPI_MODE_RDONLY, MPI_INFO_NULL,
+            &file);
+        MPI_File_set_errhandler(file, MPI_ERRORS_ARE_FATAL);
+        return file;
+    }
+
+    static void readHeader(
+        MPI_File file,
+        const std::string& filename,
+        Coord<DIM> *dimensions,
+        unsigned *step,
+        unsigned *maxSteps,
+        boost::uint64_t *numEntries,
+        CELL_TYPE *edge)
+    {
+        std::vector<char> header(headerLength());
+        read(file, 0, &header[0], header.size());
+        if (std::memcmp(&header[0], MAGIC, sizeof(MAGIC)) != 0) {
+            throw FileReadException(filename);
+        }
+
+        const char *cursor = &header[sizeof(MAGIC)];
+        extract(&cursor, dimensions);
+        extract(&cursor, step);
+        extract(&cursor, maxSteps);
+        extract(&cursor, numEntries);
+        extract(&cursor, edge);
+    }
+
+    template<typename T>
+    static void extract(const char **cursor, T *target)
+    {
+        std::memcpy(target, *cursor, sizeof(T));
+        *cursor += sizeof(T);
+    }
+
+    /**
+     * Blocks may reside in older checkpoint files, which are opened
+     * on demand. These are assumed to reside in the same directory
+     * and to share the prefix.
+     */
+    static MPI_File getFile(
+        std::map<unsigned, MPI_File> *files,
+        unsigned step,
+        unsigned dataStep,
+        const std::string& prefix,
+        const std::string& currentFilename)
+    {
+        std::map<unsigned, MPI_File>::iterator i = files->find(dataStep);
+        if (i != files->end()) {
+            return i->second;
+        }
+
+        std::string name = (dataStep == step) ? currentFilename : filename(prefix, dataStep);
+        MPI_File file = openFileForRead(name, MPI_COMM_SELF);
+        (*files)[dataStep] = file;
+        return file;
+    }
+};
+
+template<typename CELL_TYPE, typename TOPOLOGY>
+const char CompressedMPIIO<CELL_TYPE, TOPOLOGY>::MAGIC[8] = {'L', 'G', 'D', 'C', 'K', 'P', 'T', '1'};
+
+}
+
+#endif
+#endif
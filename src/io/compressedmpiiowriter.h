@@ -0,0 +1,97 @@
+#ifndef LIBGEODECOMP_IO_COMPRESSEDMPIIOWRITER_H
+#define LIBGEODECOMP_IO_COMPRESSEDMPIIOWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/io/compressedmpiio.h>
+#include <libgeodecomp/io/mpiiosnapshot.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+
+#include <boost/shared_ptr.hpp>
+
+namespace LibGeoDecomp {
+
+/**
+ * Checkpoint writer which uses CompressedMPIIO instead of raw dumps:
+ * blocks which didn't change since the previous checkpoint are only
+ * referenced, all others are stored compressed. Restart via
+ * MPIIOInitializer, which recognizes the .cmpiio extension. Older
+ * checkpoints of the same run must not be deleted as long as newer
+ * ones are in use.
+ */
+template<typename CELL_TYPE>
+class CompressedMPIIOWriter : public Clonable<ParallelWriter<CELL_TYPE>, CompressedMPIIOWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+    using ParallelWriter<CELL_TYPE>::period;
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    /**
+     * blockSize is the maximum number of cells per block. Smaller
+     * blocks catch more unchanged cells, but enlarge the index.
+     */
+    CompressedMPIIOWriter(
+        const std::string& prefix,
+        const unsigned period,
+        const unsigned maxSteps,
+        const MPI_Comm& communicator = MPI_COMM_WORLD,
+        std::size_t blockSize = 4096) :
+        Clonable<ParallelWriter<CELL_TYPE>, CompressedMPIIOWriter<CELL_TYPE> >(prefix, period),
+        mpiio(blockSize),
+        maxSteps(maxSteps),
+        comm(communicator)
+    {}
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<Topology::DIM>& validRegion,
+        const Coord<Topology::DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        // all regions of a step have to go into one index, so we
+        // collect them first:
+        if (snapshot) {
+            snapshot->append(grid, validRegion);
+        } else {
+            snapshot.reset(
+                new MPIIOSnapshot<CELL_TYPE>(grid, validRegion, globalDimensions, step, maxSteps));
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        mpiio.writeRegion(
+            *snapshot,
+            globalDimensions,
+            step,
+            maxSteps,
+            prefix,
+            snapshot->getRegion(),
+            comm);
+        snapshot.reset();
+    }
+
+private:
+    CompressedMPIIO<CELL_TYPE> mpiio;
+    unsigned maxSteps;
+    MPI_Comm comm;
+    boost::shared_ptr<MPIIOSnapshot<CELL_TYPE> > snapshot;
+};
+
+}
+
+#endif
+#endif
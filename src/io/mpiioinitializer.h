@@ -5,8 +5,10 @@
 #ifdef LIBGEODECOMP_WITH_MPI
 
 #include <libgeodecomp/communication/typemaps.h>
+#include <libgeodecomp/io/compressedmpiio.h>
 #include <libgeodecomp/io/initializer.h>
 #include <libgeodecomp/io/mpiio.h>
+#include <libgeodecomp/io/mpiiosnapshot.h>
 
 namespace LibGeoDecomp {
 
@@ -16,6 +18,14 @@ namespace LibGeoDecomp {
  * long-running jobs which might either be shot down because of wall
  * clock limitations or node failures: here checkpoints can save
  * captital amounts of compute time.
+ *
+ * If a staging directory is given (see StagedMPIIOWriter), each rank
+ * will prefer its node-local copy of the snapshot and only read the
+ * remainder of its subdomain from the global file -- which is not
+ * even touched if all ranks find their data locally.
+ *
+ * Compressed checkpoints (see CompressedMPIIOWriter) are recognized
+ * by their extension .cmpiio.
  */
 template<typename CELL_TYPE>
 class MPIIOInitializer : public Initializer<CELL_TYPE>
@@ -27,20 +37,72 @@ public:
     explicit MPIIOInitializer(
         const std::string& filename,
         const MPI_Datatype& mpiDatatype = Typemaps::lookup<CELL_TYPE>(),
-        const MPI_Comm& comm = MPI_COMM_WORLD) :
+        const MPI_Comm& comm = MPI_COMM_WORLD,
+        const std::string& stagingDirectory = "") :
         file(filename),
         datatype(mpiDatatype),
-        communicator(comm)
+        communicator(comm),
+        compressed(boost::filesystem::path(filename).extension() == ".cmpiio")
     {
-        mpiio.readMetadata(
-            &dimensions, &currentStep, &maximumSteps, file, communicator);
+        int haveLocalSnapshots = 0;
+        if (!stagingDirectory.empty()) {
+            int rank;
+            MPI_Comm_rank(communicator, &rank);
+            localFile = MPIIOSnapshot<CELL_TYPE>::localFilename(stagingDirectory, file, rank);
+
+            MPIIOSnapshot<CELL_TYPE> snapshot;
+            if (snapshot.load(localFile, true)) {
+                haveLocalSnapshots = 1;
+                dimensions = snapshot.getDimensions();
+                currentStep = snapshot.getStep();
+                maximumSteps = snapshot.getMaxSteps();
+            } else {
+                localFile = "";
+            }
+        }
+
+        // opening the global file is a collective operation, so
+        // either all ranks read it or none:
+        MPI_Allreduce(MPI_IN_PLACE, &haveLocalSnapshots, 1, MPI_INT, MPI_LAND, communicator);
+        if (haveLocalSnapshots) {
+            return;
+        }
+
+        if (compressed) {
+            compressedMPIIO.readMetadata(
+                &dimensions, &currentStep, &maximumSteps, file, communicator);
+        } else {
+            mpiio.readMetadata(
+                &dimensions, &currentStep, &maximumSteps, file, communicator);
+        }
     }
 
     virtual void grid(GridBase<CELL_TYPE, DIM> *target)
     {
         Region<DIM> region;
         region << target->boundingBox();
-        mpiio.readRegion(target, file, region, communicator, datatype);
+        Region<DIM> remainder = region;
+
+        MPIIOSnapshot<CELL_TYPE> snapshot;
+        bool haveSnapshot = !localFile.empty() && snapshot.load(localFile);
+        if (haveSnapshot) {
+            remainder -= snapshot.getRegion();
+        }
+
+        int needGlobalFile = !remainder.empty();
+        MPI_Allreduce(MPI_IN_PLACE, &needGlobalFile, 1, MPI_INT, MPI_LOR, communicator);
+        if (needGlobalFile) {
+            if (compressed) {
+                compressedMPIIO.readRegion(target, file, remainder, communicator);
+            } else {
+                mpiio.readRegion(target, file, remainder, communicator, datatype);
+            }
+        }
+
+        // also sets the edge cell, even if our share is empty:
+        if (haveSnapshot) {
+            snapshot.copyTo(target, region);
+        }
     }
 
     virtual Coord<DIM> gridDimensions() const
@@ -60,9 +122,12 @@ public:
 
 private:
     std::string file;
+    std::string localFile;
     MPI_Datatype datatype;
     MPI_Comm communicator;
+    bool compressed;
     MPIIO<CELL_TYPE> mpiio;
+    CompressedMPIIO<CELL_TYPE> compressedMPIIO;
     unsigned currentStep;
     unsigned maximumSteps;
     Coord<DIM> dimensions;
@@ -0,0 +1,323 @@
+#ifndef LIBGEODECOMP_IO_MPIIOSNAPSHOT_H
+#define LIBGEODECOMP_IO_MPIIOSNAPSHOT_H
+
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/ioexception.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * In-memory copy of one rank's share of a checkpoint. It carries the
+ * same metadata as the header of a .mpiio file (dimensions, step,
+ * maxSteps, edge cell) and implements the part of the grid interface
+ * needed by MPIIO::writeRegion(), so it can be drained to the global
+ * file at any later time.
+ *
+ * Snapshots can also be saved to/loaded from node-local storage
+ * (e.g. /dev/shm), which is what StagedMPIIOWriter and
+ * MPIIOInitializer use for fast checkpoint/restart. Cells are stored
+ * bytewise, so these files are only meant to be read back on the
+ * same machine.
+ */
+template<typename CELL_TYPE>
+class MPIIOSnapshot
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+
+    MPIIOSnapshot() :
+        step(0),
+        maxSteps(0)
+    {}
+
+    /**
+     * Copies all cells of region from grid. This is the only part
+     * of a staged checkpoint which the simulation has to wait for.
+     */
+    MPIIOSnapshot(
+        const GridBase<CELL_TYPE, DIM>& grid,
+        const Region<DIM>& region,
+        const Coord<DIM>& dimensions,
+        unsigned step,
+        unsigned maxSteps) :
+        dimensions(dimensions),
+        step(step),
+        maxSteps(maxSteps),
+        edgeCell(grid.getEdge())
+    {
+        append(grid, region);
+    }
+
+    /**
+     * Adds another (disjoint) region, e.g. if a simulator calls a
+     * ParallelWriter multiple times per time step.
+     */
+    void append(const GridBase<CELL_TYPE, DIM>& grid, const Region<DIM>& newRegion)
+    {
+        std::size_t offset = cells.size();
+        cells.resize(offset + newRegion.size());
+
+        for (typename Region<DIM>::StreakIterator i = newRegion.beginStreak();
+             i != newRegion.endStreak();
+             ++i) {
+            if (i->length() > 0) {
+                grid.get(*i, &cells[offset]);
+            }
+            addToIndex(*i, offset);
+            offset += i->length();
+        }
+
+        region += newRegion;
+    }
+
+    /**
+     * Derives the name of a rank's node-local copy of the global
+     * checkpoint file.
+     */
+    static std::string localFilename(
+        const std::string& stagingDirectory,
+        const std::string& globalFilename,
+        int rank)
+    {
+        std::ostringstream buf;
+        buf << stagingDirectory << "/"
+            << boost::filesystem::path(globalFilename).filename().string()
+            << ".rank" << rank;
+        return buf.str();
+    }
+
+    /**
+     * Writes to a temporary file first and renames it afterwards, so
+     * readers never see incomplete snapshots.
+     */
+    void save(const std::string& filename) const
+    {
+        std::string tempFilename = filename + ".tmp";
+        {
+            std::ofstream file(tempFilename.c_str(), std::ios::binary);
+            if (!file) {
+                throw FileOpenException(tempFilename);
+            }
+
+            write(file, &dimensions, 1);
+            write(file, &step,       1);
+            write(file, &maxSteps,   1);
+            write(file, &edgeCell,   1);
+            write(file, streaks);
+            write(file, cells);
+
+            if (!file) {
+                throw FileWriteException(tempFilename);
+            }
+        }
+
+        if (std::rename(tempFilename.c_str(), filename.c_str()) != 0) {
+            throw FileWriteException(filename);
+        }
+    }
+
+    /**
+     * Returns false if no snapshot exists under the given name. If
+     * metadataOnly is set, region and cells are not loaded.
+     */
+    bool load(const std::string& filename, bool metadataOnly = false)
+    {
+        std::ifstream file(filename.c_str(), std::ios::binary);
+        if (!file) {
+            return false;
+        }
+
+        read(file, &dimensions, 1);
+        read(file, &step,       1);
+        read(file, &maxSteps,   1);
+        read(file, &edgeCell,   1);
+        region.clear();
+        streaks.clear();
+        rows.clear();
+        cells.clear();
+        if (metadataOnly) {
+            return checkStream(file, filename);
+        }
+
+        std::vector<Streak<DIM> > buffer;
+        read(file, &buffer);
+        read(file, &cells);
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            region << buffer[i];
+            addToIndex(buffer[i], offset);
+            offset += buffer[i].length();
+        }
+
+        if (cells.size() != offset) {
+            throw FileReadException(filename);
+        }
+
+        return checkStream(file, filename);
+    }
+
+    /**
+     * Copies the cells of the intersection of the snapshot's region
+     * and targetRegion to target.
+     */
+    void copyTo(GridBase<CELL_TYPE, DIM> *target, const Region<DIM>& targetRegion) const
+    {
+        target->setEdge(edgeCell);
+        Region<DIM> overlap = region & targetRegion;
+        for (typename Region<DIM>::StreakIterator i = overlap.beginStreak();
+             i != overlap.endStreak();
+             ++i) {
+            if (i->length() > 0) {
+                target->set(*i, &cells[offset(*i)]);
+            }
+        }
+    }
+
+    void get(const Streak<DIM>& streak, CELL_TYPE *target) const
+    {
+        typename std::vector<CELL_TYPE>::const_iterator begin = cells.begin() + offset(streak);
+        std::copy(begin, begin + streak.length(), target);
+    }
+
+    /**
+     * Returns the stored cells of streak, which must be contained in
+     * one of the appended regions. The pointer remains valid as long
+     * as no further regions are appended.
+     */
+    const CELL_TYPE *data(const Streak<DIM>& streak) const
+    {
+        return &cells[offset(streak)];
+    }
+
+    const CELL_TYPE& getEdge() const
+    {
+        return edgeCell;
+    }
+
+    const Region<DIM>& getRegion() const
+    {
+        return region;
+    }
+
+    const Coord<DIM>& getDimensions() const
+    {
+        return dimensions;
+    }
+
+    unsigned getStep() const
+    {
+        return step;
+    }
+
+    unsigned getMaxSteps() const
+    {
+        return maxSteps;
+    }
+
+private:
+    typedef std::vector<std::pair<Streak<DIM>, std::size_t> > Row;
+
+    Coord<DIM> dimensions;
+    unsigned step;
+    unsigned maxSteps;
+    CELL_TYPE edgeCell;
+    Region<DIM> region;
+    std::vector<CELL_TYPE> cells;
+    // streaks in the order in which their cells are stored:
+    std::vector<Streak<DIM> > streaks;
+    // streaks (and their offsets in cells) grouped by their
+    // y/z-coordinates, so we can look up partial streaks:
+    std::map<Coord<DIM>, Row> rows;
+
+    void addToIndex(const Streak<DIM>& streak, std::size_t offset)
+    {
+        streaks << streak;
+        rows[rowKey(streak)] << std::make_pair(streak, offset);
+    }
+
+    static Coord<DIM> rowKey(const Streak<DIM>& streak)
+    {
+        Coord<DIM> ret = streak.origin;
+        ret.x() = 0;
+        return ret;
+    }
+
+    std::size_t offset(const Streak<DIM>& streak) const
+    {
+        typename std::map<Coord<DIM>, Row>::const_iterator row = rows.find(rowKey(streak));
+        if (row != rows.end()) {
+            for (typename Row::const_iterator i = row->second.begin(); i != row->second.end(); ++i) {
+                if ((i->first.origin.x() <= streak.origin.x()) && (streak.endX <= i->first.endX)) {
+                    return i->second + streak.origin.x() - i->first.origin.x();
+                }
+            }
+        }
+
+        std::ostringstream buf;
+        buf << "MPIIOSnapshot doesn't contain streak " << streak;
+        throw std::logic_error(buf.str());
+    }
+
+    template<typename T>
+    static void write(std::ofstream& file, const T *data, std::size_t count)
+    {
+        file.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    }
+
+    template<typename T>
+    static void write(std::ofstream& file, const std::vector<T>& vec)
+    {
+        std::size_t size = vec.size();
+        write(file, &size, 1);
+        if (size > 0) {
+            write(file, &vec[0], size);
+        }
+    }
+
+    template<typename T>
+    static void read(std::ifstream& file, T *data, std::size_t count)
+    {
+        file.read(reinterpret_cast<char*>(data), count * sizeof(T));
+    }
+
+    template<typename T>
+    static void read(std::ifstream& file, std::vector<T> *vec)
+    {
+        std::size_t size = 0;
+        read(file, &size, 1);
+        if (!file) {
+            return;
+        }
+
+        vec->resize(size);
+        if (size > 0) {
+            read(file, &(*vec)[0], size);
+        }
+    }
+
+    static bool checkStream(const std::ifstream& file, const std::string& filename)
+    {
+        if (!file) {
+            throw FileReadException(filename);
+        }
+
+        return true;
+    }
+};
+
+}
+
+#endif
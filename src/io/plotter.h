@@ -1,8 +1,11 @@
 #ifndef LIBGEODECOMP_IO_PLOTTER_H
 #define LIBGEODECOMP_IO_PLOTTER_H
 
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/imagepainter.h>
 #include <libgeodecomp/io/simplecellplotter.h>
 #include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/apitraits.h>
 #include <libgeodecomp/storage/grid.h>
 #include <libgeodecomp/storage/image.h>
 
@@ -17,6 +20,28 @@
 
 namespace LibGeoDecomp {
 
+namespace PlotterHelpers {
+
+/**
+ * Detects whether a CELL_PLOTTER can convert whole streaks of cells
+ * to colors (see SimpleCellPlotter::colors()).
+ */
+template<typename CELL_PLOTTER, typename SUPPORTS_STREAK_PLOTTING = void>
+class SelectStreakPlotting
+{
+public:
+    typedef APITraits::FalseType Value;
+};
+
+template<typename CELL_PLOTTER>
+class SelectStreakPlotting<CELL_PLOTTER, typename CELL_PLOTTER::SupportsStreakPlotting>
+{
+public:
+    typedef APITraits::TrueType Value;
+};
+
+}
+
 /**
  * This class renders a 2D grid of cells by stitching together the 2D
  * tiles generated per cell by the CELL_PLOTTER. Useful for generating
@@ -79,6 +104,35 @@ public:
         }
     }
 
+    /**
+     * Renders directly into image, which is much faster than going
+     * through a painter if the CELL_PLOTTER supports streak
+     * plotting: each row of cells is converted to colors in bulk
+     * (rows are distributed among threads), and the tiles are then
+     * written as contiguous spans of pixels. Other CELL_PLOTTERs are
+     * called per cell, just as with plotGrid().
+     */
+    void plotGrid(const typename Writer<CELL>::GridType& grid, Image *image) const
+    {
+        CoordBox<2> viewport(
+            Coord<2>(0, 0),
+            Coord<2>(cellDim.x() * grid.dimensions().x(),
+                     cellDim.y() * grid.dimensions().y()));
+        plotGridInViewport(grid, image, viewport);
+    }
+
+    void plotGridInViewport(
+        const typename Writer<CELL>::GridType& grid,
+        Image *image,
+        const CoordBox<2>& viewport) const
+    {
+        plotGridInViewport(
+            grid,
+            image,
+            viewport,
+            typename PlotterHelpers::SelectStreakPlotting<CELL_PLOTTER>::Value());
+    }
+
     const Coord<2>& getCellDim()
     {
         return cellDim;
@@ -92,6 +146,63 @@ public:
 private:
     Coord<2> cellDim;
     CELL_PLOTTER cellPlotter;
+
+    void plotGridInViewport(
+        const typename Writer<CELL>::GridType& grid,
+        Image *image,
+        const CoordBox<2>& viewport,
+        APITraits::FalseType) const
+    {
+        ImagePainter painter(image);
+        plotGridInViewport(grid, painter, viewport);
+    }
+
+    void plotGridInViewport(
+        const typename Writer<CELL>::GridType& grid,
+        Image *image,
+        const CoordBox<2>& viewport,
+        APITraits::TrueType) const
+    {
+        int sx = viewport.origin.x() / cellDim.x();
+        int sy = viewport.origin.y() / cellDim.y();
+        int ex = ceil((double(viewport.origin.x()) + viewport.dimensions.x()) / cellDim.x());
+        int ey = ceil((double(viewport.origin.y()) + viewport.dimensions.y()) / cellDim.y());
+        ex = std::min(ex, grid.dimensions().x());
+        ey = std::min(ey, grid.dimensions().y());
+        if ((sx >= ex) || (sy >= ey)) {
+            return;
+        }
+
+        // pixels covered by cells [sx, ex) within the image:
+        Coord<2> imageDim = image->getDimensions();
+        int startX = std::max(0, sx * cellDim.x() - viewport.origin.x());
+        int endX = std::min(imageDim.x(), ex * cellDim.x() - viewport.origin.x());
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (int y = sy; y < ey; ++y) {
+            int startY = std::max(0, y * cellDim.y() - viewport.origin.y());
+            int endY = std::min(imageDim.y(), (y + 1) * cellDim.y() - viewport.origin.y());
+            if ((startY >= endY) || (startX >= endX)) {
+                continue;
+            }
+
+            std::vector<Color> colors(ex - sx);
+            cellPlotter.colors(grid, Streak<2>(Coord<2>(sx, y), ex), &colors[0]);
+
+            // render the first line of pixels, the remaining lines
+            // of this row of tiles are plain copies:
+            Color *line = &(*image)[Coord<2>(0, startY)];
+            for (int x = startX; x < endX; ++x) {
+                line[x] = colors[(x + viewport.origin.x()) / cellDim.x() - sx];
+            }
+
+            for (int i = startY + 1; i < endY; ++i) {
+                std::copy(line + startX, line + endX, &(*image)[Coord<2>(0, i)] + startX);
+            }
+        }
+    }
 };
 
 }
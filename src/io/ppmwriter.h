@@ -14,6 +14,7 @@
 #include <fstream>
 #include <iomanip>
 #include <string>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -73,8 +74,7 @@ public:
 
         Coord<2> imageDim = plotter.calcImageDim(grid.boundingBox().dimensions);
         Image image(imageDim);
-        ImagePainter painter(&image);
-        plotter.plotGrid(grid, painter);
+        plotter.plotGrid(grid, &image);
         writePPM(image, step);
     }
 
@@ -86,7 +86,7 @@ public:
         std::ostringstream filename;
         filename << prefix << "." << std::setfill('0') << std::setw(4)
                  << step << ".ppm";
-        std::ofstream outfile(filename.str().c_str());
+        std::ofstream outfile(filename.str().c_str(), std::ios::binary);
         if (!outfile) {
             throw FileOpenException(filename.str());
         }
@@ -95,15 +95,21 @@ public:
         outfile << "P6 " << img.getDimensions().x()
                 << " "   << img.getDimensions().y() << " 255\n";
 
-        // body second:
+        // body second, assembled in memory so it can be written in
+        // one go:
+        std::vector<char> buffer(img.getDimensions().prod() * 3);
+        char *cursor = buffer.empty() ? 0 : &buffer[0];
         for (int y = 0; y < img.getDimensions().y(); ++y) {
             for (int x = 0; x < img.getDimensions().x(); ++x) {
                 const Color& rgb = img[Coord<2>(x, y)];
-                outfile << (char)rgb.red()
-                        << (char)rgb.green()
-                        << (char)rgb.blue();
+                *cursor++ = (char)rgb.red();
+                *cursor++ = (char)rgb.green();
+                *cursor++ = (char)rgb.blue();
             }
         }
+        if (!buffer.empty()) {
+            outfile.write(&buffer[0], buffer.size());
+        }
 
         if (!outfile.good()) {
             throw FileWriteException(filename.str());
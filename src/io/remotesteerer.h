@@ -9,6 +9,8 @@
 #include <libgeodecomp/communication/typemaps.h>
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/io/steerer.h>
+#include <libgeodecomp/io/remotesteerer/bulkdatahandler.h>
+#include <libgeodecomp/io/remotesteerer/bulkdataserver.h>
 #include <libgeodecomp/io/remotesteerer/commandserver.h>
 #include <libgeodecomp/io/remotesteerer/handler.h>
 #include <libgeodecomp/io/remotesteerer/gethandler.h>
@@ -34,6 +36,11 @@ using namespace RemoteSteererHelpers;
  *
  * Keep in mind that the connection node will generally double as an
  * execution node.
+ *
+ * Large amounts of data (e.g. whole fields for live visualization)
+ * don't fit well into the line-oriented CommandServer. For these the
+ * RemoteSteerer can open a second, binary channel (see
+ * enableBulkData()).
  */
 template<typename CELL_TYPE>
 class RemoteSteerer : public Steerer<CELL_TYPE>
@@ -53,8 +60,11 @@ public:
         MPI_Comm communicator = MPI_COMM_WORLD) :
         Steerer<CELL_TYPE>(period),
         port(port),
+        root(root),
+        communicator(communicator),
         pipe(new Pipe(root, communicator))
     {
+        bulkDataHandler = 0;
         if (MPILayer(communicator).rank() == root) {
             commandServer.reset(new CommandServer<CELL_TYPE>(port, pipe));
         }
@@ -120,6 +130,38 @@ public:
         handlers["get_" + accessor->name()].reset(new GetHandler<CELL_TYPE, MEMBER_TYPE>(accessorPtr));
     }
 
+    /**
+     * Lets clients pull cell members in bulk: the command "bulk" is
+     * forwarded to a BulkDataHandler, whose output is streamed to
+     * clients connected to dataPort on the root node. Members need
+     * to be registered via addBulkDataSelector(). Needs to be called
+     * on all ranks.
+     */
+    void enableBulkData(int dataPort)
+    {
+        boost::shared_ptr<BulkDataServer> server;
+        if (commandServer) {
+            server.reset(new BulkDataServer(dataPort));
+            addAction(new PassThroughAction<CELL_TYPE>(
+                          "bulk",
+                          "usage: \"bulk SELECTOR STRIDE X Y [Z] DIM_X DIM_Y [DIM_Z] [FRAMES]\", "
+                          "will stream member SELECTOR of every STRIDE'th cell in the given box "
+                          "to the bulk data port for the next FRAMES steering events"));
+        }
+
+        bulkDataHandler = new BulkDataHandler<CELL_TYPE>(server, root, communicator);
+        addHandler(bulkDataHandler);
+    }
+
+    void addBulkDataSelector(const Selector<CELL_TYPE>& selector)
+    {
+        if (!bulkDataHandler) {
+            throw std::logic_error("RemoteSteerer: call enableBulkData() before adding selectors");
+        }
+
+        bulkDataHandler->addSelector(selector);
+    }
+
     void sendCommand(const std::string& command)
     {
         CommandServer<CELL_TYPE>::sendCommand(command, port);
@@ -133,8 +175,12 @@ public:
 private:
     HandlerMap handlers;
     int port;
+    int root;
+    MPI_Comm communicator;
     boost::shared_ptr<Pipe> pipe;
     boost::shared_ptr<CommandServer<CELL_TYPE> > commandServer;
+    // owned by handlers:
+    BulkDataHandler<CELL_TYPE> *bulkDataHandler;
 };
 
 }
@@ -0,0 +1,276 @@
+#ifndef LIBGEODECOMP_IO_REMOTESTEERER_BULKDATAHANDLER_H
+#define LIBGEODECOMP_IO_REMOTESTEERER_BULKDATAHANDLER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/remotesteerer/bulkdataserver.h>
+#include <libgeodecomp/io/remotesteerer/handler.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+/**
+ * Extracts a member of all cells within a box from the grid and
+ * ships it to the BulkDataServer on the root node. Usage:
+ *
+ *   bulk SELECTOR STRIDE X Y [Z] DIM_X DIM_Y [DIM_Z] [FRAMES]
+ *
+ * sends the member named SELECTOR of every STRIDE'th cell in each
+ * direction of the box at (X, Y, Z) with extent (DIM_X, DIM_Y,
+ * DIM_Z). The request will be repeated at the next FRAMES - 1 times
+ * the Steerer is called (default: 1), which allows for streaming.
+ *
+ * All ranks pack their share of the box in place (via
+ * GridBase::saveMember()), which then gets gathered at the root.
+ * Each frame is laid out as follows (integers are 32 bits, host byte
+ * order):
+ *
+ *   step, DIM, origin[DIM], dimensions[DIM], stride,
+ *   bytes per cell, length of name, name, data
+ *
+ * where dimensions refers to the downsampled box and the data is
+ * stored in row-major order (x runs fastest). Cells outside of the
+ * simulation space are zeroed.
+ */
+template<typename CELL_TYPE>
+class BulkDataHandler : public Handler<CELL_TYPE>
+{
+public:
+    friend class BulkDataHandlerTest;
+
+    typedef typename Handler<CELL_TYPE>::GridType GridType;
+    typedef typename Handler<CELL_TYPE>::Topology Topology;
+    typedef boost::int32_t Int;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * server may be null on all ranks but root.
+     */
+    BulkDataHandler(
+        boost::shared_ptr<BulkDataServer> server,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        Handler<CELL_TYPE>("bulk"),
+        server(server),
+        mpiLayer(communicator),
+        root(root)
+    {}
+
+    void addSelector(const Selector<CELL_TYPE>& selector)
+    {
+        selectors[selector.name()] = selector;
+    }
+
+    virtual bool operator()(const StringVec& parameters, Pipe& pipe, GridType *grid, const Region<DIM>& validRegion, unsigned step)
+    {
+        std::size_t numParams = 2 + 2 * DIM;
+        if ((parameters.size() != numParams) && (parameters.size() != (numParams + 1))) {
+            if (mpiLayer.rank() == root) {
+                pipe.addSteeringFeedback("usage: bulk SELECTOR STRIDE ORIGIN DIMENSIONS [FRAMES]");
+            }
+            return true;
+        }
+
+        typename std::map<std::string, Selector<CELL_TYPE> >::iterator selector =
+            selectors.find(parameters[0]);
+        if (selector == selectors.end()) {
+            if (mpiLayer.rank() == root) {
+                pipe.addSteeringFeedback("bulk: selector not found: " + parameters[0]);
+            }
+            return true;
+        }
+
+        int stride = std::max(1, StringOps::atoi(parameters[1]));
+        Coord<DIM> origin;
+        Coord<DIM> dimensions;
+        for (int d = 0; d < DIM; ++d) {
+            origin[d]     = StringOps::atoi(parameters[2 + d]);
+            dimensions[d] = std::max(0, StringOps::atoi(parameters[2 + DIM + d]));
+        }
+        int frames = 1;
+        if (parameters.size() > numParams) {
+            frames = StringOps::atoi(parameters[numParams]);
+        }
+
+        std::vector<char> frame = extract(
+            selector->second, grid, validRegion, step, CoordBox<DIM>(origin, dimensions), stride);
+        if (mpiLayer.rank() == root) {
+            if (server) {
+                server->send(frame);
+            }
+
+            if (frames > 1) {
+                StringVec next = parameters;
+                next.resize(numParams);
+                next << StringOps::itoa(frames - 1);
+                pipe.addSteeringRequest(Handler<CELL_TYPE>::key() + " " + StringOps::join(next, " "));
+            }
+        }
+
+        return true;
+    }
+
+private:
+    boost::shared_ptr<BulkDataServer> server;
+    std::map<std::string, Selector<CELL_TYPE> > selectors;
+    MPILayer mpiLayer;
+    int root;
+
+    /**
+     * Collective operation, yields the complete frame on root (and an
+     * empty vector on all other ranks).
+     */
+    std::vector<char> extract(
+        const Selector<CELL_TYPE>& selector,
+        const GridType *grid,
+        const Region<DIM>& validRegion,
+        unsigned step,
+        const CoordBox<DIM>& box,
+        int stride)
+    {
+        Coord<DIM> sampledDimensions;
+        for (int d = 0; d < DIM; ++d) {
+            sampledDimensions[d] = (box.dimensions[d] + stride - 1) / stride;
+        }
+
+        Region<DIM> localRegion = sample(box, stride, validRegion);
+        std::size_t bytesPerCell = selector.sizeOfExternal();
+
+        std::vector<char> localData(localRegion.size() * bytesPerCell);
+        if (!localData.empty()) {
+            grid->saveMemberUnchecked(&localData[0], MemoryLocation::HOST, selector, localRegion);
+        }
+
+        // each streak is encoded as its origin, followed by endX:
+        std::vector<int> localStreaks;
+        localStreaks.reserve(localRegion.numStreaks() * (DIM + 1));
+        for (typename Region<DIM>::StreakIterator i = localRegion.beginStreak();
+             i != localRegion.endStreak();
+             ++i) {
+            for (int d = 0; d < DIM; ++d) {
+                localStreaks << i->origin[d];
+            }
+            localStreaks << i->endX;
+        }
+
+        std::vector<int> streakLengths = mpiLayer.gather(int(localStreaks.size()), root);
+        std::vector<int> dataLengths = mpiLayer.gather(int(localData.size()), root);
+        std::vector<int> streaks(sum(streakLengths));
+        std::vector<char> data(sum(dataLengths));
+        mpiLayer.gatherV(localStreaks, streakLengths, root, streaks);
+        mpiLayer.gatherV(localData, dataLengths, root, data);
+
+        std::vector<char> frame;
+        if (mpiLayer.rank() != root) {
+            return frame;
+        }
+
+        append(&frame, step);
+        append(&frame, DIM);
+        for (int d = 0; d < DIM; ++d) {
+            append(&frame, box.origin[d]);
+        }
+        for (int d = 0; d < DIM; ++d) {
+            append(&frame, sampledDimensions[d]);
+        }
+        append(&frame, stride);
+        append(&frame, bytesPerCell);
+        std::string name = selector.name();
+        append(&frame, name.size());
+        frame.insert(frame.end(), name.begin(), name.end());
+
+        std::size_t header = frame.size();
+        frame.resize(header + sampledDimensions.prod() * bytesPerCell, 0);
+
+        // streaks of all ranks arrive in the same order as their data:
+        std::size_t cursor = 0;
+        for (std::size_t i = 0; i < streaks.size(); i += (DIM + 1)) {
+            Coord<DIM> relativeOrigin;
+            for (int d = 0; d < DIM; ++d) {
+                relativeOrigin[d] = (streaks[i + d] - box.origin[d]) / stride;
+            }
+            std::size_t length = (streaks[i + DIM] - streaks[i]) * bytesPerCell;
+            std::size_t offset = relativeOrigin.toIndex(sampledDimensions) * bytesPerCell;
+
+            std::memcpy(&frame[header + offset], &data[cursor], length);
+            cursor += length;
+        }
+
+        return frame;
+    }
+
+    /**
+     * Returns all cells of box which lie on the lattice given by
+     * stride and are contained in validRegion.
+     */
+    static Region<DIM> sample(const CoordBox<DIM>& box, int stride, const Region<DIM>& validRegion)
+    {
+        Region<DIM> boxRegion;
+        boxRegion << box;
+        if (stride == 1) {
+            return boxRegion & validRegion;
+        }
+
+        // limit the lattice to the cells we might actually own:
+        CoordBox<DIM> bounds = (boxRegion & validRegion).boundingBox();
+        Coord<DIM> start;
+        Coord<DIM> end;
+        for (int d = 0; d < DIM; ++d) {
+            int offset = bounds.origin[d] - box.origin[d];
+            start[d] = box.origin[d] + (offset + stride - 1) / stride * stride;
+            end[d] = bounds.origin[d] + bounds.dimensions[d];
+        }
+
+        Region<DIM> lattice;
+        if (bounds.dimensions.prod() > 0) {
+            addLattice(&lattice, start, start, end, stride, DIM - 1);
+        }
+
+        return lattice & validRegion;
+    }
+
+    static void addLattice(
+        Region<DIM> *lattice,
+        const Coord<DIM>& start,
+        Coord<DIM> cursor,
+        const Coord<DIM>& end,
+        int stride,
+        int dim)
+    {
+        for (cursor[dim] = start[dim]; cursor[dim] < end[dim]; cursor[dim] += stride) {
+            if (dim == 0) {
+                *lattice << cursor;
+            } else {
+                addLattice(lattice, start, cursor, end, stride, dim - 1);
+            }
+        }
+    }
+
+    template<typename VALUE>
+    static void append(std::vector<char> *frame, VALUE value)
+    {
+        Int buf = static_cast<Int>(value);
+        const char *bytes = reinterpret_cast<const char*>(&buf);
+        frame->insert(frame->end(), bytes, bytes + sizeof(buf));
+    }
+};
+
+}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef LIBGEODECOMP_IO_REMOTESTEERER_BULKDATASERVER_H
+#define LIBGEODECOMP_IO_REMOTESTEERER_BULKDATASERVER_H
+
+#include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/misc/stringops.h>
+
+#include <boost/asio.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <deque>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+using boost::asio::ip::tcp;
+
+/**
+ * The BulkDataServer is the binary counterpart of the CommandServer:
+ * it streams frames of raw simulation data (see BulkDataHandler) to
+ * a single client, e.g. a visualization frontend. Each frame is
+ * preceded by its length (a 64-bit unsigned integer in host byte
+ * order).
+ *
+ * send() never blocks on the network: frames are queued and written
+ * by a background thread. If the client can't keep up, the oldest
+ * frames are dropped so that it always sees recent data. Frames sent
+ * while no client is connected are discarded.
+ */
+class BulkDataServer
+{
+public:
+    friend class BulkDataServerTest;
+
+    typedef boost::uint64_t FrameLength;
+
+    explicit BulkDataServer(int port, std::size_t maxQueuedFrames = 4) :
+        port(port),
+        maxQueuedFrames(maxQueuedFrames),
+        continueFlag(true),
+        connected(false)
+    {
+        acceptor.reset(new tcp::acceptor(ioService, tcp::endpoint(tcp::v4(), port)));
+        serverThread = boost::thread(&BulkDataServer::runServer, this);
+    }
+
+    ~BulkDataServer()
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            continueFlag = false;
+            if (connected) {
+                boost::system::error_code errorCode;
+                socket->shutdown(tcp::socket::shutdown_both, errorCode);
+            }
+        }
+        signal.notify_all();
+
+        // unblock the accept() call of the server thread, if any:
+        try {
+            boost::asio::io_service ioService;
+            tcp::socket wakeUp(ioService);
+            wakeUp.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+        } catch (...) {
+            // the server thread was not waiting for a connection
+        }
+
+        serverThread.join();
+    }
+
+    /**
+     * Queues frame for delivery to the client.
+     */
+    void send(const std::vector<char>& frame)
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            if (!connected) {
+                return;
+            }
+
+            frames.push_back(frame);
+            while (frames.size() > maxQueuedFrames) {
+                LOG(DBG, "BulkDataServer dropping frame as client is too slow");
+                frames.pop_front();
+            }
+        }
+
+        signal.notify_one();
+    }
+
+    bool hasClient()
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        return connected;
+    }
+
+    /**
+     * A convenience function for clients: reads one frame from
+     * socket. Returns false if the connection was closed.
+     */
+    static bool receiveFrame(tcp::socket& socket, std::vector<char> *frame)
+    {
+        FrameLength length;
+        boost::system::error_code errorCode;
+
+        boost::asio::read(socket, boost::asio::buffer(&length, sizeof(length)), errorCode);
+        if (errorCode) {
+            return false;
+        }
+
+        frame->resize(length);
+        if (length > 0) {
+            boost::asio::read(socket, boost::asio::buffer(&(*frame)[0], length), errorCode);
+        }
+
+        return !errorCode;
+    }
+
+private:
+    int port;
+    std::size_t maxQueuedFrames;
+    boost::asio::io_service ioService;
+    boost::shared_ptr<tcp::acceptor> acceptor;
+    boost::shared_ptr<tcp::socket> socket;
+    boost::thread serverThread;
+    boost::mutex mutex;
+    boost::condition_variable signal;
+    std::deque<std::vector<char> > frames;
+    bool continueFlag;
+    bool connected;
+
+    void runServer()
+    {
+        for (;;) {
+            boost::shared_ptr<tcp::socket> newSocket(new tcp::socket(ioService));
+            boost::system::error_code errorCode;
+            acceptor->accept(*newSocket, errorCode);
+
+            {
+                boost::lock_guard<boost::mutex> lock(mutex);
+                if (!continueFlag) {
+                    return;
+                }
+                if (errorCode) {
+                    LOG(WARN, "BulkDataServer::runServer() encountered " << errorCode.message());
+                    continue;
+                }
+
+                LOG(INFO, "BulkDataServer: client connected");
+                socket = newSocket;
+                connected = true;
+            }
+
+            runSession();
+
+            boost::lock_guard<boost::mutex> lock(mutex);
+            LOG(INFO, "BulkDataServer: client disconnected");
+            connected = false;
+            frames.clear();
+            if (!continueFlag) {
+                return;
+            }
+        }
+    }
+
+    void runSession()
+    {
+        for (;;) {
+            std::vector<char> frame;
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                while (continueFlag && frames.empty()) {
+                    signal.wait(lock);
+                }
+                if (!continueFlag) {
+                    return;
+                }
+
+                std::swap(frame, frames.front());
+                frames.pop_front();
+            }
+
+            FrameLength length = frame.size();
+            std::vector<boost::asio::const_buffer> buffers;
+            buffers.push_back(boost::asio::buffer(&length, sizeof(length)));
+            buffers.push_back(boost::asio::buffer(frame));
+
+            boost::system::error_code errorCode;
+            boost::asio::write(*socket, buffers, boost::asio::transfer_all(), errorCode);
+            if (errorCode) {
+                LOG(WARN, "BulkDataServer::runSession() encountered " << errorCode.message());
+                return;
+            }
+        }
+    }
+};
+
+}
+
+}
+
+#endif
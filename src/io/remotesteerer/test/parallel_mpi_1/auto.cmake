@@ -0,0 +1,14 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}actiontest.cpp
+  ${RELATIVE_PATH}bulkdataservertest.cpp
+  ${RELATIVE_PATH}commandservertest.cpp
+  ${RELATIVE_PATH}handlertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}actiontest.h
+  ${RELATIVE_PATH}bulkdataservertest.h
+  ${RELATIVE_PATH}commandservertest.h
+  ${RELATIVE_PATH}handlertest.h
+)
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BulkDataServerTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/bulkdataservertest.h"
+
+static BulkDataServerTest suite_BulkDataServerTest;
+
+static CxxTest::List Tests_BulkDataServerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BulkDataServerTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/bulkdataservertest.h", 13, "BulkDataServerTest", suite_BulkDataServerTest, Tests_BulkDataServerTest );
+
+static class TestDescription_suite_BulkDataServerTest_testFramesAreDeliveredInOrder : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataServerTest_testFramesAreDeliveredInOrder() : CxxTest::RealTestDescription( Tests_BulkDataServerTest, suiteDescription_BulkDataServerTest, 16, "testFramesAreDeliveredInOrder" ) {}
+ void runTest() { suite_BulkDataServerTest.testFramesAreDeliveredInOrder(); }
+} testDescription_suite_BulkDataServerTest_testFramesAreDeliveredInOrder;
+
+static class TestDescription_suite_BulkDataServerTest_testReconnectAndShutdown : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataServerTest_testReconnectAndShutdown() : CxxTest::RealTestDescription( Tests_BulkDataServerTest, suiteDescription_BulkDataServerTest, 41, "testReconnectAndShutdown" ) {}
+ void runTest() { suite_BulkDataServerTest.testReconnectAndShutdown(); }
+} testDescription_suite_BulkDataServerTest_testReconnectAndShutdown;
+
@@ -0,0 +1,93 @@
+#include <libgeodecomp/io/remotesteerer/bulkdataserver.h>
+
+#include <cxxtest/TestSuite.h>
+#include <unistd.h>
+
+using namespace LibGeoDecomp;
+using namespace LibGeoDecomp::RemoteSteererHelpers;
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+class BulkDataServerTest : public CxxTest::TestSuite
+{
+public:
+    void testFramesAreDeliveredInOrder()
+    {
+        int port = 47120;
+        BulkDataServer server(port);
+
+        // nobody's listening yet:
+        server.send(makeFrame(1000, 'x'));
+
+        boost::asio::io_service ioService;
+        tcp::socket socket(ioService);
+        connect(&socket, &server, port);
+
+        std::vector<char> frame;
+        server.send(makeFrame(5, 'a'));
+        server.send(std::vector<char>());
+        server.send(makeFrame(3 * 1024 * 1024, 'b'));
+
+        TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+        TS_ASSERT_EQUALS(makeFrame(5, 'a'), frame);
+        TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+        TS_ASSERT_EQUALS(std::size_t(0), frame.size());
+        TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+        TS_ASSERT_EQUALS(makeFrame(3 * 1024 * 1024, 'b'), frame);
+    }
+
+    void testReconnectAndShutdown()
+    {
+        int port = 47121;
+        BulkDataServer server(port);
+        std::vector<char> frame;
+
+        {
+            boost::asio::io_service ioService;
+            tcp::socket socket(ioService);
+            connect(&socket, &server, port);
+            server.send(makeFrame(7, 'c'));
+            TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+        }
+
+        // the server only notices the disconnect once it's writing:
+        while (server.hasClient()) {
+            server.send(makeFrame(7, 'c'));
+            usleep(10000);
+        }
+
+        boost::asio::io_service ioService;
+        tcp::socket socket(ioService);
+        connect(&socket, &server, port);
+        server.send(makeFrame(9, 'd'));
+        TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+        TS_ASSERT_EQUALS(makeFrame(9, 'd'), frame);
+
+        // the server must not hang in its d-tor while a client is
+        // still connected, even if it isn't reading:
+    }
+
+private:
+    std::vector<char> makeFrame(std::size_t size, char seed)
+    {
+        std::vector<char> ret(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            ret[i] = seed + (i % 7);
+        }
+        return ret;
+    }
+
+    void connect(tcp::socket *socket, BulkDataServer *server, int port)
+    {
+        socket->connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+        while (!server->hasClient()) {
+            usleep(1000);
+        }
+    }
+};
+
+}
+
+}
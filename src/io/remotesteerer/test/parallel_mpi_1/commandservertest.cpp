@@ -0,0 +1,45 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CommandServerTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/commandservertest.h"
+
+static CommandServerTest suite_CommandServerTest;
+
+static CxxTest::List Tests_CommandServerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CommandServerTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/commandservertest.h", 12, "CommandServerTest", suite_CommandServerTest, Tests_CommandServerTest );
+
+static class TestDescription_suite_CommandServerTest_testActionInvocationAndFeedback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CommandServerTest_testActionInvocationAndFeedback() : CxxTest::RealTestDescription( Tests_CommandServerTest, suiteDescription_CommandServerTest, 38, "testActionInvocationAndFeedback" ) {}
+ void runTest() { suite_CommandServerTest.testActionInvocationAndFeedback(); }
+} testDescription_suite_CommandServerTest_testActionInvocationAndFeedback;
+
+static class TestDescription_suite_CommandServerTest_testInvalidCommand : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CommandServerTest_testInvalidCommand() : CxxTest::RealTestDescription( Tests_CommandServerTest, suiteDescription_CommandServerTest, 48, "testInvalidCommand" ) {}
+ void runTest() { suite_CommandServerTest.testInvalidCommand(); }
+} testDescription_suite_CommandServerTest_testInvalidCommand;
+
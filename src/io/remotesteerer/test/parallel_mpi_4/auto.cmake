@@ -0,0 +1,10 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}bulkdatahandlertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}pipetest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}bulkdatahandlertest.h
+  ${RELATIVE_PATH}pipetest.h
+)
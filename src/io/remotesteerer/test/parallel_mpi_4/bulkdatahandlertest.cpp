@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BulkDataHandlerTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_4/bulkdatahandlertest.h"
+
+static BulkDataHandlerTest suite_BulkDataHandlerTest;
+
+static CxxTest::List Tests_BulkDataHandlerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BulkDataHandlerTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_4/bulkdatahandlertest.h", 22, "BulkDataHandlerTest", suite_BulkDataHandlerTest, Tests_BulkDataHandlerTest );
+
+static class TestDescription_suite_BulkDataHandlerTest_testFullBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataHandlerTest_testFullBox() : CxxTest::RealTestDescription( Tests_BulkDataHandlerTest, suiteDescription_BulkDataHandlerTest, 68, "testFullBox" ) {}
+ void runTest() { suite_BulkDataHandlerTest.testFullBox(); }
+} testDescription_suite_BulkDataHandlerTest_testFullBox;
+
+static class TestDescription_suite_BulkDataHandlerTest_testDownsampling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataHandlerTest_testDownsampling() : CxxTest::RealTestDescription( Tests_BulkDataHandlerTest, suiteDescription_BulkDataHandlerTest, 86, "testDownsampling" ) {}
+ void runTest() { suite_BulkDataHandlerTest.testDownsampling(); }
+} testDescription_suite_BulkDataHandlerTest_testDownsampling;
+
+static class TestDescription_suite_BulkDataHandlerTest_testCellsOutsideOfGridAreZeroed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataHandlerTest_testCellsOutsideOfGridAreZeroed() : CxxTest::RealTestDescription( Tests_BulkDataHandlerTest, suiteDescription_BulkDataHandlerTest, 104, "testCellsOutsideOfGridAreZeroed" ) {}
+ void runTest() { suite_BulkDataHandlerTest.testCellsOutsideOfGridAreZeroed(); }
+} testDescription_suite_BulkDataHandlerTest_testCellsOutsideOfGridAreZeroed;
+
+static class TestDescription_suite_BulkDataHandlerTest_testStreamingRequeuesRequest : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataHandlerTest_testStreamingRequeuesRequest() : CxxTest::RealTestDescription( Tests_BulkDataHandlerTest, suiteDescription_BulkDataHandlerTest, 122, "testStreamingRequeuesRequest" ) {}
+ void runTest() { suite_BulkDataHandlerTest.testStreamingRequeuesRequest(); }
+} testDescription_suite_BulkDataHandlerTest_testStreamingRequeuesRequest;
+
+static class TestDescription_suite_BulkDataHandlerTest_testInvalidRequests : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BulkDataHandlerTest_testInvalidRequests() : CxxTest::RealTestDescription( Tests_BulkDataHandlerTest, suiteDescription_BulkDataHandlerTest, 152, "testInvalidRequests" ) {}
+ void runTest() { suite_BulkDataHandlerTest.testInvalidRequests(); }
+} testDescription_suite_BulkDataHandlerTest_testInvalidRequests;
+
@@ -0,0 +1,219 @@
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_HPX
+#include <hpx/config.hpp>
+#endif
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/remotesteerer/bulkdatahandler.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <unistd.h>
+
+using namespace LibGeoDecomp;
+using namespace LibGeoDecomp::RemoteSteererHelpers;
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+class BulkDataHandlerTest : public CxxTest::TestSuite
+{
+public:
+    typedef BulkDataHandler<TestCell<2> > HandlerType;
+    typedef DisplacedGrid<TestCell<2> > GridType;
+
+    void setUp()
+    {
+        mpiLayer.reset(new MPILayer);
+        port = 47122;
+        pipe.reset(new Pipe);
+        box = CoordBox<2>(Coord<2>(0, 0), Coord<2>(20, 16));
+
+        // every rank owns 4 rows:
+        validRegion.clear();
+        validRegion << CoordBox<2>(Coord<2>(0, 4 * mpiLayer->rank()), Coord<2>(20, 4));
+
+        grid.reset(new GridType(box));
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TestCell<2> cell;
+            cell.testValue = validRegion.count(*i) ? (i->x() + 100 * i->y()) : -1;
+            grid->set(*i, cell);
+        }
+
+        if (mpiLayer->rank() == 0) {
+            server.reset(new BulkDataServer(port));
+            socket.reset(new tcp::socket(ioService));
+            socket->connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+            while (!server->hasClient()) {
+                usleep(1000);
+            }
+        }
+
+        handler.reset(new HandlerType(server));
+        handler->addSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+    }
+
+    void tearDown()
+    {
+        handler.reset();
+        socket.reset();
+        server.reset();
+        mpiLayer->barrier();
+        mpiLayer.reset();
+    }
+
+    void testFullBox()
+    {
+        TS_ASSERT((*handler)(params("testValue 1 0 0 20 16"), *pipe, &*grid, validRegion, 42));
+
+        if (mpiLayer->rank() == 0) {
+            std::vector<char> frame;
+            TS_ASSERT(BulkDataServer::receiveFrame(*socket, &frame));
+            const char *cursor = checkHeader(frame, 42, Coord<2>(0, 0), Coord<2>(20, 16), 1);
+
+            for (int y = 0; y < 16; ++y) {
+                for (int x = 0; x < 20; ++x) {
+                    TS_ASSERT_EQUALS(x + 100.0 * y, read<double>(&cursor));
+                }
+            }
+            TS_ASSERT_EQUALS(&frame[0] + frame.size(), cursor);
+        }
+    }
+
+    void testDownsampling()
+    {
+        TS_ASSERT((*handler)(params("testValue 3 1 2 17 13"), *pipe, &*grid, validRegion, 5));
+
+        if (mpiLayer->rank() == 0) {
+            std::vector<char> frame;
+            TS_ASSERT(BulkDataServer::receiveFrame(*socket, &frame));
+            const char *cursor = checkHeader(frame, 5, Coord<2>(1, 2), Coord<2>(6, 5), 3);
+
+            for (int y = 2; y < 15; y += 3) {
+                for (int x = 1; x < 18; x += 3) {
+                    TS_ASSERT_EQUALS(x + 100.0 * y, read<double>(&cursor));
+                }
+            }
+            TS_ASSERT_EQUALS(&frame[0] + frame.size(), cursor);
+        }
+    }
+
+    void testCellsOutsideOfGridAreZeroed()
+    {
+        TS_ASSERT((*handler)(params("testValue 1 18 14 4 4"), *pipe, &*grid, validRegion, 5));
+
+        if (mpiLayer->rank() == 0) {
+            std::vector<char> frame;
+            TS_ASSERT(BulkDataServer::receiveFrame(*socket, &frame));
+            const char *cursor = checkHeader(frame, 5, Coord<2>(18, 14), Coord<2>(4, 4), 1);
+
+            for (int y = 14; y < 18; ++y) {
+                for (int x = 18; x < 22; ++x) {
+                    double expected = ((x < 20) && (y < 16)) ? (x + 100.0 * y) : 0;
+                    TS_ASSERT_EQUALS(expected, read<double>(&cursor));
+                }
+            }
+        }
+    }
+
+    void testStreamingRequeuesRequest()
+    {
+        (*handler)(params("testValue 2 0 0 4 4 3"), *pipe, &*grid, validRegion, 5);
+
+        StringVec expected;
+        if (mpiLayer->rank() == 0) {
+            expected << "bulk testValue 2 0 0 4 4 2";
+        }
+        TS_ASSERT_EQUALS(expected, pipe->copySteeringRequestsQueue());
+
+        pipe->sync();
+        StringVec request = StringOps::tokenize(pipe->retrieveSteeringRequests()[0], " ");
+        TS_ASSERT_EQUALS("bulk", pop_front(request));
+        (*handler)(request, *pipe, &*grid, validRegion, 6);
+        pipe->sync();
+        request = StringOps::tokenize(pipe->retrieveSteeringRequests()[0], " ");
+        TS_ASSERT_EQUALS("bulk", pop_front(request));
+        (*handler)(request, *pipe, &*grid, validRegion, 7);
+        pipe->sync();
+        TS_ASSERT_EQUALS(std::size_t(0), pipe->retrieveSteeringRequests().size());
+
+        if (mpiLayer->rank() == 0) {
+            std::vector<char> frame;
+            for (unsigned step = 5; step < 8; ++step) {
+                TS_ASSERT(BulkDataServer::receiveFrame(*socket, &frame));
+                checkHeader(frame, step, Coord<2>(0, 0), Coord<2>(2, 2), 2);
+            }
+        }
+    }
+
+    void testInvalidRequests()
+    {
+        TS_ASSERT((*handler)(params("pressure 1 0 0 4 4"), *pipe, &*grid, validRegion, 5));
+        TS_ASSERT((*handler)(params("testValue 1 0 0"), *pipe, &*grid, validRegion, 5));
+
+        StringVec expected;
+        if (mpiLayer->rank() == 0) {
+            expected << "bulk: selector not found: pressure"
+                     << "usage: bulk SELECTOR STRIDE ORIGIN DIMENSIONS [FRAMES]";
+        }
+        TS_ASSERT_EQUALS(expected, pipe->copySteeringFeedback());
+    }
+
+private:
+    boost::shared_ptr<MPILayer> mpiLayer;
+    boost::shared_ptr<Pipe> pipe;
+    int port;
+    CoordBox<2> box;
+    Region<2> validRegion;
+    boost::shared_ptr<GridType> grid;
+    boost::shared_ptr<BulkDataServer> server;
+    boost::asio::io_service ioService;
+    boost::shared_ptr<tcp::socket> socket;
+    boost::shared_ptr<HandlerType> handler;
+
+    StringVec params(const std::string& line)
+    {
+        return StringOps::tokenize(line, " ");
+    }
+
+    template<typename T>
+    T read(const char **cursor)
+    {
+        T ret;
+        std::memcpy(&ret, *cursor, sizeof(T));
+        *cursor += sizeof(T);
+        return ret;
+    }
+
+    const char *checkHeader(
+        const std::vector<char>& frame,
+        int step,
+        const Coord<2>& origin,
+        const Coord<2>& dimensions,
+        int stride)
+    {
+        const char *cursor = &frame[0];
+        TS_ASSERT_EQUALS(step,             read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(2,                read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(origin.x(),       read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(origin.y(),       read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(dimensions.x(),   read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(dimensions.y(),   read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(stride,           read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(int(sizeof(double)), read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS(9,                read<HandlerType::Int>(&cursor));
+        TS_ASSERT_EQUALS("testValue",      std::string(cursor, 9));
+        cursor += 9;
+
+        std::size_t dataSize = dimensions.prod() * sizeof(double);
+        TS_ASSERT_EQUALS(frame.size(), std::size_t(cursor - &frame[0]) + dataSize);
+        return cursor;
+    }
+};
+
+}
+
+}
@@ -2,6 +2,7 @@
 #define LIBGEODECOMP_IO_SIMPLECELLPLOTTER_H
 
 #include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/misc/palette.h>
 #include <libgeodecomp/misc/quickpalette.h>
 #include <libgeodecomp/storage/filter.h>
@@ -97,6 +98,12 @@ class SimpleCellPlotter
 public:
     friend class PPMWriterTest;
 
+    /**
+     * Signals to the Plotter that colors() is available, so cells
+     * don't need to be plotted one by one.
+     */
+    typedef void SupportsStreakPlotting;
+
     template<typename MEMBER, typename PALETTE>
     explicit SimpleCellPlotter(MEMBER CELL_TYPE:: *memberPointer, const PALETTE& palette) :
         cellToColorSelector(
@@ -129,6 +136,27 @@ public:
             color);
     }
 
+    /**
+     * Converts all cells of the streak to colors at once. This
+     * extracts the member via saveMember(), which avoids copying
+     * whole cells (especially costly for SoAGrid).
+     */
+    template<typename GRID_TYPE>
+    void colors(
+        const GRID_TYPE& grid,
+        const Streak<2>& streak,
+        Color *target) const
+    {
+        Region<2> region;
+        region << streak;
+
+        grid.saveMemberUnchecked(
+            reinterpret_cast<char*>(target),
+            MemoryLocation::HOST,
+            cellToColorSelector,
+            region);
+    }
+
 private:
     Selector<CELL_TYPE> cellToColorSelector;
 };
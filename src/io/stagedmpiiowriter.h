@@ -0,0 +1,484 @@
+#ifndef LIBGEODECOMP_IO_STAGEDMPIIOWRITER_H
+#define LIBGEODECOMP_IO_STAGEDMPIIOWRITER_H
+
+#include <libgeodecomp/config.h>
+#if defined(LIBGEODECOMP_WITH_MPI) && defined(LIBGEODECOMP_WITH_THREADS)
+
+#include <libgeodecomp/communication/typemaps.h>
+#include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/io/mpiio.h>
+#include <libgeodecomp/io/mpiiosnapshot.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <deque>
+#include <iomanip>
+
+namespace LibGeoDecomp {
+
+namespace StagedMPIIOWriterHelpers {
+
+/**
+ * Background worker of a StagedMPIIOWriter: saves queued snapshots
+ * to node-local storage and then drains them to the global .mpiio
+ * files.
+ *
+ * Drains are issued as non-blocking MPI-IO writes. If MPI was
+ * initialized with MPI_THREAD_MULTIPLE, the worker issues and
+ * completes them itself. Otherwise MPI may only be called from the
+ * simulation thread, so the worker hands the locally saved snapshots
+ * back. progress() then starts their writes and completes them in
+ * later calls, without waiting for the file system.
+ *
+ * At most maxQueued snapshots may be queued, staged or in flight at
+ * any time. If the drain lags behind, push() blocks until a slot
+ * becomes available, which bounds the memory footprint.
+ */
+template<typename CELL_TYPE>
+class Stager
+{
+public:
+    typedef MPIIOSnapshot<CELL_TYPE> Snapshot;
+    typedef boost::shared_ptr<Snapshot> SnapshotPtr;
+    typedef typename Snapshot::Topology Topology;
+    static const int DIM = Topology::DIM;
+
+    class Job
+    {
+    public:
+        Job(
+            const SnapshotPtr& snapshot = SnapshotPtr(),
+            const std::string& localFilename = "",
+            const std::string& globalFilename = "",
+            bool writeHeader = false) :
+            snapshot(snapshot),
+            localFilename(localFilename),
+            globalFilename(globalFilename),
+            writeHeader(writeHeader)
+        {}
+
+        SnapshotPtr snapshot;
+        std::string localFilename;
+        std::string globalFilename;
+        // the header is identical on all ranks, so only one writes it:
+        bool writeHeader;
+    };
+
+    Stager(const MPI_Datatype& datatype, bool drainInBackground, std::size_t maxQueued = 2) :
+        datatype(datatype),
+        drainInBackground(drainInBackground),
+        maxQueued((std::max)(maxQueued, std::size_t(1))),
+        busy(false),
+        done(false)
+    {
+        thread = boost::thread(&Stager::run, this);
+    }
+
+    ~Stager()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            done = true;
+        }
+        signal.notify_all();
+        thread.join();
+
+        for (typename std::deque<TransferPtr>::iterator i = inFlight.begin(); i != inFlight.end(); ++i) {
+            complete(*i);
+        }
+    }
+
+    /**
+     * Queues a snapshot, blocks while maxQueued snapshots are still
+     * being processed.
+     */
+    void push(const Job& job)
+    {
+        for (;;) {
+            progress();
+
+            boost::unique_lock<boost::mutex> lock(mutex);
+            if ((pending.size() + busy + staged.size() + inFlight.size()) < maxQueued) {
+                pending << job;
+                break;
+            }
+
+            if (!staged.empty()) {
+                // progress() will start these
+                continue;
+            }
+
+            if (!inFlight.empty()) {
+                // only this thread may complete these writes:
+                lock.unlock();
+                complete(inFlight.front());
+                inFlight.pop_front();
+                continue;
+            }
+
+            signal.wait(lock);
+        }
+
+        signal.notify_all();
+    }
+
+    /**
+     * Starts writing snapshots which have been staged locally, but
+     * which the worker was not allowed to drain to the global file.
+     * Completes earlier writes if they are done. Never waits for the
+     * file system. Rethrows errors from the worker thread.
+     */
+    void progress()
+    {
+        std::deque<Job> jobs;
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            checkError();
+            jobs.swap(staged);
+        }
+
+        for (typename std::deque<Job>::iterator i = jobs.begin(); i != jobs.end(); ++i) {
+            inFlight << startDrain(*i);
+        }
+
+        while (!inFlight.empty() && isComplete(inFlight.front())) {
+            complete(inFlight.front());
+            inFlight.pop_front();
+        }
+
+        if (!jobs.empty()) {
+            signal.notify_all();
+        }
+    }
+
+    /**
+     * Blocks until all queued snapshots have reached the global file.
+     */
+    void flush()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            while (busy || !pending.empty()) {
+                signal.wait(lock);
+            }
+        }
+
+        progress();
+        for (typename std::deque<TransferPtr>::iterator i = inFlight.begin(); i != inFlight.end(); ++i) {
+            complete(*i);
+        }
+        inFlight.clear();
+        signal.notify_all();
+    }
+
+private:
+    /**
+     * A drain in progress. The header fields need a fixed address
+     * until the writes have completed, hence these objects are never
+     * copied.
+     */
+    class Transfer
+    {
+    public:
+        Job job;
+        MPI_File file;
+        std::vector<MPI_Request> requests;
+        Coord<DIM> dimensions;
+        unsigned step;
+        unsigned maxSteps;
+        CELL_TYPE edgeCell;
+    };
+    typedef boost::shared_ptr<Transfer> TransferPtr;
+
+    MPIIO<CELL_TYPE, Topology> mpiio;
+    MPI_Datatype datatype;
+    bool drainInBackground;
+    std::size_t maxQueued;
+    bool busy;
+    bool done;
+    std::string error;
+    std::deque<Job> pending;
+    std::deque<Job> staged;
+    // only accessed by the simulation thread:
+    std::deque<TransferPtr> inFlight;
+    boost::mutex mutex;
+    boost::condition_variable signal;
+    boost::thread thread;
+
+    void run()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+
+        for (;;) {
+            while (pending.empty() && !done) {
+                signal.wait(lock);
+            }
+            if (pending.empty()) {
+                return;
+            }
+
+            Job job = pending.front();
+            pending.pop_front();
+            busy = true;
+            lock.unlock();
+
+            std::string message;
+            try {
+                job.snapshot->save(job.localFilename);
+                if (drainInBackground) {
+                    complete(startDrain(job));
+                }
+            } catch (const std::exception& e) {
+                message = e.what();
+            }
+
+            lock.lock();
+            if (!drainInBackground) {
+                staged << job;
+            }
+            if (!message.empty()) {
+                error = message;
+            }
+            busy = false;
+            signal.notify_all();
+        }
+    }
+
+    /**
+     * Each rank opens the global file independently as ranks might
+     * finish their node-local copies in any order. The layout matches
+     * MPIIO::writeRegion().
+     */
+    TransferPtr startDrain(const Job& job)
+    {
+        const Snapshot& snapshot = *job.snapshot;
+        TransferPtr transfer(new Transfer);
+        transfer->job = job;
+        transfer->dimensions = snapshot.getDimensions();
+        transfer->step = snapshot.getStep();
+        transfer->maxSteps = snapshot.getMaxSteps();
+        transfer->edgeCell = snapshot.getEdge();
+        transfer->file = mpiio.openFileForWrite(job.globalFilename, MPI_COMM_SELF);
+
+        MPI_Aint coordLength = mpiio.getLength(Typemaps::lookup<Coord<DIM> >());
+        MPI_Aint unsignedLength = mpiio.getLength(MPI_UNSIGNED);
+        MPI_Aint cellLength = mpiio.getLength(datatype);
+        MPI_Offset headerLength = coordLength + 2 * unsignedLength + cellLength;
+
+        if (job.writeHeader) {
+            write(transfer.get(), 0, &transfer->dimensions, 1, Typemaps::lookup<Coord<DIM> >());
+            write(transfer.get(), coordLength, &transfer->step, 1, MPI_UNSIGNED);
+            write(transfer.get(), coordLength + unsignedLength, &transfer->maxSteps, 1, MPI_UNSIGNED);
+            write(transfer.get(), coordLength + 2 * unsignedLength, &transfer->edgeCell, 1, datatype);
+        }
+
+        const Region<DIM>& region = snapshot.getRegion();
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            if (i->length() == 0) {
+                continue;
+            }
+
+            // the coords need to be normalized because on torus
+            // topologies the coordnates may exceed the bounding box
+            // (especially negative coordnates may occurr).
+            Coord<DIM> coord = Topology::normalize(i->origin, transfer->dimensions);
+            MPI_Offset offset = headerLength + coord.toIndex(transfer->dimensions) * cellLength;
+            write(transfer.get(), offset, snapshot.data(*i), i->length(), datatype);
+        }
+
+        return transfer;
+    }
+
+    template<typename T>
+    static void write(Transfer *transfer, MPI_Offset offset, const T *data, int count, MPI_Datatype type)
+    {
+        MPI_Request request;
+        MPI_File_iwrite_at(
+            transfer->file, offset, const_cast<T*>(data), count, type, &request);
+        transfer->requests << request;
+    }
+
+    static bool isComplete(const TransferPtr& transfer)
+    {
+        if (transfer->requests.empty()) {
+            return true;
+        }
+
+        int flag;
+        MPI_Testall(transfer->requests.size(), &transfer->requests[0], &flag, MPI_STATUSES_IGNORE);
+        return flag != 0;
+    }
+
+    static void complete(const TransferPtr& transfer)
+    {
+        if (!transfer->requests.empty()) {
+            MPI_Waitall(transfer->requests.size(), &transfer->requests[0], MPI_STATUSES_IGNORE);
+            transfer->requests.clear();
+        }
+        MPI_File_close(&transfer->file);
+    }
+
+    void checkError()
+    {
+        if (!error.empty()) {
+            std::string message = error;
+            error.clear();
+            throw FileWriteException(message);
+        }
+    }
+};
+
+}
+
+/**
+ * Checkpoint writer with the same output format as
+ * ParallelMPIIOWriter, but which doesn't block the simulation while
+ * writing to the (usually slow) shared file system. On each
+ * checkpoint the rank's validRegion is merely copied into memory. A
+ * background thread then saves this snapshot to a node-local
+ * directory (e.g. /dev/shm or a local scratch disk) and drains it to
+ * the global .mpiio file.
+ *
+ * Pass the same staging directory to MPIIOInitializer to restart
+ * from the node-local copies where available.
+ *
+ * If MPI wasn't initialized with MPI_THREAD_MULTIPLE, the writes to
+ * the global file are issued as non-blocking MPI-IO operations from
+ * the simulation thread during subsequent calls to stepFinished().
+ * How much of these writes overlaps with computation then depends on
+ * the MPI library's asynchronous progress.
+ *
+ * At most maxQueued checkpoints are kept in memory. If the file
+ * system can't keep up, the simulation is throttled.
+ */
+template<typename CELL_TYPE>
+class StagedMPIIOWriter : public Clonable<ParallelWriter<CELL_TYPE>, StagedMPIIOWriter<CELL_TYPE> >
+{
+public:
+    friend class StagedMPIIOWriterTest;
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    typedef StagedMPIIOWriterHelpers::Stager<CELL_TYPE> Stager;
+    static const int DIM = Topology::DIM;
+    using ParallelWriter<CELL_TYPE>::period;
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    StagedMPIIOWriter(
+        const std::string& prefix,
+        const std::string& stagingDirectory,
+        const unsigned period,
+        const unsigned maxSteps,
+        const MPI_Comm& communicator = MPI_COMM_WORLD,
+        const MPI_Datatype& mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value(),
+        const std::size_t maxQueued = 2) :
+        Clonable<ParallelWriter<CELL_TYPE>, StagedMPIIOWriter<CELL_TYPE> >(prefix, period),
+        stagingDirectory(stagingDirectory),
+        maxSteps(maxSteps),
+        comm(communicator),
+        datatype(mpiDatatype),
+        maxQueued(maxQueued)
+    {
+        MPI_Comm_rank(comm, &rank);
+        boost::filesystem::create_directories(stagingDirectory);
+        initStager();
+    }
+
+    /**
+     * Clones don't share the background thread.
+     */
+    StagedMPIIOWriter(const StagedMPIIOWriter& other) :
+        Clonable<ParallelWriter<CELL_TYPE>, StagedMPIIOWriter<CELL_TYPE> >(other.prefix, other.period),
+        stagingDirectory(other.stagingDirectory),
+        maxSteps(other.maxSteps),
+        comm(other.comm),
+        datatype(other.datatype),
+        maxQueued(other.maxQueued),
+        rank(other.rank)
+    {
+        initStager();
+    }
+
+    ~StagedMPIIOWriter()
+    {
+        try {
+            stager->flush();
+        } catch (const std::exception& e) {
+            LOG(ERROR, "StagedMPIIOWriter failed to flush checkpoints: " << e.what());
+        }
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<Topology::DIM>& validRegion,
+        const Coord<Topology::DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        stager->progress();
+
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        if (snapshot) {
+            snapshot->append(grid, validRegion);
+        } else {
+            snapshot.reset(
+                new typename Stager::Snapshot(grid, validRegion, globalDimensions, step, maxSteps));
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        stager->push(typename Stager::Job(snapshot, localFilename(step), filename(step), this->rank == 0));
+        snapshot.reset();
+
+        if (event == WRITER_ALL_DONE) {
+            stager->flush();
+            // all global files are complete once everyone is done:
+            MPI_Barrier(comm);
+        }
+    }
+
+private:
+    std::string stagingDirectory;
+    unsigned maxSteps;
+    MPI_Comm comm;
+    MPI_Datatype datatype;
+    std::size_t maxQueued;
+    int rank;
+    boost::shared_ptr<Stager> stager;
+    // collects the regions of the current step until lastCall:
+    typename Stager::SnapshotPtr snapshot;
+
+    void initStager()
+    {
+        int threadSupport;
+        MPI_Query_thread(&threadSupport);
+        stager.reset(new Stager(datatype, threadSupport == MPI_THREAD_MULTIPLE, maxQueued));
+    }
+
+    std::string filename(unsigned step) const
+    {
+        std::ostringstream buf;
+        buf << prefix << std::setfill('0') << std::setw(5) << step << ".mpiio";
+        return buf.str();
+    }
+
+    std::string localFilename(unsigned step) const
+    {
+        return MPIIOSnapshot<CELL_TYPE>::localFilename(stagingDirectory, filename(step), rank);
+    }
+};
+
+}
+
+#endif
+#endif
@@ -18,6 +18,30 @@ public:
     }
 };
 
+/**
+ * Paints the same tiles as SimpleCellPlotter, but lacks colors(), so
+ * the Plotter has to fall back to plotting cell by cell.
+ */
+class PerCellPlotter
+{
+public:
+    PerCellPlotter() :
+        delegate(&TestCell<2>::testValue, TestCellPalette())
+    {}
+
+    template<typename PAINTER>
+    void operator()(
+        const TestCell<2>& cell,
+        PAINTER& painter,
+        const Coord<2>& cellDimensions) const
+    {
+        delegate(cell, painter, cellDimensions);
+    }
+
+private:
+    SimpleCellPlotter<TestCell<2> > delegate;
+};
+
 class PlotterTest : public CxxTest::TestSuite
 {
 private:
@@ -153,6 +177,48 @@ public:
         int span = t2 - t1;
         TS_ASSERT(span < 10);
     }
+
+    void testPlotGridIntoImageMatchesPainter()
+    {
+        Grid<TestCell<2> > testGrid(Coord<2>(7, 5));
+        CoordBox<2> box = testGrid.boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            testGrid[*i].testValue = i->x() * 30 + i->y() * 7;
+        }
+
+        Plotter<TestCell<2> > smallPlotter(
+            Coord<2>(3, 2),
+            SimpleCellPlotter<TestCell<2> >(&TestCell<2>::testValue, TestCellPalette()));
+        Plotter<TestCell<2>, PerCellPlotter> perCellPlotter(Coord<2>(3, 2), PerCellPlotter());
+
+        std::vector<CoordBox<2> > viewports;
+        viewports << CoordBox<2>(Coord<2>(0, 0), Coord<2>(21, 10))
+                  << CoordBox<2>(Coord<2>(4, 3), Coord<2>(10, 5))
+                  << CoordBox<2>(Coord<2>(5, 1), Coord<2>(30, 20))
+                  << CoordBox<2>(Coord<2>(40, 1), Coord<2>(10, 10));
+
+        for (std::size_t i = 0; i < viewports.size(); ++i) {
+            Image expected(viewports[i].dimensions);
+            ImagePainter painter(&expected);
+            smallPlotter.plotGridInViewport(testGrid, painter, viewports[i]);
+
+            Image actual(viewports[i].dimensions);
+            smallPlotter.plotGridInViewport(testGrid, &actual, viewports[i]);
+            TS_ASSERT_EQUALS(expected, actual);
+
+            Image fallback(viewports[i].dimensions);
+            perCellPlotter.plotGridInViewport(testGrid, &fallback, viewports[i]);
+            TS_ASSERT_EQUALS(expected, fallback);
+        }
+
+        Image expected(smallPlotter.calcImageDim(Coord<2>(7, 5)));
+        ImagePainter painter(&expected);
+        smallPlotter.plotGrid(testGrid, painter);
+
+        Image actual(smallPlotter.calcImageDim(Coord<2>(7, 5)));
+        smallPlotter.plotGrid(testGrid, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+    }
 };
 
 }
@@ -0,0 +1,73 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TestTestInitializer_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_1/testinitializertest.h"
+
+static TestTestInitializer suite_TestTestInitializer;
+
+static CxxTest::List Tests_TestTestInitializer = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TestTestInitializer( "/root/repo/src/io/test/parallel_mpi_1/testinitializertest.h", 12, "TestTestInitializer", suite_TestTestInitializer, Tests_TestTestInitializer );
+
+static class TestDescription_suite_TestTestInitializer_testGridRectangle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testGridRectangle() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 26, "testGridRectangle" ) {}
+ void runTest() { suite_TestTestInitializer.testGridRectangle(); }
+} testDescription_suite_TestTestInitializer_testGridRectangle;
+
+static class TestDescription_suite_TestTestInitializer_testGrid1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testGrid1() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 32, "testGrid1" ) {}
+ void runTest() { suite_TestTestInitializer.testGrid1(); }
+} testDescription_suite_TestTestInitializer_testGrid1;
+
+static class TestDescription_suite_TestTestInitializer_testGrid2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testGrid2() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 59, "testGrid2" ) {}
+ void runTest() { suite_TestTestInitializer.testGrid2(); }
+} testDescription_suite_TestTestInitializer_testGrid2;
+
+static class TestDescription_suite_TestTestInitializer_testGridWidth : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testGridWidth() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 93, "testGridWidth" ) {}
+ void runTest() { suite_TestTestInitializer.testGridWidth(); }
+} testDescription_suite_TestTestInitializer_testGridWidth;
+
+static class TestDescription_suite_TestTestInitializer_testGridHeight : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testGridHeight() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 98, "testGridHeight" ) {}
+ void runTest() { suite_TestTestInitializer.testGridHeight(); }
+} testDescription_suite_TestTestInitializer_testGridHeight;
+
+static class TestDescription_suite_TestTestInitializer_testMaxSteps : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testMaxSteps() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 103, "testMaxSteps" ) {}
+ void runTest() { suite_TestTestInitializer.testMaxSteps(); }
+} testDescription_suite_TestTestInitializer_testMaxSteps;
+
+static class TestDescription_suite_TestTestInitializer_testStartStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestTestInitializer_testStartStep() : CxxTest::RealTestDescription( Tests_TestTestInitializer, suiteDescription_TestTestInitializer, 108, "testStartStep" ) {}
+ void runTest() { suite_TestTestInitializer.testStartStep(); }
+} testDescription_suite_TestTestInitializer_testStartStep;
+
@@ -11,6 +11,24 @@ using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
 
+/**
+ * Test model for use with BinaryOutputArchive/BinaryInputArchive
+ */
+class CollectingWriterTestCell
+{
+public:
+    class API : public APITraits::HasBinarySerialization
+    {};
+
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & values;
+    }
+
+    std::vector<int> values;
+};
+
 class CollectingWriterTest : public CxxTest::TestSuite
 {
 public:
@@ -57,6 +75,44 @@ public:
         }
     }
 
+    void testVariableSizeCells()
+    {
+        MPILayer mpiLayer;
+        MemoryWriter<CollectingWriterTestCell> *memoryWriter = 0;
+        if (mpiLayer.rank() == 0) {
+            memoryWriter = new MemoryWriter<CollectingWriterTestCell>(1);
+        }
+        CollectingWriter<CollectingWriterTestCell> collectingWriter(memoryWriter, 0, MPI_COMM_WORLD, MPI_CHAR);
+
+        Coord<2> dim(10, mpiLayer.size());
+        CoordBox<2> box(Coord<2>(), dim);
+        DisplacedGrid<CollectingWriterTestCell> grid(box);
+        Region<2> validRegion;
+        validRegion << Streak<2>(Coord<2>(0, mpiLayer.rank()), dim.x());
+
+        for (Region<2>::Iterator i = validRegion.begin(); i != validRegion.end(); ++i) {
+            for (int j = 0; j <= i->x(); ++j) {
+                grid[*i].values << (i->y() * 100 + j);
+            }
+        }
+
+        collectingWriter.stepFinished(grid, validRegion, dim, 0, WRITER_INITIALIZED, mpiLayer.rank(), true);
+
+        if (mpiLayer.rank() == 0) {
+            TS_ASSERT_EQUALS(std::size_t(1), memoryWriter->getGrids().size());
+            MemoryWriter<CollectingWriterTestCell>::GridType& globalGrid = memoryWriter->getGrid(0);
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                CollectingWriterTestCell cell = globalGrid.get(*i);
+                const std::vector<int>& values = cell.values;
+                TS_ASSERT_EQUALS(std::size_t(i->x() + 1), values.size());
+                for (std::size_t j = 0; j < values.size(); ++j) {
+                    TS_ASSERT_EQUALS(int(i->y() * 100 + j), values[j]);
+                }
+            }
+        }
+    }
+
 private:
     boost::shared_ptr<StripingSimulator<TestCell<3> > > sim;
     MemoryWriter<TestCell<3> > *writer;
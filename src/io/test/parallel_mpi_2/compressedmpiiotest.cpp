@@ -0,0 +1,57 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CompressedMPIIOTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/compressedmpiiotest.h"
+
+static CompressedMPIIOTest suite_CompressedMPIIOTest;
+
+static CxxTest::List Tests_CompressedMPIIOTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CompressedMPIIOTest( "/root/repo/src/io/test/parallel_mpi_2/compressedmpiiotest.h", 16, "CompressedMPIIOTest", suite_CompressedMPIIOTest, Tests_CompressedMPIIOTest );
+
+static class TestDescription_suite_CompressedMPIIOTest_testCodec : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CompressedMPIIOTest_testCodec() : CxxTest::RealTestDescription( Tests_CompressedMPIIOTest, suiteDescription_CompressedMPIIOTest, 41, "testCodec" ) {}
+ void runTest() { suite_CompressedMPIIOTest.testCodec(); }
+} testDescription_suite_CompressedMPIIOTest_testCodec;
+
+static class TestDescription_suite_CompressedMPIIOTest_testIncrementalCheckpoints : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CompressedMPIIOTest_testIncrementalCheckpoints() : CxxTest::RealTestDescription( Tests_CompressedMPIIOTest, suiteDescription_CompressedMPIIOTest, 74, "testIncrementalCheckpoints" ) {}
+ void runTest() { suite_CompressedMPIIOTest.testIncrementalCheckpoints(); }
+} testDescription_suite_CompressedMPIIOTest_testIncrementalCheckpoints;
+
+static class TestDescription_suite_CompressedMPIIOTest_testLargeStepNumbers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CompressedMPIIOTest_testLargeStepNumbers() : CxxTest::RealTestDescription( Tests_CompressedMPIIOTest, suiteDescription_CompressedMPIIOTest, 131, "testLargeStepNumbers" ) {}
+ void runTest() { suite_CompressedMPIIOTest.testLargeStepNumbers(); }
+} testDescription_suite_CompressedMPIIOTest_testLargeStepNumbers;
+
+static class TestDescription_suite_CompressedMPIIOTest_testWriterAndInitializer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CompressedMPIIOTest_testWriterAndInitializer() : CxxTest::RealTestDescription( Tests_CompressedMPIIOTest, suiteDescription_CompressedMPIIOTest, 161, "testWriterAndInitializer" ) {}
+ void runTest() { suite_CompressedMPIIOTest.testWriterAndInitializer(); }
+} testDescription_suite_CompressedMPIIOTest_testWriterAndInitializer;
+
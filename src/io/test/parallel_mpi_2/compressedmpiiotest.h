@@ -0,0 +1,194 @@
+#include <libgeodecomp/io/compressedmpiiowriter.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/mpiioinitializer.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/loadbalancer/randombalancer.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/parallelization/stripingsimulator.h>
+
+#include <boost/filesystem.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CompressedMPIIOTest : public CxxTest::TestSuite
+{
+public:
+    typedef Topologies::Cube<3>::Topology Topology;
+    typedef Grid<double, Topology> GridType;
+
+    std::vector<std::string> files;
+    int rank;
+
+    void setUp()
+    {
+        rank = MPILayer().rank();
+        files.clear();
+    }
+
+    void tearDown()
+    {
+        MPILayer().barrier();
+        if (rank == 0) {
+            for (std::size_t i = 0; i < files.size(); ++i) {
+                boost::filesystem::remove(files[i]);
+            }
+        }
+    }
+
+    void testCodec()
+    {
+        std::vector<double> smooth;
+        std::vector<double> noise;
+        for (int i = 0; i < 1000; ++i) {
+            smooth << 1.0 + (i / 100) * 0.25;
+            noise << (i * 7919 % 1013) * 1.2345e-3;
+        }
+        smooth[500] = -4711.0;
+
+        std::vector<char> buffer;
+        CompressedMPIIOHelpers::ShuffleRLECodec::encode(
+            reinterpret_cast<char*>(&smooth[0]), sizeof(double), smooth.size(), &buffer);
+        TS_ASSERT(buffer.size() < smooth.size() * sizeof(double) / 10);
+
+        std::vector<double> decoded(smooth.size());
+        CompressedMPIIOHelpers::ShuffleRLECodec::decode(
+            &buffer[0], buffer.size(), sizeof(double), decoded.size(), reinterpret_cast<char*>(&decoded[0]));
+        TS_ASSERT_EQUALS(smooth, decoded);
+
+        buffer.clear();
+        CompressedMPIIOHelpers::ShuffleRLECodec::encode(
+            reinterpret_cast<char*>(&noise[0]), sizeof(double), noise.size(), &buffer);
+        CompressedMPIIOHelpers::ShuffleRLECodec::decode(
+            &buffer[0], buffer.size(), sizeof(double), decoded.size(), reinterpret_cast<char*>(&decoded[0]));
+        TS_ASSERT_EQUALS(noise, decoded);
+
+        TS_ASSERT_THROWS(
+            CompressedMPIIOHelpers::ShuffleRLECodec::decode(
+                &buffer[0], buffer.size() - 1, sizeof(double), decoded.size(), reinterpret_cast<char*>(&decoded[0])),
+            std::logic_error&);
+    }
+
+    void testIncrementalCheckpoints()
+    {
+        Coord<3> dim(64, 32, 16);
+        GridType grid(dim, 0.0, -1.0);
+        CoordBox<3> box(Coord<3>(), dim);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid[*i] = (i->toIndex(dim) * 7919 % 1013) * 1.2345e-3;
+        }
+
+        // each rank owns half of the z-slices:
+        Region<3> region;
+        region << CoordBox<3>(Coord<3>(0, 0, rank * 8), Coord<3>(dim.x(), dim.y(), 8));
+
+        CompressedMPIIO<double, Topology> mpiio(32);
+        std::string prefix = "testcompressedmpiio";
+        files << CompressedMPIIO<double, Topology>::filename(prefix, 0)
+              << CompressedMPIIO<double, Topology>::filename(prefix, 4);
+
+        mpiio.writeRegion(grid, dim, 0, 10, prefix, region);
+        std::size_t fullBytes = mpiio.lastBytesWritten();
+
+        GridType expected0 = grid;
+        grid[Coord<3>(5, 6, 7)] = 47.11;
+        grid[Coord<3>(3, 2, 9)] = 0.815;
+        mpiio.writeRegion(grid, dim, 4, 10, prefix, region);
+        std::size_t incrementalBytes = mpiio.lastBytesWritten();
+        // only one block per rank was altered, the rest is index:
+        TS_ASSERT(incrementalBytes * 5 < fullBytes);
+
+        Coord<3> actualDim;
+        unsigned step;
+        unsigned maxSteps;
+        mpiio.readMetadata(&actualDim, &step, &maxSteps, files[1]);
+        TS_ASSERT_EQUALS(dim, actualDim);
+        TS_ASSERT_EQUALS(unsigned(4), step);
+        TS_ASSERT_EQUALS(unsigned(10), maxSteps);
+
+        Region<3> all;
+        all << CoordBox<3>(Coord<3>(), dim);
+        GridType actual0(dim);
+        GridType actual1(dim);
+        mpiio.readRegion(&actual0, files[0], all);
+        mpiio.readRegion(&actual1, files[1], all);
+        TS_ASSERT_EQUALS(expected0, actual0);
+        TS_ASSERT_EQUALS(grid, actual1);
+
+        // reading parts of a file only touches blocks within the region:
+        GridType partial(dim, 0.0, 0.0);
+        Region<3> part;
+        part << Streak<3>(Coord<3>(2, 6, 7), 10);
+        mpiio.readRegion(&partial, files[1], part);
+        TS_ASSERT_EQUALS(47.11, partial[Coord<3>(5, 6, 7)]);
+        TS_ASSERT_EQUALS(0.0,   partial[Coord<3>(1, 6, 7)]);
+        TS_ASSERT_EQUALS(0.0,   partial[Coord<3>(10, 6, 7)]);
+        TS_ASSERT_EQUALS(-1.0,  partial.getEdge());
+    }
+
+    void testLargeStepNumbers()
+    {
+        typedef CompressedMPIIO<double, Topology> MPIIOType;
+        TS_ASSERT_EQUALS("foo", MPIIOType::prefixOf(MPIIOType::filename("foo", 99999), 99999));
+        TS_ASSERT_EQUALS("foo", MPIIOType::prefixOf(MPIIOType::filename("foo", 123456), 123456));
+        TS_ASSERT_EQUALS("bar1", MPIIOType::prefixOf(MPIIOType::filename("bar1", 7), 7));
+        TS_ASSERT_THROWS(MPIIOType::prefixOf(MPIIOType::filename("foo", 7), 8), std::invalid_argument&);
+
+        Coord<3> dim(16, 8, 4);
+        GridType grid(dim, 1.0, -1.0);
+        Region<3> region;
+        region << CoordBox<3>(Coord<3>(0, 0, rank * 2), Coord<3>(dim.x(), dim.y(), 2));
+
+        MPIIOType mpiio(32);
+        std::string prefix = "testcompressedmpiiolarge";
+        files << MPIIOType::filename(prefix, 99999)
+              << MPIIOType::filename(prefix, 100000);
+
+        mpiio.writeRegion(grid, dim, 99999, 200000, prefix, region);
+        grid[Coord<3>(1, 2, 3)] = 47.11;
+        // this file references unchanged blocks from the previous one:
+        mpiio.writeRegion(grid, dim, 100000, 200000, prefix, region);
+
+        Region<3> all;
+        all << CoordBox<3>(Coord<3>(), dim);
+        GridType actual(dim);
+        mpiio.readRegion(&actual, files[1], all);
+        TS_ASSERT_EQUALS(grid, actual);
+    }
+
+    void testWriterAndInitializer()
+    {
+        for (unsigned i = 0; i <= 21; i += (i == 20)? 1 : 4) {
+            files << CompressedMPIIO<TestCell<3> >::filename("testcompressedmpiiowriter", i);
+        }
+
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+        LoadBalancer *balancer = rank? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(init, balancer);
+        sim.addWriter(new CompressedMPIIOWriter<TestCell<3> >("testcompressedmpiiowriter", 4, init->maxSteps()));
+        sim.run();
+        MPILayer().barrier();
+
+        SerialSimulator<TestCell<3> > simReference(new TestInitializer<TestCell<3> >());
+        MemoryWriter<TestCell<3> > *memoryWriter = new MemoryWriter<TestCell<3> >(4);
+        simReference.addWriter(memoryWriter);
+        simReference.run();
+        typedef APITraits::SelectTopology<TestCell<3> >::Value TestCellTopology;
+        std::vector<Grid<TestCell<3>, TestCellTopology> > expected = memoryWriter->getGrids();
+        TS_ASSERT_EQUALS(files.size(), expected.size());
+
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            MPIIOInitializer<TestCell<3> > restart(files[i]);
+            TS_ASSERT_EQUALS(unsigned(21), restart.maxSteps());
+            TS_ASSERT_EQUALS(expected[i].getDimensions(), restart.gridDimensions());
+
+            Grid<TestCell<3>, TestCellTopology> actual(restart.gridDimensions());
+            restart.grid(&actual);
+            TS_ASSERT_EQUALS(expected[i], actual);
+        }
+    }
+};
+
+}
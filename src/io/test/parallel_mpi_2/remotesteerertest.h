@@ -1,9 +1,11 @@
 #include <cxxtest/TestSuite.h>
+#include <cstring>
 #include <libgeodecomp/config.h>
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/io/logger.h>
 #include <libgeodecomp/io/parallelmemorywriter.h>
 #include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/storage/displacedgrid.h>
 #include <libgeodecomp/storage/dataaccessor.h>
 #include <libgeodecomp/loadbalancer/noopbalancer.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
@@ -329,8 +331,65 @@ public:
 #endif
     }
 
+    void testBulkData()
+    {
+#if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+        MPILayer mpiLayer;
+        int commandPort = 47116;
+        int dataPort = 47117;
+        RemoteSteerer<TestCell<2> > remoteSteerer(1, commandPort);
+        remoteSteerer.enableBulkData(dataPort);
+        remoteSteerer.addBulkDataSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        CoordBox<2> box(Coord<2>(), Coord<2>(8, 6));
+        Region<2> validRegion;
+        validRegion << CoordBox<2>(Coord<2>(0, 3 * mpiLayer.rank()), Coord<2>(8, 3));
+        DisplacedGrid<TestCell<2> > grid(box);
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TestCell<2> cell;
+            cell.testValue = i->x() + 10 * i->y();
+            grid.set(*i, cell);
+        }
+
+        boost::asio::io_service ioService;
+        tcp::socket socket(ioService);
+        if (mpiLayer.rank() == 0) {
+            socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), dataPort));
+            remoteSteerer.sendCommand("bulk testValue 2 0 0 8 6 2");
+
+            // sleep until the request has made it into the pipeline
+            while (remoteSteerer.pipe->copySteeringRequestsQueue().size() == 0) {
+                usleep(10000);
+            }
+        }
+        mpiLayer.barrier();
+
+        SteererFeedback feedback;
+        for (unsigned step = 10; step < 13; ++step) {
+            remoteSteerer.nextStep(&grid, validRegion, box.dimensions, step, STEERER_NEXT_STEP, 0, true, &feedback);
+        }
+
+        if (mpiLayer.rank() == 0) {
+            for (int i = 0; i < 2; ++i) {
+                std::vector<char> frame;
+                TS_ASSERT(BulkDataServer::receiveFrame(socket, &frame));
+
+                // 9 ints of header, 9 chars of name, 4x3 doubles:
+                TS_ASSERT_EQUALS(9 * sizeof(int) + 9 + 12 * sizeof(double), frame.size());
+                double values[12];
+                std::memcpy(values, &frame[frame.size() - sizeof(values)], sizeof(values));
+                TS_ASSERT_EQUALS( 0.0, values[0]);
+                TS_ASSERT_EQUALS( 6.0, values[3]);
+                TS_ASSERT_EQUALS(46.0, values[11]);
+            }
+        }
+#endif
+    }
+
 private:
 #if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+    typedef Steerer<TestCell<2> >::SteererFeedback SteererFeedback;
+
     boost::shared_ptr<MPILayer> mpiLayer;
     boost::shared_ptr<StripingSimulator<TestCell<2> > > sim;
     RemoteSteerer<TestCell<2> > *steerer;
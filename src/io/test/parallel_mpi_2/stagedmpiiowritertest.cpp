@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StagedMPIIOWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/stagedmpiiowritertest.h"
+
+static StagedMPIIOWriterTest suite_StagedMPIIOWriterTest;
+
+static CxxTest::List Tests_StagedMPIIOWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StagedMPIIOWriterTest( "/root/repo/src/io/test/parallel_mpi_2/stagedmpiiowritertest.h", 17, "StagedMPIIOWriterTest", suite_StagedMPIIOWriterTest, Tests_StagedMPIIOWriterTest );
+
+static class TestDescription_suite_StagedMPIIOWriterTest_testGlobalFilesMatchReference : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StagedMPIIOWriterTest_testGlobalFilesMatchReference() : CxxTest::RealTestDescription( Tests_StagedMPIIOWriterTest, suiteDescription_StagedMPIIOWriterTest, 63, "testGlobalFilesMatchReference" ) {}
+ void runTest() { suite_StagedMPIIOWriterTest.testGlobalFilesMatchReference(); }
+} testDescription_suite_StagedMPIIOWriterTest_testGlobalFilesMatchReference;
+
+static class TestDescription_suite_StagedMPIIOWriterTest_testRestartFromLocalCopies : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StagedMPIIOWriterTest_testRestartFromLocalCopies() : CxxTest::RealTestDescription( Tests_StagedMPIIOWriterTest, suiteDescription_StagedMPIIOWriterTest, 91, "testRestartFromLocalCopies" ) {}
+ void runTest() { suite_StagedMPIIOWriterTest.testRestartFromLocalCopies(); }
+} testDescription_suite_StagedMPIIOWriterTest_testRestartFromLocalCopies;
+
+static class TestDescription_suite_StagedMPIIOWriterTest_testFallbackToGlobalFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StagedMPIIOWriterTest_testFallbackToGlobalFile() : CxxTest::RealTestDescription( Tests_StagedMPIIOWriterTest, suiteDescription_StagedMPIIOWriterTest, 125, "testFallbackToGlobalFile" ) {}
+ void runTest() { suite_StagedMPIIOWriterTest.testFallbackToGlobalFile(); }
+} testDescription_suite_StagedMPIIOWriterTest_testFallbackToGlobalFile;
+
@@ -0,0 +1,176 @@
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/mpiioinitializer.h>
+#include <libgeodecomp/io/stagedmpiiowriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/loadbalancer/randombalancer.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/parallelization/stripingsimulator.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <boost/filesystem.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class StagedMPIIOWriterTest : public CxxTest::TestSuite
+{
+public:
+    typedef APITraits::SelectTopology<TestCell<3> >::Value Topology;
+    typedef Grid<TestCell<3>, Topology> GridType;
+
+    std::string stagingDirectory;
+    std::vector<GridType> expected;
+    int rank;
+
+    void setUp()
+    {
+        rank = MPILayer().rank();
+        stagingDirectory = "teststagedmpiiowriter_staging";
+
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+        SerialSimulator<TestCell<3> > simReference(init);
+        MemoryWriter<TestCell<3> > *memoryWriter = new MemoryWriter<TestCell<3> >(4);
+        simReference.addWriter(memoryWriter);
+        simReference.run();
+        expected = memoryWriter->getGrids();
+
+        TestInitializer<TestCell<3> > *init2 = new TestInitializer<TestCell<3> >();
+        LoadBalancer *balancer = rank? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(init2, balancer);
+        sim.addWriter(
+            new StagedMPIIOWriter<TestCell<3> >(
+                "teststagedmpiiowriter",
+                stagingDirectory,
+                4,
+                init2->maxSteps()));
+        sim.run();
+    }
+
+    void tearDown()
+    {
+        MPILayer().barrier();
+        if (rank == 0) {
+            for (unsigned i = 0; i <= 21; i += (i == 20)? 1 : 4) {
+                boost::filesystem::remove(filename(i));
+            }
+            boost::filesystem::remove_all(stagingDirectory);
+        }
+        MPILayer().barrier();
+    }
+
+    void testGlobalFilesMatchReference()
+    {
+        if (rank != 0) {
+            return;
+        }
+
+        MPIIO<TestCell<3> > mpiio;
+        std::vector<GridType> actual;
+
+        for (unsigned i = 0; i <= 21; i += (i == 20)? 1 : 4) {
+            Coord<3> dimensions;
+            unsigned step;
+            unsigned maxSteps;
+            mpiio.readMetadata(&dimensions, &step, &maxSteps, filename(i), MPI_COMM_SELF);
+            TS_ASSERT_EQUALS(i, step);
+            TS_ASSERT_EQUALS(unsigned(21), maxSteps);
+
+            Region<3> region;
+            region << CoordBox<3>(Coord<3>(), dimensions);
+            GridType buffer(dimensions);
+            mpiio.readRegion(&buffer, filename(i), region, MPI_COMM_SELF);
+            actual.push_back(buffer);
+        }
+
+        TS_ASSERT_EQUALS(expected.size(), actual.size());
+        TS_ASSERT_EQUALS(expected, actual);
+    }
+
+    void testRestartFromLocalCopies()
+    {
+        MPIIOSnapshot<TestCell<3> > snapshot;
+        std::string localFile = MPIIOSnapshot<TestCell<3> >::localFilename(
+            stagingDirectory, filename(8), rank);
+        TS_ASSERT(snapshot.load(localFile));
+        TS_ASSERT_EQUALS(unsigned(8), snapshot.getStep());
+        // the RandomBalancer may leave a rank without any cells, but
+        // together the local copies need to cover the whole grid:
+        unsigned localCells = snapshot.getRegion().size();
+        std::vector<unsigned> cells = MPILayer().allGather(localCells);
+        TS_ASSERT_EQUALS(unsigned(expected[2].getDimensions().prod()), sum(cells));
+
+        // remove the global file to ensure we're only reading locally:
+        MPILayer().barrier();
+        if (rank == 0) {
+            boost::filesystem::remove(filename(8));
+        }
+        MPILayer().barrier();
+
+        MPIIOInitializer<TestCell<3> > init(
+            filename(8),
+            Typemaps::lookup<TestCell<3> >(),
+            MPI_COMM_WORLD,
+            stagingDirectory);
+        TS_ASSERT_EQUALS(unsigned(8), init.startStep());
+        TS_ASSERT_EQUALS(unsigned(21), init.maxSteps());
+        TS_ASSERT_EQUALS(expected[2].getDimensions(), init.gridDimensions());
+
+        DisplacedGrid<TestCell<3>, Topology> grid(snapshot.getRegion().boundingBox());
+        init.grid(&grid);
+        checkGrid(grid, snapshot.getRegion(), expected[2]);
+    }
+
+    void testFallbackToGlobalFile()
+    {
+        // ranks without local copies force everyone to use the
+        // global file, but the local copies still take precedence:
+        if (rank == 1) {
+            boost::filesystem::remove(
+                MPIIOSnapshot<TestCell<3> >::localFilename(stagingDirectory, filename(12), rank));
+        }
+        MPILayer().barrier();
+
+        MPIIOInitializer<TestCell<3> > init(
+            filename(12),
+            Typemaps::lookup<TestCell<3> >(),
+            MPI_COMM_WORLD,
+            stagingDirectory);
+        TS_ASSERT_EQUALS(unsigned(12), init.startStep());
+
+        CoordBox<3> box(Coord<3>(), init.gridDimensions());
+        DisplacedGrid<TestCell<3>, Topology> grid(box);
+        init.grid(&grid);
+
+        Region<3> region;
+        region << box;
+        checkGrid(grid, region, expected[3]);
+    }
+
+private:
+    std::string filename(unsigned step) const
+    {
+        std::ostringstream buf;
+        buf << "teststagedmpiiowriter" << std::setfill('0') << std::setw(5) << step << ".mpiio";
+        return buf.str();
+    }
+
+    void checkGrid(
+        const DisplacedGrid<TestCell<3>, Topology>& actual,
+        const Region<3>& region,
+        const GridType& expected)
+    {
+        TS_ASSERT_EQUALS(expected.getEdge(), actual.getEdge());
+
+        std::size_t mismatches = 0;
+        for (Region<3>::Iterator i = region.begin(); i != region.end(); ++i) {
+            if (!(actual[*i] == expected[*i])) {
+                ++mismatches;
+            }
+        }
+        TS_ASSERT_EQUALS(std::size_t(0), mismatches);
+    }
+};
+
+}
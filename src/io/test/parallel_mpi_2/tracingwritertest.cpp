@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TracingWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/tracingwritertest.h"
+
+static TracingWriterTest suite_TracingWriterTest;
+
+static CxxTest::List Tests_TracingWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TracingWriterTest( "/root/repo/src/io/test/parallel_mpi_2/tracingwritertest.h", 14, "TracingWriterTest", suite_TracingWriterTest, Tests_TracingWriterTest );
+
+static class TestDescription_suite_TracingWriterTest_testOutputToStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracingWriterTest_testOutputToStream() : CxxTest::RealTestDescription( Tests_TracingWriterTest, suiteDescription_TracingWriterTest, 31, "testOutputToStream" ) {}
+ void runTest() { suite_TracingWriterTest.testOutputToStream(); }
+} testDescription_suite_TracingWriterTest_testOutputToStream;
+
@@ -0,0 +1,20 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}clonableinitializerwrappertest.cpp
+  ${RELATIVE_PATH}initializertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}serialbovwritertest.cpp
+  ${RELATIVE_PATH}silowritertest.cpp
+  ${RELATIVE_PATH}steerertest.cpp
+  ${RELATIVE_PATH}unstructuredtestinitializertest.cpp
+  ${RELATIVE_PATH}visitwritertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}clonableinitializerwrappertest.h
+  ${RELATIVE_PATH}initializertest.h
+  ${RELATIVE_PATH}serialbovwritertest.h
+  ${RELATIVE_PATH}silowritertest.h
+  ${RELATIVE_PATH}steerertest.h
+  ${RELATIVE_PATH}unstructuredtestinitializertest.h
+  ${RELATIVE_PATH}visitwritertest.h
+)
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ClonableInitializerWrapperTest_init = false;
+#include "/root/repo/src/io/test/unit/clonableinitializerwrappertest.h"
+
+static ClonableInitializerWrapperTest suite_ClonableInitializerWrapperTest;
+
+static CxxTest::List Tests_ClonableInitializerWrapperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ClonableInitializerWrapperTest( "/root/repo/src/io/test/unit/clonableinitializerwrappertest.h", 124, "ClonableInitializerWrapperTest", suite_ClonableInitializerWrapperTest, Tests_ClonableInitializerWrapperTest );
+
+static class TestDescription_suite_ClonableInitializerWrapperTest_testDelegate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ClonableInitializerWrapperTest_testDelegate() : CxxTest::RealTestDescription( Tests_ClonableInitializerWrapperTest, suiteDescription_ClonableInitializerWrapperTest, 133, "testDelegate" ) {}
+ void runTest() { suite_ClonableInitializerWrapperTest.testDelegate(); }
+} testDescription_suite_ClonableInitializerWrapperTest_testDelegate;
+
+static class TestDescription_suite_ClonableInitializerWrapperTest_testWrapWithCopyConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ClonableInitializerWrapperTest_testWrapWithCopyConstructor() : CxxTest::RealTestDescription( Tests_ClonableInitializerWrapperTest, suiteDescription_ClonableInitializerWrapperTest, 157, "testWrapWithCopyConstructor" ) {}
+ void runTest() { suite_ClonableInitializerWrapperTest.testWrapWithCopyConstructor(); }
+} testDescription_suite_ClonableInitializerWrapperTest_testWrapWithCopyConstructor;
+
+static class TestDescription_suite_ClonableInitializerWrapperTest_testForwardingOfConstructorArguments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ClonableInitializerWrapperTest_testForwardingOfConstructorArguments() : CxxTest::RealTestDescription( Tests_ClonableInitializerWrapperTest, suiteDescription_ClonableInitializerWrapperTest, 168, "testForwardingOfConstructorArguments" ) {}
+ void runTest() { suite_ClonableInitializerWrapperTest.testForwardingOfConstructorArguments(); }
+} testDescription_suite_ClonableInitializerWrapperTest_testForwardingOfConstructorArguments;
+
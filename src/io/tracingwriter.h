@@ -3,12 +3,14 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/posix_time/time_parsers.hpp>
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/io/writer.h>
 #include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/perfcounters.h>
 
 namespace LibGeoDecomp {
 
@@ -17,6 +19,12 @@ namespace LibGeoDecomp {
  * which allows the user to gauge execution time (current, remaining,
  * estimated time of arrival (ETA)) and performance (GLUPS, memory
  * bandwidth).
+ *
+ * If hardware counters have been activated via
+ * PerfCounters::enable(), it'll also report instructions per cycle
+ * (IPC) and the measured main memory traffic per cell update for
+ * the calling thread. This helps to tell compute-bound from
+ * memory-bound kernels.
  */
 template<typename CELL_TYPE>
 class TracingWriter :
@@ -45,11 +53,15 @@ public:
         outputRank(outputRank),
         stream(stream),
         lastStep(0),
-        maxSteps(maxSteps)
-    {}
+        maxSteps(maxSteps),
+        localCells(0)
+    {
+        std::fill(lastCounters, lastCounters + PerfCounters::NUM_COUNTERS, 0.0);
+    }
 
     virtual void stepFinished(const WriterGridType& grid, unsigned step, WriterEvent event)
     {
+        localCells = grid.dimensions().prod();
         stepFinished(step, grid.dimensions(), event);
     }
 
@@ -62,8 +74,13 @@ public:
         std::size_t rank,
         bool lastCall)
     {
-        if (lastCall && ((outputRank == OUTPUT_ON_ALL_RANKS) || (outputRank == (int)rank))) {
-            stepFinished(step, globalDimensions, event);
+        localCells += validRegion.size();
+
+        if (lastCall) {
+            if ((outputRank == OUTPUT_ON_ALL_RANKS) || (outputRank == (int)rank)) {
+                stepFinished(step, globalDimensions, event);
+            }
+            localCells = 0;
         }
     }
 
@@ -73,6 +90,10 @@ private:
     Time startTime;
     unsigned lastStep;
     unsigned maxSteps;
+    // number of cells updated by this process, used to normalize
+    // hardware counter readings:
+    std::size_t localCells;
+    double lastCounters[PerfCounters::NUM_COUNTERS];
 
     void stepFinished(unsigned step, const Coord<DIM>& globalDimensions, WriterEvent event)
     {
@@ -84,6 +105,7 @@ private:
             stream << "TracingWriter::initialized()\n";
             printTime();
             lastStep = step;
+            readCounters(lastCounters);
             break;
         case WRITER_STEP_FINISHED:
             normalStepFinished(step, globalDimensions);
@@ -124,7 +146,44 @@ private:
                << boost::posix_time::to_simple_string(eta) << "\n"
                << "  speed: " << glups << " GLUPS\n"
                << "  effective memory bandwidth " << bandwidth << " GB/s\n";
+        printCounters(step);
         printTime();
+        lastStep = step;
+    }
+
+    void printCounters(unsigned step)
+    {
+        const PerfCounters *perfCounters = PerfCounters::instance();
+        if (!perfCounters || !perfCounters->available()) {
+            return;
+        }
+
+        double counters[PerfCounters::NUM_COUNTERS];
+        readCounters(counters);
+        double cycles = counters[PerfCounters::CYCLES] - lastCounters[PerfCounters::CYCLES];
+        double instructions = counters[PerfCounters::INSTRUCTIONS] - lastCounters[PerfCounters::INSTRUCTIONS];
+        double misses = counters[PerfCounters::CACHE_MISSES] - lastCounters[PerfCounters::CACHE_MISSES];
+        double updates = 1.0 * (step - lastStep) * NANO_STEPS * localCells;
+        std::copy(counters, counters + PerfCounters::NUM_COUNTERS, lastCounters);
+
+        if (perfCounters->available(PerfCounters::CYCLES) &&
+            perfCounters->available(PerfCounters::INSTRUCTIONS) &&
+            (cycles > 0)) {
+            stream << "  IPC: " << (instructions / cycles) << "\n";
+        }
+
+        if (perfCounters->available(PerfCounters::CACHE_MISSES) && (updates > 0)) {
+            stream << "  measured memory traffic: "
+                   << (misses * PerfCounters::CACHE_LINE_SIZE / updates) << " bytes/cell\n";
+        }
+    }
+
+    void readCounters(double *counters) const
+    {
+        const PerfCounters *perfCounters = PerfCounters::instance();
+        if (perfCounters) {
+            perfCounters->read(counters);
+        }
     }
 
     void printTime() const
@@ -36,9 +36,11 @@
 #include <libgeodecomp/loadbalancer/tracingbalancer.h>
 #include <libgeodecomp/misc/apitraits.h>
 #include <libgeodecomp/misc/color.h>
+#include <libgeodecomp/misc/counterbasedrandom.h>
 #include <libgeodecomp/misc/random.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
+#include <libgeodecomp/parallelization/threadsimulator.h>
 #include <libgeodecomp/storage/boxcell.h>
 #include <libgeodecomp/storage/containercell.h>
 #include <libgeodecomp/storage/fixedarray.h>
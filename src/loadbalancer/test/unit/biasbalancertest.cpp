@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BiasBalancerTest_init = false;
+#include "/root/repo/src/loadbalancer/test/unit/biasbalancertest.h"
+
+static BiasBalancerTest suite_BiasBalancerTest;
+
+static CxxTest::List Tests_BiasBalancerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BiasBalancerTest( "/root/repo/src/loadbalancer/test/unit/biasbalancertest.h", 9, "BiasBalancerTest", suite_BiasBalancerTest, Tests_BiasBalancerTest );
+
+static class TestDescription_suite_BiasBalancerTest_testDestabilization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BiasBalancerTest_testDestabilization() : CxxTest::RealTestDescription( Tests_BiasBalancerTest, suiteDescription_BiasBalancerTest, 27, "testDestabilization" ) {}
+ void runTest() { suite_BiasBalancerTest.testDestabilization(); }
+} testDescription_suite_BiasBalancerTest_testDestabilization;
+
+static class TestDescription_suite_BiasBalancerTest_testDeleteBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BiasBalancerTest_testDeleteBalancer() : CxxTest::RealTestDescription( Tests_BiasBalancerTest, suiteDescription_BiasBalancerTest, 37, "testDeleteBalancer" ) {}
+ void runTest() { suite_BiasBalancerTest.testDeleteBalancer(); }
+} testDescription_suite_BiasBalancerTest_testDeleteBalancer;
+
+static class TestDescription_suite_BiasBalancerTest_testInterfaceToOtherBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BiasBalancerTest_testInterfaceToOtherBalancer() : CxxTest::RealTestDescription( Tests_BiasBalancerTest, suiteDescription_BiasBalancerTest, 47, "testInterfaceToOtherBalancer" ) {}
+ void runTest() { suite_BiasBalancerTest.testInterfaceToOtherBalancer(); }
+} testDescription_suite_BiasBalancerTest_testInterfaceToOtherBalancer;
+
@@ -0,0 +1,132 @@
+#ifndef LIBGEODECOMP_MISC_AMRTESTCELL_H
+#define LIBGEODECOMP_MISC_AMRTESTCELL_H
+
+#include <libgeodecomp/geometry/stencils.h>
+#include <libgeodecomp/io/simpleinitializer.h>
+#include <libgeodecomp/misc/apitraits.h>
+
+#include <iostream>
+
+namespace LibGeoDecomp {
+
+namespace AMRTestCellHelpers {
+
+class EmptyAPI
+{};
+
+}
+
+/**
+ * A test vehicle for the AMRGrid: explicit heat diffusion on a torus.
+ * Cells are refined wherever the temperature exceeds a threshold,
+ * which initially is just a hot spot in the center. The diffusion
+ * coefficient is scaled with the mesh width of the cell's level,
+ * assuming a refinement ratio of 2. Passing
+ * APITraits::HasAdaptiveMeshRefinement as ADDITIONAL_API has the
+ * SerialSimulator refine the model, the default yields a uniform
+ * reference.
+ */
+template<typename ADDITIONAL_API = AMRTestCellHelpers::EmptyAPI>
+class AMRTestCell
+{
+public:
+    class API :
+        public ADDITIONAL_API,
+        public APITraits::HasTorusTopology<2>,
+        public APITraits::HasStencil<Stencils::VonNeumann<2, 1> >
+    {};
+
+    class Initializer : public SimpleInitializer<AMRTestCell>
+    {
+    public:
+        /**
+         * The hot spot in the center is set to spotValue.
+         */
+        explicit Initializer(
+            const Coord<2>& dimensions = Coord<2>(32, 16),
+            unsigned steps = 10,
+            double spotValue = 1.0) :
+            SimpleInitializer<AMRTestCell>(dimensions, steps),
+            spotValue(spotValue)
+        {}
+
+        virtual void grid(GridBase<AMRTestCell, 2> *target)
+        {
+            CoordBox<2> spot(this->gridDimensions() / 2 - Coord<2>(2, 2), Coord<2>(4, 4));
+            CoordBox<2> box = target->boundingBox();
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                target->set(*i, AMRTestCell(spot.inBounds(*i) ? spotValue : 0.0));
+            }
+        }
+
+    private:
+        double spotValue;
+    };
+
+    explicit AMRTestCell(double value = 0, int level = 0) :
+        value(value),
+        level(level)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, int /* nanoStep */)
+    {
+        const AMRTestCell& self = hood[FixedCoord< 0,  0>()];
+        double laplacian =
+            hood[FixedCoord< 0, -1>()].value +
+            hood[FixedCoord<-1,  0>()].value +
+            hood[FixedCoord< 1,  0>()].value +
+            hood[FixedCoord< 0,  1>()].value -
+            4 * self.value;
+
+        level = self.level;
+        value = self.value + 0.01 * (1 << (2 * level)) * laplacian;
+    }
+
+    AMRTestCell prolongate(int fineLevel) const
+    {
+        return AMRTestCell(value, fineLevel);
+    }
+
+    static AMRTestCell restrictFrom(const AMRTestCell *children, std::size_t num, int coarseLevel)
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < num; ++i) {
+            sum += children[i].value;
+        }
+
+        return AMRTestCell(sum / num, coarseLevel);
+    }
+
+    bool needsRefinement() const
+    {
+        return value > 0.05;
+    }
+
+    bool operator==(const AMRTestCell& other) const
+    {
+        return (value == other.value) && (level == other.level);
+    }
+
+    bool operator!=(const AMRTestCell& other) const
+    {
+        return !(*this == other);
+    }
+
+    double value;
+    int level;
+};
+
+}
+
+template<typename CharT, typename Traits, typename ADDITIONAL_API>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os,
+           const LibGeoDecomp::AMRTestCell<ADDITIONAL_API>& cell)
+{
+    os << "AMRTestCell(" << cell.value << ", " << cell.level << ")";
+    return os;
+}
+
+#endif
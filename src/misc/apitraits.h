@@ -684,6 +684,45 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    /**
+     * Decide whether a model can be (de-)serialized with the
+     * lightweight BinaryOutputArchive/BinaryInputArchive.
+     */
+    template<typename CELL, typename HAS_BINARY_SERIALIZATION = void>
+    class SelectBinarySerialization
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectBinarySerialization<CELL, typename CELL::API::SupportsBinarySerialization>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Flags cells of varying size which can be marshalled via
+     * BinaryOutputArchive/BinaryInputArchive (see
+     * binaryserialization.h). These archives work with the same
+     * serialize() member templates as Boost.Serialization, but
+     * without streams and archive headers: trivially copyable members
+     * are simply memcpy()'d and containers are prefixed by their
+     * size. Pointers are not tracked. If a cell has both,
+     * HasBinarySerialization and HasBoostSerialization, binary
+     * serialization takes precedence for ghost zone exchange.
+     * ContainerCell and BoxCell inherit their cargo's API, so they
+     * opt in if and only if their cargo does.
+     */
+    class HasBinarySerialization
+    {
+    public:
+        typedef void SupportsBinarySerialization;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     template<typename CELL, typename HAS_SPEED = void>
     class SelectStaticData
     {
@@ -764,6 +803,84 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    template<typename CELL, typename HAS_ACTIVITY_TRACKING = void>
+    class SelectActivityTracking
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectActivityTracking<CELL, typename CELL::API::SupportsActivityTracking>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Models in which only few cells change per time step (e.g.
+     * along the front of a bush fire or a flood) can use this trait
+     * to have the simulator skip quiescent cells: only cells with a
+     * neighbor (as defined by the stencil) which changed during the
+     * previous nano step are updated, all others are carried over.
+     * The cell has to provide a member function
+     *
+     *   bool changed() const
+     *
+     * which reports whether the last call to update() (or
+     * updateLineX()) altered the cell. The cell's update must not
+     * depend on anything but its neighborhood (e.g. not on the nano
+     * step or time step), as the result would otherwise depend on
+     * which cells were skipped. Not available for unstructured grids.
+     */
+    class HasActivityTracking
+    {
+    public:
+        typedef void SupportsActivityTracking;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+    template<typename CELL, typename HAS_ADAPTIVE_MESH_REFINEMENT = void>
+    class SelectAdaptiveMeshRefinement
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectAdaptiveMeshRefinement<CELL, typename CELL::API::SupportsAdaptiveMeshRefinement>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Models which need a finer resolution only in parts of the
+     * simulation space (e.g. along a coast line) can use this trait
+     * to have the SerialSimulator store them in an AMRGrid (see
+     * there for the member functions the cell needs to provide).
+     * The grid is tiled into blocks of BLOCK_WIDTH^DIM cells, which
+     * may be refined up to MAX_LEVEL times by RATIO per dimension.
+     * The refinement is adapted every REGRID_PERIOD steps (never if
+     * REGRID_PERIOD is 0). Writers
+     * and getGrid() see the coarsest level. Other simulators ignore
+     * this trait for now.
+     */
+    template<int MAX_LEVEL, int BLOCK_WIDTH = 8, int RATIO = 2, int REGRID_PERIOD = 1>
+    class HasAdaptiveMeshRefinement
+    {
+    public:
+        typedef void SupportsAdaptiveMeshRefinement;
+
+        static const int AMR_MAX_LEVEL = MAX_LEVEL;
+        static const int AMR_BLOCK_WIDTH = BLOCK_WIDTH;
+        static const int AMR_RATIO = RATIO;
+        static const int AMR_REGRID_PERIOD = REGRID_PERIOD;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     template<typename CELL, typename HAS_SEPARATE_CUDA_UPDATE = void>
     class SelectSeparateCUDAUpdate
     {
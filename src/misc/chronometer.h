@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_MISC_CHRONOMETER_H
 #define LIBGEODECOMP_MISC_CHRONOMETER_H
 
+#include <libgeodecomp/misc/perfcounters.h>
 #include <libgeodecomp/misc/scopedtimer.h>
 #include <libgeodecomp/storage/fixedarray.h>
 
@@ -28,24 +29,64 @@ public:
     template<typename CHRONOMETER>
     BasicTimerImplementation(CHRONOMETER *chrono) :
         totalTimes(chrono->rawTotalTimes()),
+        totalCounters(chrono->rawTotalCounters()),
+        perfCounters(PerfCounters::instance()),
         t(ScopedTimer::time())
-    {}
+    {
+        if (perfCounters) {
+            perfCounters->read(counters);
+        }
+    }
 
     template<typename CHRONOMETER>
     BasicTimerImplementation(CHRONOMETER *chrono, double t) :
         totalTimes(chrono->rawTotalTimes()),
+        totalCounters(chrono->rawTotalCounters()),
+        perfCounters(0),
         t(t)
     {}
 
 protected:
     double *totalTimes;
+    double *totalCounters;
+    // only set if hardware counters are being sampled:
+    const PerfCounters *perfCounters;
 
     double elapsed() const
     {
         return ScopedTimer::time() - t;
     }
 
+    /**
+     * Converts start time and start counter values into the
+     * respective deltas.
+     */
+    void stop()
+    {
+        t = elapsed();
+
+        if (perfCounters) {
+            double now[PerfCounters::NUM_COUNTERS];
+            perfCounters->read(now);
+            for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+                counters[i] = now[i] - counters[i];
+            }
+        }
+    }
+
+    void add(int id)
+    {
+        totalTimes[id] += t;
+
+        if (perfCounters) {
+            for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+                totalCounters[id * PerfCounters::NUM_COUNTERS + i] += counters[i];
+            }
+        }
+    }
+
     double t;
+    double counters[PerfCounters::NUM_COUNTERS];
 };
 
 /**
@@ -104,7 +145,7 @@ public:
                                                                     \
         ~CLASS_NAME ## Implementation()                             \
         {                                                           \
-            totalTimes[ID] += t;                                    \
+            add(ID);                                                \
         }                                                           \
     };                                                              \
                                                                     \
@@ -121,7 +162,7 @@ public:
                                                                     \
         ~CLASS_NAME()                                               \
         {                                                           \
-            t = elapsed();                                          \
+            stop();                                                 \
         }                                                           \
     };
 }
@@ -211,9 +252,12 @@ public:
 
     // measure one time interval per class of events
     static const std::size_t NUM_INTERVALS = ChronometerHelpers::EventUtil<100>::NUM_EVENTS;
+    // one slot per hardware counter and interval
+    static const std::size_t NUM_COUNTER_SLOTS = NUM_INTERVALS * PerfCounters::NUM_COUNTERS;
 
     Chronometer() :
-        totalTimes(NUM_INTERVALS, 0)
+        totalTimes(NUM_INTERVALS, 0),
+        totalCounters(NUM_COUNTER_SLOTS, 0)
     {
         reset();
     }
@@ -238,6 +282,10 @@ public:
             totalTimes[i] += other.totalTimes[i];
         }
 
+        for (std::size_t i = 0; i < NUM_COUNTER_SLOTS; ++i) {
+            totalCounters[i] += other.totalCounters[i];
+        }
+
         return *this;
     }
 
@@ -249,11 +297,12 @@ public:
     }
 
     /**
-     * Flushes all time totals to 0.
+     * Flushes all time and counter totals to 0.
      */
     void reset()
     {
         std::fill(totalTimes.begin(), totalTimes.end(), 0);
+        std::fill(totalCounters.begin(), totalCounters.end(), 0);
     }
 
     void cycle()
@@ -292,11 +341,52 @@ public:
         return totalTimes[i1] / totalTimes[i2];
     }
 
+    /**
+     * Returns the accumulated value of the given hardware counter
+     * (see PerfCounters) for INTERVAL. Counters are only sampled
+     * after PerfCounters::enable() has been called.
+     */
+    template<typename INTERVAL>
+    double counter(int counterID) const
+    {
+        return totalCounters[INTERVAL::ID * PerfCounters::NUM_COUNTERS + counterID];
+    }
+
+    /**
+     * Instructions per cycle (IPC) during INTERVAL, or 0 if no
+     * cycles were recorded.
+     */
+    template<typename INTERVAL>
+    double instructionsPerCycle() const
+    {
+        double cycles = counter<INTERVAL>(PerfCounters::CYCLES);
+        if (cycles == 0) {
+            return 0;
+        }
+
+        return counter<INTERVAL>(PerfCounters::INSTRUCTIONS) / cycles;
+    }
+
+    /**
+     * Estimated main memory traffic during INTERVAL, derived from
+     * last level cache misses.
+     */
+    template<typename INTERVAL>
+    double memoryBytes() const
+    {
+        return counter<INTERVAL>(PerfCounters::CACHE_MISSES) * PerfCounters::CACHE_LINE_SIZE;
+    }
+
     double *rawTotalTimes()
     {
         return totalTimes.begin();
     }
 
+    double *rawTotalCounters()
+    {
+        return totalCounters.begin();
+    }
+
     template<typename EVENT>
     void addTime(double elapsedTime)
     {
@@ -315,7 +405,16 @@ public:
 
         for (std::size_t i = 0; i < NUM_INTERVALS; ++i) {
             buf << std::left << std::setw(20) << ChronometerHelpers::EventToString()(i)
-                << ": " << totalTimes[i] << "s\n";
+                << ": " << totalTimes[i] << "s";
+
+            if (PerfCounters::instance()) {
+                for (int c = 0; c < PerfCounters::NUM_COUNTERS; ++c) {
+                    buf << ", " << PerfCounters::counterName(c) << " "
+                        << totalCounters[i * PerfCounters::NUM_COUNTERS + c];
+                }
+            }
+
+            buf << "\n";
         }
 
         return buf.str();
@@ -323,6 +422,7 @@ public:
 
 private:
     FixedArray<double, Chronometer::NUM_INTERVALS> totalTimes;
+    FixedArray<double, Chronometer::NUM_COUNTER_SLOTS> totalCounters;
 };
 
 }
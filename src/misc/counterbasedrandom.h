@@ -0,0 +1,183 @@
+#ifndef LIBGEODECOMP_MISC_COUNTERBASEDRANDOM_H
+#define LIBGEODECOMP_MISC_COUNTERBASEDRANDOM_H
+
+#include <libflatarray/short_vec.hpp>
+#include <libgeodecomp/geometry/coord.h>
+
+#include <boost/cstdint.hpp>
+
+namespace LibGeoDecomp {
+
+/**
+ * Counter-based pseudo random number generator for use within
+ * update(): each number is a pure function of (seed, stream,
+ * location, step, nano step, index), computed via the Philox4x32-10
+ * bijection (Salmon et al., "Parallel Random Numbers: As Easy as 1,
+ * 2, 3", SC'11). There is no shared state, so calls from different
+ * threads don't race, and results are bitwise identical regardless
+ * of the Simulator, number of threads or domain decomposition.
+ *
+ * location identifies the cell, either by its ID (e.g. for particle
+ * codes) or via location(Coord). Cells need to track the current
+ * time step themselves (update() only gets the nano step). index
+ * allows for drawing multiple numbers per cell and nano step:
+ *
+ *   CounterBasedRandom rng(seed);
+ *   double r = rng.gen_d(CounterBasedRandom::location(pos), step, nanoStep, 0);
+ *
+ * Unlike Random, instances are cheap to copy and may be stored
+ * within cells or models.
+ */
+class CounterBasedRandom
+{
+public:
+    typedef boost::uint32_t Word;
+    typedef boost::uint64_t Location;
+
+    /**
+     * seed and stream form the key of the generator. Use different
+     * streams for statistically independent processes within the
+     * same model.
+     */
+    inline explicit CounterBasedRandom(Word seed = 0, Word stream = 0)
+    {
+        key[0] = seed;
+        key[1] = stream;
+    }
+
+    /**
+     * Maps coordinates to a location so that neighboring cells along
+     * the x-axis yield consecutive locations (which is what the
+     * short_vec overloads assume). Supports coordinates in [0, 2^21)
+     * for 3D and [0, 2^32) for 1D/2D.
+     */
+    static inline Location location(const Coord<1>& coord)
+    {
+        return Location(Word(coord.x()));
+    }
+
+    static inline Location location(const Coord<2>& coord)
+    {
+        return Location(Word(coord.x())) | (Location(Word(coord.y())) << 32);
+    }
+
+    static inline Location location(const Coord<3>& coord)
+    {
+        const Location mask = (Location(1) << 21) - 1;
+        return
+            (Location(coord.x()) & mask) |
+            ((Location(coord.y()) & mask) << 21) |
+            ((Location(coord.z()) & mask) << 42);
+    }
+
+    /**
+     * Uniformly distributed 32 bit word.
+     */
+    inline Word gen_u(Location location, Word step, Word nanoStep, Word index = 0) const
+    {
+        Word result[4];
+        generate(location, step, nanoStep, index / 4, result);
+        return result[index % 4];
+    }
+
+    /**
+     * Uniformly distributed integer in [0, max).
+     */
+    inline Word gen_u(Location location, Word step, Word nanoStep, Word index, Word max) const
+    {
+        return Word((boost::uint64_t(gen_u(location, step, nanoStep, index)) * max) >> 32);
+    }
+
+    /**
+     * Uniformly distributed in [0, max), using 53 random bits.
+     */
+    inline double gen_d(Location location, Word step, Word nanoStep, Word index = 0, double max = 1.0) const
+    {
+        Word result[4];
+        generate(location, step, nanoStep, index / 2, result);
+        Word *words = result + 2 * (index % 2);
+
+        return toDouble(words[0], words[1]) * max;
+    }
+
+    /**
+     * Batch version of gen_d() for updateLineX(): lane i is set to
+     * gen_d(location + i, ...), so results are independent of the
+     * vector width.
+     */
+    template<typename CARGO, int ARITY>
+    inline void gen_d(
+        LibFlatArray::short_vec<CARGO, ARITY> *ret,
+        Location location,
+        Word step,
+        Word nanoStep,
+        Word index = 0,
+        double max = 1.0) const
+    {
+        CARGO buf[ARITY];
+        for (int i = 0; i < ARITY; ++i) {
+            buf[i] = gen_d(location + i, step, nanoStep, index, max);
+        }
+        ret->load(buf);
+    }
+
+    /**
+     * The raw Philox4x32-10 bijection.
+     */
+    static inline void philox(const Word counter[4], const Word key[2], Word result[4])
+    {
+        Word c[4] = { counter[0], counter[1], counter[2], counter[3] };
+        Word k[2] = { key[0], key[1] };
+
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                k[0] += 0x9E3779B9;
+                k[1] += 0xBB67AE85;
+            }
+
+            boost::uint64_t product0 = boost::uint64_t(0xD2511F53) * c[0];
+            boost::uint64_t product1 = boost::uint64_t(0xCD9E8D57) * c[2];
+            Word hi0 = Word(product0 >> 32);
+            Word lo0 = Word(product0);
+            Word hi1 = Word(product1 >> 32);
+            Word lo1 = Word(product1);
+
+            c[0] = hi1 ^ c[1] ^ k[0];
+            c[1] = lo1;
+            c[2] = hi0 ^ c[3] ^ k[1];
+            c[3] = lo0;
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            result[i] = c[i];
+        }
+    }
+
+private:
+    Word key[2];
+
+    /**
+     * nanoStep occupies the upper 8 bits of the last counter word,
+     * the block index the lower 24 bits.
+     */
+    inline void generate(Location location, Word step, Word nanoStep, Word block, Word result[4]) const
+    {
+        Word counter[4] = {
+            Word(location),
+            Word(location >> 32),
+            step,
+            (nanoStep << 24) | (block & 0xFFFFFF)
+        };
+        philox(counter, key, result);
+    }
+
+    static inline double toDouble(Word a, Word b)
+    {
+        // 27 + 26 bits, as in the reference Mersenne Twister's genrand_res53():
+        return ((a >> 5) * 67108864.0 + (b >> 6)) * (1.0 / 9007199254740992.0);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef LIBGEODECOMP_MISC_FRONTTESTCELL_H
+#define LIBGEODECOMP_MISC_FRONTTESTCELL_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/stencils.h>
+#include <libgeodecomp/io/simpleinitializer.h>
+#include <libgeodecomp/misc/apitraits.h>
+
+#include <algorithm>
+
+namespace LibGeoDecomp {
+
+namespace FrontTestCellHelpers {
+
+class EmptyAPI
+{};
+
+}
+
+/**
+ * A test vehicle for activity tracking (see
+ * APITraits::HasActivityTracking): each cell takes on the maximum of
+ * its own value and its neighbors' values minus one. Initially a
+ * few seeds are set, which spread as diamonds until their values are
+ * exhausted, so only the cells along these fronts change. Passing
+ * APITraits::HasActivityTracking as ADDITIONAL_API yields the
+ * tracked variant, the default yields a reference model which is
+ * updated in full.
+ */
+template<typename ADDITIONAL_API = FrontTestCellHelpers::EmptyAPI>
+class FrontTestCell
+{
+public:
+    class API :
+        public ADDITIONAL_API,
+        public APITraits::HasCubeTopology<2>,
+        public APITraits::HasStencil<Stencils::VonNeumann<2, 1> >
+#ifdef LIBGEODECOMP_WITH_MPI
+        , public APITraits::HasOpaqueMPIDataType<FrontTestCell<ADDITIONAL_API> >
+#endif
+    {};
+
+    class Initializer : public SimpleInitializer<FrontTestCell>
+    {
+    public:
+        explicit Initializer(
+            const Coord<2>& dimensions = Coord<2>(64, 48),
+            unsigned steps = 40) :
+            SimpleInitializer<FrontTestCell>(dimensions, steps)
+        {}
+
+        virtual void grid(GridBase<FrontTestCell, 2> *target)
+        {
+            CoordBox<2> box = target->boundingBox();
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                target->set(*i, FrontTestCell());
+            }
+
+            Coord<2> dim = this->gridDimensions();
+            setSeed(target, Coord<2>(3, 4), 9);
+            setSeed(target, dim / 2, 17);
+            setSeed(target, dim - Coord<2>(5, 2), 6);
+        }
+
+    private:
+        void setSeed(GridBase<FrontTestCell, 2> *target, const Coord<2>& coord, int value)
+        {
+            if (target->boundingBox().inBounds(coord)) {
+                target->set(coord, FrontTestCell(value));
+            }
+        }
+    };
+
+    explicit FrontTestCell(int value = 0) :
+        value(value),
+        hasChanged(false)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, int /* nanoStep */)
+    {
+        int oldValue = hood[FixedCoord< 0,  0>()].value;
+        int maxNeighbor = std::max(
+            std::max(hood[FixedCoord< 0, -1>()].value, hood[FixedCoord<-1,  0>()].value),
+            std::max(hood[FixedCoord< 1,  0>()].value, hood[FixedCoord< 0,  1>()].value));
+
+        value = std::max(oldValue, maxNeighbor - 1);
+        hasChanged = (value != oldValue);
+    }
+
+    bool changed() const
+    {
+        return hasChanged;
+    }
+
+    int value;
+    bool hasChanged;
+};
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef LIBGEODECOMP_MISC_HIPARSIMULATIONFACTORY_H
+#define LIBGEODECOMP_MISC_HIPARSIMULATIONFACTORY_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/loadbalancer/oozebalancer.h>
+#include <libgeodecomp/misc/simulationfactory.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/parallelization/hiparsimulator.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Manufactures HiParSimulators for the auto-tuner. Tunable
+ * parameters are the domain decomposition ("Partition"), the width
+ * of the ghost zones ("GhostZoneWidth") and the period of the load
+ * balancer ("LoadBalancingPeriod").
+ *
+ * All ranks of the communicator need to evaluate the same parameters
+ * in lockstep, which is the case if every rank runs the same
+ * (deterministic) optimizer: measured times are reduced to the
+ * maximum across all ranks, so all ranks see the same fitness.
+ */
+template<typename CELL>
+class HiParSimulationFactory : public SimulationFactory<CELL>
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    static const int DIM = Topology::DIM;
+
+    explicit HiParSimulationFactory(
+        ClonableInitializer<CELL> *initializer,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        SimulationFactory<CELL>(initializer),
+        communicator(communicator)
+    {
+        std::vector<std::string> partitions;
+        partitions << "ZCurve"
+                   << "Striping"
+                   << "RecursiveBisection"
+                   << "Checkerboarding";
+
+        SimulationFactory<CELL>::parameterSet.addParameter("Partition",           partitions);
+        SimulationFactory<CELL>::parameterSet.addParameter("GhostZoneWidth",      1, 10);
+        SimulationFactory<CELL>::parameterSet.addParameter("LoadBalancingPeriod", 1, 1000);
+    }
+
+protected:
+    MPI_Comm communicator;
+
+    virtual Simulator<CELL> *buildSimulator(
+        Initializer<CELL> *initializer,
+        const SimulationParameters& params) const
+    {
+        std::string partition = params["Partition"];
+
+        if (partition == "ZCurve") {
+            return buildHiParSimulator<ZCurvePartition<DIM> >(initializer, params);
+        }
+        if (partition == "Striping") {
+            return buildHiParSimulator<StripingPartition<DIM> >(initializer, params);
+        }
+        if (partition == "RecursiveBisection") {
+            return buildHiParSimulator<RecursiveBisectionPartition<DIM> >(initializer, params);
+        }
+        if (partition == "Checkerboarding") {
+            return buildHiParSimulator<CheckerboardingPartition<DIM> >(initializer, params);
+        }
+
+        throw std::invalid_argument("HiParSimulationFactory: unknown partition " + partition);
+    }
+
+    template<typename PARTITION>
+    Simulator<CELL> *buildHiParSimulator(
+        Initializer<CELL> *initializer,
+        const SimulationParameters& params) const
+    {
+        int ghostZoneWidth = params["GhostZoneWidth"];
+        int loadBalancingPeriod = params["LoadBalancingPeriod"];
+
+        HiParSimulator<CELL, PARTITION> *sim = new HiParSimulator<CELL, PARTITION>(
+            initializer,
+            new OozeBalancer(),
+            loadBalancingPeriod,
+            ghostZoneWidth,
+            communicator);
+
+        for (unsigned i = 0; i < SimulationFactory<CELL>::parallelWriters.size(); ++i) {
+            sim->addWriter(SimulationFactory<CELL>::parallelWriters[i].get()->clone());
+        }
+        for (unsigned i = 0; i < SimulationFactory<CELL>::steerers.size(); ++i) {
+            sim->addSteerer(SimulationFactory<CELL>::steerers[i].get()->clone());
+        }
+
+        return sim;
+    }
+
+    virtual double synchronizeTime(double seconds)
+    {
+        double ret;
+        MPI_Allreduce(&seconds, &ret, 1, MPI_DOUBLE, MPI_MAX, communicator);
+        return ret;
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef LIBGEODECOMP_MISC_OPENMPSIMULATIONFACTORY_H
+#define LIBGEODECOMP_MISC_OPENMPSIMULATIONFACTORY_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+#include <libgeodecomp/misc/simulationfactory.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/parallelization/openmpsimulator.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Manufactures OpenMPSimulators for the auto-tuner. Tunable
+ * parameters are the OpenMP schedule ("Scheduling": "dynamic" or
+ * "static"), whether first touch placement is used ("FirstTouch",
+ * implies a static schedule) and whether the update is also
+ * parallelized within streaks ("FineGrainedParallelism").
+ */
+template<typename CELL>
+class OpenMPSimulationFactory : public SimulationFactory<CELL>
+{
+public:
+    explicit OpenMPSimulationFactory(ClonableInitializer<CELL> *initializer) :
+        SimulationFactory<CELL>(initializer)
+    {
+        std::vector<std::string> schedules;
+        schedules << "dynamic"
+                  << "static";
+        std::vector<bool> flags;
+        flags << false
+              << true;
+
+        SimulationFactory<CELL>::parameterSet.addParameter("Scheduling",             schedules);
+        SimulationFactory<CELL>::parameterSet.addParameter("FirstTouch",             flags);
+        SimulationFactory<CELL>::parameterSet.addParameter("FineGrainedParallelism", flags);
+    }
+
+protected:
+    virtual Simulator<CELL> *buildSimulator(
+        Initializer<CELL> *initializer,
+        const SimulationParameters& params) const
+    {
+        bool staticScheduling = (params["Scheduling"] == "static");
+        bool firstTouch = params["FirstTouch"];
+        bool fineGrainedParallelism = params["FineGrainedParallelism"];
+
+        OpenMPSimulator<CELL> *sim = new OpenMPSimulator<CELL>(
+            initializer,
+            fineGrainedParallelism,
+            firstTouch,
+            staticScheduling);
+
+        for (unsigned i = 0; i < SimulationFactory<CELL>::writers.size(); ++i) {
+            sim->addWriter(SimulationFactory<CELL>::writers[i].get()->clone());
+        }
+        for (unsigned i = 0; i < SimulationFactory<CELL>::steerers.size(); ++i) {
+            sim->addSteerer(SimulationFactory<CELL>::steerers[i].get()->clone());
+        }
+
+        return sim;
+    }
+};
+
+}
+
+#endif
+
+#endif
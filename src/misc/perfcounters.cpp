@@ -0,0 +1,164 @@
+#include <libgeodecomp/misc/perfcounters.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace LibGeoDecomp {
+
+PerfCounters *PerfCounters::globalInstance = 0;
+
+#ifdef __linux__
+
+namespace {
+
+int openCounter(unsigned long long config, int groupLeader, bool inherit)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (groupLeader == -1) ? 1 : 0;
+    // also count threads spawned later on, e.g. OpenMP's or
+    // ThreadSimulator's workers. Reads sum over all of them:
+    attr.inherit = inherit ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    return syscall(__NR_perf_event_open, &attr, 0, -1, groupLeader, 0);
+}
+
+}
+
+PerfCounters::PerfCounters() :
+    leader(-1),
+    numOpen(0)
+{
+    const unsigned long long configs[NUM_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES
+    };
+
+    // some kernels refuse to combine inherited counters with group
+    // reads, in which case we fall back to the calling thread:
+    bool inherit = true;
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        fds[i] = openCounter(configs[i], leader, inherit);
+        if ((fds[i] == -1) && (leader == -1) && inherit) {
+            inherit = false;
+            fds[i] = openCounter(configs[i], leader, inherit);
+        }
+        slots[i] = -1;
+
+        if (fds[i] == -1) {
+            continue;
+        }
+
+        if (leader == -1) {
+            leader = fds[i];
+        }
+        slots[i] = numOpen++;
+    }
+
+    if (leader != -1) {
+        ioctl(leader, PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        if (fds[i] != -1) {
+            close(fds[i]);
+        }
+    }
+}
+
+void PerfCounters::read(double *values) const
+{
+    // layout with PERF_FORMAT_GROUP: { nr, values[nr] }
+    unsigned long long buf[NUM_COUNTERS + 1] = { 0 };
+
+    if ((leader == -1) || (::read(leader, buf, sizeof(buf)) <= 0)) {
+        std::fill(values, values + NUM_COUNTERS, 0.0);
+        return;
+    }
+
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        values[i] = (slots[i] == -1) ? 0.0 : double(buf[1 + slots[i]]);
+    }
+}
+
+#else
+
+PerfCounters::PerfCounters() :
+    leader(-1),
+    numOpen(0)
+{
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        fds[i] = -1;
+        slots[i] = -1;
+    }
+}
+
+PerfCounters::~PerfCounters()
+{}
+
+void PerfCounters::read(double *values) const
+{
+    std::fill(values, values + NUM_COUNTERS, 0.0);
+}
+
+#endif
+
+bool PerfCounters::available() const
+{
+    return numOpen > 0;
+}
+
+bool PerfCounters::available(int counter) const
+{
+    return slots[counter] != -1;
+}
+
+bool PerfCounters::enable()
+{
+    if (!globalInstance) {
+        globalInstance = new PerfCounters();
+    }
+
+    return globalInstance->available();
+}
+
+void PerfCounters::disable()
+{
+    delete globalInstance;
+    globalInstance = 0;
+}
+
+std::string PerfCounters::counterName(int counter)
+{
+    switch (counter) {
+    case CYCLES:
+        return "cycles";
+    case INSTRUCTIONS:
+        return "instructions";
+    case CACHE_MISSES:
+        return "cache_misses";
+    default:
+        throw std::invalid_argument("unknown hardware counter");
+    }
+}
+
+}
@@ -0,0 +1,99 @@
+#ifndef LIBGEODECOMP_MISC_PERFCOUNTERS_H
+#define LIBGEODECOMP_MISC_PERFCOUNTERS_H
+
+#include <string>
+
+namespace LibGeoDecomp {
+
+/**
+ * Thin wrapper for Linux' perf_event_open(2) interface. It opens a
+ * group of hardware counters (cycles, retired instructions and last
+ * level cache misses) which are read in a single system call.
+ *
+ * Counters cover the thread which created the PerfCounters object
+ * and all threads it spawns afterwards (perf's inherit mode), so
+ * multi-threaded simulators are measured as a whole as long as their
+ * worker threads are started after the counters. On platforms without perf support, or if the kernel
+ * denies access (see /proc/sys/kernel/perf_event_paranoid), all
+ * counters read as 0 and available() returns false.
+ *
+ * Chronometer will sample these counters over the intervals of all
+ * events defined via DEFINE_EVENT once enable() has been called.
+ */
+class PerfCounters
+{
+public:
+    enum Counter {
+        CYCLES = 0,
+        INSTRUCTIONS = 1,
+        CACHE_MISSES = 2
+    };
+
+    static const int NUM_COUNTERS = 3;
+
+    /**
+     * Bytes transferred from/to main memory per last level cache
+     * miss. Used to estimate memory bandwidth from CACHE_MISSES.
+     */
+    static const int CACHE_LINE_SIZE = 64;
+
+    PerfCounters();
+
+    ~PerfCounters();
+
+    /**
+     * Returns true if at least one counter could be opened.
+     */
+    bool available() const;
+
+    /**
+     * Returns true if the given counter is being tracked.
+     */
+    bool available(int counter) const;
+
+    /**
+     * Stores the current (cumulative) counter values in values,
+     * which needs to hold NUM_COUNTERS elements.
+     */
+    void read(double *values) const;
+
+    /**
+     * Returns the process-wide instance which Chronometer uses for
+     * sampling, or 0 if hardware counters are disabled (the
+     * default).
+     */
+    static const PerfCounters *instance()
+    {
+        return globalInstance;
+    }
+
+    /**
+     * Activates sampling for all Chronometer events. Returns whether
+     * the counters are actually available. Counters track the
+     * calling thread and all threads created after this call, so
+     * call this before the simulator spawns its workers (and before
+     * the first OpenMP parallel region).
+     */
+    static bool enable();
+
+    static void disable();
+
+    static std::string counterName(int counter);
+
+private:
+    static PerfCounters *globalInstance;
+
+    int leader;
+    int fds[NUM_COUNTERS];
+    // index of each counter within the group read buffer, -1 if unavailable
+    int slots[NUM_COUNTERS];
+    int numOpen;
+
+    PerfCounters(const PerfCounters& other);
+
+    PerfCounters& operator=(const PerfCounters& other);
+};
+
+}
+
+#endif
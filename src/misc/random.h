@@ -13,7 +13,9 @@ namespace LibGeoDecomp {
 
 /**
  * LibGeoDecomp's internal wrapper for generating pseudo random
- * numbers.
+ * numbers. All calls share one generator, so this is not
+ * thread-safe, and results depend on the order of calls. Use
+ * CounterBasedRandom from within update() instead.
  */
 class Random
 {
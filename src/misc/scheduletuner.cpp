@@ -0,0 +1,79 @@
+#include <libgeodecomp/misc/scheduletuner.h>
+
+#include <algorithm>
+
+namespace LibGeoDecomp {
+
+ScheduleTuner::ScheduleTuner(
+    unsigned period,
+    unsigned samples,
+    double hysteresis,
+    const Candidate& initial) :
+    period(std::max(1u, period)),
+    samples(std::max(1u, samples)),
+    hysteresis(hysteresis),
+    active(0),
+    probing(0),
+    counter(0)
+{
+    // the initial setting goes first so that it can be measured
+    // before any potentially slow candidate has thrashed the caches:
+    candidates.push_back(initial);
+    for (int i = 0; i < 8; ++i) {
+        Candidate candidate((i & 1) != 0, (i & 2) != 0, (i & 4) != 0);
+        if (candidate != initial) {
+            candidates.push_back(candidate);
+        }
+    }
+
+    timings.resize(candidates.size(), 0);
+}
+
+const ScheduleTuner::Candidate& ScheduleTuner::current() const
+{
+    if (tuning()) {
+        return candidates[probing];
+    }
+
+    return candidates[active];
+}
+
+const ScheduleTuner::Candidate& ScheduleTuner::best() const
+{
+    return candidates[active];
+}
+
+void ScheduleTuner::report(double seconds)
+{
+    ++counter;
+
+    if (!tuning()) {
+        if (counter >= period) {
+            counter = 0;
+            probing = 0;
+            std::fill(timings.begin(), timings.end(), 0);
+        }
+        return;
+    }
+
+    timings[probing] += seconds;
+    if (counter < samples) {
+        return;
+    }
+
+    counter = 0;
+    ++probing;
+    if (!tuning()) {
+        evaluate();
+    }
+}
+
+void ScheduleTuner::evaluate()
+{
+    std::size_t fastest = std::min_element(timings.begin(), timings.end()) - timings.begin();
+    if (timings[fastest] < (1.0 - hysteresis) * timings[active]) {
+        active = fastest;
+    }
+}
+
+}
@@ -0,0 +1,119 @@
+#ifndef LIBGEODECOMP_MISC_SCHEDULETUNER_H
+#define LIBGEODECOMP_MISC_SCHEDULETUNER_H
+
+#include <cstddef>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * ScheduleTuner selects the threading settings of the UpdateFunctor
+ * (static vs. dynamic scheduling, plane vs. streak granularity and
+ * fine grained parallelism, see
+ * UpdateFunctorHelpers::ConcurrencyEnableOpenMP) while a simulation
+ * is running.
+ *
+ * Every period steps it enters a tuning phase in which each
+ * candidate is timed over a couple of real steps. Afterwards it
+ * switches to the fastest candidate, but only if that beats the
+ * current setting by more than the given (relative) hysteresis, so
+ * that measurement noise won't make it flip back and forth. The
+ * first tuning phase starts right away.
+ *
+ * Simulators query current() before each step and report() the
+ * time the step took afterwards.
+ */
+class ScheduleTuner
+{
+public:
+    friend class ScheduleTunerTest;
+
+    class Candidate
+    {
+    public:
+        explicit Candidate(
+            bool staticScheduling = false,
+            bool streakGranularity = false,
+            bool fineGrainedParallelism = false) :
+            staticScheduling(staticScheduling),
+            streakGranularity(streakGranularity),
+            fineGrainedParallelism(fineGrainedParallelism)
+        {}
+
+        /**
+         * Builds a concurrency spec for the UpdateFunctor, e.g.
+         * UpdateFunctorHelpers::ConcurrencyEnableOpenMP.
+         */
+        template<typename CONCURRENCY_SPEC>
+        CONCURRENCY_SPEC concurrencySpec() const
+        {
+            return CONCURRENCY_SPEC(!staticScheduling, fineGrainedParallelism, streakGranularity);
+        }
+
+        bool operator==(const Candidate& other) const
+        {
+            return
+                (staticScheduling       == other.staticScheduling) &&
+                (streakGranularity      == other.streakGranularity) &&
+                (fineGrainedParallelism == other.fineGrainedParallelism);
+        }
+
+        bool operator!=(const Candidate& other) const
+        {
+            return !(*this == other);
+        }
+
+        bool staticScheduling;
+        bool streakGranularity;
+        bool fineGrainedParallelism;
+    };
+
+    /**
+     * Tunes every period steps, timing each candidate over samples
+     * steps. A new candidate is adopted only if it's faster than the
+     * current one by more than hysteresis (e.g. 0.05 = 5%). initial
+     * is used until the first tuning phase has completed and wins
+     * all ties.
+     */
+    explicit ScheduleTuner(
+        unsigned period = 1000,
+        unsigned samples = 2,
+        double hysteresis = 0.05,
+        const Candidate& initial = Candidate());
+
+    /**
+     * The settings to be used for the upcoming step.
+     */
+    const Candidate& current() const;
+
+    /**
+     * The settings which won the last tuning phase.
+     */
+    const Candidate& best() const;
+
+    /**
+     * Records the time the last step (run with current()) took.
+     */
+    void report(double seconds);
+
+    bool tuning() const
+    {
+        return probing < candidates.size();
+    }
+
+private:
+    std::vector<Candidate> candidates;
+    std::vector<double> timings;
+    unsigned period;
+    unsigned samples;
+    double hysteresis;
+    std::size_t active;
+    std::size_t probing;
+    unsigned counter;
+
+    void evaluate();
+};
+
+}
+
+#endif
@@ -14,6 +14,10 @@
 #endif
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+
+#include <algorithm>
+#include <cmath>
 
 namespace LibGeoDecomp {
 
@@ -25,8 +29,67 @@ template<typename CELL>
 class SimulationFactory : public Optimizer::Evaluator
 {
 public:
+    /**
+     * Controls the short probe runs which replace full simulation
+     * runs during evaluation (see setProbeSettings()). After
+     * warmupSteps the time of each step() is recorded. Sampling
+     * stops once the 95% confidence interval of the mean time per
+     * cell update is narrower than tolerance (relative to the mean),
+     * but not before minSamples and not after maxSamples steps. A
+     * candidate is aborted early if it is clearly worse than the
+     * best one seen so far (the incumbent), i.e. if even the lower
+     * bound of its confidence interval exceeds the incumbent's time
+     * by abortFactor.
+     */
+    class ProbeSettings
+    {
+    public:
+        explicit ProbeSettings(
+            unsigned warmupSteps = 2,
+            unsigned minSamples = 5,
+            unsigned maxSamples = 50,
+            double tolerance = 0.05,
+            double abortFactor = 1.5) :
+            warmupSteps(warmupSteps),
+            minSamples(minSamples),
+            maxSamples(maxSamples),
+            tolerance(tolerance),
+            abortFactor(abortFactor)
+        {}
+
+        unsigned warmupSteps;
+        unsigned minSamples;
+        unsigned maxSamples;
+        double tolerance;
+        double abortFactor;
+    };
+
+    /**
+     * Outcome of the most recent probe run, mostly useful for
+     * diagnostics.
+     */
+    class ProbeResult
+    {
+    public:
+        ProbeResult() :
+            timePerCellUpdate(0),
+            confidence(0),
+            samples(0),
+            aborted(false)
+        {}
+
+        // mean time per cell update in seconds
+        double timePerCellUpdate;
+        // half width of the 95% confidence interval
+        double confidence;
+        unsigned samples;
+        bool aborted;
+    };
+
     SimulationFactory(ClonableInitializer<CELL> *initializer) :
-        initializer(initializer)
+        initializer(initializer),
+        probing(false),
+        incumbent(0)
     {}
 
     virtual ~SimulationFactory()
@@ -59,11 +122,31 @@ public:
         return sim;
     }
 
+    /**
+     * Evaluates the given parameters and returns the (negated) time
+     * required to run the simulation. With probing enabled, this
+     * time is extrapolated from a short probe run.
+     */
     virtual double operator()(const SimulationParameters& params)
     {
         LOG(Logger::DBG, "SimulationFactory::operator(params)")
         Simulator<CELL> *sim = buildSimulator(initializer->clone(), params);
         LOG(Logger::DBG, "sim get buildSimulator(initializer->clone(), params)")
+
+        if (probing) {
+            probeResult = probe(sim);
+            delete sim;
+
+            if (!probeResult.aborted &&
+                ((incumbent == 0) || (probeResult.timePerCellUpdate < incumbent))) {
+                incumbent = probeResult.timePerCellUpdate;
+            }
+
+            double cells = initializer->gridBox().dimensions.prod();
+            double steps = initializer->maxSteps() - initializer->startStep();
+            return probeResult.timePerCellUpdate * cells * steps * -1.0;
+        }
+
         Chronometer chrono;
 
         {
@@ -74,13 +157,46 @@ public:
 
         LOG(Logger::DBG,"now deleting sim")
         delete sim;
-        return chrono.interval<TimeCompute>() * -1.0;
+        return synchronizeTime(chrono.interval<TimeCompute>()) * -1.0;
     }
 
     SimulationParameters& parameters()
     {
         return parameterSet;
     }
+
+    /**
+     * Switches evaluation from full simulation runs to short probe
+     * runs. Probing relies on Simulator::step(), so the simulators
+     * built by the factory need to be ready to step right after
+     * construction.
+     */
+    void setProbeSettings(const ProbeSettings& settings)
+    {
+        probeSettings = settings;
+        probing = true;
+        resetIncumbent();
+    }
+
+    void disableProbing()
+    {
+        probing = false;
+    }
+
+    /**
+     * Forgets the best candidate seen so far, so no evaluation will
+     * be aborted early until a new one has been found.
+     */
+    void resetIncumbent()
+    {
+        incumbent = 0;
+    }
+
+    const ProbeResult& lastProbe() const
+    {
+        return probeResult;
+    }
+
 protected:
     virtual Simulator<CELL> *buildSimulator(
         Initializer<CELL> *initializer,
@@ -92,6 +208,102 @@ protected:
     std::vector<boost::shared_ptr<Writer<CELL> > > writers;
     // FIXME: Something need to be done with the parallelWriters in subclasses!
     std::vector<boost::shared_ptr<Steerer<CELL> > > steerers;
+    bool probing;
+    ProbeSettings probeSettings;
+    ProbeResult probeResult;
+    // time per cell update of the best candidate so far, 0 if none:
+    double incumbent;
+
+    /**
+     * Simulators spanning multiple MPI ranks will be timed
+     * differently on each rank. Their factories need to reduce
+     * these times so that all ranks arrive at the same fitness (and
+     * probing decisions).
+     */
+    virtual double synchronizeTime(double seconds)
+    {
+        return seconds;
+    }
+
+    ProbeResult probe(Simulator<CELL> *sim)
+    {
+        ProbeResult result;
+        double cells = initializer->gridBox().dimensions.prod();
+        unsigned endStep = sim->getStep() + initializer->maxSteps() - initializer->startStep();
+
+        // leave at least one step for measurements:
+        for (unsigned i = 0; (i < probeSettings.warmupSteps) && (sim->getStep() + 1 < endStep); ++i) {
+            sim->step();
+        }
+
+        std::vector<double> samples;
+
+        while ((samples.size() < probeSettings.maxSamples) && (sim->getStep() < endStep)) {
+            unsigned startStep = sim->getStep();
+            double startTime = ScopedTimer::time();
+            sim->step();
+            double elapsed = synchronizeTime(ScopedTimer::time() - startTime);
+            // some simulators advance multiple time steps at once:
+            unsigned steps = std::max(1u, sim->getStep() - startStep);
+            samples.push_back(elapsed / steps / cells);
+
+            double n = samples.size();
+            double mean = 0;
+            for (std::size_t i = 0; i < samples.size(); ++i) {
+                mean += samples[i];
+            }
+            mean /= n;
+
+            double variance = 0;
+            for (std::size_t i = 0; i < samples.size(); ++i) {
+                variance += (samples[i] - mean) * (samples[i] - mean);
+            }
+
+            result.samples = samples.size();
+            result.timePerCellUpdate = mean;
+            if (result.samples < 2) {
+                result.confidence = mean;
+                continue;
+            }
+            result.confidence = studentT95(result.samples - 1) * std::sqrt(variance / (n - 1) / n);
+
+            if (result.samples < probeSettings.minSamples) {
+                continue;
+            }
+            if (result.confidence <= probeSettings.tolerance * result.timePerCellUpdate) {
+                break;
+            }
+            if ((incumbent > 0) &&
+                ((result.timePerCellUpdate - result.confidence) > (probeSettings.abortFactor * incumbent))) {
+                LOG(Logger::DBG, "aborting probe, candidate is clearly slower than incumbent")
+                result.aborted = true;
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Two-sided 95% quantile of Student's t-distribution.
+     */
+    static double studentT95(unsigned degreesOfFreedom)
+    {
+        static const double quantiles[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086 };
+
+        if (degreesOfFreedom == 0) {
+            return quantiles[0];
+        }
+        if (degreesOfFreedom <= 20) {
+            return quantiles[degreesOfFreedom - 1];
+        }
+        if (degreesOfFreedom <= 30) {
+            return 2.042;
+        }
+        return 1.96;
+    }
 };
 
 /**
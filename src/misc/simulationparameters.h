@@ -339,7 +339,7 @@ public:
 
     void setValue(double newValue)
     {
-        index = sanitizeIndex(index);
+        index = sanitizeIndex(newValue);
         current = elements[index];
     }
 
@@ -464,6 +464,19 @@ public:
         return parameters.size();
     }
 
+    /**
+     * Returns the names of all parameters in alphabetical order.
+     */
+    std::vector<std::string> getNames() const
+    {
+        std::vector<std::string> ret;
+        for (std::map<std::string, int>::const_iterator i = names.begin(); i != names.end(); ++i) {
+            ret.push_back(i->first);
+        }
+
+        return ret;
+    }
+
 protected:
     std::map<std::string, int> names;
     std::vector<ParamPointerType> parameters;
@@ -0,0 +1,6 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}simulationfactorytest.h
+)
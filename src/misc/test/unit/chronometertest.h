@@ -147,6 +147,52 @@ public:
         TS_ASSERT_LESS_THAN_EQUALS(0.015, c->interval<TimeComputeInner>());
     }
 
+    void testHardwareCountersAreOffByDefault()
+    {
+        {
+            TimeComputeInner t(c);
+            ScopedTimer::busyWait(15000);
+        }
+
+        for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+            TS_ASSERT_EQUALS(0, c->counter<TimeComputeInner>(i));
+            TS_ASSERT_EQUALS(0, c->counter<TimeCompute>(i));
+        }
+        TS_ASSERT_EQUALS(0, c->instructionsPerCycle<TimeCompute>());
+    }
+
+    void testHardwareCounters()
+    {
+        bool available = PerfCounters::enable();
+        {
+            TimeComputeInner t(c);
+            ScopedTimer::busyWait(15000);
+        }
+        c->addTime<TimeComputeGhost>(5);
+
+        Chronometer c2 = *c + *c;
+        std::vector<std::string> lines = StringOps::tokenize(c->report(), "\n");
+        PerfCounters::disable();
+
+        TS_ASSERT_EQUALS(lines.size(), Chronometer::NUM_INTERVALS);
+        TS_ASSERT_EQUALS(0, c->counter<TimeComputeGhost>(PerfCounters::CYCLES));
+        TS_ASSERT_EQUALS(
+            2 * c->counter<TimeComputeInner>(PerfCounters::INSTRUCTIONS),
+            c2.counter<TimeComputeInner>(PerfCounters::INSTRUCTIONS));
+
+        if (!available) {
+            std::cout << "\nChronometerTest::testHardwareCounters() skipped: perf_event_open() unavailable\n";
+            return;
+        }
+
+        // parent events accumulate the counters of their children:
+        TS_ASSERT_LESS_THAN(0, c->counter<TimeComputeInner>(PerfCounters::CYCLES));
+        TS_ASSERT_EQUALS(
+            c->counter<TimeComputeInner>(PerfCounters::CYCLES),
+            c->counter<TimeCompute>(PerfCounters::CYCLES));
+        TS_ASSERT_LESS_THAN(0, c->instructionsPerCycle<TimeCompute>());
+    }
+
 private:
     Chronometer *c;
 };
@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CounterBasedRandomTest_init = false;
+#include "/root/repo/src/misc/test/unit/counterbasedrandomtest.h"
+
+static CounterBasedRandomTest suite_CounterBasedRandomTest;
+
+static CxxTest::List Tests_CounterBasedRandomTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CounterBasedRandomTest( "/root/repo/src/misc/test/unit/counterbasedrandomtest.h", 15, "CounterBasedRandomTest", suite_CounterBasedRandomTest, Tests_CounterBasedRandomTest );
+
+static class TestDescription_suite_CounterBasedRandomTest_testKnownAnswers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testKnownAnswers() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 20, "testKnownAnswers" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testKnownAnswers(); }
+} testDescription_suite_CounterBasedRandomTest_testKnownAnswers;
+
+static class TestDescription_suite_CounterBasedRandomTest_testDeterminism : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testDeterminism() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 50, "testDeterminism" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testDeterminism(); }
+} testDescription_suite_CounterBasedRandomTest_testDeterminism;
+
+static class TestDescription_suite_CounterBasedRandomTest_testAllInputsAreSignificant : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testAllInputsAreSignificant() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 62, "testAllInputsAreSignificant" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testAllInputsAreSignificant(); }
+} testDescription_suite_CounterBasedRandomTest_testAllInputsAreSignificant;
+
+static class TestDescription_suite_CounterBasedRandomTest_testDouble : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testDouble() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 77, "testDouble" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testDouble(); }
+} testDescription_suite_CounterBasedRandomTest_testDouble;
+
+static class TestDescription_suite_CounterBasedRandomTest_testUnsigned : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testUnsigned() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 101, "testUnsigned" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testUnsigned(); }
+} testDescription_suite_CounterBasedRandomTest_testUnsigned;
+
+static class TestDescription_suite_CounterBasedRandomTest_testLocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testLocation() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 117, "testLocation" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testLocation(); }
+} testDescription_suite_CounterBasedRandomTest_testLocation;
+
+static class TestDescription_suite_CounterBasedRandomTest_testShortVecMatchesScalar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testShortVecMatchesScalar() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 137, "testShortVecMatchesScalar" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testShortVecMatchesScalar(); }
+} testDescription_suite_CounterBasedRandomTest_testShortVecMatchesScalar;
+
+static class TestDescription_suite_CounterBasedRandomTest_testConcurrentDrawsMatchSerialDraws : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testConcurrentDrawsMatchSerialDraws() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 162, "testConcurrentDrawsMatchSerialDraws" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testConcurrentDrawsMatchSerialDraws(); }
+} testDescription_suite_CounterBasedRandomTest_testConcurrentDrawsMatchSerialDraws;
+
@@ -0,0 +1,196 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/counterbasedrandom.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <cxxtest/TestSuite.h>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CounterBasedRandomTest : public CxxTest::TestSuite
+{
+public:
+    typedef CounterBasedRandom::Word Word;
+
+    void testKnownAnswers()
+    {
+        // test vectors taken from the Random123 distribution (kat_vectors)
+        Word result[4];
+
+        Word counter1[4] = { 0, 0, 0, 0 };
+        Word key1[2] = { 0, 0 };
+        CounterBasedRandom::philox(counter1, key1, result);
+        TS_ASSERT_EQUALS(result[0], Word(0x6627e8d5));
+        TS_ASSERT_EQUALS(result[1], Word(0xe169c58d));
+        TS_ASSERT_EQUALS(result[2], Word(0xbc57ac4c));
+        TS_ASSERT_EQUALS(result[3], Word(0x9b00dbd8));
+
+        Word counter2[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+        Word key2[2] = { 0xffffffff, 0xffffffff };
+        CounterBasedRandom::philox(counter2, key2, result);
+        TS_ASSERT_EQUALS(result[0], Word(0x408f276d));
+        TS_ASSERT_EQUALS(result[1], Word(0x41c83b0e));
+        TS_ASSERT_EQUALS(result[2], Word(0xa20bc7c6));
+        TS_ASSERT_EQUALS(result[3], Word(0x6d5451fd));
+
+        Word counter3[4] = { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 };
+        Word key3[2] = { 0xa4093822, 0x299f31d0 };
+        CounterBasedRandom::philox(counter3, key3, result);
+        TS_ASSERT_EQUALS(result[0], Word(0xd16cfe09));
+        TS_ASSERT_EQUALS(result[1], Word(0x94fdcceb));
+        TS_ASSERT_EQUALS(result[2], Word(0x5001e420));
+        TS_ASSERT_EQUALS(result[3], Word(0x24126ea1));
+    }
+
+    void testDeterminism()
+    {
+        CounterBasedRandom a(47, 11);
+        CounterBasedRandom b(47, 11);
+        CounterBasedRandom c = a;
+
+        for (int i = 0; i < 100; ++i) {
+            TS_ASSERT_EQUALS(a.gen_d(i, 5, 1, 3), b.gen_d(i, 5, 1, 3));
+            TS_ASSERT_EQUALS(a.gen_u(i, 5, 1, 3), c.gen_u(i, 5, 1, 3));
+        }
+    }
+
+    void testAllInputsAreSignificant()
+    {
+        CounterBasedRandom rng(47, 11);
+        Word reference = rng.gen_u(1000, 5, 1, 2);
+
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(48, 11).gen_u(1000, 5, 1, 2));
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(47, 12).gen_u(1000, 5, 1, 2));
+        TS_ASSERT_DIFFERS(reference, rng.gen_u(1001, 5, 1, 2));
+        TS_ASSERT_DIFFERS(reference, rng.gen_u(1000, 6, 1, 2));
+        TS_ASSERT_DIFFERS(reference, rng.gen_u(1000, 5, 0, 2));
+        TS_ASSERT_DIFFERS(reference, rng.gen_u(1000, 5, 1, 1));
+        TS_ASSERT_DIFFERS(reference, rng.gen_u(1000, 5, 1, 6));
+        TS_ASSERT_DIFFERS(rng.gen_d(1000, 5, 1, 0), rng.gen_d(1000, 5, 1, 1));
+    }
+
+    void testDouble()
+    {
+        CounterBasedRandom rng(1);
+        double sum = 0;
+        for (int i = 0; i < 1000; ++i) {
+            double value = rng.gen_d(i, 0, 0);
+            TS_ASSERT(value >= 0.0);
+            TS_ASSERT(value < 1.0);
+            sum += value;
+        }
+        TS_ASSERT(450 < sum);
+        TS_ASSERT(550 > sum);
+
+        sum = 0;
+        for (int i = 0; i < 1000; ++i) {
+            double value = rng.gen_d(i, 0, 0, 1, 10.0);
+            TS_ASSERT(value >= 0.0);
+            TS_ASSERT(value < 10.0);
+            sum += value;
+        }
+        TS_ASSERT(4500 < sum);
+        TS_ASSERT(5500 > sum);
+    }
+
+    void testUnsigned()
+    {
+        CounterBasedRandom rng(2);
+        std::vector<int> histogram(6, 0);
+        for (int i = 0; i < 6000; ++i) {
+            Word value = rng.gen_u(i, 3, 0, 0, 6);
+            TS_ASSERT(value < 6);
+            ++histogram[value];
+        }
+
+        for (int i = 0; i < 6; ++i) {
+            TS_ASSERT(histogram[i] > 850);
+            TS_ASSERT(histogram[i] < 1150);
+        }
+    }
+
+    void testLocation()
+    {
+        TS_ASSERT_EQUALS(
+            CounterBasedRandom::location(Coord<1>(11)) + 1,
+            CounterBasedRandom::location(Coord<1>(12)));
+        TS_ASSERT_EQUALS(
+            CounterBasedRandom::location(Coord<2>(11, 47)) + 1,
+            CounterBasedRandom::location(Coord<2>(12, 47)));
+        TS_ASSERT_EQUALS(
+            CounterBasedRandom::location(Coord<3>(11, 47, 3)) + 1,
+            CounterBasedRandom::location(Coord<3>(12, 47, 3)));
+
+        TS_ASSERT_DIFFERS(
+            CounterBasedRandom::location(Coord<2>(1, 0)),
+            CounterBasedRandom::location(Coord<2>(0, 1)));
+        TS_ASSERT_DIFFERS(
+            CounterBasedRandom::location(Coord<3>(0, 1, 0)),
+            CounterBasedRandom::location(Coord<3>(0, 0, 1)));
+    }
+
+    void testShortVecMatchesScalar()
+    {
+        CounterBasedRandom rng(47);
+        CounterBasedRandom::Location start = CounterBasedRandom::location(Coord<2>(5, 9));
+
+        LibFlatArray::short_vec<double, 4> vec4;
+        rng.gen_d(&vec4, start, 7, 1, 2, 3.0);
+        double buf4[4];
+        vec4.store(buf4);
+
+        LibFlatArray::short_vec<double, 8> vec8;
+        rng.gen_d(&vec8, start, 7, 1, 2, 3.0);
+        double buf8[8];
+        vec8.store(buf8);
+
+        for (int i = 0; i < 4; ++i) {
+            double expected = rng.gen_d(CounterBasedRandom::location(Coord<2>(5 + i, 9)), 7, 1, 2, 3.0);
+            TS_ASSERT_EQUALS(expected, buf4[i]);
+            TS_ASSERT_EQUALS(expected, buf8[i]);
+        }
+        for (int i = 4; i < 8; ++i) {
+            TS_ASSERT_EQUALS(rng.gen_d(start + i, 7, 1, 2, 3.0), buf8[i]);
+        }
+    }
+
+    void testConcurrentDrawsMatchSerialDraws()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        CounterBasedRandom rng(4711);
+        std::size_t size = 4000;
+        std::vector<double> serial(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            serial[i] = rng.gen_d(i, 3, 0);
+        }
+
+        for (std::size_t numThreads = 2; numThreads <= 4; ++numThreads) {
+            std::vector<double> parallel(size);
+            boost::thread_group threads;
+            for (std::size_t t = 0; t < numThreads; ++t) {
+                threads.create_thread(
+                    boost::bind(&CounterBasedRandomTest::draw, rng, &parallel, t, numThreads));
+            }
+            threads.join_all();
+
+            TS_ASSERT_EQUALS(serial, parallel);
+        }
+#endif
+    }
+
+private:
+    static void draw(CounterBasedRandom rng, std::vector<double> *target, std::size_t offset, std::size_t stride)
+    {
+        // iterate backwards to make sure the order of calls doesn't matter:
+        for (std::size_t i = target->size() - 1 - offset; i < target->size(); i -= stride) {
+            (*target)[i] = rng.gen_d(i, 3, 0);
+        }
+    }
+};
+
+}
@@ -0,0 +1,57 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PerfCountersTest_init = false;
+#include "/root/repo/src/misc/test/unit/perfcounterstest.h"
+
+static PerfCountersTest suite_PerfCountersTest;
+
+static CxxTest::List Tests_PerfCountersTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PerfCountersTest( "/root/repo/src/misc/test/unit/perfcounterstest.h", 16, "PerfCountersTest", suite_PerfCountersTest, Tests_PerfCountersTest );
+
+static class TestDescription_suite_PerfCountersTest_testEnableDisable : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PerfCountersTest_testEnableDisable() : CxxTest::RealTestDescription( Tests_PerfCountersTest, suiteDescription_PerfCountersTest, 19, "testEnableDisable" ) {}
+ void runTest() { suite_PerfCountersTest.testEnableDisable(); }
+} testDescription_suite_PerfCountersTest_testEnableDisable;
+
+static class TestDescription_suite_PerfCountersTest_testMonotonicity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PerfCountersTest_testMonotonicity() : CxxTest::RealTestDescription( Tests_PerfCountersTest, suiteDescription_PerfCountersTest, 28, "testMonotonicity" ) {}
+ void runTest() { suite_PerfCountersTest.testMonotonicity(); }
+} testDescription_suite_PerfCountersTest_testMonotonicity;
+
+static class TestDescription_suite_PerfCountersTest_testThreadsSpawnedLaterAreCounted : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PerfCountersTest_testThreadsSpawnedLaterAreCounted() : CxxTest::RealTestDescription( Tests_PerfCountersTest, suiteDescription_PerfCountersTest, 50, "testThreadsSpawnedLaterAreCounted" ) {}
+ void runTest() { suite_PerfCountersTest.testThreadsSpawnedLaterAreCounted(); }
+} testDescription_suite_PerfCountersTest_testThreadsSpawnedLaterAreCounted;
+
+static class TestDescription_suite_PerfCountersTest_testCounterName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PerfCountersTest_testCounterName() : CxxTest::RealTestDescription( Tests_PerfCountersTest, suiteDescription_PerfCountersTest, 75, "testCounterName" ) {}
+ void runTest() { suite_PerfCountersTest.testCounterName(); }
+} testDescription_suite_PerfCountersTest_testCounterName;
+
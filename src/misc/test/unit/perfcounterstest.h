@@ -0,0 +1,93 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/perfcounters.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+
+#include <cxxtest/TestSuite.h>
+#include <stdexcept>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <boost/thread.hpp>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class PerfCountersTest : public CxxTest::TestSuite
+{
+public:
+    void testEnableDisable()
+    {
+        TS_ASSERT(!PerfCounters::instance());
+        PerfCounters::enable();
+        TS_ASSERT(PerfCounters::instance());
+        PerfCounters::disable();
+        TS_ASSERT(!PerfCounters::instance());
+    }
+
+    void testMonotonicity()
+    {
+        PerfCounters counters;
+        double before[PerfCounters::NUM_COUNTERS];
+        double after[PerfCounters::NUM_COUNTERS];
+
+        counters.read(before);
+        ScopedTimer::busyWait(10000);
+        counters.read(after);
+
+        for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+            TS_ASSERT_LESS_THAN_EQUALS(before[i], after[i]);
+            if (!counters.available(i)) {
+                TS_ASSERT_EQUALS(0, after[i]);
+            }
+        }
+
+        if (counters.available(PerfCounters::INSTRUCTIONS)) {
+            TS_ASSERT_LESS_THAN(before[PerfCounters::INSTRUCTIONS], after[PerfCounters::INSTRUCTIONS]);
+        }
+    }
+
+    void testThreadsSpawnedLaterAreCounted()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        PerfCounters counters;
+        if (!counters.available(PerfCounters::INSTRUCTIONS)) {
+            return;
+        }
+
+        double before[PerfCounters::NUM_COUNTERS];
+        double after[PerfCounters::NUM_COUNTERS];
+        const int iterations = 100 * 1000 * 1000;
+
+        counters.read(before);
+        boost::thread worker(&PerfCountersTest::spin, iterations);
+        worker.join();
+        counters.read(after);
+
+        // the calling thread was merely waiting, so nearly all
+        // instructions stem from the worker:
+        TS_ASSERT_LESS_THAN(
+            double(iterations),
+            after[PerfCounters::INSTRUCTIONS] - before[PerfCounters::INSTRUCTIONS]);
+#endif
+    }
+
+    void testCounterName()
+    {
+        TS_ASSERT_EQUALS("cycles",       PerfCounters::counterName(PerfCounters::CYCLES));
+        TS_ASSERT_EQUALS("instructions", PerfCounters::counterName(PerfCounters::INSTRUCTIONS));
+        TS_ASSERT_EQUALS("cache_misses", PerfCounters::counterName(PerfCounters::CACHE_MISSES));
+        TS_ASSERT_THROWS(PerfCounters::counterName(PerfCounters::NUM_COUNTERS), std::invalid_argument);
+    }
+
+private:
+    static void spin(int iterations)
+    {
+        volatile int counter = 0;
+        for (int i = 0; i < iterations; ++i) {
+            counter = counter + 1;
+        }
+    }
+};
+
+}
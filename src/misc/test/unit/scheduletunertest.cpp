@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ScheduleTunerTest_init = false;
+#include "/root/repo/src/misc/test/unit/scheduletunertest.h"
+
+static ScheduleTunerTest suite_ScheduleTunerTest;
+
+static CxxTest::List Tests_ScheduleTunerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScheduleTunerTest( "/root/repo/src/misc/test/unit/scheduletunertest.h", 11, "ScheduleTunerTest", suite_ScheduleTunerTest, Tests_ScheduleTunerTest );
+
+static class TestDescription_suite_ScheduleTunerTest_testAllCandidatesAreTriedInitialSettingFirst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScheduleTunerTest_testAllCandidatesAreTriedInitialSettingFirst() : CxxTest::RealTestDescription( Tests_ScheduleTunerTest, suiteDescription_ScheduleTunerTest, 16, "testAllCandidatesAreTriedInitialSettingFirst" ) {}
+ void runTest() { suite_ScheduleTunerTest.testAllCandidatesAreTriedInitialSettingFirst(); }
+} testDescription_suite_ScheduleTunerTest_testAllCandidatesAreTriedInitialSettingFirst;
+
+static class TestDescription_suite_ScheduleTunerTest_testFastestCandidateIsAdopted : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScheduleTunerTest_testFastestCandidateIsAdopted() : CxxTest::RealTestDescription( Tests_ScheduleTunerTest, suiteDescription_ScheduleTunerTest, 42, "testFastestCandidateIsAdopted" ) {}
+ void runTest() { suite_ScheduleTunerTest.testFastestCandidateIsAdopted(); }
+} testDescription_suite_ScheduleTunerTest_testFastestCandidateIsAdopted;
+
+static class TestDescription_suite_ScheduleTunerTest_testHysteresisPreventsFlapping : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScheduleTunerTest_testHysteresisPreventsFlapping() : CxxTest::RealTestDescription( Tests_ScheduleTunerTest, suiteDescription_ScheduleTunerTest, 52, "testHysteresisPreventsFlapping" ) {}
+ void runTest() { suite_ScheduleTunerTest.testHysteresisPreventsFlapping(); }
+} testDescription_suite_ScheduleTunerTest_testHysteresisPreventsFlapping;
+
+static class TestDescription_suite_ScheduleTunerTest_testTuningIsRepeatedPeriodically : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScheduleTunerTest_testTuningIsRepeatedPeriodically() : CxxTest::RealTestDescription( Tests_ScheduleTunerTest, suiteDescription_ScheduleTunerTest, 73, "testTuningIsRepeatedPeriodically" ) {}
+ void runTest() { suite_ScheduleTunerTest.testTuningIsRepeatedPeriodically(); }
+} testDescription_suite_ScheduleTunerTest_testTuningIsRepeatedPeriodically;
+
+static class TestDescription_suite_ScheduleTunerTest_testConcurrencySpec : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScheduleTunerTest_testConcurrencySpec() : CxxTest::RealTestDescription( Tests_ScheduleTunerTest, suiteDescription_ScheduleTunerTest, 92, "testConcurrencySpec" ) {}
+ void runTest() { suite_ScheduleTunerTest.testConcurrencySpec(); }
+} testDescription_suite_ScheduleTunerTest_testConcurrencySpec;
+
@@ -0,0 +1,127 @@
+#include <libgeodecomp/misc/scheduletuner.h>
+#include <libgeodecomp/storage/updatefunctor.h>
+
+#include <cxxtest/TestSuite.h>
+#include <algorithm>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ScheduleTunerTest : public CxxTest::TestSuite
+{
+public:
+    typedef ScheduleTuner::Candidate Candidate;
+
+    void testAllCandidatesAreTriedInitialSettingFirst()
+    {
+        Candidate initial(true, false, true);
+        ScheduleTuner tuner(100, 3, 0.05, initial);
+        TS_ASSERT_EQUALS(std::size_t(8), tuner.candidates.size());
+        TS_ASSERT(tuner.tuning());
+        TS_ASSERT(tuner.current() == initial);
+
+        std::vector<Candidate> seen;
+        for (int i = 0; i < 8; ++i) {
+            Candidate candidate = tuner.current();
+            TS_ASSERT(std::find(seen.begin(), seen.end(), candidate) == seen.end());
+            seen.push_back(candidate);
+
+            for (int sample = 0; sample < 3; ++sample) {
+                TS_ASSERT(tuner.current() == candidate);
+                tuner.report(1.0);
+            }
+        }
+
+        TS_ASSERT(!tuner.tuning());
+        // ties go to the current setting:
+        TS_ASSERT(tuner.best() == initial);
+        TS_ASSERT(tuner.current() == initial);
+    }
+
+    void testFastestCandidateIsAdopted()
+    {
+        Candidate winner(false, true, false);
+        ScheduleTuner tuner(10, 2, 0.05);
+        runPhase(&tuner, winner, 0.5, 1.0);
+
+        TS_ASSERT(tuner.best() == winner);
+        TS_ASSERT(tuner.current() == winner);
+    }
+
+    void testHysteresisPreventsFlapping()
+    {
+        Candidate initial;
+        Candidate other(true, true, true);
+        ScheduleTuner tuner(10, 2, 0.05, initial);
+
+        // a 3% advantage is considered noise:
+        runPhase(&tuner, other, 0.97, 1.0);
+        TS_ASSERT(tuner.best() == initial);
+
+        // a 20% advantage isn't:
+        skipPeriod(&tuner, 10);
+        runPhase(&tuner, other, 0.8, 1.0);
+        TS_ASSERT(tuner.best() == other);
+
+        // ...and the old setting has to be clearly better to win back:
+        skipPeriod(&tuner, 10);
+        runPhase(&tuner, initial, 0.78, 0.8);
+        TS_ASSERT(tuner.best() == other);
+    }
+
+    void testTuningIsRepeatedPeriodically()
+    {
+        ScheduleTuner tuner(5, 1, 0.05);
+        runPhase(&tuner, Candidate(true), 0.1, 1.0);
+        TS_ASSERT(tuner.best() == Candidate(true));
+
+        for (int i = 0; i < 4; ++i) {
+            TS_ASSERT(!tuner.tuning());
+            tuner.report(0.1);
+        }
+        TS_ASSERT(!tuner.tuning());
+        tuner.report(0.1);
+        TS_ASSERT(tuner.tuning());
+
+        // conditions may change during a run:
+        runPhase(&tuner, Candidate(false, true), 0.01, 1.0);
+        TS_ASSERT(tuner.best() == Candidate(false, true));
+    }
+
+    void testConcurrencySpec()
+    {
+        UpdateFunctorHelpers::ConcurrencyEnableOpenMP spec =
+            Candidate(true, true, false).concurrencySpec<UpdateFunctorHelpers::ConcurrencyEnableOpenMP>();
+        TS_ASSERT( spec.preferStaticScheduling());
+        TS_ASSERT( spec.preferStreakGranularity());
+        TS_ASSERT(!spec.preferFineGrainedParallelism());
+
+        spec = Candidate(false, false, true).concurrencySpec<UpdateFunctorHelpers::ConcurrencyEnableOpenMP>();
+        TS_ASSERT(!spec.preferStaticScheduling());
+        TS_ASSERT(!spec.preferStreakGranularity());
+        TS_ASSERT( spec.preferFineGrainedParallelism());
+    }
+
+private:
+    /**
+     * Feeds a full tuning phase to the tuner in which winner takes
+     * winnerTime seconds per step, all others take otherTime.
+     */
+    void runPhase(ScheduleTuner *tuner, const Candidate& winner, double winnerTime, double otherTime)
+    {
+        TS_ASSERT(tuner->tuning());
+        while (tuner->tuning()) {
+            tuner->report((tuner->current() == winner) ? winnerTime : otherTime);
+        }
+    }
+
+    void skipPeriod(ScheduleTuner *tuner, unsigned period)
+    {
+        for (unsigned i = 0; i < period; ++i) {
+            tuner->report(1.0);
+        }
+    }
+};
+
+}
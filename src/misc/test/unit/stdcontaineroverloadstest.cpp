@@ -0,0 +1,203 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StdContainerOverloadsTest_StdSet_init = false;
+#include "/root/repo/src/misc/test/unit/stdcontaineroverloadstest.h"
+
+static StdContainerOverloadsTest_StdSet suite_StdContainerOverloadsTest_StdSet;
+
+static CxxTest::List Tests_StdContainerOverloadsTest_StdSet = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StdContainerOverloadsTest_StdSet( "/root/repo/src/misc/test/unit/stdcontaineroverloadstest.h", 15, "StdContainerOverloadsTest_StdSet", suite_StdContainerOverloadsTest_StdSet, Tests_StdContainerOverloadsTest_StdSet );
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorLessLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorLessLess() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 18, "testOperatorLessLess" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testOperatorLessLess(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorLessLess;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testInsertMinMaxAndEraseMin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testInsertMinMaxAndEraseMin() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 49, "testInsertMinMaxAndEraseMin" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testInsertMinMaxAndEraseMin(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testInsertMinMaxAndEraseMin;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorAndAnd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorAndAnd() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 64, "testOperatorAndAnd" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testOperatorAndAnd(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorAndAnd;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrOr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrOr() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 86, "testOperatorOrOr" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testOperatorOrOr(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrOr;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrEquals() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 106, "testOperatorOrEquals" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testOperatorOrEquals(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorOrEquals;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorPlus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorPlus() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdSet, suiteDescription_StdContainerOverloadsTest_StdSet, 123, "testOperatorPlus" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdSet.testOperatorPlus(); }
+} testDescription_suite_StdContainerOverloadsTest_StdSet_testOperatorPlus;
+
+static StdContainerOverloadsTest_StdMap suite_StdContainerOverloadsTest_StdMap;
+
+static CxxTest::List Tests_StdContainerOverloadsTest_StdMap = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StdContainerOverloadsTest_StdMap( "/root/repo/src/misc/test/unit/stdcontaineroverloadstest.h", 136, "StdContainerOverloadsTest_StdMap", suite_StdContainerOverloadsTest_StdMap, Tests_StdContainerOverloadsTest_StdMap );
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdMap_testOperatorLessLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdMap_testOperatorLessLess() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdMap, suiteDescription_StdContainerOverloadsTest_StdMap, 139, "testOperatorLessLess" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdMap.testOperatorLessLess(); }
+} testDescription_suite_StdContainerOverloadsTest_StdMap_testOperatorLessLess;
+
+static StdContainerOverloadsTest_StdVector suite_StdContainerOverloadsTest_StdVector;
+
+static CxxTest::List Tests_StdContainerOverloadsTest_StdVector = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StdContainerOverloadsTest_StdVector( "/root/repo/src/misc/test/unit/stdcontaineroverloadstest.h", 171, "StdContainerOverloadsTest_StdVector", suite_StdContainerOverloadsTest_StdVector, Tests_StdContainerOverloadsTest_StdVector );
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testConstructor() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 205, "testConstructor" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testConstructor(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testConstructor;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testDelete : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testDelete() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 218, "testDelete" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testDelete(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testDelete;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testPop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testPop() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 226, "testPop" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testPop(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testPop;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testPopFront : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testPopFront() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 237, "testPopFront" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testPopFront(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testPopFront;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testMove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testMove() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 248, "testMove" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testMove(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testMove;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testPushFront : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testPushFront() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 261, "testPushFront" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testPushFront(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testPushFront;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testSum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testSum() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 273, "testSum" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testSum(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testSum;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testAppend : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testAppend() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 280, "testAppend" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testAppend(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testAppend;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testCoordToVector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testCoordToVector() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 294, "testCoordToVector" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testCoordToVector(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testCoordToVector;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testOperatorLessLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testOperatorLessLess() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 313, "testOperatorLessLess" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testOperatorLessLess(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testOperatorLessLess;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testContains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testContains() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 337, "testContains" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testContains(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testContains;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testSort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testSort() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 345, "testSort" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testSort(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testSort;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdVector_testMinMaxVector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdVector_testMinMaxVector() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdVector, suiteDescription_StdContainerOverloadsTest_StdVector, 355, "testMinMaxVector" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdVector.testMinMaxVector(); }
+} testDescription_suite_StdContainerOverloadsTest_StdVector_testMinMaxVector;
+
+static StdContainerOverloadsTest_StdDeque suite_StdContainerOverloadsTest_StdDeque;
+
+static CxxTest::List Tests_StdContainerOverloadsTest_StdDeque = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StdContainerOverloadsTest_StdDeque( "/root/repo/src/misc/test/unit/stdcontaineroverloadstest.h", 378, "StdContainerOverloadsTest_StdDeque", suite_StdContainerOverloadsTest_StdDeque, Tests_StdContainerOverloadsTest_StdDeque );
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorLessLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorLessLess() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 381, "testOperatorLessLess" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testOperatorLessLess(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorLessLess;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorPlus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorPlus() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 407, "testOperatorPlus" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testOperatorPlus(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testOperatorPlus;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testMinMax : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testMinMax() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 424, "testMinMax" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testMinMax(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testMinMax;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testSort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testSort() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 433, "testSort" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testSort(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testSort;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testContains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testContains() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 444, "testContains" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testContains(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testContains;
+
+static class TestDescription_suite_StdContainerOverloadsTest_StdDeque_testSum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StdContainerOverloadsTest_StdDeque_testSum() : CxxTest::RealTestDescription( Tests_StdContainerOverloadsTest_StdDeque, suiteDescription_StdContainerOverloadsTest_StdDeque, 455, "testSum" ) {}
+ void runTest() { suite_StdContainerOverloadsTest_StdDeque.testSum(); }
+} testDescription_suite_StdContainerOverloadsTest_StdDeque_testSum;
+
@@ -0,0 +1,121 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TestCellTest_init = false;
+#include "/root/repo/src/misc/test/unit/testcelltest.h"
+
+static TestCellTest suite_TestCellTest;
+
+static CxxTest::List Tests_TestCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TestCellTest( "/root/repo/src/misc/test/unit/testcelltest.h", 12, "TestCellTest", suite_TestCellTest, Tests_TestCellTest );
+
+static class TestDescription_suite_TestCellTest_testDefaultConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testDefaultConstructor() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 45, "testDefaultConstructor" ) {}
+ void runTest() { suite_TestCellTest.testDefaultConstructor(); }
+} testDescription_suite_TestCellTest_testDefaultConstructor;
+
+static class TestDescription_suite_TestCellTest_testSetUp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testSetUp() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 50, "testSetUp" ) {}
+ void runTest() { suite_TestCellTest.testSetUp(); }
+} testDescription_suite_TestCellTest_testSetUp;
+
+static class TestDescription_suite_TestCellTest_testUpdate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdate() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 55, "testUpdate" ) {}
+ void runTest() { suite_TestCellTest.testUpdate(); }
+} testDescription_suite_TestCellTest_testUpdate;
+
+static class TestDescription_suite_TestCellTest_testMultipleUpdate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testMultipleUpdate() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 62, "testMultipleUpdate" ) {}
+ void runTest() { suite_TestCellTest.testMultipleUpdate(); }
+} testDescription_suite_TestCellTest_testMultipleUpdate;
+
+static class TestDescription_suite_TestCellTest_testUpdateUnsyncedNanoStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateUnsyncedNanoStep() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 70, "testUpdateUnsyncedNanoStep" ) {}
+ void runTest() { suite_TestCellTest.testUpdateUnsyncedNanoStep(); }
+} testDescription_suite_TestCellTest_testUpdateUnsyncedNanoStep;
+
+static class TestDescription_suite_TestCellTest_testUpdateOutOfBoundsNanoStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateOutOfBoundsNanoStep() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 76, "testUpdateOutOfBoundsNanoStep" ) {}
+ void runTest() { suite_TestCellTest.testUpdateOutOfBoundsNanoStep(); }
+} testDescription_suite_TestCellTest_testUpdateOutOfBoundsNanoStep;
+
+static class TestDescription_suite_TestCellTest_testUpdateBadEdgeCellInner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateBadEdgeCellInner() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 82, "testUpdateBadEdgeCellInner" ) {}
+ void runTest() { suite_TestCellTest.testUpdateBadEdgeCellInner(); }
+} testDescription_suite_TestCellTest_testUpdateBadEdgeCellInner;
+
+static class TestDescription_suite_TestCellTest_testUpdateBadEdgeCellOuter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateBadEdgeCellOuter() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 89, "testUpdateBadEdgeCellOuter" ) {}
+ void runTest() { suite_TestCellTest.testUpdateBadEdgeCellOuter(); }
+} testDescription_suite_TestCellTest_testUpdateBadEdgeCellOuter;
+
+static class TestDescription_suite_TestCellTest_testUpdateInvalidNeighbor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateInvalidNeighbor() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 97, "testUpdateInvalidNeighbor" ) {}
+ void runTest() { suite_TestCellTest.testUpdateInvalidNeighbor(); }
+} testDescription_suite_TestCellTest_testUpdateInvalidNeighbor;
+
+static class TestDescription_suite_TestCellTest_testUpdateBadCycle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateBadCycle() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 109, "testUpdateBadCycle" ) {}
+ void runTest() { suite_TestCellTest.testUpdateBadCycle(); }
+} testDescription_suite_TestCellTest_testUpdateBadCycle;
+
+static class TestDescription_suite_TestCellTest_testUpdateBadRect : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateBadRect() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 116, "testUpdateBadRect" ) {}
+ void runTest() { suite_TestCellTest.testUpdateBadRect(); }
+} testDescription_suite_TestCellTest_testUpdateBadRect;
+
+static class TestDescription_suite_TestCellTest_testUpdateBadPos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_testUpdateBadPos() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 123, "testUpdateBadPos" ) {}
+ void runTest() { suite_TestCellTest.testUpdateBadPos(); }
+} testDescription_suite_TestCellTest_testUpdateBadPos;
+
+static class TestDescription_suite_TestCellTest_test3D1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_test3D1() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 138, "test3D1" ) {}
+ void runTest() { suite_TestCellTest.test3D1(); }
+} testDescription_suite_TestCellTest_test3D1;
+
+static class TestDescription_suite_TestCellTest_test3D2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_test3D2() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 185, "test3D2" ) {}
+ void runTest() { suite_TestCellTest.test3D2(); }
+} testDescription_suite_TestCellTest_test3D2;
+
+static class TestDescription_suite_TestCellTest_test3DwithUpdateLineXandWithoutSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestCellTest_test3DwithUpdateLineXandWithoutSoA() : CxxTest::RealTestDescription( Tests_TestCellTest, suiteDescription_TestCellTest, 242, "test3DwithUpdateLineXandWithoutSoA" ) {}
+ void runTest() { suite_TestCellTest.test3DwithUpdateLineXandWithoutSoA(); }
+} testDescription_suite_TestCellTest_test3DwithUpdateLineXandWithoutSoA;
+
@@ -0,0 +1,86 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TuningCacheTest_init = false;
+#include "/root/repo/src/misc/test/unit/tuningcachetest.h"
+
+static TuningCacheTest suite_TuningCacheTest;
+
+static CxxTest::List Tests_TuningCacheTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TuningCacheTest( "/root/repo/src/misc/test/unit/tuningcachetest.h", 19, "TuningCacheTest", suite_TuningCacheTest, Tests_TuningCacheTest );
+
+static class TestDescription_suite_TuningCacheTest_testMissingFileYieldsEmptyCache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testMissingFileYieldsEmptyCache() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 42, "testMissingFileYieldsEmptyCache" ) {}
+ void runTest() { suite_TuningCacheTest.testMissingFileYieldsEmptyCache(); }
+} testDescription_suite_TuningCacheTest_testMissingFileYieldsEmptyCache;
+
+static class TestDescription_suite_TuningCacheTest_testRoundTrip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testRoundTrip() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 49, "testRoundTrip" ) {}
+ void runTest() { suite_TuningCacheTest.testRoundTrip(); }
+} testDescription_suite_TuningCacheTest_testRoundTrip;
+
+static class TestDescription_suite_TuningCacheTest_testOnlyBetterResultsAreStored : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testOnlyBetterResultsAreStored() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 83, "testOnlyBetterResultsAreStored" ) {}
+ void runTest() { suite_TuningCacheTest.testOnlyBetterResultsAreStored(); }
+} testDescription_suite_TuningCacheTest_testOnlyBetterResultsAreStored;
+
+static class TestDescription_suite_TuningCacheTest_testConcurrentUpdatesAreMerged : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testConcurrentUpdatesAreMerged() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 102, "testConcurrentUpdatesAreMerged" ) {}
+ void runTest() { suite_TuningCacheTest.testConcurrentUpdatesAreMerged(); }
+} testDescription_suite_TuningCacheTest_testConcurrentUpdatesAreMerged;
+
+static class TestDescription_suite_TuningCacheTest_testConcurrentProcessesDontLoseUpdates : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testConcurrentProcessesDontLoseUpdates() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 114, "testConcurrentProcessesDontLoseUpdates" ) {}
+ void runTest() { suite_TuningCacheTest.testConcurrentProcessesDontLoseUpdates(); }
+} testDescription_suite_TuningCacheTest_testConcurrentProcessesDontLoseUpdates;
+
+static class TestDescription_suite_TuningCacheTest_testTempFilenameIsUniquePerProcess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testTempFilenameIsUniquePerProcess() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 143, "testTempFilenameIsUniquePerProcess" ) {}
+ void runTest() { suite_TuningCacheTest.testTempFilenameIsUniquePerProcess(); }
+} testDescription_suite_TuningCacheTest_testTempFilenameIsUniquePerProcess;
+
+static class TestDescription_suite_TuningCacheTest_testMismatchingParametersAreIgnored : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testMismatchingParametersAreIgnored() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 153, "testMismatchingParametersAreIgnored" ) {}
+ void runTest() { suite_TuningCacheTest.testMismatchingParametersAreIgnored(); }
+} testDescription_suite_TuningCacheTest_testMismatchingParametersAreIgnored;
+
+static class TestDescription_suite_TuningCacheTest_testMalformedLinesAreSkipped : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testMalformedLinesAreSkipped() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 165, "testMalformedLinesAreSkipped" ) {}
+ void runTest() { suite_TuningCacheTest.testMalformedLinesAreSkipped(); }
+} testDescription_suite_TuningCacheTest_testMalformedLinesAreSkipped;
+
+static class TestDescription_suite_TuningCacheTest_testHostInfo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TuningCacheTest_testHostInfo() : CxxTest::RealTestDescription( Tests_TuningCacheTest, suiteDescription_TuningCacheTest, 178, "testHostInfo" ) {}
+ void runTest() { suite_TuningCacheTest.testHostInfo(); }
+} testDescription_suite_TuningCacheTest_testHostInfo;
+
@@ -0,0 +1,190 @@
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/tuningcache.h>
+
+#include <cxxtest/TestSuite.h>
+#include <cstdio>
+#include <fstream>
+
+#ifndef __WIN32__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TuningCacheTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        filename = TempFile::serial("tuningcachetest");
+
+        std::vector<std::string> schedules;
+        schedules << "static"
+                  << "dynamic"
+                  << "guided";
+        params = SimulationParameters();
+        params.addParameter("WavefrontWidth", 10, 1000);
+        params.addParameter("PipelineLength", 1, 30);
+        params.addParameter("Schedule", schedules);
+    }
+
+    void tearDown()
+    {
+        std::remove(filename.c_str());
+        std::remove((filename + ".lock").c_str());
+    }
+
+    void testMissingFileYieldsEmptyCache()
+    {
+        TuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(0), cache.size());
+        TS_ASSERT(!cache.lookup("foo", &params));
+    }
+
+    void testRoundTrip()
+    {
+        std::string key = TuningCache::key("MyCell", "(100, 200)", "CacheBlockingSimulation", 8, "Fancy CPU");
+
+        {
+            params["WavefrontWidth"].setValue(117);
+            params["PipelineLength"].setValue(4);
+            params["Schedule"].setValue(2);
+
+            TuningCache cache(filename);
+            TS_ASSERT(cache.update(key, params, -0.5));
+        }
+
+        TuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(1), cache.size());
+
+        SimulationParameters actual = params;
+        actual["WavefrontWidth"].setValue(0);
+        actual["PipelineLength"].setValue(0);
+        actual["Schedule"].setValue(0);
+        double fitness = 0;
+        TS_ASSERT(cache.lookup(key, &actual, &fitness));
+        TS_ASSERT_EQUALS(-0.5, fitness);
+        TS_ASSERT_EQUALS(127, int(actual["WavefrontWidth"]));
+        TS_ASSERT_EQUALS(5,   int(actual["PipelineLength"]));
+        TS_ASSERT_EQUALS("guided", std::string(actual["Schedule"]));
+
+        // keys differ in every component:
+        SimulationParameters other = params;
+        TS_ASSERT(!cache.lookup(TuningCache::key("MyCell", "(100, 200)", "CacheBlockingSimulation", 4, "Fancy CPU"), &other));
+        TS_ASSERT(!cache.lookup(TuningCache::key("MyCell", "(100, 201)", "CacheBlockingSimulation", 8, "Fancy CPU"), &other));
+        TS_ASSERT(!cache.lookup(TuningCache::key("MyCell", "(100, 200)", "CacheBlockingSimulation", 8, "Lame CPU"), &other));
+    }
+
+    void testOnlyBetterResultsAreStored()
+    {
+        std::string key = TuningCache::key("MyCell", "(100, 200)", "SerialSimulation");
+        TuningCache cache(filename);
+
+        params["PipelineLength"].setValue(3);
+        TS_ASSERT(cache.update(key, params, -2.0));
+        params["PipelineLength"].setValue(6);
+        TS_ASSERT(!cache.update(key, params, -3.0));
+        params["PipelineLength"].setValue(9);
+        TS_ASSERT(cache.update(key, params, -1.0));
+
+        SimulationParameters actual = params;
+        double fitness;
+        TS_ASSERT(TuningCache(filename).lookup(key, &actual, &fitness));
+        TS_ASSERT_EQUALS(-1.0, fitness);
+        TS_ASSERT_EQUALS(10, int(actual["PipelineLength"]));
+    }
+
+    void testConcurrentUpdatesAreMerged()
+    {
+        TuningCache cacheA(filename);
+        TuningCache cacheB(filename);
+
+        cacheA.update("a", params, -1.0);
+        cacheB.update("b", params, -1.0);
+
+        TuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(2), cache.size());
+    }
+
+    void testConcurrentProcessesDontLoseUpdates()
+    {
+#ifndef __WIN32__
+        const int numProcesses = 8;
+        const int updatesPerProcess = 10;
+        std::vector<pid_t> children;
+
+        for (int p = 0; p < numProcesses; ++p) {
+            pid_t pid = fork();
+            if (pid == 0) {
+                TuningCache cache(filename);
+                for (int i = 0; i < updatesPerProcess; ++i) {
+                    cache.update(StringOps::itoa(p) + "_" + StringOps::itoa(i), params, -1.0);
+                }
+                _exit(0);
+            }
+            children << pid;
+        }
+
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            int status;
+            TS_ASSERT_EQUALS(children[i], waitpid(children[i], &status, 0));
+        }
+
+        TuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(numProcesses * updatesPerProcess), cache.size());
+#endif
+    }
+
+    void testTempFilenameIsUniquePerProcess()
+    {
+        std::string tempFilename = TuningCache::tempFilename(filename);
+        TS_ASSERT_EQUALS(0, tempFilename.find(filename + ".tmp"));
+        TS_ASSERT_EQUALS(tempFilename, TuningCache::tempFilename(filename));
+#ifndef __WIN32__
+        TS_ASSERT_DIFFERS(std::string::npos, tempFilename.find("." + StringOps::itoa(getpid()) + "."));
+#endif
+    }
+
+    void testMismatchingParametersAreIgnored()
+    {
+        TuningCache cache(filename);
+        cache.update("a", params, -1.0);
+
+        SimulationParameters other;
+        other.addParameter("PipelineLength", 1, 30);
+        TS_ASSERT(!cache.lookup("a", &other));
+        TS_ASSERT(cache.update("a", other, -5.0));
+        TS_ASSERT(cache.lookup("a", &other));
+    }
+
+    void testMalformedLinesAreSkipped()
+    {
+        {
+            std::ofstream file(filename.c_str());
+            file << "garbage\n"
+                 << "a\t-1\tPipelineLength\n"
+                 << "b\t-2\tPipelineLength=4\n";
+        }
+
+        TuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(1), cache.size());
+    }
+
+    void testHostInfo()
+    {
+        TS_ASSERT(TuningCache::threadCount() > 0);
+        TS_ASSERT(!TuningCache::cpuModel().empty());
+        TS_ASSERT_EQUALS(std::string::npos, TuningCache::cpuModel().find('\t'));
+    }
+
+private:
+    std::string filename;
+    SimulationParameters params;
+};
+
+}
@@ -0,0 +1,335 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/tuningcache.h>
+
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <boost/thread.hpp>
+#endif
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+namespace {
+
+/**
+ * Holds an exclusive advisory lock on a separate lock file for its
+ * lifetime. POSIX record locks (as opposed to flock()) also work on
+ * most network file systems, where shared caches are likely to
+ * live. Failing to lock degrades to unsynchronized updates.
+ */
+class CacheFileLock
+{
+public:
+    explicit CacheFileLock(const std::string& filename) :
+        fd(-1)
+    {
+#ifndef __WIN32__
+        std::string lockFilename = filename + ".lock";
+        fd = open(lockFilename.c_str(), O_RDWR | O_CREAT, 0666);
+        if (fd == -1) {
+            LOG(WARN, "TuningCache could not open lock file " << lockFilename);
+            return;
+        }
+
+        struct flock lock = flockArgs(F_WRLCK);
+        if (fcntl(fd, F_SETLKW, &lock) == -1) {
+            LOG(WARN, "TuningCache could not lock " << lockFilename);
+        }
+#endif
+    }
+
+    ~CacheFileLock()
+    {
+#ifndef __WIN32__
+        if (fd != -1) {
+            struct flock lock = flockArgs(F_UNLCK);
+            fcntl(fd, F_SETLK, &lock);
+            close(fd);
+        }
+#endif
+    }
+
+private:
+    int fd;
+
+#ifndef __WIN32__
+    static struct flock flockArgs(short type)
+    {
+        struct flock ret;
+        ret.l_type = type;
+        ret.l_whence = SEEK_SET;
+        ret.l_start = 0;
+        ret.l_len = 0;
+        return ret;
+    }
+#endif
+
+    CacheFileLock(const CacheFileLock&);
+    void operator=(const CacheFileLock&);
+};
+
+}
+
+TuningCache::TuningCache(const std::string& filename) :
+    filename(filename),
+    entries(read(filename))
+{}
+
+bool TuningCache::lookup(const std::string& key, SimulationParameters *params, double *fitness) const
+{
+    EntryMap::const_iterator i = entries.find(key);
+    if ((i == entries.end()) || !matches(i->second, *params)) {
+        return false;
+    }
+
+    for (std::map<std::string, double>::const_iterator j = i->second.values.begin();
+         j != i->second.values.end();
+         ++j) {
+        (*params)[j->first].setValue(j->second);
+    }
+    if (fitness) {
+        *fitness = i->second.fitness;
+    }
+
+    return true;
+}
+
+bool TuningCache::update(const std::string& key, const SimulationParameters& params, double fitness)
+{
+    if (!isWriter()) {
+        return store(key, params, fitness);
+    }
+
+    // hold the lock while reading, merging and replacing the file so
+    // that no other job's results get lost in between:
+    CacheFileLock lock(filename);
+    merge(read(filename));
+    if (!store(key, params, fitness)) {
+        return false;
+    }
+
+    write(filename, entries);
+    return true;
+}
+
+std::string TuningCache::key(
+    const std::string& cellType,
+    const std::string& dimensions,
+    const std::string& simulatorType,
+    int threads,
+    const std::string& cpu)
+{
+    std::ostringstream buf;
+    buf << cellType << "|" << dimensions << "|" << simulatorType << "|" << threads << "|" << cpu;
+    return buf.str();
+}
+
+std::string TuningCache::cpuModel()
+{
+    std::ifstream file("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.find("model name") != 0) {
+            continue;
+        }
+
+        std::size_t start = line.find(':');
+        if (start == std::string::npos) {
+            break;
+        }
+        start = line.find_first_not_of(" \t", start + 1);
+        std::size_t end = line.find_last_not_of(" \t\r");
+        if ((start == std::string::npos) || (end < start)) {
+            break;
+        }
+
+        // tabs separate the fields of our cache file:
+        std::string model = line.substr(start, end - start + 1);
+        for (std::size_t i = 0; i < model.size(); ++i) {
+            if (model[i] == '\t') {
+                model[i] = ' ';
+            }
+        }
+        return model;
+    }
+
+    return "unknown";
+}
+
+int TuningCache::threadCount()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+#ifdef LIBGEODECOMP_WITH_THREADS
+    return boost::thread::hardware_concurrency();
+#else
+    return 1;
+#endif
+#endif
+}
+
+TuningCache::EntryMap TuningCache::read(const std::string& filename)
+{
+    EntryMap ret;
+    std::ifstream file(filename.c_str());
+    std::string line;
+
+    while (std::getline(file, line)) {
+        StringVec tokens = StringOps::tokenize(line, "\t");
+        if (tokens.size() < 2) {
+            continue;
+        }
+
+        Entry entry(StringOps::atof(tokens[1]));
+        bool valid = true;
+        for (std::size_t i = 2; i < tokens.size(); ++i) {
+            std::size_t pos = tokens[i].rfind('=');
+            if (pos == std::string::npos) {
+                valid = false;
+                break;
+            }
+            entry.values[tokens[i].substr(0, pos)] = StringOps::atof(tokens[i].substr(pos + 1));
+        }
+
+        if (!valid) {
+            LOG(WARN, "TuningCache ignoring malformed line in " << filename << ": " << line);
+            continue;
+        }
+        ret[tokens[0]] = entry;
+    }
+
+    return ret;
+}
+
+void TuningCache::write(const std::string& filename, const EntryMap& entries)
+{
+    // write to a private file first, so concurrent readers never see
+    // a partially written cache:
+    std::string tempFilename = TuningCache::tempFilename(filename);
+    {
+        std::ofstream file(tempFilename.c_str());
+        file.precision(17);
+        for (EntryMap::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+            file << i->first << "\t" << i->second.fitness;
+            for (std::map<std::string, double>::const_iterator j = i->second.values.begin();
+                 j != i->second.values.end();
+                 ++j) {
+                file << "\t" << j->first << "=" << j->second;
+            }
+            file << "\n";
+        }
+
+        if (!file) {
+            LOG(ERROR, "TuningCache could not write " << tempFilename);
+            std::remove(tempFilename.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tempFilename.c_str(), filename.c_str()) != 0) {
+        LOG(ERROR, "TuningCache could not replace " << filename);
+        std::remove(tempFilename.c_str());
+    }
+}
+
+void TuningCache::merge(const EntryMap& fresh)
+{
+    for (EntryMap::const_iterator i = fresh.begin(); i != fresh.end(); ++i) {
+        EntryMap::iterator old = entries.find(i->first);
+        if ((old == entries.end()) || (old->second.fitness < i->second.fitness)) {
+            entries[i->first] = i->second;
+        }
+    }
+}
+
+bool TuningCache::store(const std::string& key, const SimulationParameters& params, double fitness)
+{
+    EntryMap::iterator old = entries.find(key);
+    if ((old != entries.end()) && matches(old->second, params) && (old->second.fitness >= fitness)) {
+        return false;
+    }
+
+    Entry entry(fitness);
+    std::vector<std::string> names = params.getNames();
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        entry.values[names[i]] = params[names[i]].getValue();
+    }
+    entries[key] = entry;
+
+    return true;
+}
+
+int TuningCache::mpiRank()
+{
+#ifdef LIBGEODECOMP_WITH_MPI
+    int initialized = 0;
+    int finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+    if (initialized && !finalized) {
+        int rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        return rank;
+    }
+#endif
+    return 0;
+}
+
+bool TuningCache::isWriter()
+{
+    // in MPI jobs (e.g. when tuning a HiParSimulation) all ranks
+    // find the same results, so one writer is enough:
+    return mpiRank() == 0;
+}
+
+std::string TuningCache::tempFilename(const std::string& filename)
+{
+    std::ostringstream buf;
+    buf << filename << ".tmp";
+#ifndef __WIN32__
+    char hostname[256];
+    if (gethostname(hostname, sizeof(hostname)) == 0) {
+        hostname[sizeof(hostname) - 1] = 0;
+        buf << "." << hostname;
+    }
+    buf << "." << getpid();
+#endif
+    buf << "." << mpiRank();
+
+    return buf.str();
+}
+
+bool TuningCache::matches(const Entry& entry, const SimulationParameters& params)
+{
+    std::vector<std::string> names = params.getNames();
+    if (names.size() != entry.values.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (entry.values.count(names[i]) == 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
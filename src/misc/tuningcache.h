@@ -0,0 +1,115 @@
+#ifndef LIBGEODECOMP_MISC_TUNINGCACHE_H
+#define LIBGEODECOMP_MISC_TUNINGCACHE_H
+
+#include <libgeodecomp/misc/simulationparameters.h>
+
+#include <map>
+#include <string>
+
+namespace LibGeoDecomp {
+
+/**
+ * Persistent database of auto-tuning results. Entries are keyed by a
+ * string describing the tuning problem (cell type, grid dimensions,
+ * simulator type, thread count and CPU model, see key()) and hold
+ * the best parameters found so far along with their fitness,
+ * normalized to one time step.
+ *
+ * The file is plain text with one entry per line, so users can
+ * inspect, edit or share it between jobs:
+ *
+ *   key <TAB> fitness <TAB> name=value <TAB> name=value ...
+ *
+ * Values are the real-valued representation of each parameter
+ * (OptimizableParameter::getValue()), so they can be fed back into
+ * an Optimizer as a starting point.
+ */
+class TuningCache
+{
+public:
+    friend class TuningCacheTest;
+
+    class Entry
+    {
+    public:
+        explicit Entry(double fitness = 0) :
+            fitness(fitness)
+        {}
+
+        double fitness;
+        std::map<std::string, double> values;
+    };
+
+    /**
+     * Reads all entries stored in filename. A missing file simply
+     * yields an empty cache.
+     */
+    explicit TuningCache(const std::string& filename);
+
+    /**
+     * Copies the cached values into params and returns true, or
+     * returns false if no entry for key exists or if its parameter
+     * names don't match those of params (e.g. because the
+     * SimulationFactory's parameters have changed since).
+     */
+    bool lookup(const std::string& key, SimulationParameters *params, double *fitness = 0) const;
+
+    /**
+     * Stores params for key if no entry exists yet or if fitness is
+     * better (i.e. larger) than the stored one. Updates are written
+     * to disk immediately. Jobs sharing a cache are serialized via
+     * an advisory lock on filename + ".lock", under which entries
+     * added by others since construction are merged first, so
+     * concurrent jobs don't overwrite each other's results. In MPI
+     * runs only rank 0 touches the file. Returns true if the entry
+     * was updated.
+     */
+    bool update(const std::string& key, const SimulationParameters& params, double fitness);
+
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+
+    /**
+     * Builds the key for a tuning problem. threads and cpu default
+     * to the values of the current machine.
+     */
+    static std::string key(
+        const std::string& cellType,
+        const std::string& dimensions,
+        const std::string& simulatorType,
+        int threads = threadCount(),
+        const std::string& cpu = cpuModel());
+
+    /**
+     * Returns the CPU's model name as reported by the OS, or
+     * "unknown" on systems where this is not supported.
+     */
+    static std::string cpuModel();
+
+    /**
+     * Number of threads available to the simulators.
+     */
+    static int threadCount();
+
+private:
+    typedef std::map<std::string, Entry> EntryMap;
+
+    std::string filename;
+    EntryMap entries;
+
+    void merge(const EntryMap& fresh);
+    bool store(const std::string& key, const SimulationParameters& params, double fitness);
+
+    static int mpiRank();
+    static bool isWriter();
+    static std::string tempFilename(const std::string& filename);
+    static EntryMap read(const std::string& filename);
+    static void write(const std::string& filename, const EntryMap& entries);
+    static bool matches(const Entry& entry, const SimulationParameters& params);
+};
+
+}
+
+#endif
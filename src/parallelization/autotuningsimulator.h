@@ -2,13 +2,18 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_AUTOTUNINGSIMULATOR_H
 #define LIBGEODECOMP_PARALLELIZATION_AUTOTUNINGSIMULATOR_H
 
+#include <libgeodecomp/misc/hiparsimulationfactory.h>
+#include <libgeodecomp/misc/openmpsimulationfactory.h>
 #include <libgeodecomp/misc/optimizer.h>
 #include <libgeodecomp/misc/simulationfactory.h>
 #include <libgeodecomp/misc/simulationparameters.h>
+#include <libgeodecomp/misc/tuningcache.h>
 #include <libgeodecomp/io/initializer.h>
 #include <libgeodecomp/io/varstepinitializerproxy.h>
 #include <libgeodecomp/io/logger.h>
+#include <algorithm>
 #include <cfloat>
+#include <typeinfo>
 
 namespace LibGeoDecomp {
 
@@ -17,12 +22,15 @@ namespace LibGeoDecomp {
  * facilities to select the most efficient Simulator implementation
  * and suitable parameters for the given simulation model and
  * hardware.
+ *
+ * Results can be persisted across jobs via setTuningCache().
  */
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 class AutoTuningSimulator
 {
 public:
     typedef boost::shared_ptr<SimulationFactory<CELL_TYPE> > SimFactoryPtr;
+    typedef typename SimulationFactory<CELL_TYPE>::ProbeSettings ProbeSettings;
     class Simulation{
     public:
         Simulation(std::string name,
@@ -80,6 +88,23 @@ public:
 
     void prepareSimulations();
 
+    /**
+     * Makes runTest() consult the TuningCache stored in filename
+     * before optimizing each simulation. If skipSearch is set,
+     * cached parameters are used as-is, otherwise they only serve
+     * as the optimizer's starting point. Better parameters are
+     * written back to the cache either way.
+     */
+    void setTuningCache(const std::string& filename, bool skipSearch = true);
+
+    /**
+     * Lets all simulations' factories evaluate candidates via short
+     * probe runs instead of complete simulation runs (see
+     * SimulationFactory::setProbeSettings()). This also applies to
+     * simulations added later on.
+     */
+    void setProbeSettings(const ProbeSettings& settings);
+
 private:
     void addNewSimulation(std::string name,
         std::string typeOfSimulation,
@@ -87,12 +112,21 @@ private:
 
     bool isInMap(const std::string name)const;
 
+    std::string tuningKey(const Simulation& simulation) const;
+
+    bool allSimulationsCached() const;
+
+    void configureFactory(SimFactoryPtr factory);
+
     std::map<const std::string, SimulationPtr> simulations;
     unsigned optimizationSteps; // maximum number of Steps for the optimizer
     VarStepInitializerProxy<CELL_TYPE> varStepInitializer;
     std::vector<boost::shared_ptr<ParallelWriter<CELL_TYPE> > > parallelWriters;
     std::vector<boost::shared_ptr<Writer<CELL_TYPE> > > writers;
     std::vector<boost::shared_ptr<Steerer<CELL_TYPE> > > steerers;
+    boost::shared_ptr<TuningCache> tuningCache;
+    bool skipCachedSearch;
+    boost::shared_ptr<ProbeSettings> probeSettings;
 
     /**
      * fitnessGoal must be negative, the autotuning is searching for a Maximum.
@@ -107,7 +141,8 @@ private:
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::AutoTuningSimulator(Initializer<CELL_TYPE> *initializer):
     optimizationSteps(10),
-    varStepInitializer(initializer)
+    varStepInitializer(initializer),
+    skipCachedSearch(true)
 {
     addNewSimulation("SerialSimulation",
         "SerialSimulation",
@@ -117,6 +152,9 @@ AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::AutoTuningSimulator(Initializer<
     addNewSimulation("CacheBlockingSimulation",
         "CacheBlockingSimulation",
         varStepInitializer);
+    addNewSimulation("OpenMPSimulation",
+        "OpenMPSimulation",
+        varStepInitializer);
 #endif
 
 #ifdef __CUDACC__
@@ -160,6 +198,7 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::addNewSimulation(std::strin
 {
     if (typeOfSimulation == "SerialSimulation") {
         SimFactoryPtr simFac_p(new SerialSimulationFactory<CELL_TYPE>(&initializer));
+        configureFactory(simFac_p);
         SimulationPtr sim_p(new Simulation(
                 typeOfSimulation,
                 simFac_p,
@@ -171,6 +210,33 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::addNewSimulation(std::strin
 #ifdef LIBGEODECOMP_WITH_THREADS
     if (typeOfSimulation == "CacheBlockingSimulation") {
         SimFactoryPtr simFac_p(new CacheBlockingSimulationFactory<CELL_TYPE>(&initializer));
+        configureFactory(simFac_p);
+        SimulationPtr sim_p(new Simulation(
+                typeOfSimulation,
+                simFac_p,
+                simFac_p->parameters()));
+        simulations[name] = sim_p;
+        return;
+    }
+
+    if (typeOfSimulation == "OpenMPSimulation") {
+        SimFactoryPtr simFac_p(new OpenMPSimulationFactory<CELL_TYPE>(&initializer));
+        configureFactory(simFac_p);
+        SimulationPtr sim_p(new Simulation(
+                typeOfSimulation,
+                simFac_p,
+                simFac_p->parameters()));
+        simulations[name] = sim_p;
+        return;
+    }
+#endif
+
+#ifdef LIBGEODECOMP_WITH_MPI
+    // not added by default as all ranks need to take part in the
+    // tuning process:
+    if (typeOfSimulation == "HiParSimulation") {
+        SimFactoryPtr simFac_p(new HiParSimulationFactory<CELL_TYPE>(&initializer));
+        configureFactory(simFac_p);
         SimulationPtr sim_p(new Simulation(
                 typeOfSimulation,
                 simFac_p,
@@ -184,6 +250,7 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::addNewSimulation(std::strin
 #ifdef LIBGEODECOMP_WITH_CUDA
      if (typeOfSimulation == "CudaSimulation") {
         SimFactoryPtr simFac_p(new CudaSimulationFactory<CELL_TYPE>(&initializer));
+        configureFactory(simFac_p);
         SimulationPtr sim_p(new Simulation(
                 typeOfSimulation,
                 simFac_p,
@@ -265,7 +332,10 @@ template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::run()
 {
     prepareSimulations();
-    if (normalizeSteps(fitnessGoal)) {
+    if (tuningCache && skipCachedSearch && allSimulationsCached()) {
+        LOG(Logger::INFO, "AutoTuningSimulator: using cached parameters for all simulations")
+        runTest();
+    } else if (normalizeSteps(fitnessGoal)) {
         runTest();
     } else {
         LOG(Logger::WARN,"normalize Steps was not successful, a default value is used!")
@@ -344,8 +414,25 @@ unsigned AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::normalizeSteps(double g
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::runTest()
 {
+    // the cache stores the fitness per time step as the number of
+    // steps used for evaluation varies from job to job:
+    double steps = std::max(1u, varStepInitializer.maxSteps());
+
     typedef typename std::map<const std::string, SimulationPtr>::iterator IterType;
     for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
+        std::string key;
+        if (tuningCache) {
+            key = tuningKey(*iter->second);
+            double cachedFitness;
+            if (tuningCache->lookup(key, &iter->second->parameters, &cachedFitness)) {
+                LOG(Logger::INFO, "found cached parameters for " << iter->first)
+                if (skipCachedSearch) {
+                    iter->second->fitness = cachedFitness * steps;
+                    continue;
+                }
+            }
+        }
+
         OPTIMIZER_TYPE optimizer(iter->second->parameters);
         iter->second->parameters = optimizer(
             optimizationSteps,
@@ -356,6 +443,10 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::runTest()
             << ": " << iter->second->fitness << std::endl
             << "new Parameters:"<< std::endl << iter->second->parameters
             << std::endl);
+
+        if (tuningCache) {
+            tuningCache->update(key, iter->second->parameters, iter->second->fitness / steps);
+        }
     }
 }
 
@@ -377,6 +468,54 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::prepareSimulations()
     }
 }
 
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::setTuningCache(const std::string& filename, bool skipSearch)
+{
+    tuningCache.reset(new TuningCache(filename));
+    skipCachedSearch = skipSearch;
+}
+
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::setProbeSettings(const ProbeSettings& settings)
+{
+    probeSettings.reset(new ProbeSettings(settings));
+    typedef typename std::map<const std::string, SimulationPtr>::iterator IterType;
+    for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
+        configureFactory(iter->second->simulationFactory);
+    }
+}
+
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::configureFactory(SimFactoryPtr factory)
+{
+    if (probeSettings) {
+        factory->setProbeSettings(*probeSettings);
+    }
+}
+
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+std::string AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::tuningKey(const Simulation& simulation) const
+{
+    return TuningCache::key(
+        typeid(CELL_TYPE).name(),
+        varStepInitializer.gridDimensions().toString(),
+        simulation.simulationType);
+}
+
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+bool AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::allSimulationsCached() const
+{
+    typedef typename std::map<const std::string, SimulationPtr>::const_iterator IterType;
+    for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
+        SimulationParameters params = iter->second->parameters;
+        if (!tuningCache->lookup(tuningKey(*iter->second), &params)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
     bool AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::isInMap(const std::string name)const
 {
@@ -70,9 +70,14 @@ public:
         delete curGrid;
     }
 
+    /**
+     * Runs one pass of the wavefront pipeline, which advances the
+     * simulation by pipelineLength nano steps. Writers and steerers
+     * are only served by run().
+     */
     virtual void step()
     {
-        // fixme
+        hop();
     }
 
     virtual void run()
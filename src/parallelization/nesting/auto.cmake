@@ -0,0 +1,17 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}commonstepper.h
+  ${RELATIVE_PATH}cudastepper.h
+  ${RELATIVE_PATH}eventpoint.h
+  ${RELATIVE_PATH}hpxupdategroup.h
+  ${RELATIVE_PATH}mpiupdategroup.h
+  ${RELATIVE_PATH}multicorestepper.h
+  ${RELATIVE_PATH}offsethelper.h
+  ${RELATIVE_PATH}parallelwriteradapter.h
+  ${RELATIVE_PATH}steereradapter.h
+  ${RELATIVE_PATH}stepper.h
+  ${RELATIVE_PATH}threadupdategroup.h
+  ${RELATIVE_PATH}updategroup.h
+  ${RELATIVE_PATH}vanillastepper.h
+)
@@ -267,7 +267,7 @@ public:
     typedef class Stepper<CELL_TYPE> ParentType;
     typedef typename ParentType::GridType GridType;
     typedef CUDAGrid<CELL_TYPE, Topology, true> CUDAGridType;
-    typedef PartitionManager<Topology> PartitionManagerType;
+    typedef typename Stepper<CELL_TYPE>::PartitionManagerType PartitionManagerType;
     typedef PatchBufferFixed<GridType, GridType, 1> PatchBufferType1;
     typedef PatchBufferFixed<GridType, GridType, 2> PatchBufferType2;
     typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
@@ -32,7 +32,8 @@ public:
     typedef typename APITraits::SelectSoA<CELL_TYPE>::Value SupportsSoA;
     typedef typename GridTypeSelector<CELL_TYPE, Topology, true, SupportsSoA>::Value GridType;
 
-    typedef PartitionManager<Topology> PartitionManagerType;
+    typedef typename APITraits::SelectStencil<CELL_TYPE>::Value Stencil;
+    typedef PartitionManager<Topology, Stencil> PartitionManagerType;
     typedef boost::shared_ptr<PatchProvider<GridType> > PatchProviderPtr;
     typedef boost::shared_ptr<PatchAccepter<GridType> > PatchAccepterPtr;
     typedef std::deque<PatchProviderPtr> PatchProviderList;
@@ -0,0 +1,17 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mpiupdategrouptest.cpp
+  ${RELATIVE_PATH}multicoresteppertest.cpp
+  ${RELATIVE_PATH}offsethelpertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}vanillastepperbasictest.cpp
+  ${RELATIVE_PATH}vanillastepperregiontest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}cudasteppertest.h
+  ${RELATIVE_PATH}mpiupdategrouptest.h
+  ${RELATIVE_PATH}multicoresteppertest.h
+  ${RELATIVE_PATH}offsethelpertest.h
+  ${RELATIVE_PATH}vanillastepperbasictest.h
+  ${RELATIVE_PATH}vanillastepperregiontest.h
+)
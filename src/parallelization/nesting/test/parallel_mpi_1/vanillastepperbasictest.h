@@ -2,6 +2,7 @@
 
 #include <libgeodecomp.h>
 #include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/fronttestcell.h>
 #include <libgeodecomp/misc/testhelper.h>
 #include <libgeodecomp/parallelization/nesting/vanillastepper.h>
 #include <libgeodecomp/storage/mockpatchaccepter.h>
@@ -57,6 +58,55 @@ public:
         TS_ASSERT_EQUALS(std::size_t(3), patchAccepter->getOfferedNanoSteps().size());
     }
 
+    void testScheduleTuning()
+    {
+        typedef VanillaStepper<TestCell<2>, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> OpenMPStepperType;
+        OpenMPStepperType openMPStepper(partitionManager, init);
+        openMPStepper.enableScheduleTuning(5, 2);
+        TS_ASSERT(openMPStepper.scheduleTuner->tuning());
+
+        // all 8 candidates are tried for 2 nano steps each, the
+        // results must not depend on the choice:
+        openMPStepper.update(16);
+        TS_ASSERT(!openMPStepper.scheduleTuner->tuning());
+        TS_ASSERT_TEST_GRID(GridType, openMPStepper.grid(), 16);
+
+        openMPStepper.update(5);
+        TS_ASSERT(openMPStepper.scheduleTuner->tuning());
+        openMPStepper.update(19);
+        TS_ASSERT_TEST_GRID(GridType, openMPStepper.grid(), 40);
+    }
+
+    void testActivityTracking()
+    {
+        typedef FrontTestCell<> ReferenceCell;
+        typedef FrontTestCell<APITraits::HasActivityTracking> TrackedCell;
+        typedef VanillaStepper<ReferenceCell, UpdateFunctorHelpers::ConcurrencyNoP> ReferenceStepperType;
+        typedef VanillaStepper<TrackedCell, UpdateFunctorHelpers::ConcurrencyNoP> TrackedStepperType;
+
+        boost::shared_ptr<Initializer<ReferenceCell> > referenceInit(new ReferenceCell::Initializer());
+        boost::shared_ptr<Initializer<TrackedCell> > trackedInit(new TrackedCell::Initializer());
+        CoordBox<2> box = trackedInit->gridBox();
+
+        boost::shared_ptr<ReferenceStepperType::PartitionManagerType> referencePartitionManager(
+            new ReferenceStepperType::PartitionManagerType(box));
+        boost::shared_ptr<TrackedStepperType::PartitionManagerType> trackedPartitionManager(
+            new TrackedStepperType::PartitionManagerType(box));
+        ReferenceStepperType reference(referencePartitionManager, referenceInit);
+        TrackedStepperType tracked(trackedPartitionManager, trackedInit);
+
+        for (int t = 0; t < 20; ++t) {
+            reference.update1();
+            tracked.update1();
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                TS_ASSERT_EQUALS(reference.grid().get(*i).value, tracked.grid().get(*i).value);
+            }
+        }
+
+        TS_ASSERT(!tracked.activityTracker.allCellsActive());
+    }
+
 private:
     boost::shared_ptr<TestInitializer<TestCell<2> > > init;
     boost::shared_ptr<PartitionManager<Topologies::Cube<2>::Topology> > partitionManager;
@@ -0,0 +1,10 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mpiupdategrouptest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}vanillasteppertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}mpiupdategrouptest.h
+  ${RELATIVE_PATH}vanillasteppertest.h
+)
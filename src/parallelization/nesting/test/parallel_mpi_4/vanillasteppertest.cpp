@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_VanillaStepperTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_4/vanillasteppertest.h"
+
+static VanillaStepperTest suite_VanillaStepperTest;
+
+static CxxTest::List Tests_VanillaStepperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VanillaStepperTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_4/vanillasteppertest.h", 18, "VanillaStepperTest", suite_VanillaStepperTest, Tests_VanillaStepperTest );
+
+static class TestDescription_suite_VanillaStepperTest_testFoo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaStepperTest_testFoo() : CxxTest::RealTestDescription( Tests_VanillaStepperTest, suiteDescription_VanillaStepperTest, 39, "testFoo" ) {}
+ void runTest() { suite_VanillaStepperTest.testFoo(); }
+} testDescription_suite_VanillaStepperTest_testFoo;
+
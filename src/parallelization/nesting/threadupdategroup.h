@@ -0,0 +1,132 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_THREADUPDATEGROUP_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_THREADUPDATEGROUP_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+#include <libgeodecomp/communication/threadpatchlink.h>
+#include <libgeodecomp/parallelization/nesting/updategroup.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * This implementation of UpdateGroup is used by the ThreadSimulator:
+ * all UpdateGroups live within one process and exchange their ghost
+ * zones via ThreadPatchLinks. The rank merely identifies the group's
+ * share of the Partition.
+ */
+template<class CELL_TYPE>
+class ThreadUpdateGroup : public UpdateGroup<CELL_TYPE, ThreadPatchLink>
+{
+public:
+    friend class ThreadSimulatorTest;
+
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::GridType GridType;
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::PatchAccepterVec PatchAccepterVec;
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::PatchProviderVec PatchProviderVec;
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::PatchLinkAccepter PatchLinkAccepter;
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::PatchLinkProvider PatchLinkProvider;
+    typedef typename UpdateGroup<CELL_TYPE, ThreadPatchLink>::PatchLinkPtr PatchLinkPtr;
+    typedef typename ThreadPatchLink<GridType>::Registry Registry;
+
+    using UpdateGroup<CELL_TYPE, ThreadPatchLink>::init;
+    using UpdateGroup<CELL_TYPE, ThreadPatchLink>::currentStep;
+    using UpdateGroup<CELL_TYPE, ThreadPatchLink>::patchLinks;
+    using UpdateGroup<CELL_TYPE, ThreadPatchLink>::rank;
+    const static int DIM = UpdateGroup<CELL_TYPE, ThreadPatchLink>::DIM;
+    const static int NANO_STEPS = APITraits::SelectNanoSteps<CELL_TYPE>::VALUE;
+
+    /**
+     * All UpdateGroups of one simulation need to share the same
+     * registry, which ties their PatchLinks together.
+     */
+    template<typename STEPPER>
+    ThreadUpdateGroup(
+        boost::shared_ptr<Partition<DIM> > partition,
+        const CoordBox<DIM>& box,
+        const unsigned& ghostZoneWidth,
+        boost::shared_ptr<Initializer<CELL_TYPE> > initializer,
+        STEPPER *stepperType,
+        PatchAccepterVec patchAcceptersGhost = PatchAccepterVec(),
+        PatchAccepterVec patchAcceptersInner = PatchAccepterVec(),
+        PatchProviderVec patchProvidersGhost = PatchProviderVec(),
+        PatchProviderVec patchProvidersInner = PatchProviderVec(),
+        boost::shared_ptr<Registry> registry = boost::shared_ptr<Registry>(new Registry()),
+        unsigned rank = 0) :
+        UpdateGroup<CELL_TYPE, ThreadPatchLink>(ghostZoneWidth, initializer, rank),
+        registry(registry)
+    {
+        init(
+            partition,
+            box,
+            ghostZoneWidth,
+            initializer,
+            stepperType,
+            patchAcceptersGhost,
+            patchAcceptersInner,
+            patchProvidersGhost,
+            patchProvidersInner);
+    }
+
+    inline long currentNanoStep() const
+    {
+        std::pair<int, int> now = currentStep();
+        return (long)now.first * NANO_STEPS + now.second;
+    }
+
+    /**
+     * Returns true if the next nano step can be computed without
+     * waiting for any neighboring UpdateGroup.
+     */
+    inline bool ready() const
+    {
+        std::size_t nextNanoStep = currentNanoStep() + 1;
+        for (typename std::vector<PatchLinkPtr>::const_iterator i = patchLinks.begin();
+             i != patchLinks.end();
+             ++i) {
+            if (!(*i)->ready(nextNanoStep)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    boost::shared_ptr<Registry> registry;
+
+    std::vector<CoordBox<DIM> > gatherBoundingBoxes(
+        const CoordBox<DIM>& ownBoundingBox,
+        boost::shared_ptr<Partition<DIM> > partition) const
+    {
+        // all regions are known locally, no need to communicate:
+        std::size_t size = partition->getWeights().size();
+        std::vector<CoordBox<DIM> > boundingBoxes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            boundingBoxes[i] = (i == rank) ? ownBoundingBox : partition->getRegion(i).boundingBox();
+        }
+
+        return boundingBoxes;
+    }
+
+    virtual boost::shared_ptr<PatchLinkAccepter> makePatchLinkAccepter(int target, const Region<DIM>& region)
+    {
+        return boost::shared_ptr<PatchLinkAccepter>(
+            new PatchLinkAccepter(
+                region,
+                registry->channel(rank, target, region)));
+    }
+
+    virtual boost::shared_ptr<PatchLinkProvider> makePatchLinkProvider(int source, const Region<DIM>& region)
+    {
+        return boost::shared_ptr<PatchLinkProvider>(
+            new PatchLinkProvider(
+                region,
+                registry->channel(source, rank, region)));
+    }
+};
+
+}
+
+#endif
+#endif
@@ -34,7 +34,7 @@ public:
     typedef typename PATCH_LINK<GridType>::Accepter PatchLinkAccepter;
     typedef typename PATCH_LINK<GridType>::Provider PatchLinkProvider;
     typedef boost::shared_ptr<PatchLink> PatchLinkPtr;
-    typedef PartitionManager<Topology> PartitionManagerType;
+    typedef typename StepperType::PartitionManagerType PartitionManagerType;
     typedef typename PartitionManagerType::RegionVecMap RegionVecMap;
     typedef typename StepperType::PatchAccepterVec PatchAccepterVec;
     typedef typename StepperType::PatchProviderVec PatchProviderVec;
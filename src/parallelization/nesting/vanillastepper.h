@@ -1,7 +1,9 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 
+#include <libgeodecomp/misc/scheduletuner.h>
 #include <libgeodecomp/parallelization/nesting/commonstepper.h>
+#include <libgeodecomp/storage/activitytracker.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
 namespace LibGeoDecomp {
@@ -13,6 +15,12 @@ namespace LibGeoDecomp {
  * calculation and support wide halos (halos = ghostzones). Ghost
  * zones of width k mean that synchronization only needs to be done
  * every k'th (nano) step.
+ *
+ * For models with activity tracking (see
+ * APITraits::HasActivityTracking) the stepper skips quiescent cells
+ * in the inner set. Cells near the rim are always updated, as their
+ * neighbors may be altered by ghost zone updates and patches from
+ * other nodes.
  */
 template<typename CELL_TYPE, typename CONCURRENCY_SPEC>
 class VanillaStepper : public CommonStepper<CELL_TYPE>
@@ -28,7 +36,8 @@ public:
 
     typedef class CommonStepper<CELL_TYPE> ParentType;
     typedef typename ParentType::GridType GridType;
-    typedef PartitionManager<Topology> PartitionManagerType;
+    typedef typename Stepper<CELL_TYPE>::PartitionManagerType PartitionManagerType;
+    typedef typename Stepper<CELL_TYPE>::Stencil Stencil;
     typedef PatchBufferFixed<GridType, GridType, 1> PatchBufferType1;
     typedef PatchBufferFixed<GridType, GridType, 2> PatchBufferType2;
     typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
@@ -80,28 +89,55 @@ public:
             innerSetPatchAccepters,
             ghostZonePatchProviders,
             innerSetPatchProviders,
-            enableFineGrainedParallelism)
+            enableFineGrainedParallelism),
+        activityTracker(partitionManager->getSimulationArea())
     {
+        // rim(0) is the largest of the rims:
+        alwaysActive = rim(0).expandWithStencil(
+            1,
+            partitionManager->getSimulationArea(),
+            Topology(),
+            Stencil());
         initGrids();
     }
 
+    /**
+     * Lets the stepper tune the threading of its inner set updates
+     * while it's running (see ScheduleTuner). Ghost zone updates are
+     * left alone as they're too small to yield reliable timings.
+     */
+    void enableScheduleTuning(unsigned period = 1000, unsigned samples = 2, double hysteresis = 0.05)
+    {
+        scheduleTuner.reset(new ScheduleTuner(
+                                period,
+                                samples,
+                                hysteresis,
+                                ScheduleTuner::Candidate(true, false, enableFineGrainedParallelism)));
+    }
+
 private:
+    boost::shared_ptr<ScheduleTuner> scheduleTuner;
+    ActivityTracker<CELL_TYPE> activityTracker;
+    Region<DIM> alwaysActive;
+
     inline void update1()
     {
         TimeTotal t(&chronometer);
         unsigned index = ghostZoneWidth() - --validGhostZoneWidth;
         const Region<DIM>& region = innerSet(index);
+        double computeTime = chronometer.template interval<TimeComputeInner>();
         {
             TimeComputeInner t(&chronometer);
 
-            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+            CONCURRENCY_SPEC concurrencySpec(false, enableFineGrainedParallelism);
+            if (scheduleTuner) {
+                concurrencySpec = scheduleTuner->current().template concurrencySpec<CONCURRENCY_SPEC>();
+            }
+
+            updateInnerSet(
                 region,
-                Coord<DIM>(),
-                Coord<DIM>(),
-                *oldGrid,
-                &*newGrid,
-                curNanoStep,
-                CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
+                concurrencySpec,
+                typename APITraits::SelectActivityTracking<CELL_TYPE>::Value());
             std::swap(oldGrid, newGrid);
 
             ++curNanoStep;
@@ -110,6 +146,9 @@ private:
                 ++curStep;
             }
         }
+        if (scheduleTuner) {
+            scheduleTuner->report(chronometer.template interval<TimeComputeInner>() - computeTime);
+        }
 
         notifyPatchAccepters(innerSet(ghostZoneWidth()), ParentType::INNER_SET, globalNanoStep());
 
@@ -120,9 +159,59 @@ private:
 
         index = ghostZoneWidth() - validGhostZoneWidth;
         const Region<DIM>& nextRegion = innerSet(index);
+        activateIfPatchesPending(globalNanoStep());
         notifyPatchProviders(nextRegion, ParentType::INNER_SET, globalNanoStep());
     }
 
+    inline void updateInnerSet(
+        const Region<DIM>& region,
+        const CONCURRENCY_SPEC& concurrencySpec,
+        APITraits::FalseType)
+    {
+        UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+            region,
+            Coord<DIM>(),
+            Coord<DIM>(),
+            *oldGrid,
+            &*newGrid,
+            curNanoStep,
+            concurrencySpec);
+    }
+
+    inline void updateInnerSet(
+        const Region<DIM>& region,
+        const CONCURRENCY_SPEC& concurrencySpec,
+        APITraits::TrueType)
+    {
+        Region<DIM> activeRegion = activityTracker.select(region) + (region & alwaysActive);
+        activityTracker.carryOver(activeRegion, *oldGrid, &*newGrid);
+        UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+            activeRegion,
+            Coord<DIM>(),
+            Coord<DIM>(),
+            *oldGrid,
+            &*newGrid,
+            curNanoStep,
+            concurrencySpec);
+        activityTracker.record(activeRegion, *newGrid);
+    }
+
+    /**
+     * Inner set patches (e.g. from Steerers) may alter any cell, so
+     * activity tracking has to start from scratch.
+     */
+    inline void activateIfPatchesPending(std::size_t nanoStep)
+    {
+        for (typename ParentType::PatchProviderList::iterator i =
+                 patchProviders[ParentType::INNER_SET].begin();
+             i != patchProviders[ParentType::INNER_SET].end();
+             ++i) {
+            if (nanoStep == (*i)->nextAvailableNanoStep()) {
+                activityTracker.activateAll();
+            }
+        }
+    }
+
     inline void initGrids()
     {
         initGridsCommon();
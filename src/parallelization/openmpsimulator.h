@@ -6,7 +6,10 @@
 
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/scheduletuner.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
+#include <libgeodecomp/storage/activitytracker.h>
+#include <libgeodecomp/storage/firsttouch.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
@@ -14,7 +17,8 @@ namespace LibGeoDecomp {
 
 /**
  * OpenMPSimulator is based on SerialSimulator, but is capable of
- * threading via OpenMP.
+ * threading via OpenMP. Just like the SerialSimulator it supports
+ * activity tracking (see APITraits::HasActivityTracking).
  */
 template<typename CELL_TYPE>
 class OpenMPSimulator : public MonolithicSimulator<CELL_TYPE>
@@ -41,23 +45,40 @@ public:
 
     /**
      * creates a OpenMPSimulator with the given initializer.
+     *
+     * enableFirstTouch makes the simulator allocate and initialize
+     * its grids in parallel and switches the update to a static
+     * schedule, so that each thread works on memory which is local
+     * to its NUMA node (see FirstTouch). As the Initializer itself
+     * runs serially, its output is staged in a temporary grid and
+     * then copied in parallel.
+     *
+     * enableStaticScheduling requests a static OpenMP schedule
+     * without first touch placement. Static schedules carry less
+     * overhead, dynamic ones cope better with imbalanced updates.
      */
     explicit OpenMPSimulator(
         Initializer<CELL_TYPE> *initializer,
-        bool enableFineGrainedParallelism = false) :
+        bool enableFineGrainedParallelism = false,
+        bool enableFirstTouch = false,
+        bool enableStaticScheduling = false) :
         MonolithicSimulator<CELL_TYPE>(initializer),
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
+        enableFineGrainedParallelism(enableFineGrainedParallelism),
+        enableFirstTouch(enableFirstTouch),
+        enableStaticScheduling(enableStaticScheduling || enableFirstTouch),
+        activityTracker(initializer->gridDimensions())
     {
         stepNum = initializer->startStep();
         Coord<DIM> dim = initializer->gridBox().dimensions;
-        curGrid = new GridType(CoordBox<DIM>(Coord<DIM>(), dim));
-        newGrid = new GridType(CoordBox<DIM>(Coord<DIM>(), dim));
-        initializer->grid(curGrid);
-        initializer->grid(newGrid);
+        CoordBox<DIM> box(Coord<DIM>(), dim);
+        curGrid = new GridType(box, CELL_TYPE(), CELL_TYPE(), Coord<DIM>(), enableFirstTouch);
+        newGrid = new GridType(box, CELL_TYPE(), CELL_TYPE(), Coord<DIM>(), enableFirstTouch);
 
         // fixme: refactor OpenMPSimulator, serialsim, cudasim to reduce code duplication
-        CoordBox<DIM> box = curGrid->boundingBox();
-        simArea << box;
+        simArea << curGrid->boundingBox();
+
+        initGrid(curGrid);
+        initGrid(newGrid);
     }
 
     virtual ~OpenMPSimulator()
@@ -81,20 +102,41 @@ public:
 
         handleInput(STEERER_NEXT_STEP, feedback);
 
+        double computeTime = chronometer.template interval<TimeCompute>();
         for (unsigned i = 0; i < NANO_STEPS; ++i) {
             nanoStep(i);
         }
+        if (scheduleTuner) {
+            scheduleTuner->report(chronometer.template interval<TimeCompute>() - computeTime);
+        }
 
         ++stepNum;
         handleOutput(WRITER_STEP_FINISHED);
     }
 
+    /**
+     * Lets the simulator pick its OpenMP schedule on its own while
+     * it's running, see ScheduleTuner. This overrides the scheduling
+     * and fine grained parallelism flags given to the constructor,
+     * except that first touch placement still pins the schedule to
+     * static (as threads would otherwise leave their NUMA nodes).
+     */
+    void enableScheduleTuning(unsigned period = 1000, unsigned samples = 2, double hysteresis = 0.05)
+    {
+        scheduleTuner.reset(new ScheduleTuner(
+                                period,
+                                samples,
+                                hysteresis,
+                                ScheduleTuner::Candidate(enableStaticScheduling, false, enableFineGrainedParallelism)));
+    }
+
     /**
      * continue simulating until the maximum number of steps is reached.
      */
     virtual void run()
     {
-        initializer->grid(curGrid);
+        initGrid(curGrid);
+        activityTracker.activateAll();
         stepNum = initializer->startStep();
         setIORegions();
 
@@ -127,11 +169,38 @@ protected:
     GridType *newGrid;
     Region<DIM> simArea;
     bool enableFineGrainedParallelism;
+    bool enableFirstTouch;
+    bool enableStaticScheduling;
+    boost::shared_ptr<ScheduleTuner> scheduleTuner;
+    ActivityTracker<CELL_TYPE> activityTracker;
 
     void nanoStep(const unsigned& nanoStep)
     {
         TimeCompute t(&chronometer);
 
+        // first touch placement only pays off if threads stick to
+        // their planes, hence static scheduling:
+        UpdateFunctorHelpers::ConcurrencyEnableOpenMP concurrencySpec(
+            !enableStaticScheduling, enableFineGrainedParallelism);
+        if (scheduleTuner) {
+            ScheduleTuner::Candidate candidate = scheduleTuner->current();
+            candidate.staticScheduling |= enableFirstTouch;
+            candidate.streakGranularity &= !enableFirstTouch;
+            concurrencySpec = candidate.concurrencySpec<UpdateFunctorHelpers::ConcurrencyEnableOpenMP>();
+        }
+
+        update(
+            nanoStep,
+            concurrencySpec,
+            typename APITraits::SelectActivityTracking<CELL_TYPE>::Value());
+        std::swap(curGrid, newGrid);
+    }
+
+    void update(
+        const unsigned& nanoStep,
+        const UpdateFunctorHelpers::ConcurrencyEnableOpenMP& concurrencySpec,
+        APITraits::FalseType)
+    {
         UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
             simArea,
             Coord<DIM>(),
@@ -139,8 +208,38 @@ protected:
             *curGrid,
             newGrid,
             nanoStep,
-            UpdateFunctorHelpers::ConcurrencyEnableOpenMP(true, enableFineGrainedParallelism));
-        std::swap(curGrid, newGrid);
+            concurrencySpec);
+    }
+
+    void update(
+        const unsigned& nanoStep,
+        const UpdateFunctorHelpers::ConcurrencyEnableOpenMP& concurrencySpec,
+        APITraits::TrueType)
+    {
+        Region<DIM> region = activityTracker.select(simArea);
+        activityTracker.carryOver(region, *curGrid, newGrid);
+        UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
+            region,
+            Coord<DIM>(),
+            Coord<DIM>(),
+            *curGrid,
+            newGrid,
+            nanoStep,
+            concurrencySpec);
+        activityTracker.record(region, *newGrid);
+    }
+
+    void initGrid(GridType *grid)
+    {
+        if (!enableFirstTouch) {
+            initializer->grid(grid);
+            return;
+        }
+
+        GridType buffer(grid->boundingBox());
+        initializer->grid(&buffer);
+        grid->setEdge(buffer.getEdge());
+        FirstTouch::copy<CELL_TYPE, DIM>(buffer, grid, simArea);
     }
 
     /**
@@ -172,6 +271,8 @@ protected:
             if ((event != STEERER_NEXT_STEP) ||
                 (stepNum % steerers[i]->getPeriod() == 0)) {
                 steerers[i]->nextStep(curGrid, simArea, gridDim, getStep(), event, 0, true, feedback);
+                // the steerer may have modified any cell:
+                activityTracker.activateAll();
             }
         }
         // fixme: apply SteererFeedback!
@@ -7,9 +7,14 @@
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
+#include <libgeodecomp/storage/activitytracker.h>
+#include <libgeodecomp/storage/amrgrid.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
+#include <boost/shared_ptr.hpp>
+#include <stdexcept>
+
 namespace LibGeoDecomp {
 
 /**
@@ -18,6 +23,15 @@ namespace LibGeoDecomp {
  * purpose is to make fostering new applications easier. The absence
  * of concurrency simplifies debugging. As its name implies, it
  * doesn't do any threading, but vectorization (SIMD) is supported.
+ *
+ * Models which flag APITraits::HasActivityTracking will only have
+ * those cells updated whose neighborhood changed (see
+ * ActivityTracker).
+ *
+ * Models which flag APITraits::HasAdaptiveMeshRefinement are stored
+ * in an AMRGrid instead. Writers and getGrid() see its coarsest
+ * level, which is synchronized after each step. Steerers and
+ * activity tracking are not supported for such models yet.
  */
 template<typename CELL_TYPE>
 class SerialSimulator : public MonolithicSimulator<CELL_TYPE>
@@ -30,6 +44,8 @@ public:
     typedef typename APITraits::SelectSoA<CELL_TYPE>::Value SupportsSoA;
     typedef typename GridTypeSelector<CELL_TYPE, Topology, false, SupportsSoA>::Value GridType;
     typedef typename Steerer<CELL_TYPE>::SteererFeedback SteererFeedback;
+    typedef typename APITraits::SelectAdaptiveMeshRefinement<CELL_TYPE>::Value SupportsAMR;
+    typedef AMRGrid<CELL_TYPE> AMRGridType;
 
     static const int DIM = Topology::DIM;
 
@@ -46,7 +62,8 @@ public:
      * creates a SerialSimulator with the given initializer.
      */
     explicit SerialSimulator(Initializer<CELL_TYPE> *initializer) :
-        MonolithicSimulator<CELL_TYPE>(initializer)
+        MonolithicSimulator<CELL_TYPE>(initializer),
+        activityTracker(initializer->gridDimensions())
     {
         stepNum = initializer->startStep();
         Coord<DIM> dim = initializer->gridBox().dimensions;
@@ -54,6 +71,7 @@ public:
         newGrid = new GridType(CoordBox<DIM>(Coord<DIM>(), dim));
         initializer->grid(curGrid);
         initializer->grid(newGrid);
+        initAMRGrid(SupportsAMR());
 
         // fixme: refactor serialsim, cudasim to reduce code duplication
         CoordBox<DIM> box = curGrid->boundingBox();
@@ -86,6 +104,7 @@ public:
         }
 
         ++stepNum;
+        regrid(SupportsAMR());
         handleOutput(WRITER_STEP_FINISHED);
     }
 
@@ -95,6 +114,8 @@ public:
     virtual void run()
     {
         initializer->grid(curGrid);
+        initAMRGrid(SupportsAMR());
+        activityTracker.activateAll();
         stepNum = initializer->startStep();
         setIORegions();
 
@@ -122,19 +143,94 @@ public:
         return curGrid;
     }
 
+    virtual void addSteerer(Steerer<CELL_TYPE> *steerer)
+    {
+        if (SupportsAMR()) {
+            delete steerer;
+            throw std::logic_error("SerialSimulator doesn't support Steerers for models with adaptive mesh refinement yet");
+        }
+
+        MonolithicSimulator<CELL_TYPE>::addSteerer(steerer);
+    }
+
 protected:
     GridType *curGrid;
     GridType *newGrid;
     Region<DIM> simArea;
+    ActivityTracker<CELL_TYPE> activityTracker;
+    boost::shared_ptr<AMRGridType> amrGrid;
 
     void nanoStep(const unsigned& nanoStep)
     {
         TimeCompute t(&chronometer);
 
-        UpdateFunctor<CELL_TYPE>()(simArea, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
+        updateGrids(nanoStep, SupportsAMR());
+    }
+
+    void updateGrids(const unsigned& nanoStep, APITraits::FalseType /* supportsAMR */)
+    {
+        update(nanoStep, typename APITraits::SelectActivityTracking<CELL_TYPE>::Value());
         std::swap(curGrid, newGrid);
     }
 
+    void updateGrids(const unsigned& nanoStep, APITraits::TrueType /* supportsAMR */)
+    {
+        amrGrid->update(nanoStep);
+    }
+
+    void update(const unsigned& nanoStep, APITraits::FalseType)
+    {
+        UpdateFunctor<CELL_TYPE>()(simArea, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
+    }
+
+    void update(const unsigned& nanoStep, APITraits::TrueType)
+    {
+        Region<DIM> region = activityTracker.select(simArea);
+        activityTracker.carryOver(region, *curGrid, newGrid);
+        UpdateFunctor<CELL_TYPE>()(region, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
+        activityTracker.record(region, *newGrid);
+    }
+
+    void initAMRGrid(APITraits::FalseType)
+    {}
+
+    /**
+     * Sets up the coarsest level from curGrid and refines it as far
+     * as the model's criterion asks for.
+     */
+    void initAMRGrid(APITraits::TrueType)
+    {
+        typedef typename CELL_TYPE::API API;
+
+        amrGrid.reset(new AMRGridType(
+                          initializer->gridDimensions(),
+                          Coord<DIM>::diagonal(API::AMR_BLOCK_WIDTH),
+                          API::AMR_MAX_LEVEL,
+                          API::AMR_RATIO,
+                          curGrid->getEdge()));
+        amrGrid->load(*curGrid);
+
+        // each regrid() adds at most one level:
+        for (int i = 0; i < amrGrid->getMaxLevel(); ++i) {
+            amrGrid->regrid();
+        }
+        amrGrid->save(curGrid);
+    }
+
+    void regrid(APITraits::FalseType)
+    {}
+
+    void regrid(APITraits::TrueType)
+    {
+        TimeCompute t(&chronometer);
+
+        const int period = CELL_TYPE::API::AMR_REGRID_PERIOD;
+        if ((period > 0) && ((stepNum % period) == 0)) {
+            amrGrid->regrid();
+        }
+        amrGrid->save(curGrid);
+    }
+
     /**
      * notifies all registered Writers
      */
@@ -172,6 +268,8 @@ protected:
                     0,
                     true,
                     feedback);
+                // the steerer may have modified any cell:
+                activityTracker.activateAll();
             }
         }
         // fixme: apply SteererFeedback!
@@ -0,0 +1,7 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hiparsimulatortest.h
+  ${RELATIVE_PATH}stripingsimulatortest.h
+)
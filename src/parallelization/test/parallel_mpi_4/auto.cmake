@@ -0,0 +1,12 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hiparsimulationfactorytest.cpp
+  ${RELATIVE_PATH}hiparsimulatortest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}stripingsimulatortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hiparsimulationfactorytest.h
+  ${RELATIVE_PATH}hiparsimulatortest.h
+  ${RELATIVE_PATH}stripingsimulatortest.h
+)
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulationFactoryTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulationfactorytest.h"
+
+static HiParSimulationFactoryTest suite_HiParSimulationFactoryTest;
+
+static CxxTest::List Tests_HiParSimulationFactoryTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulationFactoryTest( "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulationfactorytest.h", 14, "HiParSimulationFactoryTest", suite_HiParSimulationFactoryTest, Tests_HiParSimulationFactoryTest );
+
+static class TestDescription_suite_HiParSimulationFactoryTest_testParametersSelectPartition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulationFactoryTest_testParametersSelectPartition() : CxxTest::RealTestDescription( Tests_HiParSimulationFactoryTest, suiteDescription_HiParSimulationFactoryTest, 32, "testParametersSelectPartition" ) {}
+ void runTest() { suite_HiParSimulationFactoryTest.testParametersSelectPartition(); }
+} testDescription_suite_HiParSimulationFactoryTest_testParametersSelectPartition;
+
+static class TestDescription_suite_HiParSimulationFactoryTest_testFitnessIsConsistentAcrossRanks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulationFactoryTest_testFitnessIsConsistentAcrossRanks() : CxxTest::RealTestDescription( Tests_HiParSimulationFactoryTest, suiteDescription_HiParSimulationFactoryTest, 57, "testFitnessIsConsistentAcrossRanks" ) {}
+ void runTest() { suite_HiParSimulationFactoryTest.testFitnessIsConsistentAcrossRanks(); }
+} testDescription_suite_HiParSimulationFactoryTest_testFitnessIsConsistentAcrossRanks;
+
+static class TestDescription_suite_HiParSimulationFactoryTest_testProbingKeepsRanksInLockstep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulationFactoryTest_testProbingKeepsRanksInLockstep() : CxxTest::RealTestDescription( Tests_HiParSimulationFactoryTest, suiteDescription_HiParSimulationFactoryTest, 74, "testProbingKeepsRanksInLockstep" ) {}
+ void runTest() { suite_HiParSimulationFactoryTest.testProbingKeepsRanksInLockstep(); }
+} testDescription_suite_HiParSimulationFactoryTest_testProbingKeepsRanksInLockstep;
+
@@ -0,0 +1,94 @@
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/io/varstepinitializerproxy.h>
+#include <libgeodecomp/misc/hiparsimulationfactory.h>
+#include <libgeodecomp/misc/testcell.h>
+
+#include <boost/shared_ptr.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class HiParSimulationFactoryTest : public CxxTest::TestSuite
+{
+public:
+    typedef HiParSimulationFactory<TestCell<2> > FactoryType;
+
+    void setUp()
+    {
+        initializer.reset(new VarStepInitializerProxy<TestCell<2> >(
+                              new TestInitializer<TestCell<2> >(Coord<2>(64, 48), 20)));
+        factory.reset(new FactoryType(initializer.get()));
+    }
+
+    void tearDown()
+    {
+        factory.reset();
+        initializer.reset();
+    }
+
+    void testParametersSelectPartition()
+    {
+        SimulationParameters& params = factory->parameters();
+        params["GhostZoneWidth"].setValue(2);
+        params["LoadBalancingPeriod"].setValue(9);
+
+        params["Partition"].setValue(0);
+        boost::shared_ptr<Simulator<TestCell<2> > > sim((*factory)());
+        TS_ASSERT((dynamic_cast<HiParSimulator<TestCell<2>, ZCurvePartition<2> >*>(sim.get())));
+
+        params["Partition"].setValue(1);
+        sim.reset((*factory)());
+        TS_ASSERT((dynamic_cast<HiParSimulator<TestCell<2>, StripingPartition<2> >*>(sim.get())));
+
+        params["Partition"].setValue(2);
+        sim.reset((*factory)());
+        TS_ASSERT((dynamic_cast<HiParSimulator<TestCell<2>, RecursiveBisectionPartition<2> >*>(sim.get())));
+
+        params["Partition"].setValue(3);
+        sim.reset((*factory)());
+        TS_ASSERT((dynamic_cast<HiParSimulator<TestCell<2>, CheckerboardingPartition<2> >*>(sim.get())));
+        sim->run();
+        TS_ASSERT_EQUALS(unsigned(20), sim->getStep());
+    }
+
+    void testFitnessIsConsistentAcrossRanks()
+    {
+        SimulationParameters params = factory->parameters();
+
+        for (int partition = 0; partition < 4; ++partition) {
+            params["Partition"].setValue(partition);
+            params["GhostZoneWidth"].setValue(partition);
+
+            double fitness = (*factory)(params);
+            TS_ASSERT(fitness < 0);
+            std::vector<double> fitnesses = MPILayer().allGather(fitness);
+            for (std::size_t i = 1; i < fitnesses.size(); ++i) {
+                TS_ASSERT_EQUALS(fitnesses[0], fitnesses[i]);
+            }
+        }
+    }
+
+    void testProbingKeepsRanksInLockstep()
+    {
+        // a tiny tolerance would let ranks stop sampling at
+        // different times if they decided on their own:
+        factory->setProbeSettings(FactoryType::ProbeSettings(1, 2, 10, 0.01));
+        double fitness = (*factory)(factory->parameters());
+
+        std::vector<double> fitnesses = MPILayer().allGather(fitness);
+        std::vector<unsigned> samples = MPILayer().allGather(factory->lastProbe().samples);
+        for (std::size_t i = 1; i < fitnesses.size(); ++i) {
+            TS_ASSERT_EQUALS(fitnesses[0], fitnesses[i]);
+            TS_ASSERT_EQUALS(samples[0], samples[i]);
+        }
+    }
+
+private:
+    boost::shared_ptr<VarStepInitializerProxy<TestCell<2> > > initializer;
+    boost::shared_ptr<FactoryType> factory;
+};
+
+}
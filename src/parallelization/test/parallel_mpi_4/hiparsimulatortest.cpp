@@ -0,0 +1,146 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulatortest.h"
+
+static HiParSimulatorTest suite_HiParSimulatorTest;
+
+static CxxTest::List Tests_HiParSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulatortest.h", 65, "HiParSimulatorTest", suite_HiParSimulatorTest, Tests_HiParSimulatorTest );
+
+static class TestDescription_suite_HiParSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 107, "testStep" ) {}
+ void runTest() { suite_HiParSimulatorTest.testStep(); }
+} testDescription_suite_HiParSimulatorTest_testStep;
+
+static class TestDescription_suite_HiParSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 140, "testRun" ) {}
+ void runTest() { suite_HiParSimulatorTest.testRun(); }
+} testDescription_suite_HiParSimulatorTest_testRun;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 174, "testSteererCallback" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererCallback(); }
+} testDescription_suite_HiParSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 198, "testSteererFunctionalityBasic" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionalityBasic(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 214, "testSteererFunctionality2DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 233, "testSteererFunctionality2DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 252, "testSteererFunctionality2DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 271, "testSteererFunctionality2DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 290, "testSteererFunctionality2DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 309, "testSteererFunctionality2DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 328, "testSteererFunctionality3DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 347, "testSteererFunctionality3DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 366, "testSteererFunctionality3DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 385, "testSteererFunctionality3DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 404, "testSteererFunctionality3DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 423, "testSteererFunctionality3DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 442, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_HiParSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_HiParSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCell() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 496, "testNonPoDCell" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCell(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCell;
+
+static class TestDescription_suite_HiParSimulatorTest_testIO : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testIO() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 512, "testIO" ) {}
+ void runTest() { suite_HiParSimulatorTest.testIO(); }
+} testDescription_suite_HiParSimulatorTest_testIO;
+
@@ -0,0 +1,165 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelStripingSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_4/stripingsimulatortest.h"
+
+static ParallelStripingSimulatorTest suite_ParallelStripingSimulatorTest;
+
+static CxxTest::List Tests_ParallelStripingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelStripingSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_4/stripingsimulatortest.h", 36, "ParallelStripingSimulatorTest", suite_ParallelStripingSimulatorTest, Tests_ParallelStripingSimulatorTest );
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testGhostHeight : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testGhostHeight() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 71, "testGhostHeight" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testGhostHeight(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testGhostHeight;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testNeighbors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testNeighbors() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 86, "testNeighbors" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testNeighbors(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testNeighbors;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testInitRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testInitRegions() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 106, "testInitRegions" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testInitRegions(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testInitRegions;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 136, "testStep" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testStep(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testStep;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 165, "testRun" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRun(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRun;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testEveryN1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testEveryN1() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 209, "testEveryN1" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testEveryN1(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testEveryN1;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testEveryN7 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testEveryN7() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 214, "testEveryN7" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testEveryN7(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testEveryN7;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid1() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 219, "testRedistributeGrid1" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRedistributeGrid1(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid1;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid2() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 240, "testRedistributeGrid2" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRedistributeGrid2(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid2;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid3() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 280, "testRedistributeGrid3" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRedistributeGrid3(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid3;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid4() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 286, "testRedistributeGrid4" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRedistributeGrid4(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid4;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid5() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 292, "testRedistributeGrid5" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testRedistributeGrid5(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testRedistributeGrid5;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad1() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 362, "testBalanceLoad1" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testBalanceLoad1(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad1;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad2() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 367, "testBalanceLoad2" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testBalanceLoad2(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad2;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad3() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 372, "testBalanceLoad3" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testBalanceLoad3(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad3;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad4() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 377, "testBalanceLoad4" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testBalanceLoad4(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testBalanceLoad4;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testLoadGathering : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testLoadGathering() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 382, "testLoadGathering" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testLoadGathering(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testLoadGathering;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testEmptyBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testEmptyBalancer() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 393, "testEmptyBalancer" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testEmptyBalancer(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testEmptyBalancer;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 407, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_test3Dsimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_test3Dsimple() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 435, "test3Dsimple" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.test3Dsimple(); }
+} testDescription_suite_ParallelStripingSimulatorTest_test3Dsimple;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_test3Dadvanced : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_test3Dadvanced() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 444, "test3Dadvanced" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.test3Dadvanced(); }
+} testDescription_suite_ParallelStripingSimulatorTest_test3Dadvanced;
+
+static class TestDescription_suite_ParallelStripingSimulatorTest_testSteererFunctionality : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelStripingSimulatorTest_testSteererFunctionality() : CxxTest::RealTestDescription( Tests_ParallelStripingSimulatorTest, suiteDescription_ParallelStripingSimulatorTest, 453, "testSteererFunctionality" ) {}
+ void runTest() { suite_ParallelStripingSimulatorTest.testSteererFunctionality(); }
+} testDescription_suite_ParallelStripingSimulatorTest_testSteererFunctionality;
+
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CacheBlockingSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h"
+
+static CacheBlockingSimulatorTest suite_CacheBlockingSimulatorTest;
+
+static CxxTest::List Tests_CacheBlockingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CacheBlockingSimulatorTest( "/root/repo/src/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h", 15, "CacheBlockingSimulatorTest", suite_CacheBlockingSimulatorTest, Tests_CacheBlockingSimulatorTest );
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testPipelinedUpdate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testPipelinedUpdate() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 29, "testPipelinedUpdate" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testPipelinedUpdate(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testPipelinedUpdate;
+
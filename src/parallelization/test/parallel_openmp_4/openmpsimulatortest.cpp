@@ -0,0 +1,134 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OpenMPSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h"
+
+static OpenMPSimulatorTest suite_OpenMPSimulatorTest;
+
+static CxxTest::List Tests_OpenMPSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OpenMPSimulatorTest( "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h", 18, "OpenMPSimulatorTest", suite_OpenMPSimulatorTest, Tests_OpenMPSimulatorTest );
+
+static class TestDescription_suite_OpenMPSimulatorTest_testInitialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testInitialization() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 43, "testInitialization" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testInitialization(); }
+} testDescription_suite_OpenMPSimulatorTest_testInitialization;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 50, "testStep" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testStep(); }
+} testDescription_suite_OpenMPSimulatorTest_testStep;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 61, "testRun" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRun(); }
+} testDescription_suite_OpenMPSimulatorTest_testRun;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testWriterInvocation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 71, "testWriterInvocation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testWriterInvocation(); }
+} testDescription_suite_OpenMPSimulatorTest_testWriterInvocation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testDeleteInitializer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testDeleteInitializer() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 78, "testDeleteInitializer" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testDeleteInitializer(); }
+} testDescription_suite_OpenMPSimulatorTest_testDeleteInitializer;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRegisterWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRegisterWriter() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 89, "testRegisterWriter" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRegisterWriter(); }
+} testDescription_suite_OpenMPSimulatorTest_testRegisterWriter;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 98, "testOpenMPSimulatorShouldCallBackWriter" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testOpenMPSimulatorShouldCallBackWriter(); }
+} testDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 116, "testRunMustResetGridPriorToSimulation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRunMustResetGridPriorToSimulation(); }
+} testDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_test3D() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 148, "test3D" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.test3D(); }
+} testDescription_suite_OpenMPSimulatorTest_test3D;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 163, "testSteererCallback" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSteererCallback(); }
+} testDescription_suite_OpenMPSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 185, "testSteererCanTerminateSimulation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSteererCanTerminateSimulation(); }
+} testDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSoA() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 201, "testSoA" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSoA(); }
+} testDescription_suite_OpenMPSimulatorTest_testSoA;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testFirstTouch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testFirstTouch() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 217, "testFirstTouch" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testFirstTouch(); }
+} testDescription_suite_OpenMPSimulatorTest_testFirstTouch;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testFirstTouchSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testFirstTouchSoA() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 229, "testFirstTouchSoA" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testFirstTouchSoA(); }
+} testDescription_suite_OpenMPSimulatorTest_testFirstTouchSoA;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testScheduleTuning : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testScheduleTuning() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 242, "testScheduleTuning" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testScheduleTuning(); }
+} testDescription_suite_OpenMPSimulatorTest_testScheduleTuning;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testScheduleTuningSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testScheduleTuningSoA() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 258, "testScheduleTuningSoA" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testScheduleTuningSoA(); }
+} testDescription_suite_OpenMPSimulatorTest_testScheduleTuningSoA;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testActivityTracking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testActivityTracking() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 268, "testActivityTracking" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testActivityTracking(); }
+} testDescription_suite_OpenMPSimulatorTest_testActivityTracking;
+
@@ -8,6 +8,7 @@
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/io/teststeerer.h>
 #include <libgeodecomp/io/testwriter.h>
+#include <libgeodecomp/misc/fronttestcell.h>
 #include <libgeodecomp/parallelization/openmpsimulator.h>
 
 using namespace LibGeoDecomp;
@@ -213,6 +214,80 @@ public:
         TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 21 * NANO_STEPS_3D);
     }
 
+    void testFirstTouch()
+    {
+        OpenMPSimulator<TestCell<2> > sim(createInitializer(), false, true);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), startStep * NANO_STEPS_2D);
+
+        sim.step();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), (startStep + 1) * NANO_STEPS_2D);
+
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), init->maxSteps() * NANO_STEPS_2D);
+    }
+
+    void testFirstTouchSoA()
+    {
+        typedef GridBase<TestCellSoA, 3> GridBaseType;
+        OpenMPSimulator<TestCellSoA> sim(new TestInitializer<TestCellSoA>(), false, true);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 0);
+
+        sim.step();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), NANO_STEPS_3D);
+
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 21 * NANO_STEPS_3D);
+    }
+
+    void testScheduleTuning()
+    {
+        OpenMPSimulator<TestCell<2> > sim(createInitializer());
+        sim.enableScheduleTuning(3, 1);
+        TS_ASSERT(sim.scheduleTuner->tuning());
+
+        for (int i = 0; i < 8; ++i) {
+            sim.step();
+            TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), (startStep + 1 + i) * NANO_STEPS_2D);
+        }
+        TS_ASSERT(!sim.scheduleTuner->tuning());
+
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), init->maxSteps() * NANO_STEPS_2D);
+    }
+
+    void testScheduleTuningSoA()
+    {
+        typedef GridBase<TestCellSoA, 3> GridBaseType;
+        OpenMPSimulator<TestCellSoA> sim(new TestInitializer<TestCellSoA>());
+        sim.enableScheduleTuning(2, 1);
+
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 21 * NANO_STEPS_3D);
+    }
+
+    void testActivityTracking()
+    {
+        typedef FrontTestCell<> ReferenceCell;
+        typedef FrontTestCell<APITraits::HasActivityTracking> TrackedCell;
+        OpenMPSimulator<ReferenceCell> reference(new ReferenceCell::Initializer());
+        OpenMPSimulator<TrackedCell> tracked(new TrackedCell::Initializer());
+        CoordBox<2> box = tracked.getGrid()->boundingBox();
+        Region<2> simArea;
+        simArea << box;
+
+        for (int t = 0; t < 20; ++t) {
+            reference.step();
+            tracked.step();
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, tracked.getGrid()->get(*i).value);
+            }
+        }
+
+        // all fronts have died out by now:
+        TS_ASSERT(tracked.activityTracker.select(simArea).empty());
+    }
+
 private:
     boost::shared_ptr<MockWriter<>::EventsStore> events;
     boost::shared_ptr<OpenMPSimulator<TestCell<2> > > simulator;
@@ -0,0 +1,146 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AutotuningSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h"
+
+static AutotuningSimulatorTest suite_AutotuningSimulatorTest;
+
+static CxxTest::List Tests_AutotuningSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AutotuningSimulatorTest( "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h", 84, "AutotuningSimulatorTest", suite_AutotuningSimulatorTest, Tests_AutotuningSimulatorTest );
+
+static class TestDescription_suite_AutotuningSimulatorTest_testBasicPatternOptimized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testBasicPatternOptimized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 96, "testBasicPatternOptimized" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testBasicPatternOptimized(); }
+} testDescription_suite_AutotuningSimulatorTest_testBasicPatternOptimized;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testNormalizeSteps : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testNormalizeSteps() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 112, "testNormalizeSteps" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testNormalizeSteps(); }
+} testDescription_suite_AutotuningSimulatorTest_testNormalizeSteps;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 143, "testBasicSimplexOptimized" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testBasicSimplexOptimized(); }
+} testDescription_suite_AutotuningSimulatorTest_testBasicSimplexOptimized;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 159, "testAddOwnSimulations" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testAddOwnSimulations(); }
+} testDescription_suite_AutotuningSimulatorTest_testAddOwnSimulations;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testManuallyParamterized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testManuallyParamterized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 182, "testManuallyParamterized" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testManuallyParamterized(); }
+} testDescription_suite_AutotuningSimulatorTest_testManuallyParamterized;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testInvalidArguments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testInvalidArguments() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 206, "testInvalidArguments" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testInvalidArguments(); }
+} testDescription_suite_AutotuningSimulatorTest_testInvalidArguments;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testAddWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testAddWriter() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 231, "testAddWriter" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testAddWriter(); }
+} testDescription_suite_AutotuningSimulatorTest_testAddWriter;
+
+static class TestDescription_suite_AutotuningSimulatorTest_testTuningCache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorTest_testTuningCache() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorTest, suiteDescription_AutotuningSimulatorTest, 245, "testTuningCache" ) {}
+ void runTest() { suite_AutotuningSimulatorTest.testTuningCache(); }
+} testDescription_suite_AutotuningSimulatorTest_testTuningCache;
+
+static SimulationFactoryTest suite_SimulationFactoryTest;
+
+static CxxTest::List Tests_SimulationFactoryTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SimulationFactoryTest( "/root/repo/src/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h", 294, "SimulationFactoryTest", suite_SimulationFactoryTest, Tests_SimulationFactoryTest );
+
+static class TestDescription_suite_SimulationFactoryTest_testVarStepInitializerProxy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testVarStepInitializerProxy() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 319, "testVarStepInitializerProxy" ) {}
+ void runTest() { suite_SimulationFactoryTest.testVarStepInitializerProxy(); }
+} testDescription_suite_SimulationFactoryTest_testVarStepInitializerProxy;
+
+static class TestDescription_suite_SimulationFactoryTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testBasic() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 345, "testBasic" ) {}
+ void runTest() { suite_SimulationFactoryTest.testBasic(); }
+} testDescription_suite_SimulationFactoryTest_testBasic;
+
+static class TestDescription_suite_SimulationFactoryTest_testCacheBlockingFitness : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testCacheBlockingFitness() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 355, "testCacheBlockingFitness" ) {}
+ void runTest() { suite_SimulationFactoryTest.testCacheBlockingFitness(); }
+} testDescription_suite_SimulationFactoryTest_testCacheBlockingFitness;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToSimulator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToSimulator() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 369, "testAddWriterToSimulator" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToSimulator(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToSimulator;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 384, "testAddWriterToSerialSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToSerialSimulationFactory(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToSerialSimulationFactory;
+
+static class TestDescription_suite_SimulationFactoryTest_testProbeStopsOnceConfident : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testProbeStopsOnceConfident() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 394, "testProbeStopsOnceConfident" ) {}
+ void runTest() { suite_SimulationFactoryTest.testProbeStopsOnceConfident(); }
+} testDescription_suite_SimulationFactoryTest_testProbeStopsOnceConfident;
+
+static class TestDescription_suite_SimulationFactoryTest_testProbeIsBounded : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testProbeIsBounded() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 408, "testProbeIsBounded" ) {}
+ void runTest() { suite_SimulationFactoryTest.testProbeIsBounded(); }
+} testDescription_suite_SimulationFactoryTest_testProbeIsBounded;
+
+static class TestDescription_suite_SimulationFactoryTest_testProbeAbortsClearlyWorseCandidates : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testProbeAbortsClearlyWorseCandidates() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 422, "testProbeAbortsClearlyWorseCandidates" ) {}
+ void runTest() { suite_SimulationFactoryTest.testProbeAbortsClearlyWorseCandidates(); }
+} testDescription_suite_SimulationFactoryTest_testProbeAbortsClearlyWorseCandidates;
+
+static class TestDescription_suite_SimulationFactoryTest_testOpenMPSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testOpenMPSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 441, "testOpenMPSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryTest.testOpenMPSimulationFactory(); }
+} testDescription_suite_SimulationFactoryTest_testOpenMPSimulationFactory;
+
+static class TestDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryTest, suiteDescription_SimulationFactoryTest, 475, "testAddWriterToCacheBlockingSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryTest.testAddWriterToCacheBlockingSimulationFactory(); }
+} testDescription_suite_SimulationFactoryTest_testAddWriterToCacheBlockingSimulationFactory;
+
@@ -6,14 +6,18 @@
 #include <libgeodecomp/io/tracingwriter.h>
 #include <libgeodecomp/io/clonableinitializer.h>
 #include <libgeodecomp/io/varstepinitializerproxy.h>
+#include <libgeodecomp/misc/openmpsimulationfactory.h>
 #include <libgeodecomp/misc/patternoptimizer.h>
 #include <libgeodecomp/misc/simplexoptimizer.h>
 #include <libgeodecomp/misc/simulationparameters.h>
 #include <libgeodecomp/misc/simulationfactory.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/tuningcache.h>
 #include <libgeodecomp/parallelization/autotuningsimulator.h>
 #include <libgeodecomp/parallelization/cacheblockingsimulator.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <boost/assign/list_of.hpp>
+#include <cstdio>
 #include <sstream>
 
 using namespace LibGeoDecomp;
@@ -238,6 +242,49 @@ public:
                 new TracingWriter<SimFabTestCell>(1, 100, 0, buf)));
         ats.run();
     }
+    void testTuningCache()
+    {
+        LOG(Logger::INFO, "AutotuningSimulatorTest::testTuningCache()")
+        std::string filename = TempFile::serial("autotuningcache");
+        // SerialSimulationFactory ignores its parameters, but it's
+        // the only one we can run quickly in a unit test:
+        SimulationParameters params;
+        params.addParameter("Dummy", 1, 50);
+
+        AutoTuningSimulator<SimFabTestCell, PatternOptimizer> ats(
+            new SimFabTestInitializer(dim, maxSteps));
+        ats.deleteAllSimulations();
+        ats.addNewSimulation("SerialSimulation", "SerialSimulation");
+        ats.setParameters(params, "SerialSimulation");
+        ats.setSimulationSteps(2);
+        ats.setTuningCache(filename);
+        ats.runTest();
+        TS_ASSERT_EQUALS(std::size_t(1), TuningCache(filename).size());
+
+        // a second job finds all results in the cache and
+        // doesn't need to search again:
+        AutoTuningSimulator<SimFabTestCell, PatternOptimizer> ats2(
+            new SimFabTestInitializer(dim, maxSteps));
+        ats2.deleteAllSimulations();
+        ats2.addNewSimulation("SerialSimulation", "SerialSimulation");
+        ats2.setParameters(params, "SerialSimulation");
+        ats2.setTuningCache(filename);
+        ats2.runTest();
+
+        std::vector<std::string> names = ats.getSimulationNames();
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            SimulationParameters expected = ats.getSimulationParameters(names[i]);
+            SimulationParameters actual = ats2.getSimulationParameters(names[i]);
+            std::vector<std::string> paramNames = expected.getNames();
+            for (std::size_t j = 0; j < paramNames.size(); ++j) {
+                TS_ASSERT_EQUALS(expected[paramNames[j]].getValue(), actual[paramNames[j]].getValue());
+            }
+        }
+        TS_ASSERT_EQUALS(ats.getBestSim(), ats2.getBestSim());
+
+        std::remove(filename.c_str());
+    }
+
 private:
     Coord<3> dim;
     unsigned maxSteps;
@@ -344,6 +391,87 @@ public:
         delete writer;
     }
 
+    void testProbeStopsOnceConfident()
+    {
+        typedef SimulationFactory<SimFabTestCell>::ProbeSettings ProbeSettings;
+        fab->setProbeSettings(ProbeSettings(1, 3, 20, 1e6));
+        double fitness = fab->operator()(fab->parameters());
+
+        TS_ASSERT_EQUALS(unsigned(3), fab->lastProbe().samples);
+        TS_ASSERT(!fab->lastProbe().aborted);
+        // fitness is extrapolated to the full run:
+        double expected = fab->lastProbe().timePerCellUpdate * dim.prod() * maxSteps * -1.0;
+        TS_ASSERT(fitness < 0);
+        TS_ASSERT_DELTA(expected, fitness, -1e-9 * expected);
+    }
+
+    void testProbeIsBounded()
+    {
+        typedef SimulationFactory<SimFabTestCell>::ProbeSettings ProbeSettings;
+        // a negative tolerance can never be met:
+        fab->setProbeSettings(ProbeSettings(0, 2, 7, -1));
+        fab->operator()(fab->parameters());
+        TS_ASSERT_EQUALS(unsigned(7), fab->lastProbe().samples);
+
+        initializerProxy->setMaxSteps(4);
+        fab->setProbeSettings(ProbeSettings(2, 1, 50, -1));
+        fab->operator()(fab->parameters());
+        TS_ASSERT_EQUALS(unsigned(2), fab->lastProbe().samples);
+    }
+
+    void testProbeAbortsClearlyWorseCandidates()
+    {
+        typedef SimulationFactory<SimFabTestCell>::ProbeSettings ProbeSettings;
+        // with this abortFactor every candidate is worse than the first one:
+        fab->setProbeSettings(ProbeSettings(0, 3, 10, -1, 1e-3));
+
+        fab->operator()(fab->parameters());
+        TS_ASSERT_EQUALS(unsigned(10), fab->lastProbe().samples);
+        TS_ASSERT(!fab->lastProbe().aborted);
+
+        fab->operator()(fab->parameters());
+        TS_ASSERT_EQUALS(unsigned(3), fab->lastProbe().samples);
+        TS_ASSERT(fab->lastProbe().aborted);
+
+        fab->resetIncumbent();
+        fab->operator()(fab->parameters());
+        TS_ASSERT(!fab->lastProbe().aborted);
+    }
+
+    void testOpenMPSimulationFactory()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        LOG(Logger::INFO, "SimulationFactoryTest::testOpenMPSimulationFactory()")
+        Coord<3> smallDim(20, 20, 20);
+        VarStepInitializerProxy<SimFabTestCell> proxy(new SimFabTestInitializer(smallDim, 5));
+        OpenMPSimulationFactory<SimFabTestCell> ofab(&proxy);
+
+        SerialSimulator<SimFabTestCell> reference(new SimFabTestInitializer(smallDim, 5));
+        reference.run();
+        const GridBase<SimFabTestCell, 3> *expected = reference.getGrid();
+
+        // all combinations must yield the same result:
+        for (int i = 0; i < 8; ++i) {
+            ofab.parameters()["Scheduling"].setValue(i & 1);
+            ofab.parameters()["FirstTouch"].setValue((i >> 1) & 1);
+            ofab.parameters()["FineGrainedParallelism"].setValue((i >> 2) & 1);
+
+            boost::shared_ptr<Simulator<SimFabTestCell> > sim(ofab());
+            TS_ASSERT(dynamic_cast<OpenMPSimulator<SimFabTestCell>*>(sim.get()));
+            sim->run();
+
+            const GridBase<SimFabTestCell, 3> *actual =
+                dynamic_cast<MonolithicSimulator<SimFabTestCell>*>(sim.get())->getGrid();
+            CoordBox<3> box = expected->boundingBox();
+            for (CoordBox<3>::Iterator c = box.begin(); c != box.end(); ++c) {
+                TS_ASSERT_EQUALS(expected->get(*c).temp, actual->get(*c).temp);
+            }
+        }
+
+        TS_ASSERT(ofab(ofab.parameters()) < 0);
+#endif
+    }
+
     void testAddWriterToCacheBlockingSimulationFactory()
     {
         // fixme: disabled tests based on CacheBlockingSimulator due to segfault in that Simulator
@@ -8,6 +8,8 @@
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/io/teststeerer.h>
 #include <libgeodecomp/io/testwriter.h>
+#include <libgeodecomp/misc/amrtestcell.h>
+#include <libgeodecomp/misc/fronttestcell.h>
 #include <libgeodecomp/misc/stringops.h>
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/misc/testhelper.h>
@@ -234,6 +236,83 @@ public:
         TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 21 * NANO_STEPS_3D);
     }
 
+    void testActivityTracking()
+    {
+        typedef FrontTestCell<> ReferenceCell;
+        typedef FrontTestCell<APITraits::HasActivityTracking> TrackedCell;
+        SerialSimulator<ReferenceCell> reference(new ReferenceCell::Initializer());
+        SerialSimulator<TrackedCell> tracked(new TrackedCell::Initializer());
+        CoordBox<2> box = tracked.getGrid()->boundingBox();
+        Region<2> simArea;
+        simArea << box;
+
+        for (int t = 0; t < 20; ++t) {
+            reference.step();
+            tracked.step();
+
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, tracked.getGrid()->get(*i).value);
+            }
+        }
+
+        // all fronts have died out by now:
+        TS_ASSERT(tracked.activityTracker.select(simArea).empty());
+    }
+
+    void testAdaptiveMeshRefinementWithoutRefinementMatchesUniformGrid()
+    {
+        typedef AMRTestCell<> ReferenceCell;
+        typedef AMRTestCell<APITraits::HasAdaptiveMeshRefinement<2, 4> > RefinedCell;
+        // the hot spot stays below the refinement threshold:
+        SerialSimulator<ReferenceCell> reference(new ReferenceCell::Initializer(Coord<2>(32, 16), 10, 0.04));
+        SerialSimulator<RefinedCell> refined(new RefinedCell::Initializer(Coord<2>(32, 16), 10, 0.04));
+        reference.run();
+        refined.run();
+
+        TS_ASSERT_EQUALS(unsigned(10), refined.getStep());
+        TS_ASSERT_EQUALS(std::size_t(0), refined.amrGrid->getLevel(1).size());
+
+        CoordBox<2> box = reference.getGrid()->boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(reference.getGrid()->get(*i).value, refined.getGrid()->get(*i).value);
+        }
+    }
+
+    void testAdaptiveMeshRefinement()
+    {
+        typedef AMRTestCell<APITraits::HasAdaptiveMeshRefinement<2, 4> > RefinedCell;
+        typedef MockWriter<RefinedCell> WriterType;
+        boost::shared_ptr<WriterType::EventsStore> events(new WriterType::EventsStore);
+
+        SerialSimulator<RefinedCell> sim(new RefinedCell::Initializer());
+        TS_ASSERT_LESS_THAN(std::size_t(0), sim.amrGrid->getLevel(2).size());
+        TS_ASSERT_EQUALS(1.0, sim.getGrid()->get(Coord<2>(16, 8)).value);
+
+        sim.addWriter(new WriterType(events, 5));
+        sim.run();
+        TS_ASSERT_LESS_THAN(std::size_t(0), sim.amrGrid->getLevel(1).size());
+
+        // heat spreads, but stays roughly symmetric:
+        double center = sim.getGrid()->get(Coord<2>(16, 8)).value;
+        TS_ASSERT_LESS_THAN(center, 1.0);
+        TS_ASSERT_LESS_THAN(0.0, sim.getGrid()->get(Coord<2>(13, 8)).value);
+        TS_ASSERT_DELTA(
+            sim.getGrid()->get(Coord<2>(13, 8)).value,
+            sim.getGrid()->get(Coord<2>(18, 8)).value,
+            1e-10);
+
+        WriterType::EventsStore expectedEvents;
+        expectedEvents << WriterType::Event( 0, WRITER_INITIALIZED,   0, true)
+                       << WriterType::Event( 5, WRITER_STEP_FINISHED, 0, true)
+                       << WriterType::Event(10, WRITER_STEP_FINISHED, 0, true)
+                       << WriterType::Event(10, WRITER_ALL_DONE,      0, true);
+        TS_ASSERT_EQUALS(expectedEvents, *events);
+
+        typedef MockSteerer<RefinedCell> SteererType;
+        boost::shared_ptr<SteererType::EventsStore> steererEvents(new SteererType::EventsStore);
+        TS_ASSERT_THROWS(sim.addSteerer(new SteererType(5, steererEvents)), std::logic_error&);
+    }
+
 private:
     boost::shared_ptr<MockWriter<>::EventsStore> events;
     boost::shared_ptr<SerialSimulator<TestCell<2> > > simulator;
@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ThreadSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/unit/threadsimulatortest.h"
+
+static ThreadSimulatorTest suite_ThreadSimulatorTest;
+
+static CxxTest::List Tests_ThreadSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThreadSimulatorTest( "/root/repo/src/parallelization/test/unit/threadsimulatortest.h", 83, "ThreadSimulatorTest", suite_ThreadSimulatorTest, Tests_ThreadSimulatorTest );
+
+static class TestDescription_suite_ThreadSimulatorTest_testSingleUpdateGroup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testSingleUpdateGroup() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 93, "testSingleUpdateGroup" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testSingleUpdateGroup(); }
+} testDescription_suite_ThreadSimulatorTest_testSingleUpdateGroup;
+
+static class TestDescription_suite_ThreadSimulatorTest_testOverDecomposition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testOverDecomposition() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 110, "testOverDecomposition" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testOverDecomposition(); }
+} testDescription_suite_ThreadSimulatorTest_testOverDecomposition;
+
+static class TestDescription_suite_ThreadSimulatorTest_testMoreThreadsThanUpdateGroups : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testMoreThreadsThanUpdateGroups() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 132, "testMoreThreadsThanUpdateGroups" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testMoreThreadsThanUpdateGroups(); }
+} testDescription_suite_ThreadSimulatorTest_testMoreThreadsThanUpdateGroups;
+
+static class TestDescription_suite_ThreadSimulatorTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_test3D() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 143, "test3D" ) {}
+ void runTest() { suite_ThreadSimulatorTest.test3D(); }
+} testDescription_suite_ThreadSimulatorTest_test3D;
+
+static class TestDescription_suite_ThreadSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 152, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_ThreadSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_ThreadSimulatorTest_testFailingUpdateGroupStopsPeers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testFailingUpdateGroupStopsPeers() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 173, "testFailingUpdateGroupStopsPeers" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testFailingUpdateGroupStopsPeers(); }
+} testDescription_suite_ThreadSimulatorTest_testFailingUpdateGroupStopsPeers;
+
+static class TestDescription_suite_ThreadSimulatorTest_testPeerBlockedInGetReturnsOnFailure : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadSimulatorTest_testPeerBlockedInGetReturnsOnFailure() : CxxTest::RealTestDescription( Tests_ThreadSimulatorTest, suiteDescription_ThreadSimulatorTest, 192, "testPeerBlockedInGetReturnsOnFailure" ) {}
+ void runTest() { suite_ThreadSimulatorTest.testPeerBlockedInGetReturnsOnFailure(); }
+} testDescription_suite_ThreadSimulatorTest_testPeerBlockedInGetReturnsOnFailure;
+
@@ -0,0 +1,244 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/paralleltestwriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/threadsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+/**
+ * Throws from within the first UpdateGroup only, all clones are
+ * harmless.
+ */
+class FailingWriter : public ParallelWriter<TestCell<2> >
+{
+public:
+    explicit FailingWriter(unsigned failStep) :
+        ParallelWriter<TestCell<2> >("", 1),
+        failStep(failStep),
+        armed(true)
+    {}
+
+    ParallelWriter<TestCell<2> > *clone() const
+    {
+        FailingWriter *ret = new FailingWriter(failStep);
+        ret->armed = false;
+        return ret;
+    }
+
+    void stepFinished(
+        const GridType& /* grid */,
+        const RegionType& /* validRegion */,
+        const CoordType& /* globalDimensions */,
+        unsigned step,
+        WriterEvent /* event */,
+        std::size_t /* rank */,
+        bool /* lastCall */)
+    {
+        if (armed && (step == failStep)) {
+            throw std::runtime_error("FailingWriter gave up");
+        }
+    }
+
+private:
+    unsigned failStep;
+    bool armed;
+};
+
+/**
+ * Updates an UpdateGroup without checking whether its ghost zones
+ * are ready, so it will block inside ThreadPatchLink::Provider::get()
+ * whenever it gets ahead of its neighbors.
+ */
+template<typename UPDATE_GROUP>
+class BlockingPeer
+{
+public:
+    BlockingPeer(UPDATE_GROUP *group, boost::atomic<bool> *cancelled) :
+        group(group),
+        cancelled(cancelled)
+    {}
+
+    void operator()()
+    {
+        try {
+            group->update(1000);
+        } catch (const typename ThreadPatchLink<typename UPDATE_GROUP::GridType>::Cancelled&) {
+            *cancelled = true;
+        }
+    }
+
+private:
+    UPDATE_GROUP *group;
+    boost::atomic<bool> *cancelled;
+};
+#endif
+
+class ThreadSimulatorTest : public CxxTest::TestSuite
+{
+public:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    static const int NANO_STEPS_2D = APITraits::SelectNanoSteps<TestCell<2> >::VALUE;
+    static const int NANO_STEPS_3D = APITraits::SelectNanoSteps<TestCell<3> >::VALUE;
+    typedef ThreadSimulator<TestCell<2> > SimulatorType2D;
+    typedef ThreadSimulator<TestCell<3> > SimulatorType3D;
+#endif
+
+    void testSingleUpdateGroup()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(27, 31), 20, 3));
+        TS_ASSERT_EQUALS(unsigned(3), sim.getStep());
+
+        sim.step();
+        TS_ASSERT_EQUALS(std::size_t(1), sim.updateGroups.size());
+        TS_ASSERT_EQUALS(unsigned(4), sim.getStep());
+        checkGroups(sim, 4 * NANO_STEPS_2D);
+
+        sim.run();
+        TS_ASSERT_EQUALS(unsigned(20), sim.getStep());
+        checkGroups(sim, 20 * NANO_STEPS_2D);
+#endif
+    }
+
+    void testOverDecomposition()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(47, 29), 31), 7, 2, 3);
+        sim.step();
+        checkGroups(sim, NANO_STEPS_2D);
+
+        sim.run();
+        TS_ASSERT_EQUALS(unsigned(31), sim.getStep());
+        checkGroups(sim, 31 * NANO_STEPS_2D);
+
+        Region<2> covered;
+        for (std::size_t i = 0; i < sim.updateGroups.size(); ++i) {
+            covered += sim.updateGroups[i]->partitionManager->ownRegion();
+        }
+        Region<2> expected;
+        expected << CoordBox<2>(Coord<2>(), Coord<2>(47, 29));
+        TS_ASSERT_EQUALS(expected, covered);
+        TS_ASSERT_EQUALS(std::size_t(7), sim.gatherStatistics().size());
+#endif
+    }
+
+    void testMoreThreadsThanUpdateGroups()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(20, 20), 10), 3, 8, 2);
+        TS_ASSERT_EQUALS(std::size_t(3), sim.numThreads);
+
+        sim.run();
+        checkGroups(sim, 10 * NANO_STEPS_2D);
+#endif
+    }
+
+    void test3D()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        SimulatorType3D sim(new TestInitializer<TestCell<3> >(Coord<3>(13, 12, 17), 9), 5, 3, 2);
+        sim.run();
+        checkGroups(sim, 9 * NANO_STEPS_3D);
+#endif
+    }
+
+    void testParallelWriterInvocation()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        unsigned period = 3;
+        std::vector<unsigned> expectedSteps;
+        std::vector<WriterEvent> expectedEvents;
+        expectedSteps << 0;
+        expectedEvents << WRITER_INITIALIZED;
+        for (unsigned t = 3; t < 20; t += period) {
+            expectedSteps << t;
+            expectedEvents << WRITER_STEP_FINISHED;
+        }
+        expectedSteps << 20;
+        expectedEvents << WRITER_ALL_DONE;
+
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(31, 22), 20), 4, 2);
+        sim.addWriter(new ParallelTestWriter(period, expectedSteps, expectedEvents));
+        sim.run();
+#endif
+    }
+
+    void testFailingUpdateGroupStopsPeers()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        // more UpdateGroups than threads and a long run, so peers of
+        // the failing UpdateGroup are bound to wait for its patches:
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(40, 40), 500), 6, 3);
+        sim.addWriter(new FailingWriter(5));
+
+        std::string message;
+        try {
+            sim.run();
+        } catch (const std::runtime_error& e) {
+            message = e.what();
+        }
+        TS_ASSERT_DIFFERS(std::string::npos, message.find("FailingWriter gave up"));
+        TS_ASSERT_LESS_THAN(sim.getStep(), unsigned(500));
+#endif
+    }
+
+    void testPeerBlockedInGetReturnsOnFailure()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        typedef SimulatorType2D::UpdateGroupType UpdateGroupType;
+
+        SimulatorType2D sim(new TestInitializer<TestCell<2> >(Coord<2>(40, 40), 500), 2, 2);
+        sim.addWriter(new FailingWriter(5));
+        sim.initSimulation();
+
+        // UpdateGroup 1 can't get more than one nano step ahead of
+        // UpdateGroup 0, which fails in step 5. Afterwards the peer
+        // waits in Provider::get() for patches which will never come:
+        boost::atomic<bool> cancelled(false);
+        boost::thread peer(BlockingPeer<UpdateGroupType>(&*sim.updateGroups[1], &cancelled));
+        sim.work(0, 500 * NANO_STEPS_2D);
+
+        TS_ASSERT(sim.failed);
+        TS_ASSERT(peer.timed_join(boost::posix_time::seconds(60)));
+        TS_ASSERT(cancelled);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    void checkGroups(const SimulatorType2D& sim, unsigned cycle)
+    {
+        typedef SimulatorType2D::UpdateGroupType::GridType GridType;
+
+        for (std::size_t i = 0; i < sim.updateGroups.size(); ++i) {
+            TS_ASSERT_TEST_GRID_REGION(
+                GridType,
+                sim.updateGroups[i]->grid(),
+                sim.updateGroups[i]->partitionManager->ownRegion(),
+                cycle);
+        }
+    }
+
+    void checkGroups(const SimulatorType3D& sim, unsigned cycle)
+    {
+        typedef SimulatorType3D::UpdateGroupType::GridType GridType;
+
+        for (std::size_t i = 0; i < sim.updateGroups.size(); ++i) {
+            TS_ASSERT_TEST_GRID_REGION(
+                GridType,
+                sim.updateGroups[i]->grid(),
+                sim.updateGroups[i]->partitionManager->ownRegion(),
+                cycle);
+        }
+    }
+#endif
+};
+
+}
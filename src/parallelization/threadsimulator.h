@@ -0,0 +1,345 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_THREADSIMULATOR_H
+#define LIBGEODECOMP_PARALLELIZATION_THREADSIMULATOR_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/parallelization/distributedsimulator.h>
+#include <libgeodecomp/parallelization/nesting/parallelwriteradapter.h>
+#include <libgeodecomp/parallelization/nesting/steereradapter.h>
+#include <libgeodecomp/parallelization/nesting/threadupdategroup.h>
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * The ThreadSimulator runs the hierarchical parallelization within a
+ * single process: the simulation space is over-decomposed into
+ * numUpdateGroups ThreadUpdateGroups (using the same Partitions as
+ * the HiParSimulator), which are then driven by numThreads worker
+ * threads. Ghost zones are exchanged through lock-free buffers
+ * (ThreadPatchLink), so neither MPI nor HPX is required.
+ *
+ * The worker threads are spawned once and live as long as the
+ * simulator. They only synchronize (via a barrier) when run() or
+ * step() start and finish, not between nano steps: each worker
+ * advances its UpdateGroups as far as their ghost zones permit. As
+ * the least advanced UpdateGroup can always proceed, this never
+ * deadlocks, even if there are more UpdateGroups than threads.
+ *
+ * ParallelWriters and Steerers are cloned for each UpdateGroup, as
+ * they'll be called concurrently.
+ *
+ * If an UpdateGroup throws, all workers are stopped and run() or
+ * step() rethrow the error as std::runtime_error. The simulation
+ * can't be resumed afterwards.
+ */
+template<typename CELL_TYPE, typename PARTITION = StripingPartition<APITraits::SelectTopology<CELL_TYPE>::Value::DIM>, typename STEPPER = VanillaStepper<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyNoP> >
+class ThreadSimulator : public DistributedSimulator<CELL_TYPE>
+{
+public:
+    friend class ThreadSimulatorTest;
+    using DistributedSimulator<CELL_TYPE>::NANO_STEPS;
+    using DistributedSimulator<CELL_TYPE>::chronometer;
+    typedef typename DistributedSimulator<CELL_TYPE>::Topology Topology;
+    typedef DistributedSimulator<CELL_TYPE> ParentType;
+    typedef ThreadUpdateGroup<CELL_TYPE> UpdateGroupType;
+    typedef typename ParentType::GridType GridType;
+    typedef ParallelWriterAdapter<typename UpdateGroupType::GridType, CELL_TYPE> ParallelWriterAdapterType;
+    typedef SteererAdapter<typename UpdateGroupType::GridType, CELL_TYPE> SteererAdapterType;
+    typedef typename UpdateGroupType::PatchAccepterVec PatchAccepterVec;
+    typedef typename UpdateGroupType::PatchProviderVec PatchProviderVec;
+    typedef typename UpdateGroupType::PatchAccepterPtr PatchAccepterPtr;
+    typedef typename UpdateGroupType::PatchProviderPtr PatchProviderPtr;
+    typedef typename UpdateGroupType::Registry Registry;
+
+    static const int DIM = Topology::DIM;
+
+    inline explicit ThreadSimulator(
+        Initializer<CELL_TYPE> *initializer,
+        std::size_t numUpdateGroups = 1,
+        std::size_t numThreads = 1,
+        unsigned ghostZoneWidth = 1) :
+        ParentType(initializer),
+        numUpdateGroups(numUpdateGroups),
+        numThreads(std::min(numThreads, numUpdateGroups)),
+        ghostZoneWidth(ghostZoneWidth),
+        steererAdaptersGhost(numUpdateGroups),
+        steererAdaptersInner(numUpdateGroups),
+        writerAdaptersGhost(numUpdateGroups),
+        writerAdaptersInner(numUpdateGroups),
+        target(0),
+        shutdown(false),
+        failed(false)
+    {
+        if ((numUpdateGroups == 0) || (numThreads == 0)) {
+            throw std::invalid_argument("ThreadSimulator needs at least one UpdateGroup and one thread");
+        }
+    }
+
+    virtual ~ThreadSimulator()
+    {
+        if (!barrier) {
+            return;
+        }
+
+        shutdown = true;
+        barrier->wait();
+        workers.join_all();
+    }
+
+    inline void run()
+    {
+        initSimulation();
+        nanoStep(long(initializer->maxSteps()) * NANO_STEPS - currentNanoStep());
+    }
+
+    inline void step()
+    {
+        initSimulation();
+        nanoStep(NANO_STEPS);
+    }
+
+    virtual unsigned getStep() const
+    {
+        if (updateGroups.empty()) {
+            return initializer->startStep();
+        }
+
+        return updateGroups[0]->currentStep().first;
+    }
+
+    virtual void addSteerer(Steerer<CELL_TYPE> *steerer)
+    {
+        DistributedSimulator<CELL_TYPE>::addSteerer(steerer);
+
+        for (std::size_t i = 0; i < numUpdateGroups; ++i) {
+            boost::shared_ptr<Steerer<CELL_TYPE> > instance = steerers.back();
+            if (i > 0) {
+                instance.reset(steerers.back()->clone());
+            }
+
+            // two adapters needed, just as for the writers
+            steererAdaptersGhost[i] << PatchProviderPtr(
+                new SteererAdapterType(
+                    instance,
+                    initializer->startStep(),
+                    initializer->maxSteps(),
+                    false));
+            steererAdaptersInner[i] << PatchProviderPtr(
+                new SteererAdapterType(
+                    instance,
+                    initializer->startStep(),
+                    initializer->maxSteps(),
+                    true));
+        }
+    }
+
+    virtual void addWriter(ParallelWriter<CELL_TYPE> *writer)
+    {
+        DistributedSimulator<CELL_TYPE>::addWriter(writer);
+
+        for (std::size_t i = 0; i < numUpdateGroups; ++i) {
+            boost::shared_ptr<ParallelWriter<CELL_TYPE> > instance = writers.back();
+            if (i > 0) {
+                instance.reset(writers.back()->clone());
+            }
+
+            // we need two adapters as each ParallelWriter needs to be
+            // notified twice: once for the (inner) ghost zone, and once
+            // for the inner set.
+            writerAdaptersGhost[i] << PatchAccepterPtr(
+                new ParallelWriterAdapterType(
+                    instance,
+                    initializer->startStep(),
+                    initializer->maxSteps(),
+                    false));
+            writerAdaptersInner[i] << PatchAccepterPtr(
+                new ParallelWriterAdapterType(
+                    instance,
+                    initializer->startStep(),
+                    initializer->maxSteps(),
+                    true));
+        }
+    }
+
+    /**
+     * Yields one Chronometer per UpdateGroup.
+     */
+    std::vector<Chronometer> gatherStatistics()
+    {
+        std::vector<Chronometer> ret;
+        for (std::size_t i = 0; i < updateGroups.size(); ++i) {
+            ret << (chronometer + updateGroups[i]->statistics());
+        }
+
+        return ret;
+    }
+
+private:
+    using DistributedSimulator<CELL_TYPE>::initializer;
+    using DistributedSimulator<CELL_TYPE>::steerers;
+    using DistributedSimulator<CELL_TYPE>::writers;
+
+    std::size_t numUpdateGroups;
+    std::size_t numThreads;
+    unsigned ghostZoneWidth;
+    std::vector<boost::shared_ptr<UpdateGroupType> > updateGroups;
+
+    std::vector<PatchProviderVec> steererAdaptersGhost;
+    std::vector<PatchProviderVec> steererAdaptersInner;
+    std::vector<PatchAccepterVec> writerAdaptersGhost;
+    std::vector<PatchAccepterVec> writerAdaptersInner;
+
+    boost::shared_ptr<Registry> registry;
+    boost::thread_group workers;
+    boost::shared_ptr<boost::barrier> barrier;
+    long target;
+    bool shutdown;
+    boost::atomic<bool> failed;
+    boost::mutex errorMutex;
+    std::string error;
+
+    /**
+     * Lazy initialization, for the same reasons as in the
+     * HiParSimulator: Writers and Steerers need to be known when the
+     * UpdateGroups are created.
+     */
+    inline void initSimulation()
+    {
+        if (!updateGroups.empty()) {
+            return;
+        }
+
+        CoordBox<DIM> box = initializer->gridBox();
+        std::size_t items = box.dimensions.prod();
+        std::vector<std::size_t> weights(numUpdateGroups);
+        for (std::size_t i = 0; i < numUpdateGroups; ++i) {
+            weights[i] = items * (i + 1) / numUpdateGroups - items * i / numUpdateGroups;
+        }
+
+        boost::shared_ptr<PARTITION> partition(
+            new PARTITION(
+                box.origin,
+                box.dimensions,
+                0,
+                weights));
+        registry.reset(new Registry());
+
+        for (std::size_t i = 0; i < numUpdateGroups; ++i) {
+            updateGroups << boost::shared_ptr<UpdateGroupType>(
+                new UpdateGroupType(
+                    partition,
+                    box,
+                    ghostZoneWidth,
+                    initializer,
+                    static_cast<STEPPER*>(0),
+                    writerAdaptersGhost[i],
+                    writerAdaptersInner[i],
+                    steererAdaptersGhost[i],
+                    steererAdaptersInner[i],
+                    registry,
+                    i));
+
+            writerAdaptersGhost[i].clear();
+            writerAdaptersInner[i].clear();
+            steererAdaptersGhost[i].clear();
+            steererAdaptersInner[i].clear();
+        }
+
+        barrier.reset(new boost::barrier(numThreads + 1));
+        for (std::size_t i = 0; i < numThreads; ++i) {
+            workers.create_thread(boost::bind(&ThreadSimulator::serve, this, i));
+        }
+    }
+
+    inline long currentNanoStep() const
+    {
+        return updateGroups[0]->currentNanoStep();
+    }
+
+    inline void nanoStep(long remainingNanoSteps)
+    {
+        target = currentNanoStep() + remainingNanoSteps;
+
+        // first wait releases the workers, second one collects them:
+        barrier->wait();
+        barrier->wait();
+
+        if (failed) {
+            failed = false;
+            throw std::runtime_error("ThreadSimulator: UpdateGroup failed: " + error);
+        }
+    }
+
+    /**
+     * Main loop of worker thread i. target and shutdown are only
+     * written while all workers are waiting at the barrier.
+     */
+    void serve(std::size_t thread)
+    {
+        for (;;) {
+            barrier->wait();
+            if (shutdown) {
+                return;
+            }
+
+            work(thread, target);
+            barrier->wait();
+        }
+    }
+
+    /**
+     * Worker thread i is responsible for every numThreads'th
+     * UpdateGroup. Each UpdateGroup is advanced for as long as its
+     * ghost zones are available, the thread will only idle if none of
+     * its UpdateGroups can proceed.
+     */
+    void work(std::size_t thread, long target)
+    {
+        try {
+            for (;;) {
+                bool done = true;
+                bool progress = false;
+
+                for (std::size_t i = thread; i < updateGroups.size(); i += numThreads) {
+                    UpdateGroupType& group = *updateGroups[i];
+                    while ((group.currentNanoStep() < target) && group.ready()) {
+                        group.update(1);
+                        progress = true;
+                    }
+
+                    done &= (group.currentNanoStep() >= target);
+                }
+
+                if (done || failed) {
+                    return;
+                }
+                if (!progress) {
+                    boost::this_thread::yield();
+                }
+            }
+        } catch (const std::exception& e) {
+            boost::lock_guard<boost::mutex> lock(errorMutex);
+            // cancelling the Registry releases peers blocked on our
+            // UpdateGroups' patches. Their Cancelled errors are mere
+            // follow-ups, so we report only the first error:
+            if (!failed) {
+                error = e.what();
+            }
+            failed = true;
+            registry->cancel();
+        }
+    }
+};
+
+}
+
+#endif
+#endif
@@ -0,0 +1,138 @@
+#ifndef LIBGEODECOMP_STORAGE_ACTIVITYTRACKER_H
+#define LIBGEODECOMP_STORAGE_ACTIVITYTRACKER_H
+
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/misc/apitraits.h>
+
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Helps simulators to implement activity tracking (see
+ * APITraits::HasActivityTracking): it maintains the set of active
+ * cells, i.e. those with at least one neighbor which changed during
+ * the previous nano step. All other cells would yield the same state
+ * if they were updated, so they may be skipped.
+ *
+ * Simulators alternate between two grids, so a cell which was
+ * updated in the previous nano step, but is skipped in the current
+ * one, still has its outdated state in the target grid. carryOver()
+ * fixes that by copying exactly these cells. Usage per nano step:
+ *
+ *   Region<DIM> region = tracker.select(simArea);
+ *   tracker.carryOver(region, *curGrid, newGrid);
+ *   // update region from curGrid to newGrid
+ *   tracker.record(region, *newGrid);
+ *
+ * Whenever cells get modified outside of the update (e.g. by
+ * Steerers or the Initializer), activateAll() needs to be called.
+ */
+template<typename CELL_TYPE>
+class ActivityTracker
+{
+public:
+    friend class ActivityTrackerTest;
+
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    typedef typename APITraits::SelectStencil<CELL_TYPE>::Value Stencil;
+    static const int DIM = Topology::DIM;
+
+    explicit ActivityTracker(const Coord<DIM>& gridDimensions = Coord<DIM>()) :
+        gridDimensions(gridDimensions),
+        allActive(true)
+    {}
+
+    /**
+     * Marks all cells as active, so the next call to select() will
+     * return its argument unchanged.
+     */
+    inline void activateAll()
+    {
+        allActive = true;
+    }
+
+    inline bool allCellsActive() const
+    {
+        return allActive;
+    }
+
+    /**
+     * Returns the subset of region which needs to be updated.
+     */
+    inline Region<DIM> select(const Region<DIM>& region) const
+    {
+        if (allActive) {
+            return region;
+        }
+
+        return region & active;
+    }
+
+    /**
+     * Copies those cells from source to target which were updated
+     * during the previous nano step, but are not contained in
+     * region, which will be updated next.
+     */
+    template<typename GRID_TYPE>
+    inline void carryOver(const Region<DIM>& region, const GRID_TYPE& source, GRID_TYPE *target)
+    {
+        Region<DIM> stale = lastUpdate - region;
+        std::vector<CELL_TYPE> buffer;
+
+        for (typename Region<DIM>::StreakIterator i = stale.beginStreak(); i != stale.endStreak(); ++i) {
+            buffer.resize(i->length());
+            source.get(*i, &buffer[0]);
+            target->set(*i, &buffer[0]);
+        }
+    }
+
+    /**
+     * Scans the cells of region (which have just been updated and
+     * stored in grid) for changes. Their neighbors form the active
+     * set for the next nano step.
+     */
+    template<typename GRID_TYPE>
+    inline void record(const Region<DIM>& region, const GRID_TYPE& grid)
+    {
+        Region<DIM> changed;
+        std::vector<CELL_TYPE> buffer;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            buffer.resize(i->length());
+            grid.get(*i, &buffer[0]);
+
+            Streak<DIM> streak = *i;
+            streak.endX = streak.origin.x();
+            for (std::size_t j = 0; j < buffer.size(); ++j) {
+                if (buffer[j].changed()) {
+                    ++streak.endX;
+                    continue;
+                }
+
+                if (streak.length() > 0) {
+                    changed << streak;
+                }
+                streak.origin.x() = i->origin.x() + j + 1;
+                streak.endX = streak.origin.x();
+            }
+            if (streak.length() > 0) {
+                changed << streak;
+            }
+        }
+
+        active = changed.expandWithStencil(1, gridDimensions, Topology(), Stencil());
+        lastUpdate = region;
+        allActive = false;
+    }
+
+private:
+    Coord<DIM> gridDimensions;
+    Region<DIM> active;
+    Region<DIM> lastUpdate;
+    bool allActive;
+};
+
+}
+
+#endif
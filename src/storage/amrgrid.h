@@ -0,0 +1,583 @@
+#ifndef LIBGEODECOMP_STORAGE_AMRGRID_H
+#define LIBGEODECOMP_STORAGE_AMRGRID_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/gridbase.h>
+#include <libgeodecomp/storage/updatefunctor.h>
+
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace AMRGridHelpers {
+
+/**
+ * Default refinement criterion for AMRGrid::regrid(), defers to the
+ * cell.
+ */
+template<typename CELL>
+class NeedsRefinement
+{
+public:
+    inline bool operator()(const CELL& cell) const
+    {
+        return cell.needsRefinement();
+    }
+};
+
+/**
+ * Elementwise division, rounding towards negative infinity.
+ */
+template<int DIM>
+inline Coord<DIM> divide(const Coord<DIM>& coord, const Coord<DIM>& divisor)
+{
+    Coord<DIM> ret;
+    for (int i = 0; i < DIM; ++i) {
+        ret[i] = (coord[i] >= 0) ?
+            (coord[i] / divisor[i]) :
+            -((divisor[i] - 1 - coord[i]) / divisor[i]);
+    }
+
+    return ret;
+}
+
+}
+
+/**
+ * AMRGrid implements block-structured adaptive mesh refinement: the
+ * simulation space is tiled into blocks of blockDim cells. Each
+ * block may be refined into ratio^DIM child blocks, each of which
+ * again holds blockDim cells, so cells on level l are ratio^l times
+ * finer than those on level 0. Only leaf blocks are updated, all
+ * others hold the restriction of their children, which is what
+ * Writers should see anyway.
+ *
+ * Ghost zones of the blocks are filled from neighboring blocks,
+ * prolongating coarser and restricting finer cells as needed. Thus
+ * cells see a regular neighborhood, even across coarse-fine
+ * boundaries, and update() doesn't need to know about AMR. All
+ * levels are advanced with the same time step (no subcycling), and
+ * fluxes across coarse-fine boundaries are not corrected, so
+ * conservation only holds within a level.
+ * regrid() maintains a 2:1 balance, i.e. adjacent leaves differ by
+ * at most one level. CELL needs to provide:
+ *
+ *   // a cell for the (finer) level which represents this cell,
+ *   // e.g. a copy with adjusted mesh width:
+ *   CELL prolongate(int level) const;
+ *
+ *   // combines num cells of level + 1 into one cell of level:
+ *   static CELL restrictFrom(const CELL *children, std::size_t num, int level);
+ *
+ *   // the default refinement criterion for regrid():
+ *   bool needsRefinement() const;
+ *
+ * SerialSimulator stores models flagged with
+ * APITraits::HasAdaptiveMeshRefinement in an AMRGrid. None of the
+ * parallel simulators support it yet.
+ */
+template<typename CELL>
+class AMRGrid
+{
+public:
+    friend class AMRGridTest;
+
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    typedef typename APITraits::SelectStencil<CELL>::Value Stencil;
+    static const int DIM = Topology::DIM;
+    typedef DisplacedGrid<CELL, typename Topologies::Cube<DIM>::Topology> BlockGridType;
+
+    /**
+     * A block's box is given in coordinates of its level. Its grids
+     * are padded by the ghost zone.
+     */
+    class Block
+    {
+    public:
+        inline Block(
+            int level,
+            const CoordBox<DIM>& box,
+            unsigned ghostZoneWidth,
+            const CELL& edgeCell) :
+            level(level),
+            box(box),
+            leaf(true)
+        {
+            CoordBox<DIM> outerBox(
+                box.origin - Coord<DIM>::diagonal(ghostZoneWidth),
+                box.dimensions + Coord<DIM>::diagonal(2 * ghostZoneWidth));
+            curGrid.reset(new BlockGridType(outerBox, CELL(), edgeCell));
+            newGrid.reset(new BlockGridType(outerBox, CELL(), edgeCell));
+        }
+
+        int level;
+        CoordBox<DIM> box;
+        bool leaf;
+        boost::shared_ptr<BlockGridType> curGrid;
+        boost::shared_ptr<BlockGridType> newGrid;
+    };
+
+    typedef boost::shared_ptr<Block> BlockPtr;
+    // blocks of one level, indexed by their position in the level's block lattice
+    typedef std::map<Coord<DIM>, BlockPtr> Level;
+
+    /**
+     * dimensions refers to level 0 and needs to be a multiple of
+     * blockDim, which in turn needs to be a multiple of ratio.
+     */
+    inline AMRGrid(
+        const Coord<DIM>& dimensions,
+        const Coord<DIM>& blockDim,
+        int maxLevel,
+        int ratio = 2,
+        const CELL& edgeCell = CELL()) :
+        dimensions(dimensions),
+        blockDim(blockDim),
+        maxLevel(maxLevel),
+        ratio(ratio),
+        ghostZoneWidth(Stencil::RADIUS),
+        edgeCell(edgeCell),
+        levels(maxLevel + 1)
+    {
+        if ((maxLevel < 0) || (ratio < 2)) {
+            throw std::invalid_argument("AMRGrid needs maxLevel >= 0 and ratio >= 2");
+        }
+
+        for (int i = 0; i < DIM; ++i) {
+            if ((blockDim[i] <= 0) ||
+                (dimensions[i] % blockDim[i] != 0) ||
+                ((maxLevel > 0) && (blockDim[i] % ratio != 0))) {
+                throw std::invalid_argument("AMRGrid dimensions need to be divisible by blockDim, and blockDim by ratio");
+            }
+        }
+
+        CoordBox<DIM> lattice(Coord<DIM>(), latticeDim(0));
+        for (typename CoordBox<DIM>::Iterator i = lattice.begin(); i != lattice.end(); ++i) {
+            levels[0][*i] = makeBlock(0, *i);
+        }
+    }
+
+    /**
+     * Sets level 0 from grid, which needs to cover the simulation
+     * space. Any refinement is discarded.
+     */
+    void load(const GridBase<CELL, DIM>& grid)
+    {
+        for (int l = 1; l <= maxLevel; ++l) {
+            levels[l].clear();
+        }
+
+        for (typename Level::iterator i = levels[0].begin(); i != levels[0].end(); ++i) {
+            Block& block = *i->second;
+            block.leaf = true;
+
+            for (typename CoordBox<DIM>::Iterator c = block.box.begin(); c != block.box.end(); ++c) {
+                (*block.curGrid)[*c] = grid.get(*c);
+            }
+        }
+    }
+
+    /**
+     * Copies level 0 (with refined parts restricted) to target.
+     */
+    void save(GridBase<CELL, DIM> *target) const
+    {
+        for (typename Level::const_iterator i = levels[0].begin(); i != levels[0].end(); ++i) {
+            const Block& block = *i->second;
+
+            for (typename CoordBox<DIM>::Iterator c = block.box.begin(); c != block.box.end(); ++c) {
+                target->set(*c, (*block.curGrid)[*c]);
+            }
+        }
+    }
+
+    /**
+     * Returns the cell at coord (given in coordinates of level,
+     * which must not exceed maxLevel), either directly, restricted
+     * from a finer or prolongated from a coarser level.
+     */
+    CELL get(int level, const Coord<DIM>& coord) const
+    {
+        Coord<DIM> levelDim = dimensions * scale(level);
+        if (Topology::isOutOfBounds(coord, levelDim)) {
+            return edgeCell;
+        }
+
+        Coord<DIM> c = Topology::normalize(coord, levelDim);
+        for (int l = level; l >= 0; --l) {
+            typename Level::const_iterator i = levels[l].find(AMRGridHelpers::divide(c, blockDim));
+            if (i != levels[l].end()) {
+                CELL ret = (*i->second->curGrid)[c];
+                for (int fine = l + 1; fine <= level; ++fine) {
+                    ret = ret.prolongate(fine);
+                }
+                return ret;
+            }
+
+            c = AMRGridHelpers::divide(c, Coord<DIM>::diagonal(ratio));
+        }
+
+        throw std::logic_error("AMRGrid: level 0 doesn't cover the simulation space");
+    }
+
+    /**
+     * Updates all leaf blocks, then restricts the results to their
+     * ancestors.
+     */
+    void update(unsigned nanoStep)
+    {
+        std::vector<Block*> leaves;
+        for (int l = 0; l <= maxLevel; ++l) {
+            for (typename Level::iterator i = levels[l].begin(); i != levels[l].end(); ++i) {
+                if (i->second->leaf) {
+                    leaves << &*i->second;
+                }
+            }
+        }
+
+        for (typename std::vector<Block*>::iterator i = leaves.begin(); i != leaves.end(); ++i) {
+            fillGhostZone(*i);
+        }
+
+        for (typename std::vector<Block*>::iterator i = leaves.begin(); i != leaves.end(); ++i) {
+            Region<DIM> region;
+            region << (*i)->box;
+            UpdateFunctor<CELL>()(region, Coord<DIM>(), Coord<DIM>(), *(*i)->curGrid, &*(*i)->newGrid, nanoStep);
+        }
+
+        for (typename std::vector<Block*>::iterator i = leaves.begin(); i != leaves.end(); ++i) {
+            std::swap((*i)->curGrid, (*i)->newGrid);
+        }
+
+        restrictAll();
+    }
+
+    /**
+     * Adapts the refinement: leaves containing a cell which
+     * satisfies criterion are refined, refined blocks whose children
+     * don't contain any such cell are coarsened. Refinement proceeds
+     * at most one level per call. Coarser leaves are refined, too, if
+     * required to keep the 2:1 balance.
+     */
+    template<typename CRITERION>
+    void regrid(const CRITERION& criterion)
+    {
+        std::set<Block*> coarsened;
+
+        for (int l = maxLevel - 1; l >= 0; --l) {
+            for (typename Level::iterator i = levels[l].begin(); i != levels[l].end(); ++i) {
+                if (coarsenable(i->first, *i->second, criterion)) {
+                    coarsen(i->first, &*i->second);
+                    coarsened.insert(&*i->second);
+                }
+            }
+        }
+
+        std::vector<std::pair<int, Coord<DIM> > > worklist;
+        for (int l = 0; l < maxLevel; ++l) {
+            for (typename Level::iterator i = levels[l].begin(); i != levels[l].end(); ++i) {
+                if (i->second->leaf &&
+                    !coarsened.count(&*i->second) &&
+                    anyCell(*i->second, criterion)) {
+                    worklist << std::make_pair(l, i->first);
+                }
+            }
+        }
+
+        while (!worklist.empty()) {
+            int level = worklist.back().first;
+            Coord<DIM> index = worklist.back().second;
+            typename Level::iterator iter = levels[level].find(index);
+            if (iter == levels[level].end()) {
+                throw std::logic_error("AMRGrid: 2:1 balance violated");
+            }
+
+            Block& block = *iter->second;
+            if (!block.leaf) {
+                worklist.pop_back();
+                continue;
+            }
+
+            // all neighbors need to exist on the same level,
+            // otherwise the coarser leaves covering them have to be
+            // refined first:
+            bool balanced = true;
+            std::vector<Coord<DIM> > neighbors = neighborIndices(level, index);
+            for (typename std::vector<Coord<DIM> >::iterator n = neighbors.begin(); n != neighbors.end(); ++n) {
+                if (!levels[level].count(*n)) {
+                    worklist << std::make_pair(level - 1, AMRGridHelpers::divide(*n, Coord<DIM>::diagonal(ratio)));
+                    balanced = false;
+                    break;
+                }
+            }
+
+            if (balanced) {
+                worklist.pop_back();
+                refine(level, index, &block);
+            }
+        }
+    }
+
+    void regrid()
+    {
+        regrid(AMRGridHelpers::NeedsRefinement<CELL>());
+    }
+
+    /**
+     * Number of leaf cells, i.e. the number of cells updated per
+     * nano step.
+     */
+    std::size_t numLeafCells() const
+    {
+        std::size_t ret = 0;
+        for (typename Level::const_iterator i = levels[0].begin(); i != levels[0].end(); ++i) {
+            ret += leafCells(0, i->first);
+        }
+
+        return ret;
+    }
+
+    inline const Level& getLevel(int level) const
+    {
+        return levels[level];
+    }
+
+    inline int getMaxLevel() const
+    {
+        return maxLevel;
+    }
+
+    inline int getRatio() const
+    {
+        return ratio;
+    }
+
+    inline const Coord<DIM>& getDimensions() const
+    {
+        return dimensions;
+    }
+
+    inline const Coord<DIM>& getBlockDim() const
+    {
+        return blockDim;
+    }
+
+private:
+    Coord<DIM> dimensions;
+    Coord<DIM> blockDim;
+    int maxLevel;
+    int ratio;
+    unsigned ghostZoneWidth;
+    CELL edgeCell;
+    std::vector<Level> levels;
+
+    inline int scale(int level) const
+    {
+        int ret = 1;
+        for (int i = 0; i < level; ++i) {
+            ret *= ratio;
+        }
+
+        return ret;
+    }
+
+    inline Coord<DIM> latticeDim(int level) const
+    {
+        return AMRGridHelpers::divide(dimensions, blockDim) * scale(level);
+    }
+
+    inline BlockPtr makeBlock(int level, const Coord<DIM>& index) const
+    {
+        return BlockPtr(
+            new Block(
+                level,
+                CoordBox<DIM>(index.scale(blockDim), blockDim),
+                ghostZoneWidth,
+                edgeCell));
+    }
+
+    /**
+     * Indices of the blocks adjacent to index (within the Moore
+     * neighborhood), with periodic boundaries applied.
+     */
+    std::vector<Coord<DIM> > neighborIndices(int level, const Coord<DIM>& index) const
+    {
+        std::vector<Coord<DIM> > ret;
+        Coord<DIM> lattice = latticeDim(level);
+        CoordBox<DIM> box(index - Coord<DIM>::diagonal(1), Coord<DIM>::diagonal(3));
+
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            if ((*i == index) || Topology::isOutOfBounds(*i, lattice)) {
+                continue;
+            }
+
+            ret << Topology::normalize(*i, lattice);
+        }
+
+        return ret;
+    }
+
+    void fillGhostZone(Block *block) const
+    {
+        CoordBox<DIM> outerBox = block->curGrid->boundingBox();
+        for (typename CoordBox<DIM>::Iterator i = outerBox.begin(); i != outerBox.end(); ++i) {
+            if (!block->box.inBounds(*i)) {
+                (*block->curGrid)[*i] = get(block->level, *i);
+            }
+        }
+    }
+
+    void restrictAll()
+    {
+        for (int l = maxLevel - 1; l >= 0; --l) {
+            for (typename Level::iterator i = levels[l].begin(); i != levels[l].end(); ++i) {
+                if (!i->second->leaf) {
+                    restrictBlock(&*i->second);
+                }
+            }
+        }
+    }
+
+    void restrictBlock(Block *block)
+    {
+        const Level& fineLevel = levels[block->level + 1];
+        CoordBox<DIM> offsets(Coord<DIM>(), Coord<DIM>::diagonal(ratio));
+        std::vector<CELL> children(offsets.dimensions.prod());
+
+        for (typename CoordBox<DIM>::Iterator c = block->box.begin(); c != block->box.end(); ++c) {
+            Coord<DIM> fineOrigin = *c * ratio;
+            const Block& child = *fineLevel.find(AMRGridHelpers::divide(fineOrigin, blockDim))->second;
+
+            std::size_t n = 0;
+            for (typename CoordBox<DIM>::Iterator o = offsets.begin(); o != offsets.end(); ++o) {
+                children[n++] = (*child.curGrid)[fineOrigin + *o];
+            }
+
+            (*block->curGrid)[*c] = CELL::restrictFrom(&children[0], children.size(), block->level);
+        }
+    }
+
+    template<typename CRITERION>
+    bool anyCell(const Block& block, const CRITERION& criterion) const
+    {
+        for (typename CoordBox<DIM>::Iterator c = block.box.begin(); c != block.box.end(); ++c) {
+            if (criterion((*block.curGrid)[*c])) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::vector<Coord<DIM> > childIndices(const Coord<DIM>& index) const
+    {
+        std::vector<Coord<DIM> > ret;
+        CoordBox<DIM> offsets(index * ratio, Coord<DIM>::diagonal(ratio));
+        for (typename CoordBox<DIM>::Iterator i = offsets.begin(); i != offsets.end(); ++i) {
+            ret << *i;
+        }
+
+        return ret;
+    }
+
+    /**
+     * A refined block may be coarsened if all of its children are
+     * leaves and none of them needs refinement. To keep the 2:1
+     * balance, adjacent blocks of the same level must not have
+     * refined children.
+     */
+    template<typename CRITERION>
+    bool coarsenable(const Coord<DIM>& index, const Block& block, const CRITERION& criterion) const
+    {
+        if (block.leaf) {
+            return false;
+        }
+
+        const Level& fineLevel = levels[block.level + 1];
+        std::vector<Coord<DIM> > children = childIndices(index);
+        for (typename std::vector<Coord<DIM> >::iterator i = children.begin(); i != children.end(); ++i) {
+            const Block& child = *fineLevel.find(*i)->second;
+            if (!child.leaf || anyCell(child, criterion)) {
+                return false;
+            }
+        }
+
+        std::vector<Coord<DIM> > neighbors = neighborIndices(block.level, index);
+        for (typename std::vector<Coord<DIM> >::iterator n = neighbors.begin(); n != neighbors.end(); ++n) {
+            typename Level::const_iterator neighbor = levels[block.level].find(*n);
+            if ((neighbor == levels[block.level].end()) || neighbor->second->leaf) {
+                continue;
+            }
+
+            std::vector<Coord<DIM> > nephews = childIndices(*n);
+            for (typename std::vector<Coord<DIM> >::iterator i = nephews.begin(); i != nephews.end(); ++i) {
+                if (!fineLevel.find(*i)->second->leaf) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * The block already holds the restriction of its children, so
+     * these can simply be dropped.
+     */
+    void coarsen(const Coord<DIM>& index, Block *block)
+    {
+        std::vector<Coord<DIM> > children = childIndices(index);
+        for (typename std::vector<Coord<DIM> >::iterator i = children.begin(); i != children.end(); ++i) {
+            levels[block->level + 1].erase(*i);
+        }
+
+        block->leaf = true;
+    }
+
+    void refine(int level, const Coord<DIM>& index, Block *block)
+    {
+        block->leaf = false;
+
+        std::vector<Coord<DIM> > children = childIndices(index);
+        for (typename std::vector<Coord<DIM> >::iterator i = children.begin(); i != children.end(); ++i) {
+            BlockPtr child = makeBlock(level + 1, *i);
+
+            for (typename CoordBox<DIM>::Iterator c = child->box.begin(); c != child->box.end(); ++c) {
+                Coord<DIM> parentCoord = AMRGridHelpers::divide(*c, Coord<DIM>::diagonal(ratio));
+                (*child->curGrid)[*c] = (*block->curGrid)[parentCoord].prolongate(level + 1);
+            }
+
+            levels[level + 1][*i] = child;
+        }
+    }
+
+    std::size_t leafCells(int level, const Coord<DIM>& index) const
+    {
+        const Block& block = *levels[level].find(index)->second;
+        if (block.leaf) {
+            return block.box.dimensions.prod();
+        }
+
+        std::size_t ret = 0;
+        std::vector<Coord<DIM> > children = childIndices(index);
+        for (typename std::vector<Coord<DIM> >::iterator i = children.begin(); i != children.end(); ++i) {
+            ret += leafCells(level + 1, *i);
+        }
+
+        return ret;
+    }
+};
+
+}
+
+#endif
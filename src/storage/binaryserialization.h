@@ -0,0 +1,411 @@
+#ifndef LIBGEODECOMP_STORAGE_BINARYSERIALIZATION_H
+#define LIBGEODECOMP_STORAGE_BINARYSERIALIZATION_H
+
+#include <libgeodecomp/storage/fixedarray.h>
+
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+template<typename CONTAINER>
+class BoxCell;
+
+template<typename CARGO, std::size_t SIZE, typename KEY>
+class ContainerCell;
+
+namespace BinarySerializationHelpers {
+
+template<typename T>
+class IsTriviallyCopyable;
+
+template<typename T, bool TRIVIAL = IsTriviallyCopyable<T>::VALUE>
+class Serializer;
+
+}
+
+/**
+ * Lightweight replacement for boost::archive::binary_oarchive, meant
+ * for ghost zone exchange of cells with varying size (see
+ * APITraits::HasBinarySerialization). It writes straight into a
+ * std::vector<char> without any stream layer or archive header.
+ * Trivially copyable objects are memcpy()'d, containers are written
+ * as size-prefixed records and all other types are expected to
+ * provide a Boost-style serialize(ARCHIVE&, unsigned) member.
+ *
+ * The archive overwrites the buffer in place and only trims it to
+ * the number of bytes written upon destruction, so -- just like with
+ * Boost's archives -- the buffer is valid once the archive is gone.
+ * Reusing a buffer for subsequent exchanges of similar size thus
+ * neither reallocates nor resizes it.
+ */
+class BinaryOutputArchive
+{
+public:
+    explicit BinaryOutputArchive(std::vector<char> *buffer) :
+        buffer(buffer),
+        cursor(0)
+    {}
+
+    ~BinaryOutputArchive()
+    {
+        buffer->resize(cursor);
+    }
+
+    template<typename T>
+    inline BinaryOutputArchive& operator&(const T& object)
+    {
+        BinarySerializationHelpers::Serializer<T>::save(*this, object);
+        return *this;
+    }
+
+    template<typename T>
+    inline BinaryOutputArchive& operator<<(const T& object)
+    {
+        return *this & object;
+    }
+
+    inline void saveBinary(const void *data, std::size_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+
+        if ((cursor + size) > buffer->size()) {
+            grow(cursor + size);
+        }
+
+        std::memcpy(&(*buffer)[0] + cursor, data, size);
+        cursor += size;
+    }
+
+private:
+    std::vector<char> *buffer;
+    std::size_t cursor;
+
+    void grow(std::size_t minSize)
+    {
+        buffer->resize((std::max)(minSize, 2 * buffer->size()));
+    }
+};
+
+/**
+ * Counterpart of BinaryOutputArchive. Throws if a read would go
+ * beyond the end of the buffer.
+ */
+class BinaryInputArchive
+{
+public:
+    BinaryInputArchive(const char *data, std::size_t size) :
+        cursor(data),
+        end(data + size)
+    {}
+
+    template<typename T>
+    inline BinaryInputArchive& operator&(T& object)
+    {
+        BinarySerializationHelpers::Serializer<T>::load(*this, object);
+        return *this;
+    }
+
+    template<typename T>
+    inline BinaryInputArchive& operator>>(T& object)
+    {
+        return *this & object;
+    }
+
+    inline void loadBinary(void *data, std::size_t size)
+    {
+        if (size > remainingBytes()) {
+            throw std::logic_error("BinaryInputArchive: attempted read beyond end of buffer");
+        }
+
+        std::memcpy(data, cursor, size);
+        cursor += size;
+    }
+
+    inline std::size_t remainingBytes() const
+    {
+        return end - cursor;
+    }
+
+private:
+    const char *cursor;
+    const char *end;
+};
+
+namespace BinarySerializationHelpers {
+
+/**
+ * Objects for which this yields true are copied bytewise. Specialize
+ * it to return false for types which need deep copies, but look
+ * trivially copyable to the compiler (e.g. classes holding
+ * pointers).
+ */
+template<typename T>
+class IsTriviallyCopyable
+{
+public:
+    static const bool VALUE =
+        boost::has_trivial_copy<T>::value &&
+        boost::has_trivial_destructor<T>::value;
+};
+
+/**
+ * FixedArrays are trivially copyable, but only their used elements
+ * need to be transmitted.
+ */
+template<typename T, int SIZE>
+class IsTriviallyCopyable<FixedArray<T, SIZE> >
+{
+public:
+    static const bool VALUE = false;
+};
+
+/**
+ * Same for particle containers: we'd rather have them serialize
+ * themselves than copy their full capacity.
+ */
+template<typename CONTAINER>
+class IsTriviallyCopyable<BoxCell<CONTAINER> >
+{
+public:
+    static const bool VALUE = false;
+};
+
+template<typename CARGO, std::size_t SIZE, typename KEY>
+class IsTriviallyCopyable<ContainerCell<CARGO, SIZE, KEY> >
+{
+public:
+    static const bool VALUE = false;
+};
+
+template<typename T, bool TRIVIAL>
+class Serializer
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const T& object)
+    {
+        // Boost.Serialization's member functions aren't const either:
+        const_cast<T&>(object).serialize(archive, 0);
+    }
+
+    static inline void load(BinaryInputArchive& archive, T& object)
+    {
+        object.serialize(archive, 0);
+    }
+};
+
+template<typename T>
+class Serializer<T, true>
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const T& object)
+    {
+        archive.saveBinary(&object, sizeof(T));
+    }
+
+    static inline void load(BinaryInputArchive& archive, T& object)
+    {
+        archive.loadBinary(&object, sizeof(T));
+    }
+};
+
+/**
+ * Writes/reads a range of objects, in one go if possible.
+ */
+template<typename T, bool TRIVIAL = IsTriviallyCopyable<T>::VALUE>
+class RangeSerializer
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const T *data, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            archive & data[i];
+        }
+    }
+
+    static inline void load(BinaryInputArchive& archive, T *data, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            archive & data[i];
+        }
+    }
+};
+
+template<typename T>
+class RangeSerializer<T, true>
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const T *data, std::size_t size)
+    {
+        archive.saveBinary(data, size * sizeof(T));
+    }
+
+    static inline void load(BinaryInputArchive& archive, T *data, std::size_t size)
+    {
+        archive.loadBinary(data, size * sizeof(T));
+    }
+};
+
+template<typename T, std::size_t SIZE>
+class Serializer<T[SIZE], false>
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const T (&object)[SIZE])
+    {
+        RangeSerializer<T>::save(archive, object, SIZE);
+    }
+
+    static inline void load(BinaryInputArchive& archive, T (&object)[SIZE])
+    {
+        RangeSerializer<T>::load(archive, object, SIZE);
+    }
+};
+
+template<typename T, typename ALLOCATOR>
+class Serializer<std::vector<T, ALLOCATOR>, false>
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const std::vector<T, ALLOCATOR>& object)
+    {
+        std::size_t size = object.size();
+        archive & size;
+        if (size > 0) {
+            RangeSerializer<T>::save(archive, &object[0], size);
+        }
+    }
+
+    static inline void load(BinaryInputArchive& archive, std::vector<T, ALLOCATOR>& object)
+    {
+        std::size_t size;
+        archive & size;
+        object.resize(size);
+        if (size > 0) {
+            RangeSerializer<T>::load(archive, &object[0], size);
+        }
+    }
+};
+
+template<typename T, int SIZE>
+class Serializer<FixedArray<T, SIZE>, false>
+{
+public:
+    static inline void save(BinaryOutputArchive& archive, const FixedArray<T, SIZE>& object)
+    {
+        std::size_t size = object.size();
+        archive & size;
+        if (size > 0) {
+            RangeSerializer<T>::save(archive, &object[0], size);
+        }
+    }
+
+    static inline void load(BinaryInputArchive& archive, FixedArray<T, SIZE>& object)
+    {
+        std::size_t size;
+        archive & size;
+        if (size > std::size_t(SIZE)) {
+            throw std::logic_error("BinaryInputArchive: FixedArray too small for stored elements");
+        }
+
+        object.reserve(size);
+        if (size > 0) {
+            RangeSerializer<T>::load(archive, &object[0], size);
+        }
+    }
+};
+
+template<typename CHAR, typename TRAITS, typename ALLOCATOR>
+class Serializer<std::basic_string<CHAR, TRAITS, ALLOCATOR>, false>
+{
+public:
+    typedef std::basic_string<CHAR, TRAITS, ALLOCATOR> String;
+
+    static inline void save(BinaryOutputArchive& archive, const String& object)
+    {
+        std::size_t size = object.size();
+        archive & size;
+        archive.saveBinary(object.data(), size * sizeof(CHAR));
+    }
+
+    static inline void load(BinaryInputArchive& archive, String& object)
+    {
+        std::size_t size;
+        archive & size;
+        object.resize(size);
+        if (size > 0) {
+            archive.loadBinary(&object[0], size * sizeof(CHAR));
+        }
+    }
+};
+
+template<typename T, typename COMPARE, typename ALLOCATOR>
+class Serializer<std::set<T, COMPARE, ALLOCATOR>, false>
+{
+public:
+    typedef std::set<T, COMPARE, ALLOCATOR> Set;
+
+    static inline void save(BinaryOutputArchive& archive, const Set& object)
+    {
+        std::size_t size = object.size();
+        archive & size;
+        for (typename Set::const_iterator i = object.begin(); i != object.end(); ++i) {
+            archive & *i;
+        }
+    }
+
+    static inline void load(BinaryInputArchive& archive, Set& object)
+    {
+        std::size_t size;
+        archive & size;
+        object.clear();
+
+        for (std::size_t i = 0; i < size; ++i) {
+            T element;
+            archive & element;
+            object.insert(object.end(), element);
+        }
+    }
+};
+
+template<typename KEY, typename VALUE, typename COMPARE, typename ALLOCATOR>
+class Serializer<std::map<KEY, VALUE, COMPARE, ALLOCATOR>, false>
+{
+public:
+    typedef std::map<KEY, VALUE, COMPARE, ALLOCATOR> Map;
+
+    static inline void save(BinaryOutputArchive& archive, const Map& object)
+    {
+        std::size_t size = object.size();
+        archive & size;
+        for (typename Map::const_iterator i = object.begin(); i != object.end(); ++i) {
+            archive & i->first & i->second;
+        }
+    }
+
+    static inline void load(BinaryInputArchive& archive, Map& object)
+    {
+        std::size_t size;
+        archive & size;
+        object.clear();
+
+        for (std::size_t i = 0; i < size; ++i) {
+            KEY key;
+            archive & key;
+            archive & object[key];
+        }
+    }
+};
+
+}
+
+}
+
+#endif
@@ -129,6 +129,12 @@ public:
         }
     }
 
+    template<class ARCHIVE>
+    void serialize(ARCHIVE& ar, unsigned)
+    {
+        ar & origin & dimension & particles;
+    }
+
 private:
     FloatCoord<DIM> origin;
     FloatCoord<DIM> dimension;
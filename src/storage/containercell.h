@@ -5,8 +5,15 @@
 #include <libgeodecomp/geometry/coord.h>
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/stencils.h>
+#include <libgeodecomp/storage/binaryserialization.h>
 #include <libgeodecomp/storage/neighborhoodadapter.h>
 
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
 namespace LibGeoDecomp {
 
 /**
@@ -19,6 +26,13 @@ namespace LibGeoDecomp {
  * If your model doesn't access neighboring cells via IDs but rather
  * all neighbors within a certain radius, then BoxCell is a better
  * choice.
+ *
+ * Models which rebuild their containers every time step should use
+ * the bulk operations assign(), merge(), remove(begin, end) and
+ * removeIf(): they run in O(n log n) or linear time, whereas a
+ * sequence of insert() or remove() calls is quadratic. None of the
+ * operations allocate memory, so the container remains trivially
+ * copyable (see IsTriviallyCopyable) and can be sent via MPI as is.
  */
 template<typename CARGO, std::size_t SIZE, typename KEY = int>
 class ContainerCell
@@ -101,21 +115,142 @@ public:
         return false;
     }
 
-    inline Cargo *operator[](const Key& id)
+    /**
+     * Replaces the container's contents with the entries given by
+     * the keys in [keysBegin, keysEnd) and the corresponding cargo
+     * starting at cargo. The keys don't need to be sorted: they're
+     * sorted in place (via heap sort), once. If a key occurs more
+     * than once, only one of its entries is retained.
+     */
+    template<typename KEY_ITERATOR, typename CARGO_ITERATOR>
+    inline void assign(KEY_ITERATOR keysBegin, KEY_ITERATOR keysEnd, CARGO_ITERATOR cargo)
     {
-        Key *end = ids + numElements;
-        Key *pos = std::upper_bound(ids, end, id);
-        int offset = pos - ids;
+        checkSize(std::distance(keysBegin, keysEnd));
 
-        if (offset == 0) {
-            return 0;
+        numElements = 0;
+        for (; keysBegin != keysEnd; ++keysBegin, ++cargo) {
+            ids[numElements] = *keysBegin;
+            cells[numElements] = *cargo;
+            ++numElements;
+        }
+
+        sort();
+        removeDuplicates();
+    }
+
+    /**
+     * Merges the entries given by the keys in [keysBegin, keysEnd)
+     * and the corresponding cargo into the container, in linear
+     * time. The keys need to be sorted and free of duplicates. Just
+     * like insert(), entries replace existing ones with equal keys.
+     * The container remains unchanged if capacity would be exceeded.
+     */
+    template<typename KEY_ITERATOR, typename CARGO_ITERATOR>
+    inline void merge(KEY_ITERATOR keysBegin, KEY_ITERATOR keysEnd, CARGO_ITERATOR cargo)
+    {
+        std::ptrdiff_t batchSize = keysEnd - keysBegin;
+
+        // we need the final size to merge from the back, so count
+        // the keys which are already present:
+        std::size_t duplicates = 0;
+        std::ptrdiff_t i = 0;
+        std::ptrdiff_t j = 0;
+        while ((i < std::ptrdiff_t(numElements)) && (j < batchSize)) {
+            if (ids[i] < keysBegin[j]) {
+                ++i;
+            } else if (keysBegin[j] < ids[i]) {
+                ++j;
+            } else {
+                ++duplicates;
+                ++i;
+                ++j;
+            }
         }
 
-        if (ids[offset - 1] == id) {
-            return cells + offset - 1;
+        std::size_t newSize = numElements + batchSize - duplicates;
+        checkSize(newSize);
+
+        i = std::ptrdiff_t(numElements) - 1;
+        j = batchSize - 1;
+        for (std::ptrdiff_t k = newSize - 1; j >= 0; --k) {
+            if ((i >= 0) && (keysBegin[j] < ids[i])) {
+                ids[k] = ids[i];
+                cells[k] = cells[i];
+                --i;
+                continue;
+            }
+
+            if ((i >= 0) && !(ids[i] < keysBegin[j])) {
+                // drop the old entry in favor of the new one:
+                --i;
+            }
+            ids[k] = keysBegin[j];
+            cells[k] = cargo[j];
+            --j;
         }
 
-        return 0;
+        numElements = newSize;
+    }
+
+    /**
+     * Removes all entries whose keys are contained in the sorted
+     * range [keysBegin, keysEnd) with a single compaction pass.
+     * Returns the number of removed entries.
+     */
+    template<typename KEY_ITERATOR>
+    inline std::size_t remove(KEY_ITERATOR keysBegin, KEY_ITERATOR keysEnd)
+    {
+        std::size_t newSize = 0;
+        for (std::size_t i = 0; i < numElements; ++i) {
+            while ((keysBegin != keysEnd) && (*keysBegin < ids[i])) {
+                ++keysBegin;
+            }
+            if ((keysBegin != keysEnd) && !(ids[i] < *keysBegin)) {
+                continue;
+            }
+
+            moveEntry(i, newSize++);
+        }
+
+        std::size_t removed = numElements - newSize;
+        numElements = newSize;
+        return removed;
+    }
+
+    /**
+     * Removes all entries for which predicate(key, cargo) yields
+     * true with a single compaction pass, e.g. particles which have
+     * left the cell. Returns the number of removed entries.
+     */
+    template<typename PREDICATE>
+    inline std::size_t removeIf(PREDICATE predicate)
+    {
+        std::size_t newSize = 0;
+        for (std::size_t i = 0; i < numElements; ++i) {
+            if (!predicate(ids[i], cells[i])) {
+                moveEntry(i, newSize++);
+            }
+        }
+
+        std::size_t removed = numElements - newSize;
+        numElements = newSize;
+        return removed;
+    }
+
+    /**
+     * Lookups are done via binary search. If the keys are integers
+     * which form a contiguous range (a common case for models which
+     * assign IDs sequentially), the entry is indexed directly
+     * instead, which makes lookups in large containers O(1).
+     */
+    inline Cargo *operator[](const Key& id)
+    {
+        std::ptrdiff_t offset = indexOf(id, typename boost::is_integral<Key>::type());
+        if (offset < 0) {
+            return 0;
+        }
+
+        return cells + offset;
     }
 
     inline const Cargo *operator[](const Key& id) const
@@ -190,6 +325,29 @@ public:
         ar & ids & cells & numElements;
     }
 
+    /**
+     * Ghost zone exchange via BinaryOutputArchive only transmits
+     * occupied slots, keys and cargo each in one block if they are
+     * trivially copyable. Boost archives keep the format above.
+     */
+    void serialize(BinaryOutputArchive& ar, unsigned)
+    {
+        ar & numElements;
+        BinarySerializationHelpers::RangeSerializer<Key>::save(ar, ids, numElements);
+        BinarySerializationHelpers::RangeSerializer<Cargo>::save(ar, cells, numElements);
+    }
+
+    void serialize(BinaryInputArchive& ar, unsigned)
+    {
+        ar & numElements;
+        if (numElements > SIZE) {
+            numElements = 0;
+            throw std::logic_error("ContainerCell: received more elements than it can hold");
+        }
+        BinarySerializationHelpers::RangeSerializer<Key>::load(ar, ids, numElements);
+        BinarySerializationHelpers::RangeSerializer<Cargo>::load(ar, cells, numElements);
+    }
+
     inline const Key *getIDs() const
     {
         return ids;
@@ -207,6 +365,113 @@ private:
             throw std::logic_error("ContainerCell capacity exeeded");
         }
     }
+
+    inline void checkSize(std::size_t newSize) const
+    {
+        if (newSize > MAX_SIZE) {
+            throw std::logic_error("ContainerCell capacity exeeded");
+        }
+    }
+
+    inline std::ptrdiff_t indexOf(const Key& id, boost::true_type /* integral keys */) const
+    {
+        if (numElements == 0) {
+            return -1;
+        }
+
+        // ids are sorted, so the distances below are non-negative.
+        // Computing them modulo 2^64 avoids signed overflow for keys
+        // spanning more than half of Key's range:
+        const Key& first = ids[0];
+        const Key& last = ids[numElements - 1];
+        if ((boost::uint64_t(last) - boost::uint64_t(first)) == boost::uint64_t(numElements - 1)) {
+            if ((id < first) || (last < id)) {
+                return -1;
+            }
+            return std::ptrdiff_t(boost::uint64_t(id) - boost::uint64_t(first));
+        }
+
+        return indexOf(id, boost::false_type());
+    }
+
+    inline std::ptrdiff_t indexOf(const Key& id, boost::false_type) const
+    {
+        const Key *end = ids + numElements;
+        const Key *pos = std::lower_bound(ids, end, id);
+
+        if ((pos == end) || (id < *pos)) {
+            return -1;
+        }
+
+        return pos - ids;
+    }
+
+    inline void moveEntry(std::size_t from, std::size_t to)
+    {
+        if (from != to) {
+            ids[to] = ids[from];
+            cells[to] = cells[from];
+        }
+    }
+
+    inline void swapEntries(std::size_t a, std::size_t b)
+    {
+        using std::swap;
+        swap(ids[a], ids[b]);
+        swap(cells[a], cells[b]);
+    }
+
+    /**
+     * Heap sort by key: keys and cargo need to be permuted alike,
+     * which the std algorithms can't do without allocating a
+     * temporary array.
+     */
+    inline void sort()
+    {
+        for (std::size_t i = numElements / 2; i > 0; --i) {
+            siftDown(i - 1, numElements);
+        }
+
+        for (std::size_t end = numElements; end > 1; --end) {
+            swapEntries(0, end - 1);
+            siftDown(0, end - 1);
+        }
+    }
+
+    inline void siftDown(std::size_t root, std::size_t end)
+    {
+        for (;;) {
+            std::size_t child = 2 * root + 1;
+            if (child >= end) {
+                return;
+            }
+            if ((child + 1 < end) && (ids[child] < ids[child + 1])) {
+                ++child;
+            }
+            if (!(ids[root] < ids[child])) {
+                return;
+            }
+
+            swapEntries(root, child);
+            root = child;
+        }
+    }
+
+    inline void removeDuplicates()
+    {
+        if (numElements == 0) {
+            return;
+        }
+
+        std::size_t newSize = 1;
+        for (std::size_t i = 1; i < numElements; ++i) {
+            if (ids[newSize - 1] < ids[i]) {
+                moveEntry(i, newSize++);
+            }
+        }
+
+        numElements = newSize;
+    }
 };
 
 template<typename ARCHIVE, typename CARGO, std::size_t SIZE, typename KEY>
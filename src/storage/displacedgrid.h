@@ -29,12 +29,16 @@ public:
     typedef Grid<CELL_TYPE, TOPOLOGY> Delegate;
     typedef CoordMap<CELL_TYPE, Delegate> CoordMapType;
 
+    /**
+     * See Grid for a description of parallelFirstTouch.
+     */
     explicit DisplacedGrid(
         const CoordBox<DIM>& box = CoordBox<DIM>(),
         const CELL_TYPE& defaultCell = CELL_TYPE(),
         const CELL_TYPE& edgeCell = CELL_TYPE(),
-        const Coord<DIM>& topologicalDimensions = Coord<DIM>()) :
-        delegate(box.dimensions, defaultCell, edgeCell),
+        const Coord<DIM>& topologicalDimensions = Coord<DIM>(),
+        bool parallelFirstTouch = false) :
+        delegate(box.dimensions, defaultCell, edgeCell, parallelFirstTouch),
         origin(box.origin),
         topoDimensions(topologicalDimensions)
     {}
@@ -0,0 +1,187 @@
+#ifndef LIBGEODECOMP_STORAGE_FIRSTTOUCH_H
+#define LIBGEODECOMP_STORAGE_FIRSTTOUCH_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/storage/gridbase.h>
+#include <libflatarray/aligned_allocator.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Operating systems typically map a page of memory to the NUMA node
+ * of the thread which writes to it first ("first touch"), not to the
+ * node of the thread which allocated it. If a grid is initialized by
+ * the master thread, all its pages will end up on one socket and
+ * threads on other sockets will have to fetch their data via the
+ * inter-socket link during each time step.
+ *
+ * FirstTouch distributes initialization work via the same static
+ * OpenMP schedule over region.numPlanes() which the UpdateFunctor
+ * uses with ConcurrencyEnableOpenMP (given static scheduling is
+ * preferred), so that each thread touches the pages it will later
+ * update. Without OpenMP all functions fall back to serial execution.
+ */
+class FirstTouch
+{
+public:
+    /**
+     * Typical page size. Touching one byte per page is sufficient to
+     * get it mapped.
+     */
+    static const std::size_t PAGE_SIZE = 4096;
+
+    /**
+     * Writes to every page of the given memory range, using a static
+     * schedule. For grids which cover their full bounding box this
+     * yields the same partitioning as a static schedule over the
+     * grid's planes.
+     */
+    static void touch(void *data, std::size_t bytes)
+    {
+        char *cursor = static_cast<char*>(data);
+        long numPages = (bytes + PAGE_SIZE - 1) / PAGE_SIZE;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (long i = 0; i < numPages; ++i) {
+            cursor[i * PAGE_SIZE] = 0;
+        }
+    }
+
+    /**
+     * Calls functor(streak) for all streaks of the region. Planes are
+     * distributed among threads exactly like in the UpdateFunctor.
+     */
+    template<int DIM, typename FUNCTOR>
+    static void forEachStreak(const Region<DIM>& region, const FUNCTOR& functor)
+    {
+        long numPlanes = region.numPlanes();
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (long c = 0; c < numPlanes; ++c) {
+            typedef typename Region<DIM>::StreakIterator Iter;
+            Iter end = region.planeStreakIterator(c + 1);
+
+            for (Iter i = region.planeStreakIterator(c + 0); i != end; ++i) {
+                functor(*i);
+            }
+        }
+    }
+
+    /**
+     * Sets all cells within the region to the given value.
+     */
+    template<typename CELL, int DIM>
+    static void fill(GridBase<CELL, DIM> *grid, const Region<DIM>& region, const CELL& cell)
+    {
+        forEachStreak(region, FillStreak<CELL, DIM>(grid, cell));
+    }
+
+    /**
+     * Copies all cells within the region from source to target.
+     * Useful for moving data which was set up serially (e.g. by an
+     * Initializer) into a grid which was initialized in parallel.
+     */
+    template<typename CELL, int DIM>
+    static void copy(const GridBase<CELL, DIM>& source, GridBase<CELL, DIM> *target, const Region<DIM>& region)
+    {
+        forEachStreak(region, CopyStreak<CELL, DIM>(source, target));
+    }
+
+private:
+    template<typename CELL, int DIM>
+    class FillStreak
+    {
+    public:
+        FillStreak(GridBase<CELL, DIM> *grid, const CELL& cell) :
+            grid(grid),
+            cell(cell)
+        {}
+
+        void operator()(const Streak<DIM>& streak) const
+        {
+            std::vector<CELL> buffer(streak.length(), cell);
+            grid->set(streak, &buffer[0]);
+        }
+
+    private:
+        GridBase<CELL, DIM> *grid;
+        const CELL& cell;
+    };
+
+    template<typename CELL, int DIM>
+    class CopyStreak
+    {
+    public:
+        CopyStreak(const GridBase<CELL, DIM>& source, GridBase<CELL, DIM> *target) :
+            source(source),
+            target(target)
+        {}
+
+        void operator()(const Streak<DIM>& streak) const
+        {
+            std::vector<CELL> buffer(streak.length());
+            source.get(streak, &buffer[0]);
+            target->set(streak, &buffer[0]);
+        }
+
+    private:
+        const GridBase<CELL, DIM>& source;
+        GridBase<CELL, DIM> *target;
+    };
+};
+
+/**
+ * Allocator which optionally maps all pages of a new allocation via
+ * FirstTouch::touch() before returning it. This is required for
+ * containers like boost::multi_array, which default-construct all
+ * elements serially right after allocation.
+ */
+template<typename T, std::size_t ALIGNMENT>
+class FirstTouchAllocator : public LibFlatArray::aligned_allocator<T, ALIGNMENT>
+{
+public:
+    template<typename OTHER>
+    struct rebind
+    {
+        typedef FirstTouchAllocator<OTHER, ALIGNMENT> other;
+    };
+
+    explicit FirstTouchAllocator(bool parallelFirstTouch = false) :
+        parallelFirstTouch(parallelFirstTouch)
+    {}
+
+    template<typename OTHER>
+    FirstTouchAllocator(const FirstTouchAllocator<OTHER, ALIGNMENT>& other) :
+        parallelFirstTouch(other.firstTouchEnabled())
+    {}
+
+    T *allocate(std::size_t n, const void *hint = 0)
+    {
+        T *ret = LibFlatArray::aligned_allocator<T, ALIGNMENT>::allocate(n, hint);
+        if (parallelFirstTouch && (ret != 0)) {
+            FirstTouch::touch(ret, n * sizeof(T));
+        }
+
+        return ret;
+    }
+
+    bool firstTouchEnabled() const
+    {
+        return parallelFirstTouch;
+    }
+
+private:
+    bool parallelFirstTouch;
+};
+
+}
+
+#endif
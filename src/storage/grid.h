@@ -7,6 +7,7 @@
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/storage/coordmap.h>
+#include <libgeodecomp/storage/firsttouch.h>
 #include <libgeodecomp/storage/gridbase.h>
 #include <libgeodecomp/storage/selector.h>
 
@@ -89,6 +90,34 @@ public:
     }
 };
 
+/**
+ * Fills a single streak of a grid with a given cell, needs direct
+ * memory access.
+ */
+template<typename GRID>
+class FillStreak
+{
+public:
+    typedef typename GRID::Cell Cell;
+    static const int DIM = GRID::DIM;
+
+    FillStreak(GRID *grid, const Cell& cell) :
+        grid(grid),
+        cell(cell)
+    {}
+
+    void operator()(const Streak<DIM>& streak) const
+    {
+        Cell *start = &(*grid)[streak.origin];
+        Cell *end   = start + streak.length();
+        std::fill(start, end, cell);
+    }
+
+private:
+    GRID *grid;
+    const Cell& cell;
+};
+
 }
 
 /**
@@ -108,7 +137,7 @@ public:
     typedef typename boost::detail::multi_array::const_sub_array<CELL_TYPE, 1> ConstSliceRef;
     typedef typename boost::multi_array<
         // always align on cache line boundaries
-        CELL_TYPE, DIM, LibFlatArray::aligned_allocator<CELL_TYPE, 64> > CellMatrix;
+        CELL_TYPE, DIM, FirstTouchAllocator<CELL_TYPE, 64> > CellMatrix;
     typedef typename CellMatrix::index Index;
 #else
     typedef std::vector<CELL_TYPE>& SliceRef;
@@ -120,20 +149,29 @@ public:
     typedef CELL_TYPE Cell;
     typedef CoordMap<CELL_TYPE, Grid<CELL_TYPE, TOPOLOGY> > CoordMapType;
 
+    /**
+     * If parallelFirstTouch is set, memory will be mapped and
+     * initialized by all OpenMP threads (see FirstTouch) so that
+     * pages end up on the NUMA nodes of the threads which will later
+     * update them.
+     */
     explicit Grid(
         const Coord<DIM>& dim = Coord<DIM>(),
         const CELL_TYPE& defaultCell = CELL_TYPE(),
-        const CELL_TYPE& edgeCell = CELL_TYPE()) :
+        const CELL_TYPE& edgeCell = CELL_TYPE(),
+        bool parallelFirstTouch = false) :
         dimensions(dim),
-        cellMatrix(dim.toExtents()),
+        cellMatrix(dim.toExtents(), FirstTouchAllocator<CELL_TYPE, 64>(parallelFirstTouch)),
         edgeCell(edgeCell)
     {
         CoordBox<DIM> box(Coord<DIM>(), dim);
+        if (parallelFirstTouch) {
+            FirstTouch::forEachStreak(Region<DIM>() << box, GridHelpers::FillStreak<Grid>(this, defaultCell));
+            return;
+        }
+
         for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
-            Streak<DIM> s = *i;
-            CELL_TYPE *start = &(*this)[s.origin];
-            CELL_TYPE *end   = start + s.length();
-            std::fill(start, end, defaultCell);
+            GridHelpers::FillStreak<Grid>(this, defaultCell)(*i);
         }
     }
 
@@ -3,6 +3,7 @@
 
 #include <libgeodecomp/config.h>
 #include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/storage/binaryserialization.h>
 #include <libgeodecomp/storage/displacedgrid.h>
 #include <libgeodecomp/storage/unstructuredgrid.h>
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
@@ -39,6 +40,45 @@ public:
         const GRID_TYPE& grid,
         VECTOR_TYPE *vec,
         const REGION_TYPE& region)
+    {
+        typedef typename GRID_TYPE::CellType CellType;
+        gridToVector(
+            grid, vec, region,
+            typename APITraits::SelectBinarySerialization<CellType>::Value());
+    }
+
+    template<typename GRID_TYPE, typename VECTOR_TYPE, typename REGION_TYPE>
+    static void vectorToGrid(
+        const VECTOR_TYPE& vec,
+        GRID_TYPE *grid,
+        const REGION_TYPE& region)
+    {
+        typedef typename GRID_TYPE::CellType CellType;
+        vectorToGrid(
+            vec, grid, region,
+            typename APITraits::SelectBinarySerialization<CellType>::Value());
+    }
+
+    template<typename GRID_TYPE, typename VECTOR_TYPE, typename REGION_TYPE>
+    static void vectorToGrid(
+        VECTOR_TYPE& vec,
+        GRID_TYPE *grid,
+        const REGION_TYPE& region)
+    {
+        typedef typename GRID_TYPE::CellType CellType;
+        vectorToGrid(
+            vec, grid, region,
+            typename APITraits::SelectBinarySerialization<CellType>::Value());
+    }
+
+private:
+
+    template<typename GRID_TYPE, typename VECTOR_TYPE, typename REGION_TYPE>
+    static void gridToVector(
+        const GRID_TYPE& grid,
+        VECTOR_TYPE *vec,
+        const REGION_TYPE& region,
+        const APITraits::FalseType&)
     {
         typedef typename GRID_TYPE::CellType CellType;
         gridToVector(
@@ -51,7 +91,8 @@ public:
     static void vectorToGrid(
         const VECTOR_TYPE& vec,
         GRID_TYPE *grid,
-        const REGION_TYPE& region)
+        const REGION_TYPE& region,
+        const APITraits::FalseType&)
     {
         typedef typename GRID_TYPE::CellType CellType;
         vectorToGrid(
@@ -64,7 +105,8 @@ public:
     static void vectorToGrid(
         VECTOR_TYPE& vec,
         GRID_TYPE *grid,
-        const REGION_TYPE& region)
+        const REGION_TYPE& region,
+        const APITraits::FalseType&)
     {
         typedef typename GRID_TYPE::CellType CellType;
         vectorToGrid(
@@ -73,7 +115,49 @@ public:
             typename APITraits::SelectBoostSerialization<CellType>::Value());
     }
 
-private:
+    /**
+     * Cells are stored consecutively, streak by streak, via
+     * BinaryOutputArchive. The buffer's capacity is retained.
+     */
+    template<typename GRID_TYPE, typename REGION_TYPE>
+    static void gridToVector(
+        const GRID_TYPE& grid,
+        std::vector<char> *vec,
+        const REGION_TYPE& region,
+        const APITraits::TrueType&)
+    {
+        typedef typename GRID_TYPE::CellType CellType;
+        BinaryOutputArchive archive(vec);
+
+        for (typename REGION_TYPE::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            BinarySerializationHelpers::RangeSerializer<CellType>::save(
+                archive, &grid[i->origin], i->length());
+        }
+    }
+
+    template<typename GRID_TYPE, typename REGION_TYPE>
+    static void vectorToGrid(
+        const std::vector<char>& vec,
+        GRID_TYPE *grid,
+        const REGION_TYPE& region,
+        const APITraits::TrueType&)
+    {
+        typedef typename GRID_TYPE::CellType CellType;
+        BinaryInputArchive archive(vec.empty() ? 0 : &vec[0], vec.size());
+
+        for (typename REGION_TYPE::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            BinarySerializationHelpers::RangeSerializer<CellType>::load(
+                archive, &(*grid)[i->origin], i->length());
+        }
+
+        if (archive.remainingBytes() != 0) {
+            throw std::logic_error("raw vector doesn't match region");
+        }
+    }
 
     template<typename CELL_TYPE, typename TOPOLOGY_TYPE, bool TOPOLOGICALLY_CORRECT, typename REGION_TYPE>
     static void gridToVector(
@@ -1,13 +1,21 @@
 #ifndef LIBGEODECOMP_STORAGE_MESHLESSADAPTER_H
 #define LIBGEODECOMP_STORAGE_MESHLESSADAPTER_H
 
+#include <libgeodecomp/config.h>
+#include <algorithm>
 #include <list>
+#include <map>
 #include <set>
+#include <stdexcept>
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/storage/grid.h>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 namespace LibGeoDecomp {
 
 /**
@@ -16,7 +24,9 @@ namespace LibGeoDecomp {
  * actual cells may be connected by an irregular graph.
  *
  * Its purpose is mostly to aid with computing and verifying the grid
- * geometry.
+ * geometry. For large inputs bin() should be preferred over
+ * insert(): it sorts all vertices into a CellList, which stores the
+ * vertices of each container cell contiguously.
  */
 template<class TOPOLOGY=Topologies::Torus<2>::Topology>
 class MeshlessAdapter
@@ -31,6 +41,29 @@ public:
     typedef std::vector<std::pair<FloatCoord<DIM>, int> > CoordVec;
     typedef std::vector<std::vector<int> > Graph;
 
+    /**
+     * Compressed cell list: the vertices of the container cell with
+     * the linear index i (see Coord::toIndex()) are stored in
+     * entries[offsets[i]] to entries[offsets[i + 1] - 1].
+     */
+    class CellList
+    {
+    public:
+        Coord<DIM> dimensions;
+        std::vector<std::size_t> offsets;
+        CoordVec entries;
+
+        inline typename CoordVec::const_iterator begin(const Coord<DIM>& coord) const
+        {
+            return entries.begin() + offsets[coord.toIndex(dimensions)];
+        }
+
+        inline typename CoordVec::const_iterator end(const Coord<DIM>& coord) const
+        {
+            return entries.begin() + offsets[coord.toIndex(dimensions) + 1];
+        }
+    };
+
     /**
      * creates an MeshlessAdapter which assumes that the coordinates
      * of the cells are elementwise smaller than dimensions. The
@@ -62,10 +95,75 @@ public:
 
     inline void insert(CoordListGrid *grid, const FloatCoord<DIM>& pos, const int& id) const
     {
-        Coord<2> c = posToCoord(pos);
+        Coord<DIM> c = posToCoord(pos);
         (*grid)[c].push_back(std::make_pair(pos, id));
     }
 
+    /**
+     * Sorts all positions into a CellList via a counting sort: one
+     * pass to determine the fill level of each container cell, one
+     * to scatter the vertices. Both passes are run in parallel if
+     * threads are available. Within each container cell the vertices
+     * retain their original order, regardless of the number of
+     * threads.
+     */
+    CellList bin(const CoordVec& positions) const
+    {
+        long size = positions.size();
+        long numBins = discreteDim.prod();
+        int numChunks = 1;
+#ifdef LIBGEODECOMP_WITH_THREADS
+        numChunks = std::max(1L, std::min<long>(omp_get_max_threads(), size));
+#endif
+
+        CellList ret;
+        ret.dimensions = discreteDim;
+        ret.offsets.resize(numBins + 1);
+        ret.entries.resize(size);
+
+        std::vector<std::size_t> binIDs(size);
+        std::vector<std::vector<std::size_t> > cursors(numChunks);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (int chunk = 0; chunk < numChunks; ++chunk) {
+            std::vector<std::size_t>& counts = cursors[chunk];
+            counts.resize(numBins, 0);
+
+            for (long i = chunkBegin(chunk, numChunks, size); i < chunkBegin(chunk + 1, numChunks, size); ++i) {
+                binIDs[i] = posToCoord(positions[i].first).toIndex(discreteDim);
+                ++counts[binIDs[i]];
+            }
+        }
+
+        // exclusive prefix sum over all bins (and within each bin
+        // over all chunks) turns the counts into write cursors:
+        std::size_t sum = 0;
+        for (long bin = 0; bin < numBins; ++bin) {
+            ret.offsets[bin] = sum;
+            for (int chunk = 0; chunk < numChunks; ++chunk) {
+                std::size_t count = cursors[chunk][bin];
+                cursors[chunk][bin] = sum;
+                sum += count;
+            }
+        }
+        ret.offsets[numBins] = sum;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (int chunk = 0; chunk < numChunks; ++chunk) {
+            std::vector<std::size_t>& cursor = cursors[chunk];
+
+            for (long i = chunkBegin(chunk, numChunks, size); i < chunkBegin(chunk + 1, numChunks, size); ++i) {
+                ret.entries[cursor[binIDs[i]]++] = positions[i];
+            }
+        }
+
+        return ret;
+    }
+
     /**
      * checks if the grid cell containing pos or any of its neighbors
      * in its Moore neighborhood contains a vertex which is closer to
@@ -90,6 +188,33 @@ public:
         return found;
     }
 
+    /**
+     * Same as above, but operates on a CellList, which needs to be
+     * created by bin() for the current box size.
+     */
+    bool search(
+        const CellList& cells,
+        const FloatCoord<DIM>& pos,
+        std::set<int> *coords = 0) const
+    {
+        bool found = false;
+        Coord<DIM> center = posToCoord(pos);
+        CoordBox<DIM> box(Coord<DIM>::diagonal(-1), Coord<DIM>::diagonal(3));
+
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            Coord<DIM> newCenter = center + *i;
+            if (TOPOLOGY::isOutOfBounds(newCenter, cells.dimensions)) {
+                continue;
+            }
+
+            newCenter = TOPOLOGY::normalize(newCenter, cells.dimensions);
+            bool res = searchRange(cells.begin(newCenter), cells.end(newCenter), pos, coords);
+            found |= res;
+        }
+
+        return found;
+    }
+
     inline CoordVec findAllPositions(const CoordListGrid& positions) const
     {
         CoordVec ret;
@@ -98,7 +223,7 @@ public:
         for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
             const CoordList& list = positions[*i];
             for (typename CoordList::const_iterator j = list.begin(); j != list.end(); ++j) {
-                ret.push_back(*i);
+                ret.push_back(*j);
             }
         }
 
@@ -115,13 +240,17 @@ public:
         Coord<DIM> upperBorderDim;
         Coord<DIM> lowerBorderDim;
 
+        // box sizes may be probed repeatedly below, so we memorize
+        // previous results:
+        std::map<double, bool> checkedBoxSizes;
+
         // the exponential back-off algorithm allows us to find upper
         // and lower bound for the optimal box size in log time
-        if (checkBoxSize(positions, graph)) {
+        if (checkBoxSize(positions, graph, &checkedBoxSizes)) {
             upperBorder = boxSize;
             upperBorderDim = discreteDim;
             resetBoxSize(boxSize * 0.5);
-            while (checkBoxSize(positions, graph))
+            while (checkBoxSize(positions, graph, &checkedBoxSizes))
                 resetBoxSize(boxSize * 0.5);
             lowerBorder = boxSize;
             lowerBorderDim = discreteDim;
@@ -129,7 +258,7 @@ public:
             lowerBorder = boxSize;
             lowerBorderDim = discreteDim;
             resetBoxSize(boxSize * 2);
-            while (!checkBoxSize(positions, graph))
+            while (!checkBoxSize(positions, graph, &checkedBoxSizes))
                 resetBoxSize(boxSize * 2);
             upperBorder = boxSize;
             upperBorderDim = discreteDim;
@@ -142,7 +271,7 @@ public:
         while (intervalTooLarge(lowerBorderDim, upperBorderDim)) {
             double middle = (upperBorder + lowerBorder) * 0.5;
             resetBoxSize(middle);
-            if (checkBoxSize(positions, graph)) {
+            if (checkBoxSize(positions, graph, &checkedBoxSizes)) {
                 upperBorder = middle;
                 upperBorderDim = discreteDim;
             } else {
@@ -170,30 +299,60 @@ public:
         }
 
         resetBoxSize(nextLower);
-        if (checkBoxSize(positions, graph))
+        if (checkBoxSize(positions, graph, &checkedBoxSizes))
             return nextLower;
 
         resetBoxSize(maxBoxSize);
         // this should never happen, but might in arcane cases where
         // the packaging density is much higher on the far boundaries
         // than elsewhere in the the simulation space.
-        if (!checkBoxSize(positions, graph))
+        if (!checkBoxSize(positions, graph, &checkedBoxSizes))
             throw std::logic_error("failed to determine a valid box size");
         return maxBoxSize;
     }
 
+    /**
+     * Checks whether all neighbors in graph end up in adjacent
+     * container cells. Each position is binned only once (instead of
+     * once per edge), and the edges are then checked in parallel.
+     */
     bool checkBoxSize(const CoordVec& positions, const Graph& graph)
     {
-        for (std::size_t i = 0; i < graph.size(); ++i) {
-            for (std::vector<int>::const_iterator n = graph[i].begin();
-                 n != graph[i].end(); ++n) {
-                if (manhattanDistance(positions[i].first, positions[*n].first) > 1) {
-                    return false;
+        long size = positions.size();
+        int numChunks = 1;
+#ifdef LIBGEODECOMP_WITH_THREADS
+        numChunks = std::max(1L, std::min<long>(omp_get_max_threads(), size));
+#endif
+
+        binCache.resize(size);
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (long i = 0; i < size; ++i) {
+            binCache[i] = posToCoord(positions[i].first);
+        }
+
+        std::vector<char> valid(numChunks, true);
+        long numVertices = graph.size();
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (int chunk = 0; chunk < numChunks; ++chunk) {
+            long end = chunkBegin(chunk + 1, numChunks, numVertices);
+
+            for (long i = chunkBegin(chunk, numChunks, numVertices); (i < end) && valid[chunk]; ++i) {
+                for (std::vector<int>::const_iterator n = graph[i].begin();
+                     n != graph[i].end(); ++n) {
+                    if (manhattanDistance(binCache[i], binCache[*n]) > 1) {
+                        valid[chunk] = false;
+                        break;
+                    }
                 }
             }
         }
 
-        return true;
+        return std::find(valid.begin(), valid.end(), false) == valid.end();
     }
 
     const Coord<DIM>& getDiscreteDim() const
@@ -205,7 +364,7 @@ public:
     {
         std::map<Coord<DIM>, int> cache;
         for (typename CoordVec::const_iterator i = positions.begin(); i != positions.end(); ++i) {
-            Coord<DIM> c = posToCoord(*i);
+            Coord<DIM> c = posToCoord(i->first);
             cache[c]++;
         }
 
@@ -244,6 +403,28 @@ private:
     double scale;
     double radius2;
     double boxSize;
+    std::vector<Coord<DIM> > binCache;
+
+    static inline long chunkBegin(long chunk, long numChunks, long size)
+    {
+        return size * chunk / numChunks;
+    }
+
+    /**
+     * Wraps checkBoxSize() to skip box sizes which have been checked
+     * before.
+     */
+    bool checkBoxSize(const CoordVec& positions, const Graph& graph, std::map<double, bool> *checkedBoxSizes)
+    {
+        typename std::map<double, bool>::iterator i = checkedBoxSizes->find(boxSize);
+        if (i != checkedBoxSizes->end()) {
+            return i->second;
+        }
+
+        bool ret = checkBoxSize(positions, graph);
+        (*checkedBoxSizes)[boxSize] = ret;
+        return ret;
+    }
 
     void resetBoxSize(double newBoxSize)
     {
@@ -271,12 +452,20 @@ private:
         const CoordList& list,
         const FloatCoord<DIM>& pos,
         std::set<int> *coords = 0) const
+    {
+        return searchRange(list.begin(), list.end(), pos, coords);
+    }
+
+    template<typename ITERATOR>
+    bool searchRange(
+        ITERATOR begin,
+        ITERATOR end,
+        const FloatCoord<DIM>& pos,
+        std::set<int> *coords = 0) const
     {
         bool found = false;
 
-        for (typename CoordList::const_iterator iter = list.begin();
-             iter != list.end();
-             ++iter) {
+        for (ITERATOR iter = begin; iter != end; ++iter) {
             if (distance2(pos, iter->first) < radius2) {
                 found = true;
                 if (coords)
@@ -306,8 +495,11 @@ private:
 
     int manhattanDistance(const FloatCoord<DIM>& a, const FloatCoord<DIM>& b) const
     {
-        Coord<DIM> coordA = posToCoord(a);
-        Coord<DIM> coordB = posToCoord(b);
+        return manhattanDistance(posToCoord(a), posToCoord(b));
+    }
+
+    int manhattanDistance(const Coord<DIM>& coordA, const Coord<DIM>& coordB) const
+    {
         Coord<DIM> delta = coordA - coordB;
         int maxDist = 0;
 
@@ -98,6 +98,55 @@ public:
 #endif
 };
 
+/**
+ * Buffer type for cells flagged with
+ * APITraits::HasBinarySerialization. The buffer is sized during
+ * serialization.
+ */
+template<typename CELL>
+class BinaryImplementation
+{
+public:
+    typedef std::vector<char> BufferType;
+    typedef char ElementType;
+    typedef typename APITraits::FalseType FixedSize;
+
+    template<typename REGION>
+    static BufferType create(const REGION& region)
+    {
+        return BufferType();
+    }
+
+    static ElementType *getData(BufferType& buffer)
+    {
+        return &buffer.front();
+    }
+
+#ifdef LIBGEODECOMP_WITH_MPI
+    static inline MPI_Datatype cellMPIDataType()
+    {
+        return MPI_CHAR;
+    }
+#endif
+};
+
+/**
+ * Binary serialization takes precedence over all other mechanisms.
+ */
+template<typename CELL, typename SUPPORTS_BINARY_SERIALIZATION = void>
+class SelectImplementation
+{
+public:
+    typedef Implementation<CELL> Value;
+};
+
+template<typename CELL>
+class SelectImplementation<CELL, typename CELL::API::SupportsBinarySerialization>
+{
+public:
+    typedef BinaryImplementation<CELL> Value;
+};
+
 }
 
 /**
@@ -108,7 +157,7 @@ template<typename CELL>
 class SerializationBuffer
 {
 public:
-    typedef SerializationBufferHelpers::Implementation<CELL> Implementation;
+    typedef typename SerializationBufferHelpers::SelectImplementation<CELL>::Value Implementation;
     typedef typename Implementation::BufferType BufferType;
     typedef typename Implementation::ElementType ElementType;
     typedef typename Implementation::FixedSize FixedSize;
@@ -3,6 +3,7 @@
 
 #include <libflatarray/flat_array.hpp>
 
+#include <libgeodecomp/config.h>
 #include <libgeodecomp/geometry/coord.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/topologies.h>
@@ -47,69 +48,111 @@ public:
      * eeeeeeeeee
      */
     SetContent(
-        const Coord<3>& gridDim, const Coord<3>& edgeRadii, const CELL& edgeCell, const CELL& innerCell) :
+        const Coord<3>& gridDim,
+        const Coord<3>& edgeRadii,
+        const CELL& edgeCell,
+        const CELL& innerCell,
+        bool parallelFirstTouch = false) :
         gridDim(gridDim),
         edgeRadii(edgeRadii),
         edgeCell(edgeCell),
-        innerCell(innerCell)
+        innerCell(innerCell),
+        parallelFirstTouch(parallelFirstTouch)
     {}
 
     template<long DIM_X, long DIM_Y, long DIM_Z, long INDEX>
     void operator()(LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX> accessor) const
     {
+        if (parallelFirstTouch) {
+            parallelFill(accessor);
+            return;
+        }
+
         for (int z = 0; z < gridDim.z(); ++z) {
-            bool onEdge1 = false;
-            const CELL *cell1 = &innerCell;
-            if ((z < edgeRadii.z()) || (z >= (gridDim.z() - edgeRadii.z()))) {
-                cell1 = &edgeCell;
-                onEdge1 = true;
+            for (int y = 0; y < gridDim.y(); ++y) {
+                fillLine(accessor, y, z);
             }
+        }
+    }
 
-            for (int y = 0; y < gridDim.y(); ++y) {
-                bool onEdge2 = onEdge1;
-                const CELL *cell2 = cell1;
-                if ((y < edgeRadii.y()) || (y >= (gridDim.y() - edgeRadii.y()))) {
-                    cell2 = &edgeCell;
-                    onEdge2 = true;
+private:
+    Coord<3> gridDim;
+    Coord<3> edgeRadii;
+    CELL edgeCell;
+    CELL innerCell;
+    bool parallelFirstTouch;
+
+    /**
+     * Distributes the outermost dimension (z for 3D, y for 2D grids)
+     * via a static schedule, just like the UpdateFunctor does, so
+     * that memory pages get mapped close to the threads which will
+     * later update them (see FirstTouch).
+     */
+    template<long DIM_X, long DIM_Y, long DIM_Z, long INDEX>
+    void parallelFill(const LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX>& accessor) const
+    {
+        if (gridDim.z() > 1) {
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+            for (int z = 0; z < gridDim.z(); ++z) {
+                LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX> threadAccessor = accessor;
+                for (int y = 0; y < gridDim.y(); ++y) {
+                    fillLine(threadAccessor, y, z);
                 }
+            }
 
-                accessor.index =
-                    z * DIM_X * DIM_Y +
-                    y * DIM_X;
-                int x = 0;
+            return;
+        }
 
-                for (; x < edgeRadii.x(); ++x) {
-                    accessor << edgeCell;
-                    ++accessor.index;
-                }
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+        for (int y = 0; y < gridDim.y(); ++y) {
+            LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX> threadAccessor = accessor;
+            fillLine(threadAccessor, y, 0);
+        }
+    }
 
-                if (onEdge2 || INIT_INTERIOR) {
-                    for (; x < (gridDim.x() - edgeRadii.x()); ++x) {
-                        accessor << *cell2;
-                        ++accessor.index;
-                    }
-                } else {
-                    // we need to advance index and x manually, otherwise
-                    // the following loop will erase the grid's interior:
-                    int delta = gridDim.x() - 2 * edgeRadii.x();
-                    x += delta;
-                    accessor.index += delta;
-                }
+    template<long DIM_X, long DIM_Y, long DIM_Z, long INDEX>
+    void fillLine(LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX>& accessor, int y, int z) const
+    {
+        bool onEdge = false;
+        const CELL *cell = &innerCell;
+        if ((z < edgeRadii.z()) || (z >= (gridDim.z() - edgeRadii.z())) ||
+            (y < edgeRadii.y()) || (y >= (gridDim.y() - edgeRadii.y()))) {
+            cell = &edgeCell;
+            onEdge = true;
+        }
 
-                for (; x < gridDim.x(); ++x) {
-                    accessor << edgeCell;
-                    ++accessor.index;
-                }
+        accessor.index =
+            z * DIM_X * DIM_Y +
+            y * DIM_X;
+        int x = 0;
+
+        for (; x < edgeRadii.x(); ++x) {
+            accessor << edgeCell;
+            ++accessor.index;
+        }
+
+        if (onEdge || INIT_INTERIOR) {
+            for (; x < (gridDim.x() - edgeRadii.x()); ++x) {
+                accessor << *cell;
+                ++accessor.index;
             }
+        } else {
+            // we need to advance index and x manually, otherwise
+            // the following loop will erase the grid's interior:
+            int delta = gridDim.x() - 2 * edgeRadii.x();
+            x += delta;
+            accessor.index += delta;
+        }
 
+        for (; x < gridDim.x(); ++x) {
+            accessor << edgeCell;
+            ++accessor.index;
         }
     }
-
-private:
-    Coord<3> gridDim;
-    Coord<3> edgeRadii;
-    CELL edgeCell;
-    CELL innerCell;
 };
 
 /**
@@ -280,11 +323,15 @@ public:
     typedef LibFlatArray::soa_grid<CELL> Delegate;
     typedef typename APITraits::SelectStencil<CELL>::Value Stencil;
 
+    /**
+     * See Grid for a description of parallelFirstTouch.
+     */
     explicit SoAGrid(
         const CoordBox<DIM>& box = CoordBox<DIM>(),
         const CELL& defaultCell = CELL(),
         const CELL& edgeCell = CELL(),
-        const Coord<DIM>& topologicalDimensions = Coord<DIM>()) :
+        const Coord<DIM>& topologicalDimensions = Coord<DIM>(),
+        bool parallelFirstTouch = false) :
         edgeRadii(calcEdgeRadii()),
         edgeCell(edgeCell),
         box(box),
@@ -304,7 +351,7 @@ public:
         // init edges and interior
         delegate.callback(
             SoAGridHelpers::SetContent<CELL, true>(
-                actualDimensions, edgeRadii, edgeCell, defaultCell));
+                actualDimensions, edgeRadii, edgeCell, defaultCell, parallelFirstTouch));
     }
 
     virtual void set(const Coord<DIM>& absoluteCoord, const CELL& cell)
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SelectorTest_init = false;
+#include "/root/repo/src/storage/test/parallel_mpi_2/selectortest.h"
+
+static SelectorTest suite_SelectorTest;
+
+static CxxTest::List Tests_SelectorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SelectorTest( "/root/repo/src/storage/test/parallel_mpi_2/selectortest.h", 24, "SelectorTest", suite_SelectorTest, Tests_SelectorTest );
+
+static class TestDescription_suite_SelectorTest_testMPIType : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SelectorTest_testMPIType() : CxxTest::RealTestDescription( Tests_SelectorTest, suiteDescription_SelectorTest, 28, "testMPIType" ) {}
+ void runTest() { suite_SelectorTest.testMPIType(); }
+} testDescription_suite_SelectorTest_testMPIType;
+
@@ -0,0 +1,61 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ActivityTrackerTest_init = false;
+#include "/root/repo/src/storage/test/unit/activitytrackertest.h"
+
+static ActivityTrackerTest suite_ActivityTrackerTest;
+
+static CxxTest::List Tests_ActivityTrackerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ActivityTrackerTest( "/root/repo/src/storage/test/unit/activitytrackertest.h", 11, "ActivityTrackerTest", suite_ActivityTrackerTest, Tests_ActivityTrackerTest );
+
+static class TestDescription_suite_ActivityTrackerTest_testInitiallyAllCellsAreActive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testInitiallyAllCellsAreActive() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 25, "testInitiallyAllCellsAreActive" ) {}
+ void runTest() { suite_ActivityTrackerTest.testInitiallyAllCellsAreActive(); }
+} testDescription_suite_ActivityTrackerTest_testInitiallyAllCellsAreActive;
+
+static class TestDescription_suite_ActivityTrackerTest_testRecordYieldsNeighborsOfChangedCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testRecordYieldsNeighborsOfChangedCells() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 32, "testRecordYieldsNeighborsOfChangedCells" ) {}
+ void runTest() { suite_ActivityTrackerTest.testRecordYieldsNeighborsOfChangedCells(); }
+} testDescription_suite_ActivityTrackerTest_testRecordYieldsNeighborsOfChangedCells;
+
+static class TestDescription_suite_ActivityTrackerTest_testActiveSetIsClippedAtBoundary : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testActiveSetIsClippedAtBoundary() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 57, "testActiveSetIsClippedAtBoundary" ) {}
+ void runTest() { suite_ActivityTrackerTest.testActiveSetIsClippedAtBoundary(); }
+} testDescription_suite_ActivityTrackerTest_testActiveSetIsClippedAtBoundary;
+
+static class TestDescription_suite_ActivityTrackerTest_testNoChangesYieldEmptyActiveSet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testNoChangesYieldEmptyActiveSet() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 71, "testNoChangesYieldEmptyActiveSet" ) {}
+ void runTest() { suite_ActivityTrackerTest.testNoChangesYieldEmptyActiveSet(); }
+} testDescription_suite_ActivityTrackerTest_testNoChangesYieldEmptyActiveSet;
+
+static class TestDescription_suite_ActivityTrackerTest_testCarryOverCopiesOnlyStaleCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActivityTrackerTest_testCarryOverCopiesOnlyStaleCells() : CxxTest::RealTestDescription( Tests_ActivityTrackerTest, suiteDescription_ActivityTrackerTest, 80, "testCarryOverCopiesOnlyStaleCells" ) {}
+ void runTest() { suite_ActivityTrackerTest.testCarryOverCopiesOnlyStaleCells(); }
+} testDescription_suite_ActivityTrackerTest_testCarryOverCopiesOnlyStaleCells;
+
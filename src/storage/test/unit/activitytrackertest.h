@@ -0,0 +1,114 @@
+#include <libgeodecomp/misc/fronttestcell.h>
+#include <libgeodecomp/storage/activitytracker.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ActivityTrackerTest : public CxxTest::TestSuite
+{
+public:
+    typedef FrontTestCell<APITraits::HasActivityTracking> CellType;
+    typedef Grid<CellType, Topologies::Cube<2>::Topology> GridType;
+
+    void setUp()
+    {
+        dim = Coord<2>(10, 8);
+        box = CoordBox<2>(Coord<2>(), dim);
+        simArea.clear();
+        simArea << box;
+    }
+
+    void testInitiallyAllCellsAreActive()
+    {
+        ActivityTracker<CellType> tracker(dim);
+        TS_ASSERT(tracker.allCellsActive());
+        TS_ASSERT_EQUALS(simArea, tracker.select(simArea));
+    }
+
+    void testRecordYieldsNeighborsOfChangedCells()
+    {
+        ActivityTracker<CellType> tracker(dim);
+        GridType grid(dim);
+        markChanged(&grid, Coord<2>(4, 3));
+        markChanged(&grid, Coord<2>(5, 3));
+
+        tracker.record(simArea, grid);
+        TS_ASSERT(!tracker.allCellsActive());
+
+        // von Neumann neighborhood:
+        Region<2> expected;
+        expected << Streak<2>(Coord<2>(4, 2), 6)
+                 << Streak<2>(Coord<2>(3, 3), 7)
+                 << Streak<2>(Coord<2>(4, 4), 6);
+        TS_ASSERT_EQUALS(expected, tracker.select(simArea));
+
+        Region<2> half;
+        half << CoordBox<2>(Coord<2>(), Coord<2>(5, 8));
+        TS_ASSERT_EQUALS(expected & half, tracker.select(half));
+
+        tracker.activateAll();
+        TS_ASSERT_EQUALS(simArea, tracker.select(simArea));
+    }
+
+    void testActiveSetIsClippedAtBoundary()
+    {
+        ActivityTracker<CellType> tracker(dim);
+        GridType grid(dim);
+        markChanged(&grid, Coord<2>(0, 0));
+        tracker.record(simArea, grid);
+
+        Region<2> expected;
+        expected << Coord<2>(0, 0)
+                 << Coord<2>(1, 0)
+                 << Coord<2>(0, 1);
+        TS_ASSERT_EQUALS(expected, tracker.select(simArea));
+    }
+
+    void testNoChangesYieldEmptyActiveSet()
+    {
+        ActivityTracker<CellType> tracker(dim);
+        GridType grid(dim);
+        tracker.record(simArea, grid);
+
+        TS_ASSERT(tracker.select(simArea).empty());
+    }
+
+    void testCarryOverCopiesOnlyStaleCells()
+    {
+        ActivityTracker<CellType> tracker(dim);
+        GridType source(dim, CellType(1));
+        GridType target(dim, CellType(2));
+
+        Region<2> previous;
+        previous << CoordBox<2>(Coord<2>(2, 2), Coord<2>(4, 3));
+        tracker.record(previous, source);
+
+        Region<2> next;
+        next << CoordBox<2>(Coord<2>(4, 2), Coord<2>(4, 4));
+        tracker.carryOver(next, source, &target);
+
+        Region<2> stale = previous - next;
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            int expected = stale.count(*i) ? 1 : 2;
+            TS_ASSERT_EQUALS(expected, target.get(*i).value);
+        }
+    }
+
+private:
+    Coord<2> dim;
+    CoordBox<2> box;
+    Region<2> simArea;
+
+    void markChanged(GridType *grid, const Coord<2>& coord)
+    {
+        CellType cell(1);
+        cell.hasChanged = true;
+        grid->set(coord, cell);
+    }
+};
+
+}
@@ -0,0 +1,87 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AMRGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/amrgridtest.h"
+
+static AMRGridTest suite_AMRGridTest;
+
+static CxxTest::List Tests_AMRGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AMRGridTest( "/root/repo/src/storage/test/unit/amrgridtest.h", 30, "AMRGridTest", suite_AMRGridTest, Tests_AMRGridTest );
+
+static class TestDescription_suite_AMRGridTest_testConstruction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testConstruction() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 36, "testConstruction" ) {}
+ void runTest() { suite_AMRGridTest.testConstruction(); }
+} testDescription_suite_AMRGridTest_testConstruction;
+
+static class TestDescription_suite_AMRGridTest_testLoadSaveAndGet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testLoadSaveAndGet() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 52, "testLoadSaveAndGet" ) {}
+ void runTest() { suite_AMRGridTest.testLoadSaveAndGet(); }
+} testDescription_suite_AMRGridTest_testLoadSaveAndGet;
+
+static class TestDescription_suite_AMRGridTest_testRefinementAndRestriction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testRefinementAndRestriction() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 71, "testRefinementAndRestriction" ) {}
+ void runTest() { suite_AMRGridTest.testRefinementAndRestriction(); }
+} testDescription_suite_AMRGridTest_testRefinementAndRestriction;
+
+static class TestDescription_suite_AMRGridTest_testBalancedRefinementAroundHotSpot : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testBalancedRefinementAroundHotSpot() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 97, "testBalancedRefinementAroundHotSpot" ) {}
+ void runTest() { suite_AMRGridTest.testBalancedRefinementAroundHotSpot(); }
+} testDescription_suite_AMRGridTest_testBalancedRefinementAroundHotSpot;
+
+static class TestDescription_suite_AMRGridTest_testCoarsening : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testCoarsening() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 125, "testCoarsening" ) {}
+ void runTest() { suite_AMRGridTest.testCoarsening(); }
+} testDescription_suite_AMRGridTest_testCoarsening;
+
+static class TestDescription_suite_AMRGridTest_testUpdateWithoutRefinementMatchesSerialSimulator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testUpdateWithoutRefinementMatchesSerialSimulator() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 148, "testUpdateWithoutRefinementMatchesSerialSimulator" ) {}
+ void runTest() { suite_AMRGridTest.testUpdateWithoutRefinementMatchesSerialSimulator(); }
+} testDescription_suite_AMRGridTest_testUpdateWithoutRefinementMatchesSerialSimulator;
+
+static class TestDescription_suite_AMRGridTest_testUniformFieldIsPreservedAcrossLevels : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testUniformFieldIsPreservedAcrossLevels() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 170, "testUniformFieldIsPreservedAcrossLevels" ) {}
+ void runTest() { suite_AMRGridTest.testUniformFieldIsPreservedAcrossLevels(); }
+} testDescription_suite_AMRGridTest_testUniformFieldIsPreservedAcrossLevels;
+
+static class TestDescription_suite_AMRGridTest_testHeatDiffusesAcrossCoarseFineBoundaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testHeatDiffusesAcrossCoarseFineBoundaries() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 195, "testHeatDiffusesAcrossCoarseFineBoundaries" ) {}
+ void runTest() { suite_AMRGridTest.testHeatDiffusesAcrossCoarseFineBoundaries(); }
+} testDescription_suite_AMRGridTest_testHeatDiffusesAcrossCoarseFineBoundaries;
+
+static class TestDescription_suite_AMRGridTest_testUniformRefinementConservesHeat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AMRGridTest_testUniformRefinementConservesHeat() : CxxTest::RealTestDescription( Tests_AMRGridTest, suiteDescription_AMRGridTest, 217, "testUniformRefinementConservesHeat" ) {}
+ void runTest() { suite_AMRGridTest.testUniformRefinementConservesHeat(); }
+} testDescription_suite_AMRGridTest_testUniformRefinementConservesHeat;
+
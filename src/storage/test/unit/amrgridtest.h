@@ -0,0 +1,294 @@
+#include <libgeodecomp/misc/amrtestcell.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/storage/amrgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Refinement criterion which selects all cells below a threshold.
+ */
+class ValueBelow
+{
+public:
+    explicit ValueBelow(double threshold) :
+        threshold(threshold)
+    {}
+
+    bool operator()(const AMRTestCell<>& cell) const
+    {
+        return cell.value < threshold;
+    }
+
+private:
+    double threshold;
+};
+
+class AMRGridTest : public CxxTest::TestSuite
+{
+public:
+    typedef AMRGrid<AMRTestCell<> > GridType;
+    typedef GridType::Level Level;
+
+    void testConstruction()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(8, 4), 2);
+        TS_ASSERT_EQUALS(std::size_t(16), grid.getLevel(0).size());
+        TS_ASSERT_EQUALS(std::size_t(0), grid.getLevel(1).size());
+        TS_ASSERT_EQUALS(std::size_t(32 * 16), grid.numLeafCells());
+        TS_ASSERT_EQUALS(CoordBox<2>(Coord<2>(8, 12), Coord<2>(8, 4)),
+                         grid.getLevel(0).find(Coord<2>(1, 3))->second->box);
+        TS_ASSERT_EQUALS(CoordBox<2>(Coord<2>(7, 11), Coord<2>(10, 6)),
+                         grid.getLevel(0).find(Coord<2>(1, 3))->second->curGrid->boundingBox());
+
+        TS_ASSERT_THROWS(GridType(Coord<2>(30, 16), Coord<2>(8, 4), 2), std::invalid_argument&);
+        TS_ASSERT_THROWS(GridType(Coord<2>(32, 15), Coord<2>(8, 5), 2), std::invalid_argument&);
+        TS_ASSERT_THROWS(GridType(Coord<2>(32, 16), Coord<2>(8, 4), 2, 1), std::invalid_argument&);
+    }
+
+    void testLoadSaveAndGet()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(8, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        fillCoordinates(&input);
+        grid.load(input);
+
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> output(Coord<2>(32, 16));
+        grid.save(&output);
+        TS_ASSERT_EQUALS(input, output);
+
+        TS_ASSERT_EQUALS(305, grid.get(0, Coord<2>(5, 3)).value);
+        // periodic boundary conditions:
+        TS_ASSERT_EQUALS(1531, grid.get(0, Coord<2>(-1, -1)).value);
+        // prolongation from the coarse level:
+        TS_ASSERT_EQUALS(305, grid.get(2, Coord<2>(22, 13)).value);
+        TS_ASSERT_EQUALS(2, grid.get(2, Coord<2>(22, 13)).level);
+    }
+
+    void testRefinementAndRestriction()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(8, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        fillCoordinates(&input);
+        grid.load(input);
+
+        // refines block (0, 0) only:
+        grid.regrid(ValueBelow(1));
+        TS_ASSERT_EQUALS(std::size_t(4), grid.getLevel(1).size());
+        TS_ASSERT(!grid.getLevel(0).find(Coord<2>(0, 0))->second->leaf);
+        TS_ASSERT_EQUALS(std::size_t(32 * 16 + 3 * 8 * 4), grid.numLeafCells());
+        TS_ASSERT_EQUALS(305, grid.get(1, Coord<2>(10, 7)).value);
+        TS_ASSERT_EQUALS(1, grid.get(1, Coord<2>(10, 7)).level);
+
+        // restriction averages the children:
+        GridType::Block& child = *grid.levels[1][Coord<2>(1, 1)];
+        (*child.curGrid)[Coord<2>(10, 6)].value = 1;
+        (*child.curGrid)[Coord<2>(11, 6)].value = 2;
+        (*child.curGrid)[Coord<2>(10, 7)].value = 3;
+        (*child.curGrid)[Coord<2>(11, 7)].value = 4;
+        grid.restrictAll();
+        TS_ASSERT_EQUALS(2.5, grid.get(0, Coord<2>(5, 3)).value);
+        TS_ASSERT_EQUALS(0,   grid.get(0, Coord<2>(5, 3)).level);
+    }
+
+    void testBalancedRefinementAroundHotSpot()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        AMRTestCell<>::Initializer().grid(&input);
+        grid.load(input);
+
+        grid.regrid();
+        grid.regrid();
+        // the hot spot covers the corners of four blocks of level 0,
+        // each of which is refined twice:
+        TS_ASSERT_EQUALS(std::size_t(4 * 4), grid.getLevel(1).size());
+        TS_ASSERT_EQUALS(std::size_t(4 * 4), grid.getLevel(2).size());
+        checkBalance(grid);
+
+        // refining the corner at the origin (the only cell with a
+        // value below 1) twice requires the blocks wrapping around
+        // the torus to be refined, too:
+        fillCoordinates(&input);
+        GridType other(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        other.load(input);
+        other.regrid(ValueBelow(1));
+        other.regrid(ValueBelow(1));
+        TS_ASSERT_EQUALS(std::size_t(4 * 4), other.getLevel(1).size());
+        TS_ASSERT_EQUALS(std::size_t(4), other.getLevel(2).size());
+        checkBalance(other);
+    }
+
+    void testCoarsening()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        AMRTestCell<>::Initializer().grid(&input);
+        grid.load(input);
+        grid.regrid();
+        grid.regrid();
+
+        for (int i = 0; i < 2; ++i) {
+            grid.regrid(ValueBelow(-1));
+            checkBalance(grid);
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(0), grid.getLevel(1).size());
+        TS_ASSERT_EQUALS(std::size_t(0), grid.getLevel(2).size());
+        TS_ASSERT_EQUALS(std::size_t(32 * 16), grid.numLeafCells());
+        // the hot spot's heat is retained:
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> output(Coord<2>(32, 16));
+        grid.save(&output);
+        TS_ASSERT_EQUALS(input, output);
+    }
+
+    void testUpdateWithoutRefinementMatchesSerialSimulator()
+    {
+        SerialSimulator<AMRTestCell<> > sim(new AMRTestCell<>::Initializer());
+        GridType grid(Coord<2>(32, 16), Coord<2>(8, 4), 0);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        AMRTestCell<>::Initializer().grid(&input);
+        grid.load(input);
+
+        for (int i = 0; i < 5; ++i) {
+            sim.step();
+            grid.update(0);
+        }
+
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> output(Coord<2>(32, 16));
+        grid.save(&output);
+
+        CoordBox<2> box = output.boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(sim.getGrid()->get(*i).value, output[*i].value);
+        }
+    }
+
+    void testUniformFieldIsPreservedAcrossLevels()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16), AMRTestCell<>(0.25));
+        grid.load(input);
+        // deliberately unbalanced, so coarse-fine boundaries span two levels:
+        grid.refine(0, Coord<2>(3, 1), &*grid.levels[0][Coord<2>(3, 1)]);
+        grid.refine(1, Coord<2>(7, 3), &*grid.levels[1][Coord<2>(7, 3)]);
+
+        for (int i = 0; i < 5; ++i) {
+            grid.update(0);
+        }
+
+        for (int level = 0; level <= 2; ++level) {
+            const Level& blocks = grid.getLevel(level);
+            for (Level::const_iterator i = blocks.begin(); i != blocks.end(); ++i) {
+                CoordBox<2> box = i->second->box;
+                for (CoordBox<2>::Iterator c = box.begin(); c != box.end(); ++c) {
+                    TS_ASSERT_EQUALS(0.25, (*i->second->curGrid)[*c].value);
+                    TS_ASSERT_EQUALS(level, (*i->second->curGrid)[*c].level);
+                }
+            }
+        }
+    }
+
+    void testHeatDiffusesAcrossCoarseFineBoundaries()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        AMRTestCell<>::Initializer().grid(&input);
+        grid.load(input);
+        grid.regrid();
+        grid.regrid();
+
+        double before = totalHeat(grid);
+        for (int i = 0; i < 20; ++i) {
+            grid.update(0);
+        }
+
+        // heat has left the refined area. Lacking flux correction,
+        // some heat is lost at the coarse-fine boundaries, but
+        // none may be created:
+        TS_ASSERT_LESS_THAN(0, grid.get(0, Coord<2>(11, 8)).value);
+        TS_ASSERT_LESS_THAN(totalHeat(grid), before);
+        TS_ASSERT_LESS_THAN(0.8 * before, totalHeat(grid));
+    }
+
+    void testUniformRefinementConservesHeat()
+    {
+        GridType grid(Coord<2>(32, 16), Coord<2>(4, 4), 2);
+        Grid<AMRTestCell<>, Topologies::Torus<2>::Topology> input(Coord<2>(32, 16));
+        AMRTestCell<>::Initializer().grid(&input);
+        grid.load(input);
+        grid.regrid(ValueBelow(2));
+        grid.regrid(ValueBelow(2));
+        TS_ASSERT_EQUALS(std::size_t(128 * 64), grid.numLeafCells());
+
+        double before = totalHeat(grid);
+        for (int i = 0; i < 20; ++i) {
+            grid.update(0);
+        }
+
+        TS_ASSERT_DELTA(before, totalHeat(grid), 1e-10);
+        // the hot spot starts at x = 56 and each step spreads it by
+        // one cell:
+        TS_ASSERT_LESS_THAN(0, grid.get(2, Coord<2>(36, 32)).value);
+        TS_ASSERT_EQUALS(0,    grid.get(2, Coord<2>(35, 32)).value);
+    }
+
+private:
+    void fillCoordinates(GridBase<AMRTestCell<>, 2> *grid)
+    {
+        CoordBox<2> box = grid->boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid->set(*i, AMRTestCell<>(i->y() * 100 + i->x()));
+        }
+    }
+
+    /**
+     * Refined blocks need to be surrounded by blocks of the same
+     * level, so leaves differ by at most one level from their
+     * neighbors.
+     */
+    void checkBalance(const GridType& grid)
+    {
+        for (int level = 0; level <= grid.getMaxLevel(); ++level) {
+            const Level& blocks = grid.getLevel(level);
+
+            for (Level::const_iterator i = blocks.begin(); i != blocks.end(); ++i) {
+                if (i->second->leaf) {
+                    continue;
+                }
+
+                std::vector<Coord<2> > neighbors = grid.neighborIndices(level, i->first);
+                for (std::vector<Coord<2> >::iterator n = neighbors.begin(); n != neighbors.end(); ++n) {
+                    TS_ASSERT_EQUALS(std::size_t(1), blocks.count(*n));
+                }
+            }
+        }
+    }
+
+    double totalHeat(const GridType& grid)
+    {
+        double sum = 0;
+        for (int level = 0; level <= grid.getMaxLevel(); ++level) {
+            const Level& blocks = grid.getLevel(level);
+            double volume = 1.0 / (1 << (2 * level));
+
+            for (Level::const_iterator i = blocks.begin(); i != blocks.end(); ++i) {
+                if (!i->second->leaf) {
+                    continue;
+                }
+
+                CoordBox<2> box = i->second->box;
+                for (CoordBox<2>::Iterator c = box.begin(); c != box.end(); ++c) {
+                    sum += (*i->second->curGrid)[*c].value * volume;
+                }
+            }
+        }
+
+        return sum;
+    }
+};
+
+}
@@ -0,0 +1,87 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BinarySerializationTest_init = false;
+#include "/root/repo/src/storage/test/unit/binaryserializationtest.h"
+
+static BinarySerializationTest suite_BinarySerializationTest;
+
+static CxxTest::List Tests_BinarySerializationTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BinarySerializationTest( "/root/repo/src/storage/test/unit/binaryserializationtest.h", 106, "BinarySerializationTest", suite_BinarySerializationTest, Tests_BinarySerializationTest );
+
+static class TestDescription_suite_BinarySerializationTest_testTrivialTypes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testTrivialTypes() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 109, "testTrivialTypes" ) {}
+ void runTest() { suite_BinarySerializationTest.testTrivialTypes(); }
+} testDescription_suite_BinarySerializationTest_testTrivialTypes;
+
+static class TestDescription_suite_BinarySerializationTest_testContainers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testContainers() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 136, "testContainers" ) {}
+ void runTest() { suite_BinarySerializationTest.testContainers(); }
+} testDescription_suite_BinarySerializationTest_testContainers;
+
+static class TestDescription_suite_BinarySerializationTest_testFixedArrayOnlyWritesUsedElements : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testFixedArrayOnlyWritesUsedElements() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 178, "testFixedArrayOnlyWritesUsedElements" ) {}
+ void runTest() { suite_BinarySerializationTest.testFixedArrayOnlyWritesUsedElements(); }
+} testDescription_suite_BinarySerializationTest_testFixedArrayOnlyWritesUsedElements;
+
+static class TestDescription_suite_BinarySerializationTest_testParticleContainers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testParticleContainers() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 202, "testParticleContainers" ) {}
+ void runTest() { suite_BinarySerializationTest.testParticleContainers(); }
+} testDescription_suite_BinarySerializationTest_testParticleContainers;
+
+static class TestDescription_suite_BinarySerializationTest_testContainerCellTransmitsOnlyOccupiedSlots : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testContainerCellTransmitsOnlyOccupiedSlots() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 235, "testContainerCellTransmitsOnlyOccupiedSlots" ) {}
+ void runTest() { suite_BinarySerializationTest.testContainerCellTransmitsOnlyOccupiedSlots(); }
+} testDescription_suite_BinarySerializationTest_testContainerCellTransmitsOnlyOccupiedSlots;
+
+static class TestDescription_suite_BinarySerializationTest_testContainersInheritSerializationFromCargo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testContainersInheritSerializationFromCargo() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 261, "testContainersInheritSerializationFromCargo" ) {}
+ void runTest() { suite_BinarySerializationTest.testContainersInheritSerializationFromCargo(); }
+} testDescription_suite_BinarySerializationTest_testContainersInheritSerializationFromCargo;
+
+static class TestDescription_suite_BinarySerializationTest_testContainerCellKeepsBoostFormat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testContainerCellKeepsBoostFormat() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 286, "testContainerCellKeepsBoostFormat" ) {}
+ void runTest() { suite_BinarySerializationTest.testContainerCellKeepsBoostFormat(); }
+} testDescription_suite_BinarySerializationTest_testContainerCellKeepsBoostFormat;
+
+static class TestDescription_suite_BinarySerializationTest_testBufferReuseAndOverflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testBufferReuseAndOverflow() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 314, "testBufferReuseAndOverflow" ) {}
+ void runTest() { suite_BinarySerializationTest.testBufferReuseAndOverflow(); }
+} testDescription_suite_BinarySerializationTest_testBufferReuseAndOverflow;
+
+static class TestDescription_suite_BinarySerializationTest_testEmptyWritesLeaveBufferEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BinarySerializationTest_testEmptyWritesLeaveBufferEmpty() : CxxTest::RealTestDescription( Tests_BinarySerializationTest, suiteDescription_BinarySerializationTest, 337, "testEmptyWritesLeaveBufferEmpty" ) {}
+ void runTest() { suite_BinarySerializationTest.testEmptyWritesLeaveBufferEmpty(); }
+} testDescription_suite_BinarySerializationTest_testEmptyWritesLeaveBufferEmpty;
+
@@ -0,0 +1,348 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/floatcoord.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/storage/binaryserialization.h>
+#include <libgeodecomp/storage/boxcell.h>
+#include <libgeodecomp/storage/containercell.h>
+
+#include <cxxtest/TestSuite.h>
+#include <boost/type_traits/is_same.hpp>
+#include <cstring>
+#include <sstream>
+
+#ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/array.hpp>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class BinarySerializationTestParticle
+{
+public:
+    explicit BinarySerializationTestParticle(const FloatCoord<2>& pos = FloatCoord<2>(), int id = 0) :
+        pos(pos),
+        id(id)
+    {}
+
+    bool operator==(const BinarySerializationTestParticle& other) const
+    {
+        return (pos == other.pos) && (id == other.id);
+    }
+
+    FloatCoord<2> pos;
+    int id;
+};
+
+class BinarySerializationTestBoostParticle
+{
+public:
+    class API :
+        public APITraits::HasBoostSerialization
+    {};
+
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & pos;
+    }
+
+    double pos;
+};
+
+class BinarySerializationTestBinaryParticle
+{
+public:
+    class API :
+        public APITraits::HasBinarySerialization
+    {};
+
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & pos;
+    }
+
+    double pos;
+};
+
+/**
+ * Mimics the members of ContainerCell<double, 4>.
+ */
+class BinarySerializationTestLegacyContainer
+{
+public:
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & ids & cells & numElements;
+    }
+
+    int ids[4];
+    double cells[4];
+    std::size_t numElements;
+};
+
+class BinarySerializationTestCell
+{
+public:
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & name & coords & neighbors & weights & particles & grid;
+    }
+
+    std::string name;
+    std::vector<Coord<2> > coords;
+    std::set<int> neighbors;
+    std::map<std::string, double> weights;
+    std::vector<std::vector<int> > particles;
+    int grid[2][3];
+};
+
+class BinarySerializationTest : public CxxTest::TestSuite
+{
+public:
+    void testTrivialTypes()
+    {
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive outArchive(&buffer);
+            outArchive & 47 & 11.5 & Coord<3>(1, 2, 3);
+            outArchive << BinarySerializationTestParticle(FloatCoord<2>(0.5, 1.5), 4711);
+        }
+        TS_ASSERT_EQUALS(
+            sizeof(int) + sizeof(double) + sizeof(Coord<3>) + sizeof(BinarySerializationTestParticle),
+            buffer.size());
+
+        int i;
+        double d;
+        Coord<3> c;
+        BinarySerializationTestParticle p;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        inArchive & i & d & c;
+        inArchive >> p;
+
+        TS_ASSERT_EQUALS(47, i);
+        TS_ASSERT_EQUALS(11.5, d);
+        TS_ASSERT_EQUALS(Coord<3>(1, 2, 3), c);
+        TS_ASSERT_EQUALS(BinarySerializationTestParticle(FloatCoord<2>(0.5, 1.5), 4711), p);
+        TS_ASSERT_EQUALS(std::size_t(0), inArchive.remainingBytes());
+    }
+
+    void testContainers()
+    {
+        BinarySerializationTestCell cell;
+        cell.name = "foobar";
+        cell.coords << Coord<2>(1, 2)
+                    << Coord<2>(3, 4);
+        cell.neighbors.insert(5);
+        cell.neighbors.insert(-7);
+        cell.weights["a"] = 0.25;
+        cell.weights["bcd"] = 8.5;
+        cell.particles.resize(3);
+        cell.particles[1] << 10 << 20 << 30;
+        cell.particles[2] << 40;
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                cell.grid[y][x] = y * 10 + x;
+            }
+        }
+
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive outArchive(&buffer);
+            outArchive & cell;
+        }
+
+        BinarySerializationTestCell copy;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        inArchive & copy;
+
+        TS_ASSERT_EQUALS(cell.name,      copy.name);
+        TS_ASSERT_EQUALS(cell.coords,    copy.coords);
+        TS_ASSERT_EQUALS(cell.neighbors, copy.neighbors);
+        TS_ASSERT_EQUALS(cell.weights,   copy.weights);
+        TS_ASSERT_EQUALS(cell.particles, copy.particles);
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                TS_ASSERT_EQUALS(cell.grid[y][x], copy.grid[y][x]);
+            }
+        }
+        TS_ASSERT_EQUALS(std::size_t(0), inArchive.remainingBytes());
+    }
+
+    void testFixedArrayOnlyWritesUsedElements()
+    {
+        FixedArray<double, 100> array;
+        array << 1.0
+              << 2.0
+              << 3.0;
+
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive outArchive(&buffer);
+            outArchive & array;
+        }
+        TS_ASSERT_EQUALS(sizeof(std::size_t) + 3 * sizeof(double), buffer.size());
+
+        FixedArray<double, 100> copy;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        inArchive & copy;
+        TS_ASSERT_EQUALS(array, copy);
+
+        FixedArray<double, 2> tooSmall;
+        BinaryInputArchive inArchive2(&buffer[0], buffer.size());
+        TS_ASSERT_THROWS(inArchive2 & tooSmall, std::logic_error&);
+    }
+
+    void testParticleContainers()
+    {
+        typedef ContainerCell<BinarySerializationTestParticle, 50> ContainerCellType;
+        ContainerCellType containerCell;
+        containerCell.insert(4, BinarySerializationTestParticle(FloatCoord<2>(1, 2), 4));
+        containerCell.insert(2, BinarySerializationTestParticle(FloatCoord<2>(3, 4), 2));
+
+        typedef BoxCell<FixedArray<BinarySerializationTestParticle, 30> > BoxCellType;
+        BoxCellType boxCell(FloatCoord<2>(10, 20), FloatCoord<2>(5, 5));
+        boxCell.insert(BinarySerializationTestParticle(FloatCoord<2>(11, 21), 1));
+
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive outArchive(&buffer);
+            outArchive & containerCell & boxCell;
+        }
+        TS_ASSERT(buffer.size() < sizeof(ContainerCellType));
+
+        ContainerCellType containerCopy;
+        BoxCellType boxCopy;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        inArchive & containerCopy & boxCopy;
+
+        TS_ASSERT_EQUALS(std::size_t(2), containerCopy.size());
+        TS_ASSERT_EQUALS(2, containerCopy.getIDs()[0]);
+        TS_ASSERT_EQUALS(4, containerCopy.getIDs()[1]);
+        TS_ASSERT_EQUALS(BinarySerializationTestParticle(FloatCoord<2>(3, 4), 2), *containerCopy[2]);
+        TS_ASSERT_EQUALS(BinarySerializationTestParticle(FloatCoord<2>(1, 2), 4), *containerCopy[4]);
+
+        TS_ASSERT_EQUALS(std::size_t(1), boxCopy.size());
+        TS_ASSERT_EQUALS(BinarySerializationTestParticle(FloatCoord<2>(11, 21), 1), *boxCopy.begin());
+    }
+
+    void testContainerCellTransmitsOnlyOccupiedSlots()
+    {
+        typedef ContainerCell<BinarySerializationTestParticle, 50, long> ContainerCellType;
+        ContainerCellType cell;
+        for (int i = 0; i < 3; ++i) {
+            cell.insert(10 * i, BinarySerializationTestParticle(FloatCoord<2>(i, i), i));
+        }
+
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive outArchive(&buffer);
+            outArchive & cell;
+        }
+        TS_ASSERT_EQUALS(
+            sizeof(std::size_t) + 3 * sizeof(long) + 3 * sizeof(BinarySerializationTestParticle),
+            buffer.size());
+
+        // mangle the element count to exceed the capacity:
+        std::size_t tooMany = 51;
+        std::memcpy(&buffer[0], &tooMany, sizeof(tooMany));
+        ContainerCellType copy;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        TS_ASSERT_THROWS(inArchive & copy, std::logic_error&);
+        TS_ASSERT_EQUALS(std::size_t(0), copy.size());
+    }
+
+    void testContainersInheritSerializationFromCargo()
+    {
+        typedef ContainerCell<BinarySerializationTestParticle, 50> PlainContainerType;
+        typedef ContainerCell<BinarySerializationTestBoostParticle, 50> BoostContainerType;
+        typedef ContainerCell<BinarySerializationTestBinaryParticle, 50> BinaryContainerType;
+        typedef BoxCell<FixedArray<BinarySerializationTestBoostParticle, 30> > BoostBoxType;
+        typedef BoxCell<FixedArray<BinarySerializationTestBinaryParticle, 30> > BinaryBoxType;
+
+        TS_ASSERT((boost::is_same<
+                   APITraits::FalseType,
+                   APITraits::SelectBinarySerialization<PlainContainerType>::Value>::value));
+        TS_ASSERT((boost::is_same<
+                   APITraits::FalseType,
+                   APITraits::SelectBinarySerialization<BoostContainerType>::Value>::value));
+        TS_ASSERT((boost::is_same<
+                   APITraits::TrueType,
+                   APITraits::SelectBinarySerialization<BinaryContainerType>::Value>::value));
+        TS_ASSERT((boost::is_same<
+                   APITraits::FalseType,
+                   APITraits::SelectBinarySerialization<BoostBoxType>::Value>::value));
+        TS_ASSERT((boost::is_same<
+                   APITraits::TrueType,
+                   APITraits::SelectBinarySerialization<BinaryBoxType>::Value>::value));
+    }
+
+    void testContainerCellKeepsBoostFormat()
+    {
+#ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
+        ContainerCell<double, 4> cell;
+        BinarySerializationTestLegacyContainer legacy;
+        legacy.numElements = 4;
+        for (int i = 0; i < 4; ++i) {
+            legacy.ids[i] = i * 2;
+            legacy.cells[i] = i + 0.5;
+            cell.insert(legacy.ids[i], legacy.cells[i]);
+        }
+
+        std::ostringstream expected;
+        {
+            boost::archive::binary_oarchive archive(expected);
+            archive & legacy;
+        }
+
+        std::ostringstream actual;
+        {
+            boost::archive::binary_oarchive archive(actual);
+            archive & cell;
+        }
+
+        TS_ASSERT_EQUALS(expected.str(), actual.str());
+#endif
+    }
+
+    void testBufferReuseAndOverflow()
+    {
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive archive(&buffer);
+            archive & std::vector<double>(1000);
+        }
+        std::size_t capacity = buffer.capacity();
+
+        {
+            BinaryOutputArchive archive(&buffer);
+            archive & 1.0;
+        }
+        TS_ASSERT_EQUALS(sizeof(double), buffer.size());
+        TS_ASSERT_EQUALS(capacity, buffer.capacity());
+
+        double d;
+        Coord<2> c;
+        BinaryInputArchive inArchive(&buffer[0], buffer.size());
+        inArchive & d;
+        TS_ASSERT_THROWS(inArchive & c, std::logic_error&);
+    }
+
+    void testEmptyWritesLeaveBufferEmpty()
+    {
+        std::vector<char> buffer;
+        {
+            BinaryOutputArchive archive(&buffer);
+            archive.saveBinary(0, 0);
+        }
+        TS_ASSERT_EQUALS(std::size_t(0), buffer.size());
+    }
+};
+
+}
@@ -0,0 +1,105 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ContainerCellTest_init = false;
+#include "/root/repo/src/storage/test/unit/containercelltest.h"
+
+static ContainerCellTest suite_ContainerCellTest;
+
+static CxxTest::List Tests_ContainerCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ContainerCellTest( "/root/repo/src/storage/test/unit/containercelltest.h", 40, "ContainerCellTest", suite_ContainerCellTest, Tests_ContainerCellTest );
+
+static class TestDescription_suite_ContainerCellTest_testCopy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testCopy() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 43, "testCopy" ) {}
+ void runTest() { suite_ContainerCellTest.testCopy(); }
+} testDescription_suite_ContainerCellTest_testCopy;
+
+static class TestDescription_suite_ContainerCellTest_testInsertAndSearch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testInsertAndSearch() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 91, "testInsertAndSearch" ) {}
+ void runTest() { suite_ContainerCellTest.testInsertAndSearch(); }
+} testDescription_suite_ContainerCellTest_testInsertAndSearch;
+
+static class TestDescription_suite_ContainerCellTest_testInsertAtEnd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testInsertAtEnd() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 122, "testInsertAtEnd" ) {}
+ void runTest() { suite_ContainerCellTest.testInsertAtEnd(); }
+} testDescription_suite_ContainerCellTest_testInsertAtEnd;
+
+static class TestDescription_suite_ContainerCellTest_testRemove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testRemove() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 149, "testRemove" ) {}
+ void runTest() { suite_ContainerCellTest.testRemove(); }
+} testDescription_suite_ContainerCellTest_testRemove;
+
+static class TestDescription_suite_ContainerCellTest_testClear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testClear() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 168, "testClear" ) {}
+ void runTest() { suite_ContainerCellTest.testClear(); }
+} testDescription_suite_ContainerCellTest_testClear;
+
+static class TestDescription_suite_ContainerCellTest_testAssign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testAssign() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 182, "testAssign" ) {}
+ void runTest() { suite_ContainerCellTest.testAssign(); }
+} testDescription_suite_ContainerCellTest_testAssign;
+
+static class TestDescription_suite_ContainerCellTest_testMerge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testMerge() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 208, "testMerge" ) {}
+ void runTest() { suite_ContainerCellTest.testMerge(); }
+} testDescription_suite_ContainerCellTest_testMerge;
+
+static class TestDescription_suite_ContainerCellTest_testBatchRemove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testBatchRemove() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 243, "testBatchRemove" ) {}
+ void runTest() { suite_ContainerCellTest.testBatchRemove(); }
+} testDescription_suite_ContainerCellTest_testBatchRemove;
+
+static class TestDescription_suite_ContainerCellTest_testRemoveIf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testRemoveIf() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 262, "testRemoveIf" ) {}
+ void runTest() { suite_ContainerCellTest.testRemoveIf(); }
+} testDescription_suite_ContainerCellTest_testRemoveIf;
+
+static class TestDescription_suite_ContainerCellTest_testLookupWithSparseAndDenseKeys : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testLookupWithSparseAndDenseKeys() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 277, "testLookupWithSparseAndDenseKeys" ) {}
+ void runTest() { suite_ContainerCellTest.testLookupWithSparseAndDenseKeys(); }
+} testDescription_suite_ContainerCellTest_testLookupWithSparseAndDenseKeys;
+
+static class TestDescription_suite_ContainerCellTest_testLookupWithExtremeKeys : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testLookupWithExtremeKeys() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 304, "testLookupWithExtremeKeys" ) {}
+ void runTest() { suite_ContainerCellTest.testLookupWithExtremeKeys(); }
+} testDescription_suite_ContainerCellTest_testLookupWithExtremeKeys;
+
+static class TestDescription_suite_ContainerCellTest_testUpdate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ContainerCellTest_testUpdate() : CxxTest::RealTestDescription( Tests_ContainerCellTest, suiteDescription_ContainerCellTest, 336, "testUpdate" ) {}
+ void runTest() { suite_ContainerCellTest.testUpdate(); }
+} testDescription_suite_ContainerCellTest_testUpdate;
+
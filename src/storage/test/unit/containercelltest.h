@@ -4,6 +4,7 @@
 #include <libgeodecomp/misc/testhelper.h>
 
 #include <cxxtest/TestSuite.h>
+#include <climits>
 
 using namespace LibGeoDecomp;
 
@@ -178,6 +179,160 @@ public:
         TS_ASSERT_EQUALS(container.size(), std::size_t(0));
     }
 
+    void testAssign()
+    {
+        ContainerCell<MockCell, 8> container;
+        container.insert(100, MockCell(100));
+
+        std::vector<int> keys;
+        keys << 7 << 3 << 9 << 1 << 3 << 5;
+        std::vector<MockCell> cargo;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            cargo << MockCell(keys[i]);
+        }
+
+        container.assign(keys.begin(), keys.end(), cargo.begin());
+        TS_ASSERT_EQUALS(std::size_t(5), container.size());
+        int expected[] = { 1, 3, 5, 7, 9 };
+        for (int i = 0; i < 5; ++i) {
+            TS_ASSERT_EQUALS(expected[i], container.ids[i]);
+            TS_ASSERT_EQUALS(expected[i], container.cells[i].id);
+        }
+        TS_ASSERT_EQUALS(container[100], (void*)0);
+
+        keys << 11 << 12 << 13 << 14;
+        cargo.resize(keys.size());
+        TS_ASSERT_THROWS(container.assign(keys.begin(), keys.end(), cargo.begin()), std::logic_error);
+    }
+
+    void testMerge()
+    {
+        ContainerCell<MockCell, 8> container;
+        container.insert(2, MockCell(2));
+        container.insert(4, MockCell(4));
+        container.insert(8, MockCell(8));
+
+        std::vector<int> keys;
+        keys << 1 << 4 << 5 << 9;
+        std::vector<MockCell> cargo;
+        cargo << MockCell(1) << MockCell(-4) << MockCell(5) << MockCell(9);
+
+        container.merge(keys.begin(), keys.end(), cargo.begin());
+        TS_ASSERT_EQUALS(std::size_t(6), container.size());
+        int expectedIDs[]   = { 1, 2,  4, 5, 8, 9 };
+        int expectedCargo[] = { 1, 2, -4, 5, 8, 9 };
+        for (int i = 0; i < 6; ++i) {
+            TS_ASSERT_EQUALS(expectedIDs[i], container.ids[i]);
+            TS_ASSERT_EQUALS(expectedCargo[i], container.cells[i].id);
+        }
+
+        // capacity would be exceeded, container has to remain intact:
+        keys.clear();
+        keys << 0 << 3 << 6;
+        cargo.resize(3);
+        TS_ASSERT_THROWS(container.merge(keys.begin(), keys.end(), cargo.begin()), std::logic_error);
+        TS_ASSERT_EQUALS(std::size_t(6), container.size());
+        TS_ASSERT_EQUALS(5, container[5]->id);
+
+        container.clear();
+        container.merge(keys.begin(), keys.begin() + 2, cargo.begin());
+        TS_ASSERT_EQUALS(std::size_t(2), container.size());
+        TS_ASSERT_EQUALS(3, container.ids[1]);
+    }
+
+    void testBatchRemove()
+    {
+        ContainerCell<MockCell, 8> container;
+        for (int i = 0; i < 8; ++i) {
+            container.insert(i * 10, MockCell(i * 10));
+        }
+
+        std::vector<int> keys;
+        keys << -5 << 0 << 30 << 35 << 40 << 70 << 80;
+        TS_ASSERT_EQUALS(std::size_t(4), container.remove(keys.begin(), keys.end()));
+
+        int expected[] = { 10, 20, 50, 60 };
+        TS_ASSERT_EQUALS(std::size_t(4), container.size());
+        for (int i = 0; i < 4; ++i) {
+            TS_ASSERT_EQUALS(expected[i], container.ids[i]);
+            TS_ASSERT_EQUALS(expected[i], container.cells[i].id);
+        }
+    }
+
+    void testRemoveIf()
+    {
+        ContainerCell<MockCell, 8> container;
+        for (int i = 0; i < 8; ++i) {
+            container.insert(i, MockCell(i * 10));
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(3), container.removeIf(IDGreaterThan(40)));
+        TS_ASSERT_EQUALS(std::size_t(5), container.size());
+        for (int i = 0; i < 5; ++i) {
+            TS_ASSERT_EQUALS(i, container.ids[i]);
+            TS_ASSERT_EQUALS(i * 10, container[i]->id);
+        }
+    }
+
+    void testLookupWithSparseAndDenseKeys()
+    {
+        ContainerCell<MockCell, 100> container;
+        for (int i = 0; i < 100; ++i) {
+            container.insert(i + 1000, MockCell(i));
+        }
+
+        // dense keys are indexed directly:
+        for (int i = 0; i < 100; ++i) {
+            TS_ASSERT_EQUALS(container.cells + i, container[i + 1000]);
+        }
+        TS_ASSERT_EQUALS(container[999],  (void*)0);
+        TS_ASSERT_EQUALS(container[1100], (void*)0);
+
+        container.remove(1050);
+        TS_ASSERT_EQUALS(container[1050], (void*)0);
+        TS_ASSERT_EQUALS(51, container[1051]->id);
+        TS_ASSERT_EQUALS(99, container[1099]->id);
+
+        ContainerCell<MockCell, 4, Coord<2> > coordContainer;
+        coordContainer.insert(Coord<2>(1, 2), MockCell(12));
+        coordContainer.insert(Coord<2>(0, 5), MockCell(5));
+        TS_ASSERT_EQUALS(12, coordContainer[Coord<2>(1, 2)]->id);
+        TS_ASSERT_EQUALS(5,  coordContainer[Coord<2>(0, 5)]->id);
+        TS_ASSERT_EQUALS(coordContainer[Coord<2>(1, 1)], (void*)0);
+    }
+
+    void testLookupWithExtremeKeys()
+    {
+        ContainerCell<MockCell, 4> container;
+        container.insert(INT_MIN, MockCell(1));
+        container.insert(INT_MAX, MockCell(2));
+        TS_ASSERT_EQUALS(1, container[INT_MIN]->id);
+        TS_ASSERT_EQUALS(2, container[INT_MAX]->id);
+        TS_ASSERT_EQUALS(container[0],           (void*)0);
+        TS_ASSERT_EQUALS(container[INT_MIN + 1], (void*)0);
+
+        container.insert(INT_MIN + 1, MockCell(3));
+        container.remove(INT_MAX);
+        TS_ASSERT_EQUALS(container.cells + 1, container[INT_MIN + 1]);
+        TS_ASSERT_EQUALS(container[INT_MAX], (void*)0);
+
+        ContainerCell<MockCell, 4, long long> longContainer;
+        longContainer.insert(LLONG_MIN, MockCell(4));
+        longContainer.insert(LLONG_MAX - 1, MockCell(5));
+        longContainer.insert(LLONG_MAX, MockCell(6));
+        TS_ASSERT_EQUALS(4, longContainer[LLONG_MIN]->id);
+        TS_ASSERT_EQUALS(5, longContainer[LLONG_MAX - 1]->id);
+        TS_ASSERT_EQUALS(6, longContainer[LLONG_MAX]->id);
+        TS_ASSERT_EQUALS(longContainer[0], (void*)0);
+
+        ContainerCell<MockCell, 4, unsigned> unsignedContainer;
+        unsignedContainer.insert(0u, MockCell(7));
+        unsignedContainer.insert(UINT_MAX, MockCell(8));
+        TS_ASSERT_EQUALS(7, unsignedContainer[0u]->id);
+        TS_ASSERT_EQUALS(8, unsignedContainer[UINT_MAX]->id);
+        TS_ASSERT_EQUALS(unsignedContainer[1u], (void*)0);
+    }
+
     void testUpdate()
     {
         std::vector<int> ids;
@@ -210,6 +365,23 @@ public:
             }
         }
     }
+
+private:
+    class IDGreaterThan
+    {
+    public:
+        explicit IDGreaterThan(int limit) :
+            limit(limit)
+        {}
+
+        bool operator()(int /* key */, const MockCell& cell) const
+        {
+            return cell.id > limit;
+        }
+
+    private:
+        int limit;
+    };
 };
 
 }
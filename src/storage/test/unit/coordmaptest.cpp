@@ -0,0 +1,43 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CoordMapTest_init = false;
+#include "/root/repo/src/storage/test/unit/coordmaptest.h"
+
+static CoordMapTest suite_CoordMapTest;
+
+static CxxTest::List Tests_CoordMapTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CoordMapTest( "/root/repo/src/storage/test/unit/coordmaptest.h", 9, "CoordMapTest", suite_CoordMapTest, Tests_CoordMapTest );
+
+static class TestDescription_suite_CoordMapTest_testSquareBracketsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordMapTest_testSquareBracketsOperator() : CxxTest::RealTestDescription( Tests_CoordMapTest, suiteDescription_CoordMapTest, 13, "testSquareBracketsOperator" ) {}
+ void runTest() { suite_CoordMapTest.testSquareBracketsOperator(); }
+} testDescription_suite_CoordMapTest_testSquareBracketsOperator;
+
+static class TestDescription_suite_CoordMapTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordMapTest_testToString() : CxxTest::RealTestDescription( Tests_CoordMapTest, suiteDescription_CoordMapTest, 41, "testToString" ) {}
+ void runTest() { suite_CoordMapTest.testToString(); }
+} testDescription_suite_CoordMapTest_testToString;
+
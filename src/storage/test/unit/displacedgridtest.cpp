@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DisplacedGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/displacedgridtest.h"
+
+static DisplacedGridTest suite_DisplacedGridTest;
+
+static CxxTest::List Tests_DisplacedGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DisplacedGridTest( "/root/repo/src/storage/test/unit/displacedgridtest.h", 38, "DisplacedGridTest", suite_DisplacedGridTest, Tests_DisplacedGridTest );
+
+static class TestDescription_suite_DisplacedGridTest_testBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testBox() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 42, "testBox" ) {}
+ void runTest() { suite_DisplacedGridTest.testBox(); }
+} testDescription_suite_DisplacedGridTest_testBox;
+
+static class TestDescription_suite_DisplacedGridTest_testPaste : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testPaste() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 51, "testPaste" ) {}
+ void runTest() { suite_DisplacedGridTest.testPaste(); }
+} testDescription_suite_DisplacedGridTest_testPaste;
+
+static class TestDescription_suite_DisplacedGridTest_testSetOrigin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testSetOrigin() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 95, "testSetOrigin" ) {}
+ void runTest() { suite_DisplacedGridTest.testSetOrigin(); }
+} testDescription_suite_DisplacedGridTest_testSetOrigin;
+
+static class TestDescription_suite_DisplacedGridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testResize() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 113, "testResize" ) {}
+ void runTest() { suite_DisplacedGridTest.testResize(); }
+} testDescription_suite_DisplacedGridTest_testResize;
+
+static class TestDescription_suite_DisplacedGridTest_testGetSetManyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testGetSetManyCells() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 133, "testGetSetManyCells" ) {}
+ void runTest() { suite_DisplacedGridTest.testGetSetManyCells(); }
+} testDescription_suite_DisplacedGridTest_testGetSetManyCells;
+
+static class TestDescription_suite_DisplacedGridTest_testFill3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testFill3D() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 166, "testFill3D" ) {}
+ void runTest() { suite_DisplacedGridTest.testFill3D(); }
+} testDescription_suite_DisplacedGridTest_testFill3D;
+
+static class TestDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 194, "testTopologicalNormalizationWithTorus" ) {}
+ void runTest() { suite_DisplacedGridTest.testTopologicalNormalizationWithTorus(); }
+} testDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus;
+
+static class TestDescription_suite_DisplacedGridTest_testLoadSaveMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testLoadSaveMember() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 237, "testLoadSaveMember" ) {}
+ void runTest() { suite_DisplacedGridTest.testLoadSaveMember(); }
+} testDescription_suite_DisplacedGridTest_testLoadSaveMember;
+
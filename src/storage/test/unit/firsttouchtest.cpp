@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FirstTouchTest_init = false;
+#include "/root/repo/src/storage/test/unit/firsttouchtest.h"
+
+static FirstTouchTest suite_FirstTouchTest;
+
+static CxxTest::List Tests_FirstTouchTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FirstTouchTest( "/root/repo/src/storage/test/unit/firsttouchtest.h", 11, "FirstTouchTest", suite_FirstTouchTest, Tests_FirstTouchTest );
+
+static class TestDescription_suite_FirstTouchTest_testTouch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchTest_testTouch() : CxxTest::RealTestDescription( Tests_FirstTouchTest, suiteDescription_FirstTouchTest, 14, "testTouch" ) {}
+ void runTest() { suite_FirstTouchTest.testTouch(); }
+} testDescription_suite_FirstTouchTest_testTouch;
+
+static class TestDescription_suite_FirstTouchTest_testFill : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchTest_testFill() : CxxTest::RealTestDescription( Tests_FirstTouchTest, suiteDescription_FirstTouchTest, 25, "testFill" ) {}
+ void runTest() { suite_FirstTouchTest.testFill(); }
+} testDescription_suite_FirstTouchTest_testFill;
+
+static class TestDescription_suite_FirstTouchTest_testCopy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchTest_testCopy() : CxxTest::RealTestDescription( Tests_FirstTouchTest, suiteDescription_FirstTouchTest, 41, "testCopy" ) {}
+ void runTest() { suite_FirstTouchTest.testCopy(); }
+} testDescription_suite_FirstTouchTest_testCopy;
+
+static class TestDescription_suite_FirstTouchTest_testAllocator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FirstTouchTest_testAllocator() : CxxTest::RealTestDescription( Tests_FirstTouchTest, suiteDescription_FirstTouchTest, 61, "testAllocator" ) {}
+ void runTest() { suite_FirstTouchTest.testAllocator(); }
+} testDescription_suite_FirstTouchTest_testAllocator;
+
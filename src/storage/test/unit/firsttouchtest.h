@@ -0,0 +1,77 @@
+#include <cxxtest/TestSuite.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/firsttouch.h>
+
+#include <vector>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class FirstTouchTest : public CxxTest::TestSuite
+{
+public:
+    void testTouch()
+    {
+        std::vector<char> buffer(3 * FirstTouch::PAGE_SIZE + 5, 1);
+        FirstTouch::touch(&buffer[0], buffer.size());
+
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            char expected = (i % FirstTouch::PAGE_SIZE) ? 1 : 0;
+            TS_ASSERT_EQUALS(expected, buffer[i]);
+        }
+    }
+
+    void testFill()
+    {
+        CoordBox<3> box(Coord<3>(10, 20, 30), Coord<3>(40, 30, 20));
+        DisplacedGrid<int, Topologies::Cube<3>::Topology> grid(box, -1);
+
+        Region<3> region;
+        region << CoordBox<3>(Coord<3>(15, 20, 30), Coord<3>(10, 10, 20))
+               << CoordBox<3>(Coord<3>(30, 40, 40), Coord<3>(20, 10,  5));
+        FirstTouch::fill<int, 3>(&grid, region, 47);
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            int expected = region.count(*i) ? 47 : -1;
+            TS_ASSERT_EQUALS(expected, grid[*i]);
+        }
+    }
+
+    void testCopy()
+    {
+        CoordBox<2> box(Coord<2>(5, 5), Coord<2>(100, 50));
+        DisplacedGrid<double> source(box);
+        DisplacedGrid<double> target(box, -1);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            source[*i] = i->y() * 1000 + i->x();
+        }
+
+        Region<2> region;
+        region << CoordBox<2>(Coord<2>(10, 10), Coord<2>(50, 40));
+        FirstTouch::copy<double, 2>(source, &target, region);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            double expected = region.count(*i) ? source[*i] : -1;
+            TS_ASSERT_EQUALS(expected, target[*i]);
+        }
+    }
+
+    void testAllocator()
+    {
+        FirstTouchAllocator<double, 64> allocator(true);
+        TS_ASSERT(allocator.firstTouchEnabled());
+
+        FirstTouchAllocator<int, 64>::rebind<char>::other rebound(allocator);
+        TS_ASSERT(rebound.firstTouchEnabled());
+
+        double *data = allocator.allocate(10000);
+        TS_ASSERT_EQUALS(0, reinterpret_cast<std::size_t>(data) % 64);
+        std::fill(data, data + 10000, 1.0);
+        TS_ASSERT_EQUALS(1.0, data[9999]);
+        allocator.deallocate(data, 10000);
+    }
+};
+
+}
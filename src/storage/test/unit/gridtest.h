@@ -104,6 +104,19 @@ public:
         TS_ASSERT_EQUALS(47.11, g[Coord<2>(-1, -1)]);
     }
 
+    void testParallelFirstTouch()
+    {
+        Coord<3> dim(30, 20, 10);
+        Grid<double, Topologies::Cube<3>::Topology> expected(dim, 14.16, 47.11);
+        Grid<double, Topologies::Cube<3>::Topology> actual(dim, 14.16, 47.11, true);
+
+        TS_ASSERT_EQUALS(expected, actual);
+        TS_ASSERT_EQUALS(47.11, actual[Coord<3>(-1, -1, -1)]);
+
+        actual.resize(Coord<3>(40, 20, 10));
+        TS_ASSERT_EQUALS(Coord<3>(40, 20, 10), actual.getDimensions());
+    }
+
     void testMultiDimensionalConstructor()
     {
         Coord<3> dim(3, 4, 5);
@@ -0,0 +1,57 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_GridVecConvTest_init = false;
+#include "/root/repo/src/storage/test/unit/gridvecconvtest.h"
+
+static GridVecConvTest suite_GridVecConvTest;
+
+static CxxTest::List Tests_GridVecConvTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GridVecConvTest( "/root/repo/src/storage/test/unit/gridvecconvtest.h", 95, "GridVecConvTest", suite_GridVecConvTest, Tests_GridVecConvTest );
+
+static class TestDescription_suite_GridVecConvTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridVecConvTest_testBasic() : CxxTest::RealTestDescription( Tests_GridVecConvTest, suiteDescription_GridVecConvTest, 104, "testBasic" ) {}
+ void runTest() { suite_GridVecConvTest.testBasic(); }
+} testDescription_suite_GridVecConvTest_testBasic;
+
+static class TestDescription_suite_GridVecConvTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridVecConvTest_testSoA() : CxxTest::RealTestDescription( Tests_GridVecConvTest, suiteDescription_GridVecConvTest, 151, "testSoA" ) {}
+ void runTest() { suite_GridVecConvTest.testSoA(); }
+} testDescription_suite_GridVecConvTest_testSoA;
+
+static class TestDescription_suite_GridVecConvTest_testBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridVecConvTest_testBoostSerialization() : CxxTest::RealTestDescription( Tests_GridVecConvTest, suiteDescription_GridVecConvTest, 185, "testBoostSerialization" ) {}
+ void runTest() { suite_GridVecConvTest.testBoostSerialization(); }
+} testDescription_suite_GridVecConvTest_testBoostSerialization;
+
+static class TestDescription_suite_GridVecConvTest_testBinarySerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridVecConvTest_testBinarySerialization() : CxxTest::RealTestDescription( Tests_GridVecConvTest, suiteDescription_GridVecConvTest, 267, "testBinarySerialization" ) {}
+ void runTest() { suite_GridVecConvTest.testBinarySerialization(); }
+} testDescription_suite_GridVecConvTest_testBinarySerialization;
+
@@ -2,6 +2,7 @@
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/storage/gridvecconv.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
 #include <libgeodecomp/storage/soagrid.h>
 
 using namespace LibGeoDecomp;
@@ -72,6 +73,25 @@ public:
     int temperature;
 };
 
+/**
+ * Test model for use with BinaryOutputArchive/BinaryInputArchive
+ */
+class VariableSizeCell
+{
+public:
+    class API : public APITraits::HasBinarySerialization
+    {};
+
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & temperature & neighbors;
+    }
+
+    int temperature;
+    std::vector<Coord<2> > neighbors;
+};
+
 class GridVecConvTest : public CxxTest::TestSuite
 {
 public:
@@ -243,6 +263,43 @@ public:
         TS_ASSERT_EQUALS(gridB[Coord<2>(20, 19)].size(), 7);
 #endif
     }
+
+    void testBinarySerialization()
+    {
+        CoordBox<2> box(Coord<2>(10, 10), Coord<2>(30, 20));
+        DisplacedGrid<VariableSizeCell> gridA(box);
+        DisplacedGrid<VariableSizeCell> gridB(box);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            gridA[*i].temperature = i->x() * 100 + i->y();
+            for (int j = 0; j < (i->x() % 4); ++j) {
+                gridA[*i].neighbors << *i + Coord<2>(j, 0);
+            }
+        }
+
+        Region<2> region;
+        region << Streak<2>(Coord<2>(10, 11), 15)
+               << Streak<2>(Coord<2>(10, 19), 40);
+
+        std::vector<char> buffer = SerializationBuffer<VariableSizeCell>::create(region);
+        GridVecConv::gridToVector(gridA, &buffer, region);
+        GridVecConv::vectorToGrid(buffer, &gridB, region);
+
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            if (region.count(*i)) {
+                TS_ASSERT_EQUALS(gridA[*i].temperature, gridB[*i].temperature);
+                TS_ASSERT_EQUALS(gridA[*i].neighbors,   gridB[*i].neighbors);
+            } else {
+                TS_ASSERT_EQUALS(std::size_t(0), gridB[*i].neighbors.size());
+            }
+        }
+
+        buffer.pop_back();
+        TS_ASSERT_THROWS(GridVecConv::vectorToGrid(buffer, &gridB, region), std::logic_error&);
+        buffer.push_back(0);
+        buffer.push_back(0);
+        TS_ASSERT_THROWS(GridVecConv::vectorToGrid(buffer, &gridB, region), std::logic_error&);
+    }
 };
 
 }
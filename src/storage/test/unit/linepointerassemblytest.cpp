@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_LinePointerAssemblyTest_init = false;
+#include "/root/repo/src/storage/test/unit/linepointerassemblytest.h"
+
+static LinePointerAssemblyTest suite_LinePointerAssemblyTest;
+
+static CxxTest::List Tests_LinePointerAssemblyTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LinePointerAssemblyTest( "/root/repo/src/storage/test/unit/linepointerassemblytest.h", 9, "LinePointerAssemblyTest", suite_LinePointerAssemblyTest, Tests_LinePointerAssemblyTest );
+
+static class TestDescription_suite_LinePointerAssemblyTest_testMoore2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerAssemblyTest_testMoore2D() : CxxTest::RealTestDescription( Tests_LinePointerAssemblyTest, suiteDescription_LinePointerAssemblyTest, 12, "testMoore2D" ) {}
+ void runTest() { suite_LinePointerAssemblyTest.testMoore2D(); }
+} testDescription_suite_LinePointerAssemblyTest_testMoore2D;
+
@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MeshlessAdapterTest_init = false;
+#include "/root/repo/src/storage/test/unit/meshlessadaptertest.h"
+
+static MeshlessAdapterTest suite_MeshlessAdapterTest;
+
+static CxxTest::List Tests_MeshlessAdapterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MeshlessAdapterTest( "/root/repo/src/storage/test/unit/meshlessadaptertest.h", 10, "MeshlessAdapterTest", suite_MeshlessAdapterTest, Tests_MeshlessAdapterTest );
+
+static class TestDescription_suite_MeshlessAdapterTest_test1d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test1d() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 14, "test1d" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test1d(); }
+} testDescription_suite_MeshlessAdapterTest_test1d;
+
+static class TestDescription_suite_MeshlessAdapterTest_test1dCube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test1dCube() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 81, "test1dCube" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test1dCube(); }
+} testDescription_suite_MeshlessAdapterTest_test1dCube;
+
+static class TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 115, "testBoxSizeDetermination" ) {}
+ void runTest() { suite_MeshlessAdapterTest.testBoxSizeDetermination(); }
+} testDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination;
+
+static class TestDescription_suite_MeshlessAdapterTest_testBinMatchesInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_testBinMatchesInsert() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 141, "testBinMatchesInsert" ) {}
+ void runTest() { suite_MeshlessAdapterTest.testBinMatchesInsert(); }
+} testDescription_suite_MeshlessAdapterTest_testBinMatchesInsert;
+
+static class TestDescription_suite_MeshlessAdapterTest_test3dTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test3dTorus() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 183, "test3dTorus" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test3dTorus(); }
+} testDescription_suite_MeshlessAdapterTest_test3dTorus;
+
+static class TestDescription_suite_MeshlessAdapterTest_test3dCube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test3dCube() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 188, "test3dCube" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test3dCube(); }
+} testDescription_suite_MeshlessAdapterTest_test3dCube;
+
+static class TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination3d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination3d() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 193, "testBoxSizeDetermination3d" ) {}
+ void runTest() { suite_MeshlessAdapterTest.testBoxSizeDetermination3d(); }
+} testDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination3d;
+
@@ -1,4 +1,5 @@
 #include <cxxtest/TestSuite.h>
+#include <libgeodecomp/misc/random.h>
 #include <libgeodecomp/misc/testhelper.h>
 #include <libgeodecomp/storage/meshlessadapter.h>
 
@@ -136,6 +137,138 @@ public:
         adapter.resetBoxSize(0.47);
         TS_ASSERT_EQUALS_DOUBLE(0.5, adapter.findOptimumBoxSize(positions, graph));
     }
+
+    void testBinMatchesInsert()
+    {
+        typedef MeshlessAdapter<Topologies::Torus<2>::Topology> AdapterType;
+
+        FloatCoord<2> dim(20, 10);
+        AdapterType adapter(dim, 1.5);
+        AdapterType::CoordVec positions = randomPositions(dim, 500);
+
+        AdapterType::CoordListGrid grid = adapter.grid();
+        for (AdapterType::CoordVec::iterator i = positions.begin(); i != positions.end(); ++i) {
+            adapter.insert(&grid, i->first, i->second);
+        }
+        AdapterType::CellList cells = adapter.bin(positions);
+
+        TS_ASSERT_EQUALS(Coord<2>(13, 6), cells.dimensions);
+        TS_ASSERT_EQUALS(std::size_t(13 * 6 + 1), cells.offsets.size());
+        TS_ASSERT_EQUALS(std::size_t(500), cells.entries.size());
+        TS_ASSERT_EQUALS(std::size_t(500), cells.offsets.back());
+
+        // vertices retain their original order within each container cell:
+        CoordBox<2> box(Coord<2>(), cells.dimensions);
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            AdapterType::CoordVec expected(grid[*i].begin(), grid[*i].end());
+            AdapterType::CoordVec actual(cells.begin(*i), cells.end(*i));
+            TS_ASSERT_EQUALS(expected, actual);
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            FloatCoord<2> pos(Random::gen_d(dim[0]), Random::gen_d(dim[1]));
+            std::set<int> expected;
+            std::set<int> actual;
+            bool expectedFound = adapter.search(grid, pos, &expected);
+            bool actualFound = adapter.search(cells, pos, &actual);
+
+            TS_ASSERT_EQUALS(expectedFound, actualFound);
+            TS_ASSERT_EQUALS(expected, actual);
+        }
+
+        TS_ASSERT_EQUALS(positions.size(), adapter.findAllPositions(grid).size());
+        TS_ASSERT_EQUALS_DOUBLE(500.0 / (13 * 6), adapter.reportFillLevels(positions)["averageFill"]);
+    }
+
+    void test3dTorus()
+    {
+        check3d<Topologies::Torus<3>::Topology>();
+    }
+
+    void test3dCube()
+    {
+        check3d<Topologies::Cube<3>::Topology>();
+    }
+
+    void testBoxSizeDetermination3d()
+    {
+        typedef MeshlessAdapter<Topologies::Torus<3>::Topology> AdapterType;
+
+        // a 8x4x2 lattice with a spacing of 0.5, each vertex being
+        // connected to its neighbors along all axes:
+        Coord<3> lattice(8, 4, 2);
+        FloatCoord<3> dim(4, 2, 1);
+        AdapterType adapter(dim, 0.3);
+
+        AdapterType::CoordVec positions;
+        AdapterType::Graph graph;
+        CoordBox<3> box(Coord<3>(), lattice);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            int id = i->toIndex(lattice);
+            positions << std::make_pair(FloatCoord<3>(*i) * 0.5, id);
+
+            std::vector<int> neighbors;
+            for (int d = 0; d < 3; ++d) {
+                Coord<3> delta;
+                delta[d] = 1;
+                neighbors << Topologies::Torus<3>::Topology::normalize(*i + delta, lattice).toIndex(lattice);
+                neighbors << Topologies::Torus<3>::Topology::normalize(*i - delta, lattice).toIndex(lattice);
+            }
+            graph << neighbors;
+        }
+
+        TS_ASSERT(!adapter.checkBoxSize(positions, graph));
+        TS_ASSERT_EQUALS_DOUBLE(0.5, adapter.findOptimumBoxSize(positions, graph));
+        TS_ASSERT_EQUALS(Coord<3>(8, 4, 2), adapter.getDiscreteDim());
+    }
+
+private:
+    template<int DIM>
+    std::vector<std::pair<FloatCoord<DIM>, int> > randomPositions(const FloatCoord<DIM>& dim, int num)
+    {
+        Random::seed(47);
+        std::vector<std::pair<FloatCoord<DIM>, int> > ret;
+
+        for (int i = 0; i < num; ++i) {
+            FloatCoord<DIM> pos;
+            for (int d = 0; d < DIM; ++d) {
+                pos[d] = Random::gen_d(dim[d]);
+            }
+            ret << std::make_pair(pos, i);
+        }
+
+        return ret;
+    }
+
+    /**
+     * compares the CellList search against a brute force search.
+     */
+    template<typename TOPOLOGY>
+    void check3d()
+    {
+        typedef MeshlessAdapter<TOPOLOGY> AdapterType;
+
+        FloatCoord<3> dim(8, 6, 5);
+        AdapterType adapter(dim, 1.2);
+        typename AdapterType::CoordVec positions = randomPositions(dim, 400);
+        typename AdapterType::CellList cells = adapter.bin(positions);
+        TS_ASSERT_EQUALS(Coord<3>(6, 5, 4), cells.dimensions);
+
+        for (int i = 0; i < 50; ++i) {
+            FloatCoord<3> pos(Random::gen_d(dim[0]), Random::gen_d(dim[1]), Random::gen_d(dim[2]));
+            std::set<int> expected;
+            for (typename AdapterType::CoordVec::iterator j = positions.begin(); j != positions.end(); ++j) {
+                if (adapter.distance2(pos, j->first) < 1.2 * 1.2) {
+                    expected.insert(j->second);
+                }
+            }
+
+            std::set<int> actual;
+            bool found = adapter.search(cells, pos, &actual);
+            TS_ASSERT_EQUALS(!expected.empty(), found);
+            TS_ASSERT_EQUALS(expected, actual);
+        }
+    }
 };
 
 }
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PointerNeighborhoodTest_init = false;
+#include "/root/repo/src/storage/test/unit/pointerneighborhoodtest.h"
+
+static PointerNeighborhoodTest suite_PointerNeighborhoodTest;
+
+static CxxTest::List Tests_PointerNeighborhoodTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PointerNeighborhoodTest( "/root/repo/src/storage/test/unit/pointerneighborhoodtest.h", 8, "PointerNeighborhoodTest", suite_PointerNeighborhoodTest, Tests_PointerNeighborhoodTest );
+
+static class TestDescription_suite_PointerNeighborhoodTest_testMoore2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PointerNeighborhoodTest_testMoore2D() : CxxTest::RealTestDescription( Tests_PointerNeighborhoodTest, suiteDescription_PointerNeighborhoodTest, 11, "testMoore2D" ) {}
+ void runTest() { suite_PointerNeighborhoodTest.testMoore2D(); }
+} testDescription_suite_PointerNeighborhoodTest_testMoore2D;
+
+static class TestDescription_suite_PointerNeighborhoodTest_testMoore3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PointerNeighborhoodTest_testMoore3D() : CxxTest::RealTestDescription( Tests_PointerNeighborhoodTest, suiteDescription_PointerNeighborhoodTest, 31, "testMoore3D" ) {}
+ void runTest() { suite_PointerNeighborhoodTest.testMoore3D(); }
+} testDescription_suite_PointerNeighborhoodTest_testMoore3D;
+
+static class TestDescription_suite_PointerNeighborhoodTest_testVonNeumann3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PointerNeighborhoodTest_testVonNeumann3D() : CxxTest::RealTestDescription( Tests_PointerNeighborhoodTest, suiteDescription_PointerNeighborhoodTest, 76, "testVonNeumann3D" ) {}
+ void runTest() { suite_PointerNeighborhoodTest.testVonNeumann3D(); }
+} testDescription_suite_PointerNeighborhoodTest_testVonNeumann3D;
+
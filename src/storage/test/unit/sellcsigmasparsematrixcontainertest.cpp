@@ -0,0 +1,116 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SellCSigmaSparseMatrixContainerTest_init = false;
+#include "/root/repo/src/storage/test/unit/sellcsigmasparsematrixcontainertest.h"
+
+static SellCSigmaSparseMatrixContainerTest suite_SellCSigmaSparseMatrixContainerTest;
+
+static CxxTest::List Tests_SellCSigmaSparseMatrixContainerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SellCSigmaSparseMatrixContainerTest( "/root/repo/src/storage/test/unit/sellcsigmasparsematrixcontainertest.h", 16, "SellCSigmaSparseMatrixContainerTest", suite_SellCSigmaSparseMatrixContainerTest, Tests_SellCSigmaSparseMatrixContainerTest );
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_one : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_one() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 26, "testGetRow_one" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_one(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_one;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_two : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_two() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 115, "testGetRow_two" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_two(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_two;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_three : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_three() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 204, "testGetRow_three" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_three(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_three;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_fore : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_fore() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 294, "testGetRow_fore" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_fore(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_fore;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_five : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_five() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 384, "testGetRow_five" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_five(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_five;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_six : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_six() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 528, "testGetRow_six" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testGetRow_six(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testGetRow_six;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_diag : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_diag() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 577, "testMatVecMul_diag" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testMatVecMul_diag(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_diag;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_easy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_easy() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 622, "testMatVecMul_easy" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testMatVecMul_easy(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_easy;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_two : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_two() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 664, "testMatVecMul_two" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testMatVecMul_two(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testMatVecMul_two;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testEqualOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testEqualOperator() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 717, "testEqualOperator" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testEqualOperator(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testEqualOperator;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrix() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 743, "testInitFromMatrix" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testInitFromMatrix(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrix;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithoutSIGMA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithoutSIGMA() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 798, "testInitFromMatrixWithoutSIGMA" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testInitFromMatrixWithoutSIGMA(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithoutSIGMA;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA1() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 880, "testInitFromMatrixWithSIGMA1" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testInitFromMatrixWithSIGMA1(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA1;
+
+static class TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA2() : CxxTest::RealTestDescription( Tests_SellCSigmaSparseMatrixContainerTest, suiteDescription_SellCSigmaSparseMatrixContainerTest, 954, "testInitFromMatrixWithSIGMA2" ) {}
+ void runTest() { suite_SellCSigmaSparseMatrixContainerTest.testInitFromMatrixWithSIGMA2(); }
+} testDescription_suite_SellCSigmaSparseMatrixContainerTest_testInitFromMatrixWithSIGMA2;
+
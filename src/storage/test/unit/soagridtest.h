@@ -278,6 +278,31 @@ public:
         grid.callback(CheckCellValues(0 + oppositeSideOffset2, 51 + 4 + oppositeSideOffset2, 4));
     }
 
+    void testParallelFirstTouch()
+    {
+        CoordBox<3> box(Coord<3>(20, 25, 32), Coord<3>(51, 21, 15));
+        SoATestCell defaultCell(1);
+        SoATestCell edgeCell(2);
+
+        int oppositeSideOffset = (15 + 4 - 1) * 64 * 64 + (21 + 4 - 1) * 64;
+
+        SoAGrid<SoATestCell, Topologies::Cube<3>::Topology> grid(box, defaultCell, edgeCell, Coord<3>(), true);
+        grid.callback(CheckCellValues(0, 51 + 4, 2));
+        grid.callback(CheckCellValues(0 + oppositeSideOffset, 51 + 4 + oppositeSideOffset, 2));
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            TS_ASSERT_EQUALS(1, grid.get(*i).v);
+        }
+
+        CoordBox<2> box2D(Coord<2>(10, 5), Coord<2>(40, 30));
+        SoAGrid<SoATestCell, Topologies::Cube<2>::Topology> grid2D(box2D, defaultCell, edgeCell, Coord<2>(), true);
+        grid2D.callback(CheckCellValues(0, 40 + 4, 2));
+
+        for (CoordBox<2>::Iterator i = box2D.begin(); i != box2D.end(); ++i) {
+            TS_ASSERT_EQUALS(1, grid2D.get(*i).v);
+        }
+    }
+
     void testDisplacementWithTopologicalCorrectness()
     {
         CoordBox<3> box(Coord<3>(20, 25, 32), Coord<3>(50, 40, 35));
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredSoAGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredsoagridtest.h"
+
+static UnstructuredSoAGridTest suite_UnstructuredSoAGridTest;
+
+static CxxTest::List Tests_UnstructuredSoAGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredSoAGridTest( "/root/repo/src/storage/test/unit/unstructuredsoagridtest.h", 78, "UnstructuredSoAGridTest", suite_UnstructuredSoAGridTest, Tests_UnstructuredSoAGridTest );
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testConstructor() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 81, "testConstructor" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testConstructor(); }
+} testDescription_suite_UnstructuredSoAGridTest_testConstructor;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testGetAndSet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testGetAndSet() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 99, "testGetAndSet" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testGetAndSet(); }
+} testDescription_suite_UnstructuredSoAGridTest_testGetAndSet;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 113, "testSaveAndLoadMemberBasic" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testSaveAndLoadMemberBasic(); }
+} testDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 154, "testSaveAndLoadMember" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testSaveAndLoadMember(); }
+} testDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember;
+
@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredUpdateFunctorTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h"
+
+static UnstructuredUpdateFunctorTest suite_UnstructuredUpdateFunctorTest;
+
+static CxxTest::List Tests_UnstructuredUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredUpdateFunctorTest( "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h", 152, "UnstructuredUpdateFunctorTest", suite_UnstructuredUpdateFunctorTest, Tests_UnstructuredUpdateFunctorTest );
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 155, "testBasicSansUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 201, "testBasicWithUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 247, "testBasicWithSigmaButSansUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 300, "testBasicWithSigmaAndWithUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 352, "testSoA" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoA(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoA;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 405, "testSoAWithSIGMA" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMA(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA;
+
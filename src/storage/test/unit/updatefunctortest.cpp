@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UpdateFunctorTest_init = false;
+#include "/root/repo/src/storage/test/unit/updatefunctortest.h"
+
+static UpdateFunctorTest suite_UpdateFunctorTest;
+
+static CxxTest::List Tests_UpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UpdateFunctorTest( "/root/repo/src/storage/test/unit/updatefunctortest.h", 150, "UpdateFunctorTest", suite_UpdateFunctorTest, Tests_UpdateFunctorTest );
+
+static class TestDescription_suite_UpdateFunctorTest_testSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testSelector() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 153, "testSelector" ) {}
+ void runTest() { suite_UpdateFunctorTest.testSelector(); }
+} testDescription_suite_UpdateFunctorTest_testSelector;
+
+static class TestDescription_suite_UpdateFunctorTest_testMoore2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testMoore2D() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 165, "testMoore2D" ) {}
+ void runTest() { suite_UpdateFunctorTest.testMoore2D(); }
+} testDescription_suite_UpdateFunctorTest_testMoore2D;
+
+static class TestDescription_suite_UpdateFunctorTest_testMoore3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testMoore3D() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 171, "testMoore3D" ) {}
+ void runTest() { suite_UpdateFunctorTest.testMoore3D(); }
+} testDescription_suite_UpdateFunctorTest_testMoore3D;
+
+static class TestDescription_suite_UpdateFunctorTest_testVonNeumann2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testVonNeumann2D() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 177, "testVonNeumann2D" ) {}
+ void runTest() { suite_UpdateFunctorTest.testVonNeumann2D(); }
+} testDescription_suite_UpdateFunctorTest_testVonNeumann2D;
+
+static class TestDescription_suite_UpdateFunctorTest_testVonNeumann3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testVonNeumann3D() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 183, "testVonNeumann3D" ) {}
+ void runTest() { suite_UpdateFunctorTest.testVonNeumann3D(); }
+} testDescription_suite_UpdateFunctorTest_testVonNeumann3D;
+
+static class TestDescription_suite_UpdateFunctorTest_testStructOfArraysBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testStructOfArraysBasic() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 189, "testStructOfArraysBasic" ) {}
+ void runTest() { suite_UpdateFunctorTest.testStructOfArraysBasic(); }
+} testDescription_suite_UpdateFunctorTest_testStructOfArraysBasic;
+
+static class TestDescription_suite_UpdateFunctorTest_testStructOfArraysTestCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UpdateFunctorTest_testStructOfArraysTestCell() : CxxTest::RealTestDescription( Tests_UpdateFunctorTest, suiteDescription_UpdateFunctorTest, 221, "testStructOfArraysTestCell" ) {}
+ void runTest() { suite_UpdateFunctorTest.testStructOfArraysTestCell(); }
+} testDescription_suite_UpdateFunctorTest_testStructOfArraysTestCell;
+
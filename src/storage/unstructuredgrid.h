@@ -36,7 +36,8 @@ public:
         const Coord<DIM>& dim = Coord<DIM>(),
         const ELEMENT_TYPE& defaultElement = ELEMENT_TYPE(),
         const ELEMENT_TYPE& edgeElement = ELEMENT_TYPE(),
-        const Coord<DIM>& /* topological dimension is irrelevant here */ = Coord<DIM>()) :
+        const Coord<DIM>& /* topological dimension is irrelevant here */ = Coord<DIM>(),
+        bool /* parallelFirstTouch is not supported yet */ = false) :
         elements(dim.x(), defaultElement),
         edgeElement(edgeElement),
         dimension(dim)
@@ -52,7 +53,8 @@ public:
         const CoordBox<DIM> box,
         const ELEMENT_TYPE& defaultElement = ELEMENT_TYPE(),
         const ELEMENT_TYPE& edgeElement = ELEMENT_TYPE(),
-        const Coord<DIM>& /* topological dimension is irrelevant here */ = Coord<DIM>()) :
+        const Coord<DIM>& /* topological dimension is irrelevant here */ = Coord<DIM>(),
+        bool /* parallelFirstTouch is not supported yet */ = false) :
         elements(box.dimensions.x(), defaultElement),
         edgeElement(edgeElement),
         dimension(box.dimensions)
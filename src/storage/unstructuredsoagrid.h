@@ -120,7 +120,8 @@ public:
         const Coord<DIM>& dim = Coord<DIM>(),
         const ELEMENT_TYPE& defaultElement = ELEMENT_TYPE(),
         const ELEMENT_TYPE& edgeElement = ELEMENT_TYPE(),
-        const Coord<DIM>& topologicalDimensionIsIrrelevantHere = Coord<DIM>()) :
+        const Coord<DIM>& topologicalDimensionIsIrrelevantHere = Coord<DIM>(),
+        bool parallelFirstTouchIsNotSupportedYet = false) :
         elements(dim.x(), 1, 1),
         edgeElement(edgeElement),
         dimension(dim)
@@ -146,7 +147,8 @@ public:
     UnstructuredSoAGrid(const CoordBox<DIM> box,
                         const ELEMENT_TYPE& defaultElement = ELEMENT_TYPE(),
                         const ELEMENT_TYPE& edgeElement = ELEMENT_TYPE(),
-                        const Coord<DIM>& topologicalDimensionIsIrrelevantHere = Coord<DIM>()) :
+                        const Coord<DIM>& topologicalDimensionIsIrrelevantHere = Coord<DIM>(),
+                        bool parallelFirstTouchIsNotSupportedYet = false) :
         elements(box.dimensions.x(), 1, 1),
         edgeElement(edgeElement),
         dimension(box.dimensions)
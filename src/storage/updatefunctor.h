@@ -275,7 +275,7 @@ class ConcurrencyNoP
 {
 public:
     inline
-    explicit ConcurrencyNoP(bool /* unused */ = false, bool /* unused */ = false)
+    explicit ConcurrencyNoP(bool /* unused */ = false, bool /* unused */ = false, bool /* unused */ = false)
     {}
 
     bool enableOpenMP() const
@@ -297,20 +297,33 @@ public:
     {
         return false;
     }
+
+    bool preferStreakGranularity() const
+    {
+        return false;
+    }
 };
 
 /**
  * Unsurprisingly, this class requests the UpdateFunctor to use OpenMP
  * for parallelization. Flags can optionally steer the granularity and
- * dynamics of load distribution among the threads.
+ * dynamics of load distribution among the threads: updates of the
+ * ghost zone are scheduled dynamically, all others statically.
+ * Threads receive whole planes of the Region, or individual Streaks
+ * if enableStreakGranularity is set (which helps if there are fewer
+ * planes than threads or if planes are very irregular).
  */
 class ConcurrencyEnableOpenMP
 {
 public:
     inline
-    ConcurrencyEnableOpenMP(bool updatingGhost, bool enableFineGrainedParallelism) :
+    ConcurrencyEnableOpenMP(
+        bool updatingGhost,
+        bool enableFineGrainedParallelism,
+        bool enableStreakGranularity = false) :
         updatingGhost(updatingGhost),
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
+        enableFineGrainedParallelism(enableFineGrainedParallelism),
+        enableStreakGranularity(enableStreakGranularity)
     {}
 
     bool enableOpenMP() const
@@ -333,9 +346,15 @@ public:
         return enableFineGrainedParallelism;
     }
 
+    bool preferStreakGranularity() const
+    {
+        return enableStreakGranularity;
+    }
+
 private:
     bool updatingGhost;
     bool enableFineGrainedParallelism;
+    bool enableStreakGranularity;
 };
 
 /**
@@ -345,7 +364,7 @@ class ConcurrencyEnableHPX
 {
 public:
     inline
-    ConcurrencyEnableHPX(bool /* unused */, bool enableFineGrainedParallelism) :
+    ConcurrencyEnableHPX(bool /* unused */, bool enableFineGrainedParallelism, bool /* unused */ = false) :
         enableFineGrainedParallelism(enableFineGrainedParallelism)
     {}
 
@@ -369,6 +388,11 @@ public:
         return enableFineGrainedParallelism;
     }
 
+    bool preferStreakGranularity() const
+    {
+        return false;
+    }
+
 private:
     bool enableFineGrainedParallelism;
 };
@@ -5,12 +5,28 @@
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_1                         \
     if (concurrencySpec.enableOpenMP() &&                               \
         !modelThreadingSpec.hasOpenMP()) {                              \
+        typedef typename Region<DIM>::StreakIterator Iter;              \
+        if (concurrencySpec.preferStreakGranularity()) {                \
+            if (concurrencySpec.preferStaticScheduling()) {             \
+                _Pragma("omp parallel for schedule(static)")            \
+                for (std::size_t c = 0; c < region.numStreaks(); ++c) { \
+                    Iter i = region[c];                                 \
+                    LGD_UPDATE_FUNCTOR_BODY;                            \
+                }                                                       \
+            } else {                                                    \
+                _Pragma("omp parallel for schedule(dynamic)")           \
+                for (std::size_t c = 0; c < region.numStreaks(); ++c) { \
+                    Iter i = region[c];                                 \
+                    LGD_UPDATE_FUNCTOR_BODY;                            \
+                }                                                       \
+            }                                                           \
+            return;                                                     \
+        }                                                               \
+                                                                        \
         if (concurrencySpec.preferStaticScheduling()) {                 \
             _Pragma("omp parallel for schedule(static)")                \
             for (std::size_t c = 0; c < region.numPlanes(); ++c) {      \
-                typename Region<DIM>::StreakIterator e =                \
-                    region.planeStreakIterator(c + 1);                  \
-                typedef typename Region<DIM>::StreakIterator Iter;      \
+                Iter e = region.planeStreakIterator(c + 1);             \
                 for (Iter i = region.planeStreakIterator(c + 0);        \
                      i != e;                                            \
                      ++i) {                                             \
@@ -22,9 +38,7 @@
         } else {                                                        \
             _Pragma("omp parallel for schedule(dynamic)")               \
             for (std::size_t c = 0; c < region.numPlanes(); ++c) {      \
-                typename Region<DIM>::StreakIterator e =                \
-                    region.planeStreakIterator(c + 1);                  \
-                typedef typename Region<DIM>::StreakIterator Iter;      \
+                Iter e = region.planeStreakIterator(c + 1);             \
                 for (Iter i = region.planeStreakIterator(c + 0);        \
                      i != e;                                            \
                      ++i) {                                             \
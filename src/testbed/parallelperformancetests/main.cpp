@@ -3,11 +3,14 @@
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/communication/patchlink.h>
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
 #include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
 #include <libgeodecomp/geometry/partitionmanager.h>
 #include <libgeodecomp/io/collectingwriter.h>
+#include <libgeodecomp/io/compressedmpiio.h>
 #include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/mpiio.h>
 #include <libgeodecomp/misc/chronometer.h>
 #include <libgeodecomp/parallelization/nesting/stepper.h>
 #include <libgeodecomp/testbed/performancetests/cpubenchmark.h>
@@ -15,6 +18,8 @@
 #include <libflatarray/testbed/cpu_benchmark.hpp>
 #include <libflatarray/testbed/evaluate.hpp>
 
+#include <boost/filesystem.hpp>
+
 using namespace LibGeoDecomp;
 
 int cudaDevice;
@@ -250,34 +255,100 @@ private:
     std::string partitionName;
 };
 
-int main(int argc, char **argv)
+/**
+ * Writes a series of checkpoints of a grid in which only a small part
+ * changes between two checkpoints (e.g. a flood wave traveling
+ * through otherwise dry terrain). Results are per checkpoint.
+ */
+template<bool COMPRESSED>
+class CheckpointPerfTest : public CPUBenchmark
 {
-    MPI_Init(&argc, &argv);
+public:
+    std::string family()
+    {
+        return "Checkpoint<MySimpleCell>";
+    }
 
-    if ((argc < 3) || (argc == 4) || (argc > 5)) {
-        std::cerr << "usage: " << argv[0] << " [-n,--name SUBSTRING] REVISION CUDA_DEVICE \n"
-                  << "  - optional: only run tests whose name contains a SUBSTRING,\n"
-                  << "  - REVISION is purely for output reasons,\n"
-                  << "  - CUDA_DEVICE causes CUDA tests to run on the device with the given ID.\n";
-        return 1;
+    std::string species()
+    {
+        return COMPRESSED ? "compressed" : "raw";
     }
-    std::string name = "";
-    int argumentIndex = 1;
-    if (argc == 5) {
-        if ((std::string(argv[1]) == "-n") ||
-            (std::string(argv[1]) == "--name")) {
-            name = std::string(argv[2]);
+
+    double performance(std::vector<int> rawDim)
+    {
+        MPILayer mpiLayer;
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        typedef Grid<MySimpleCell, Topologies::Cube<3>::Topology> GridType;
+        GridType grid(dim);
+
+        CoordBox<3> box(Coord<3>(), dim);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid[*i].temp = 100.0 + i->z() * 0.5 + i->y() * 0.25;
         }
-        argumentIndex = 3;
+
+        int zOffsetStart = (mpiLayer.rank() + 0) * dim.z() / mpiLayer.size();
+        int zOffsetEnd =   (mpiLayer.rank() + 1) * dim.z() / mpiLayer.size();
+        Region<3> region;
+        region << CoordBox<3>(
+            Coord<3>(0, 0, zOffsetStart),
+            Coord<3>(dim.x(), dim.y(), zOffsetEnd - zOffsetStart));
+
+        MPIIO<MySimpleCell> mpiio;
+        CompressedMPIIO<MySimpleCell> compressedMPIIO;
+        std::string prefix = "checkpointperftest";
+        std::vector<std::string> files;
+        Coord<3> waveDim(dim.x() / 8, dim.y() / 8, dim.z());
+        double seconds = 0;
+
+        for (int step = 0; step < repeats(); ++step) {
+            CoordBox<3> wave(Coord<3>(step * waveDim.x(), 0, 0), waveDim);
+            for (CoordBox<3>::Iterator i = wave.begin(); i != wave.end(); ++i) {
+                grid[*i].temp += 0.125 * (1 + i->x() % 7);
+            }
+
+            ScopedTimer t(&seconds);
+            if (COMPRESSED) {
+                compressedMPIIO.writeRegion(grid, dim, step, repeats(), prefix, region);
+                files << CompressedMPIIO<MySimpleCell>::filename(prefix, step);
+            } else {
+                std::ostringstream filename;
+                filename << prefix << step << ".mpiio";
+                mpiio.writeRegion(grid, dim, step, repeats(), filename.str(), region, MPI_DOUBLE);
+                files << filename.str();
+            }
+        }
+
+        mpiLayer.barrier();
+        if (mpiLayer.rank() == 0) {
+            for (std::size_t i = 0; i < files.size(); ++i) {
+                boost::filesystem::remove(files[i]);
+            }
+        }
+
+        return seconds / repeats();
     }
-    std::string revision = argv[argumentIndex + 0];
 
-    std::stringstream s;
-    s << argv[argumentIndex + 1];
-    int cudaDevice;
-    s >> cudaDevice;
+    std::string unit()
+    {
+        return "s";
+    }
 
-    LibFlatArray::evaluate eval(name, revision);
+private:
+    int repeats()
+    {
+        return 8;
+    }
+};
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+
+    LibFlatArray::evaluate eval;
+    if (!eval.parse_arguments(argc, argv)) {
+        MPI_Finalize();
+        return 1;
+    }
 
     bool output = MPILayer().rank() == 0;
     if (output) {
@@ -288,9 +359,14 @@ int main(int argc, char **argv)
     eval(CollectingWriterPerfTest<TestCell<3> >("TestCell<3> "),                               toVector(Coord<3>::diagonal(64)),  output);
     eval(PatchLinkPerfTest<MySimpleCell>("MySimpleCell"),                                      toVector(Coord<3>::diagonal(200)), output);
     eval(PatchLinkPerfTest<TestCell<3> >("TestCell<3> "),                                      toVector(Coord<3>::diagonal(64)),  output);
+    eval(CheckpointPerfTest<false>(),                                                          toVector(Coord<3>::diagonal(256)), output);
+    eval(CheckpointPerfTest<true>(),                                                           toVector(Coord<3>::diagonal(256)), output);
     eval(PartitionManagerBig3DPerfTest<RecursiveBisectionPartition<3> >("RecursiveBisection"), toVector(Coord<3>::diagonal(100)), output);
     eval(PartitionManagerBig3DPerfTest<ZCurvePartition<3> >("ZCurve"),                         toVector(Coord<3>::diagonal(100)), output);
+    eval(PartitionManagerBig3DPerfTest<HilbertPartition3D>("Hilbert3D"),                       toVector(Coord<3>::diagonal(100)), output);
+
+    int regressions = eval.finish(output);
 
     MPI_Finalize();
-    return 0;
+    return (regressions > 0) ? 2 : 0;
 }
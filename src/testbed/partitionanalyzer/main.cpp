@@ -0,0 +1,77 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/partitionanalyzer.h>
+#include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
+#include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/geometry/partitions/scotchpartition.h>
+#include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/geometry/topologies.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace LibGeoDecomp;
+
+template<typename T>
+T parse(const char *arg)
+{
+    std::stringstream buf;
+    buf << arg;
+    T ret;
+    buf >> ret;
+    return ret;
+}
+
+template<typename TOPOLOGY>
+void analyze(const Coord<3>& dim, std::size_t numRanks, unsigned ghostZoneWidth)
+{
+    typedef PartitionAnalyzer<TOPOLOGY> Analyzer;
+    Analyzer analyzer(dim, ghostZoneWidth);
+
+    std::cout << Analyzer::Report::header() << "\n";
+    std::cout << analyzer.template analyze<StripingPartition<3> >(          "Striping",           numRanks).toString() << "\n";
+    std::cout << analyzer.template analyze<CheckerboardingPartition<3> >(   "Checkerboarding",    numRanks).toString() << "\n";
+    std::cout << analyzer.template analyze<RecursiveBisectionPartition<3> >("RecursiveBisection", numRanks).toString() << "\n";
+    std::cout << analyzer.template analyze<ZCurvePartition<3> >(            "ZCurve",             numRanks).toString() << "\n";
+    std::cout << analyzer.template analyze<HilbertPartition3D>(             "Hilbert3D",          numRanks).toString() << "\n";
+#ifdef LIBGEODECOMP_WITH_SCOTCH
+    std::cout << analyzer.template analyze<ScotchPartition<3> >(            "Scotch",             numRanks).toString() << "\n";
+#endif
+
+    std::cout << "\nrecommendation: " << analyzer.recommendation().name << "\n";
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc < 5) || (argc > 7)) {
+        std::cerr << "usage: " << argv[0] << " DIM_X DIM_Y DIM_Z RANKS [GHOST_ZONE_WIDTH] [--torus]\n"
+                  << "  - analyzes how well the available partitions decompose a grid of the given\n"
+                  << "    size for the given number of MPI ranks (e.g. 10000) and recommends the one\n"
+                  << "    with the lowest predicted time per step,\n"
+                  << "  - GHOST_ZONE_WIDTH defaults to 1,\n"
+                  << "  - --torus selects periodic boundary conditions.\n";
+        return 1;
+    }
+
+    Coord<3> dim(parse<int>(argv[1]), parse<int>(argv[2]), parse<int>(argv[3]));
+    std::size_t numRanks = parse<std::size_t>(argv[4]);
+    unsigned ghostZoneWidth = 1;
+    bool torus = false;
+
+    for (int i = 5; i < argc; ++i) {
+        if (std::string(argv[i]) == "--torus") {
+            torus = true;
+        } else {
+            ghostZoneWidth = parse<unsigned>(argv[i]);
+        }
+    }
+
+    if (torus) {
+        analyze<Topologies::Torus<3>::Topology>(dim, numRanks, ghostZoneWidth);
+    } else {
+        analyze<Topologies::Cube<3>::Topology>(dim, numRanks, ghostZoneWidth);
+    }
+
+    return 0;
+}
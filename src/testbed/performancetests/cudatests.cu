@@ -601,10 +601,10 @@ public:
     }
 };
 
-void cudaTests(std::string name, std::string revision, int cudaDevice)
+void cudaTests(LibFlatArray::evaluate *evaluate)
 {
-    cudaSetDevice(cudaDevice);
-    LibFlatArray::evaluate eval(name, revision);
+    cudaSetDevice(evaluate->cuda_device());
+    LibFlatArray::evaluate& eval = *evaluate;
 
     int increment = 4;
 
@@ -2,6 +2,7 @@
 #include <libgeodecomp/misc/apitraits.h>
 #include <libgeodecomp/io/simpleinitializer.h>
 #include <libgeodecomp/misc/chronometer.h>
+#include <libgeodecomp/misc/scopedtimer.h>
 #include <libgeodecomp/geometry/convexpolytope.h>
 #include <libgeodecomp/geometry/coord.h>
 #include <libgeodecomp/geometry/floatcoord.h>
@@ -9,11 +10,15 @@
 #include <libgeodecomp/geometry/stencils.h>
 #include <libgeodecomp/geometry/partitions/hindexingpartition.h>
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition3d.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/storage/displacedgrid.h>
 #include <libgeodecomp/storage/grid.h>
+#include <libgeodecomp/storage/gridvecconv.h>
 #include <libgeodecomp/storage/linepointerassembly.h>
 #include <libgeodecomp/storage/linepointerupdatefunctor.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 #include <libgeodecomp/parallelization/openmpsimulator.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
@@ -736,7 +741,26 @@ public:
     }
 };
 
-class Jacobi3DVanilla : public CPUBenchmark
+/**
+ * Base for the 7-point Jacobi smoothers: six additions and one
+ * multiplication per update, which ideally reads and writes one
+ * double each.
+ */
+class Jacobi3DBenchmark : public CPUBenchmark
+{
+public:
+    double flops_per_update()
+    {
+        return 7;
+    }
+
+    double bytes_per_update()
+    {
+        return 2 * sizeof(double);
+    }
+};
+
+class Jacobi3DVanilla : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -813,7 +837,7 @@ public:
     }
 };
 
-class Jacobi3DSSE : public CPUBenchmark
+class Jacobi3DSSE : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -1022,6 +1046,212 @@ private:
 
 };
 
+/**
+ * Jacobi smoother with a data-dependent update: cells above a
+ * threshold are damped, and all results are clamped to a fixed
+ * range. The scalar flavor branches per cell, derived classes may
+ * override updateLine() to eliminate the branches via masks. Only
+ * the Jacobi flops count towards the roofline, the damping is
+ * conditional.
+ */
+class Jacobi3DClamped : public Jacobi3DBenchmark
+{
+public:
+    std::string family()
+    {
+        return "Jacobi3DClamped";
+    }
+
+    std::string species()
+    {
+        return "vanilla";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int dimX = dim.x();
+        int dimY = dim.y();
+        int dimZ = dim.z();
+        int offsetZ = dimX * dimY;
+        int maxT = 20;
+
+        double *gridOld = new double[dimX * dimY * dimZ];
+        double *gridNew = new double[dimX * dimY * dimZ];
+
+        for (int z = 0; z < dimZ; ++z) {
+            for (int y = 0; y < dimY; ++y) {
+                for (int x = 0; x < dimX; ++x) {
+                    // checkerboard pattern so that the branch is hard to predict:
+                    double value = ((x + y + z) % 3) ? 0.25 : 0.75;
+                    gridOld[z * offsetZ + y * dimX + x] = value;
+                    gridNew[z * offsetZ + y * dimX + x] = value;
+                }
+            }
+        }
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            for (int t = 0; t < maxT; ++t) {
+                for (int z = 1; z < (dimZ - 1); ++z) {
+                    for (int y = 1; y < (dimY - 1); ++y) {
+                        updateLine(&gridNew[z * offsetZ + y * dimX + 0],
+                                   &gridOld[z * offsetZ + y * dimX - offsetZ],
+                                   &gridOld[z * offsetZ + y * dimX - dimX],
+                                   &gridOld[z * offsetZ + y * dimX + 0],
+                                   &gridOld[z * offsetZ + y * dimX + dimX],
+                                   &gridOld[z * offsetZ + y * dimX + offsetZ],
+                                   1,
+                                   dimX - 1);
+                    }
+                }
+
+                std::swap(gridOld, gridNew);
+            }
+        }
+
+        if (gridOld[offsetZ + dimX + 1] == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        Coord<3> actualDim = dim - Coord<3>(2, 2, 2);
+        double updates = 1.0 * maxT * actualDim.prod();
+        double gLUPS = 1e-9 * updates / seconds;
+
+        delete[] gridOld;
+        delete[] gridNew;
+
+        return gLUPS;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+
+protected:
+    static double threshold()
+    {
+        return 0.5;
+    }
+
+    static double damping()
+    {
+        return 0.9;
+    }
+
+    static double offset()
+    {
+        return 0.01;
+    }
+
+    static double lowerBound()
+    {
+        return 0.1;
+    }
+
+    static double upperBound()
+    {
+        return 0.7;
+    }
+
+    virtual void updateLine(
+        double *target,
+        double *south,
+        double *top,
+        double *same,
+        double *bottom,
+        double *north,
+        int startX,
+        int endX)
+    {
+        for (int x = startX; x < endX; ++x) {
+            updatePoint(target, south, top, same, bottom, north, x);
+        }
+    }
+
+    void updatePoint(
+        double *target,
+        double *south,
+        double *top,
+        double *same,
+        double *bottom,
+        double *north,
+        int x)
+    {
+        double value =
+            (south[x] +
+             top[x] +
+             same[x - 1] + same[x + 0] + same[x + 1] +
+             bottom[x] +
+             north[x]) * (1.0 / 7.0);
+
+        if (same[x] > threshold()) {
+            value = value * damping() + offset();
+        }
+
+        target[x] = std::min(std::max(value, lowerBound()), upperBound());
+    }
+};
+
+/**
+ * Same kernel as Jacobi3DClamped, but vectorized via short_vec:
+ * the branch is replaced by a comparison mask and blend(), the clamp
+ * by min()/max() and the damping by fma().
+ */
+class Jacobi3DClampedShortVec : public Jacobi3DClamped
+{
+public:
+    std::string species()
+    {
+        return "short_vec";
+    }
+
+protected:
+    void updateLine(
+        double *target,
+        double *south,
+        double *top,
+        double *same,
+        double *bottom,
+        double *north,
+        int startX,
+        int endX)
+    {
+        typedef short_vec<double, 8> ShortVec;
+
+        int x = startX;
+        ShortVec oneSeventh = 1.0 / 7.0;
+        ShortVec thresholdVec = threshold();
+        ShortVec dampingVec = damping();
+        ShortVec offsetVec = offset();
+        ShortVec lowerBoundVec = lowerBound();
+        ShortVec upperBoundVec = upperBound();
+
+        for (; x < (endX - ShortVec::ARITY + 1); x += ShortVec::ARITY) {
+            ShortVec center = &same[x];
+            ShortVec value =
+                ShortVec(&south[x]) +
+                ShortVec(&top[x]) +
+                ShortVec(&same[x - 1]) + center + ShortVec(&same[x + 1]) +
+                ShortVec(&bottom[x]) +
+                ShortVec(&north[x]);
+            value *= oneSeventh;
+
+            value = blend(value, fma(value, dampingVec, offsetVec), center > thresholdVec);
+            value = min(max(value, lowerBoundVec), upperBoundVec);
+            value.store(&target[x]);
+        }
+
+        for (; x < endX; ++x) {
+            updatePoint(target, south, top, same, bottom, north, x);
+        }
+    }
+};
+
 template<typename CELL>
 class NoOpInitializer : public SimpleInitializer<CELL>
 {
@@ -1065,7 +1295,7 @@ public:
     double temp;
 };
 
-class Jacobi3DClassic : public CPUBenchmark
+class Jacobi3DClassic : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -1137,7 +1367,7 @@ public:
     double temp;
 };
 
-class Jacobi3DFixedHood : public CPUBenchmark
+class Jacobi3DFixedHood : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -1369,7 +1599,7 @@ LIBFLATARRAY_REGISTER_SOA(
     ((double)(temp))
                           )
 
-class Jacobi3DStreakUpdate : public CPUBenchmark
+class Jacobi3DStreakUpdate : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -1432,7 +1662,7 @@ public:
     }
 };
 
-class Jacobi3DStreakUpdateFunctor : public CPUBenchmark
+class Jacobi3DStreakUpdateFunctor : public Jacobi3DBenchmark
 {
 public:
     std::string family()
@@ -2526,6 +2756,17 @@ public:
     {
         return "GLUPS";
     }
+
+    double flops_per_update()
+    {
+        // roughly, as counted in LBMCell::updateFluid()
+        return 180;
+    }
+
+    double bytes_per_update()
+    {
+        return 2 * sizeof(LBMCell);
+    }
 };
 
 class LBMSoA : public CPUBenchmark
@@ -2570,9 +2811,88 @@ public:
     {
         return "GLUPS";
     }
+
+    double flops_per_update()
+    {
+        return 180;
+    }
+
+    double bytes_per_update()
+    {
+        return 2.0 * LibFlatArray::aggregated_member_size<LBMSoACell>::VALUE;
+    }
+
+    bool multithreaded()
+    {
+        return true;
+    }
+};
+
+/**
+ * Measures the effective memory bandwidth of the SoA LBM kernel with
+ * serial vs. NUMA-aware parallel initialization of the grids. The
+ * difference should only be visible on multi-socket machines.
+ */
+class LBMFirstTouch : public CPUBenchmark
+{
+public:
+    explicit LBMFirstTouch(bool enableFirstTouch) :
+        enableFirstTouch(enableFirstTouch)
+    {}
+
+    std::string family()
+    {
+        return "LBMFirstTouch";
+    }
+
+    std::string species()
+    {
+        return enableFirstTouch ? "first_touch" : "serial_init";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int maxT = 20;
+        OpenMPSimulator<LBMSoACell> sim(
+            new NoOpInitializer<LBMSoACell>(dim, maxT),
+            false,
+            enableFirstTouch);
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            sim.run();
+        }
+
+        if (sim.getGrid()->get(Coord<3>(1, 1, 1)).density == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        // each update reads the old and writes the new cell:
+        double bytesPerUpdate = 2.0 * LibFlatArray::aggregated_member_size<LBMSoACell>::VALUE;
+        double updates = 1.0 * maxT * dim.prod();
+        double gBytesPerSecond = 1e-9 * updates * bytesPerUpdate / seconds;
+
+        return gBytesPerSecond;
+    }
+
+    std::string unit()
+    {
+        return "GB/s";
+    }
+
+private:
+    bool enableFirstTouch;
 };
 
-template<class PARTITION>
+/**
+ * Measures the setup time of a partition, i.e. the time required to
+ * traverse all cells of the domain.
+ */
+template<class PARTITION, int DIM = 2>
 class PartitionBenchmark : public CPUBenchmark
 {
 public:
@@ -2592,22 +2912,27 @@ public:
 
     double performance(std::vector<int> rawDim)
     {
-        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        Coord<DIM> realDim;
+        Coord<DIM> origin;
+        for (int d = 0; d < DIM; ++d) {
+            realDim[d] = rawDim[d];
+            origin[d] = 100 * (d + 1);
+        }
+
         double duration = 0;
-        Coord<2> accu;
-        Coord<2> realDim(dim.x(), dim.y());
+        Coord<DIM> accu;
 
         {
             ScopedTimer t(&duration);
 
-            PARTITION h(Coord<2>(100, 200), realDim);
+            PARTITION h(origin, realDim);
             typename PARTITION::Iterator end = h.end();
             for (typename PARTITION::Iterator i = h.begin(); i != end; ++i) {
                 accu += *i;
             }
         }
 
-        if (accu == Coord<2>()) {
+        if (accu == Coord<DIM>()) {
             throw std::runtime_error("oops, partition iteration went bad!");
         }
 
@@ -2623,6 +2948,171 @@ private:
     std::string name;
 };
 
+/**
+ * Splits the domain evenly among a number of nodes and reports the
+ * ratio of ghost cells (cells within a distance of 1 to a node's
+ * region, but not part of it) to the domain size. This is
+ * proportional to the communication volume per time step.
+ */
+template<class PARTITION, int DIM>
+class PartitionGhostVolume : public CPUBenchmark
+{
+public:
+    PartitionGhostVolume(const std::string& name, std::size_t numNodes) :
+        name(name),
+        numNodes(numNodes)
+    {}
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    std::string family()
+    {
+        std::stringstream buf;
+        buf << name << "GhostVolume" << numNodes;
+        return buf.str();
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<DIM> dim;
+        for (int d = 0; d < DIM; ++d) {
+            dim[d] = rawDim[d];
+        }
+
+        Region<DIM> domain;
+        domain << CoordBox<DIM>(Coord<DIM>(), dim);
+
+        std::vector<std::size_t> weights(numNodes, dim.prod() / numNodes);
+        weights.back() += dim.prod() - sum(weights);
+        PARTITION partition(Coord<DIM>(), dim, 0, weights);
+
+        std::size_t ghostCells = 0;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            Region<DIM> region = partition.getRegion(i);
+            ghostCells += ((region.expand(1) & domain) - region).size();
+        }
+
+        return 1.0 * ghostCells / dim.prod();
+    }
+
+    std::string unit()
+    {
+        return "ghost/cell";
+    }
+
+private:
+    std::string name;
+    std::size_t numNodes;
+};
+
+class SerializationParticle
+{
+public:
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & pos & vel & mass & id;
+    }
+
+    double pos[3];
+    double vel[3];
+    double mass;
+    int id;
+};
+
+/**
+ * Particle container with a varying number of particles per cell,
+ * exchanged via Boost.Serialization or the lightweight binary
+ * archives, depending on API.
+ */
+template<typename API_TYPE>
+class SerializationParticleCell
+{
+public:
+    typedef API_TYPE API;
+
+    template<typename ARCHIVE>
+    void serialize(ARCHIVE& archive, unsigned)
+    {
+        archive & numCollisions & particles;
+    }
+
+    int numCollisions;
+    std::vector<SerializationParticle> particles;
+};
+
+/**
+ * Measures round trips of GridVecConv (grid to buffer and back) for
+ * cells of varying size, as they occur during each ghost zone
+ * exchange in PatchLink. Use slabs (e.g. 256x256x2) as dimensions to
+ * mimic ghost zones.
+ */
+template<typename API_TYPE>
+class GridVecConvSerialization : public CPUBenchmark
+{
+public:
+    typedef SerializationParticleCell<API_TYPE> CellType;
+
+    explicit GridVecConvSerialization(const std::string& speciesName) :
+        speciesName(speciesName)
+    {}
+
+    std::string family()
+    {
+        return "GridVecConvSerialization";
+    }
+
+    std::string species()
+    {
+        return speciesName;
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        CoordBox<3> box(Coord<3>(), dim);
+        DisplacedGrid<CellType, Topologies::Cube<3>::Topology> gridA(box);
+        DisplacedGrid<CellType, Topologies::Cube<3>::Topology> gridB(box);
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            gridA[*i].numCollisions = i->x();
+            gridA[*i].particles.resize((i->x() + i->y() + i->z()) % 8);
+        }
+
+        Region<3> region;
+        region << box;
+
+        std::vector<char> buffer = SerializationBuffer<CellType>::create(region);
+        int repeats = 10;
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            for (int i = 0; i < repeats; ++i) {
+                GridVecConv::gridToVector(gridA, &buffer, region);
+                GridVecConv::vectorToGrid(buffer, &gridB, region);
+            }
+        }
+
+        if (gridB[Coord<3>(3, 4, 1)].particles.size() != 0) {
+            throw std::runtime_error("serialization round trip failed");
+        }
+
+        return seconds / repeats;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+
+private:
+    std::string speciesName;
+};
+
 #ifdef LIBGEODECOMP_WITH_CPP14
 typedef double ValueType;
 static const std::size_t MATRICES = 1;
@@ -2888,7 +3378,26 @@ class SellMatrixInitializer : public CPUBenchmark
     }
 };
 
-class SparseMatrixVectorMultiplication : public CPUBenchmark
+/**
+ * Base for the SpMV kernels which report GFLOP/s: each non-zero
+ * entry yields two flops and requires its value and column index to
+ * be loaded. Traffic for the vectors is neglected.
+ */
+class SPMVMBenchmark : public CPUBenchmark
+{
+public:
+    double flops_per_update()
+    {
+        return 1;
+    }
+
+    double bytes_per_update()
+    {
+        return (sizeof(ValueType) + sizeof(int)) / 2.0;
+    }
+};
+
+class SparseMatrixVectorMultiplication : public SPMVMBenchmark
 {
 private:
     template<typename CELL, typename GRID>
@@ -2955,7 +3464,7 @@ public:
     }
 };
 
-class SparseMatrixVectorMultiplicationVectorized : public CPUBenchmark
+class SparseMatrixVectorMultiplicationVectorized : public SPMVMBenchmark
 {
 private:
     template<typename CELL, typename GRID>
@@ -3021,7 +3530,7 @@ public:
     }
 };
 
-class SparseMatrixVectorMultiplicationVectorizedInf : public CPUBenchmark
+class SparseMatrixVectorMultiplicationVectorizedInf : public SPMVMBenchmark
 {
 private:
     template<typename CELL, typename GRID>
@@ -3088,7 +3597,7 @@ public:
 };
 
 #ifdef __AVX__
-class SparseMatrixVectorMultiplicationNative : public CPUBenchmark
+class SparseMatrixVectorMultiplicationNative : public SPMVMBenchmark
 {
 private:
     // callback to get cell's member pointer
@@ -3192,36 +3701,15 @@ public:
 #endif
 
 #ifdef LIBGEODECOMP_WITH_CUDA
-void cudaTests(std::string name, std::string revision, int cudaDevice);
+void cudaTests(LibFlatArray::evaluate *eval);
 #endif
 
 int main(int argc, char **argv)
 {
-    if ((argc < 3) || (argc == 4) || (argc > 5)) {
-        std::cerr << "usage: " << argv[0] << " [-n,--name SUBSTRING] REVISION CUDA_DEVICE \n"
-                  << "  - optional: only run tests whose name contains a SUBSTRING,\n"
-                  << "  - REVISION is purely for output reasons,\n"
-                  << "  - CUDA_DEVICE causes CUDA tests to run on the device with the given ID.\n";
+    LibFlatArray::evaluate eval;
+    if (!eval.parse_arguments(argc, argv)) {
         return 1;
     }
-
-    std::string name = "";
-    int argumentIndex = 1;
-    if (argc == 5) {
-        if ((std::string(argv[1]) == "-n") ||
-            (std::string(argv[1]) == "--name")) {
-            name = std::string(argv[2]);
-        }
-        argumentIndex = 3;
-    }
-    std::string revision = argv[argumentIndex + 0];
-
-    std::stringstream s;
-    s << argv[argumentIndex + 1];
-    int cudaDevice;
-    s >> cudaDevice;
-
-    LibFlatArray::evaluate eval(name, revision);
     eval.print_header();
 
     std::vector<Coord<3> > sizes;
@@ -3287,7 +3775,7 @@ int main(int argc, char **argv)
     {
         numCells = 500000;
         std::map<int, ConvexPolytope<Coord<2> > > cells;
-        if (std::string("RegionExpWithAdjacency").find(name) != std::string::npos) {
+        if (eval.selects_family("RegionExpWithAdjacency")) {
             cells = RegionExpandWithAdjacency::genGrid(numCells);
         }
         params[0] = numCells;
@@ -3369,6 +3857,14 @@ int main(int argc, char **argv)
         eval(Jacobi3DStreakUpdateFunctor(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(Jacobi3DClamped(), toVector(sizes[i]));
+    }
+
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(Jacobi3DClampedShortVec(), toVector(sizes[i]));
+    }
+
     sizes.clear();
 
     sizes << Coord<3>(22, 22, 22)
@@ -3387,15 +3883,38 @@ int main(int argc, char **argv)
         eval(LBMSoA(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(LBMFirstTouch(false), toVector(sizes[i]));
+    }
+
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(LBMFirstTouch(true), toVector(sizes[i]));
+    }
+
     std::vector<int> dim = toVector(Coord<3>(32 * 1024, 32 * 1024, 1));
     eval(PartitionBenchmark<HIndexingPartition   >("PartitionHIndexing"), dim);
     eval(PartitionBenchmark<StripingPartition<2> >("PartitionStriping"),  dim);
     eval(PartitionBenchmark<HilbertPartition     >("PartitionHilbert"),   dim);
     eval(PartitionBenchmark<ZCurvePartition<2>   >("PartitionZCurve"),    dim);
 
+    dim = toVector(Coord<3>(512, 512, 256));
+    eval(PartitionBenchmark<StripingPartition<3>, 3>("PartitionStriping3D"), dim);
+    eval(PartitionBenchmark<ZCurvePartition<3>,   3>("PartitionZCurve3D"),   dim);
+    eval(PartitionBenchmark<HilbertPartition3D,   3>("PartitionHilbert3D"),  dim);
+
+#ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
+    eval(GridVecConvSerialization<APITraits::HasBoostSerialization>("boost"), toVector(Coord<3>(256, 256, 2)));
+#endif
+    eval(GridVecConvSerialization<APITraits::HasBinarySerialization>("binary"), toVector(Coord<3>(256, 256, 2)));
+
+    dim = toVector(Coord<3>(256, 256, 256));
+    eval(PartitionGhostVolume<StripingPartition<3>, 3>("PartitionStriping3D", 384), dim);
+    eval(PartitionGhostVolume<ZCurvePartition<3>,   3>("PartitionZCurve3D",   384), dim);
+    eval(PartitionGhostVolume<HilbertPartition3D,   3>("PartitionHilbert3D",  384), dim);
+
 #ifdef LIBGEODECOMP_WITH_CUDA
-    cudaTests(name, revision, cudaDevice);
+    cudaTests(&eval);
 #endif
 
-    return 0;
+    return (eval.finish() > 0) ? 2 : 0;
 }